@@ -0,0 +1,85 @@
+#include "pch.h"
+#include "CppUnitTest.h"
+#include "Benchmark.h"
+#include "GameTime.h"
+#include "ActionList.h"
+#include "ActionIncrement.h"
+
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+using namespace FieaGameEngine;
+using namespace UnitTests;
+using namespace std;
+using namespace std::string_literals;
+
+namespace LibraryDesktopTests
+{
+	TEST_CLASS(ActionBenchmarks)
+	{
+	public:
+		TEST_METHOD(DeepActionListUpdate)
+		{
+			constexpr size_t depth = 32;
+			constexpr size_t incrementsPerList = 4;
+			constexpr size_t frameCount = 1000;
+
+			// Every list holds a few increments of a counter at the root, and the next list down
+			ActionList root;
+			Datum& counter = root.Append("Counter"_sym);
+			counter.PushBack(0);
+			ActionList* list = &root;
+			for (size_t level = 0; level < depth; ++level)
+			{
+				for (size_t i = 0; i < incrementsPerList; ++i)
+				{
+					shared_ptr<ActionIncrement> increment = make_shared<ActionIncrement>();
+					increment->Target = "Counter"s;
+					list->Adopt(increment, "Actions"_sym);
+				}
+				shared_ptr<ActionList> child = make_shared<ActionList>();
+				ActionList* next = child.get();
+				list->Adopt(std::move(child), "Actions"_sym);
+				list = next;
+			}
+
+			GameTime gameTime;
+			const double update = Benchmark::Measure(4, [&root, &gameTime]()
+			{
+				for (size_t frame = 0; frame < frameCount; ++frame)
+				{
+					root.Update(gameTime);
+				}
+			});
+			Benchmark::DoNotOptimize(counter.Get<int32_t>());
+
+			// The deepest list searches past every ancestor
+			const Symbol key("Counter");
+			const double uncached = Benchmark::Measure(4, [list, &key]()
+			{
+				size_t found = 0;
+				for (size_t frame = 0; frame < frameCount; ++frame)
+				{
+					found += list->Search(key) != nullptr ? 1 : 0;
+				}
+				Benchmark::DoNotOptimize(found);
+			});
+
+			Scope::SearchCache cache;
+			const double cached = Benchmark::Measure(4, [list, &key, &cache]()
+			{
+				size_t found = 0;
+				for (size_t frame = 0; frame < frameCount; ++frame)
+				{
+					found += list->Search(key, cache) != nullptr ? 1 : 0;
+				}
+				Benchmark::DoNotOptimize(found);
+			});
+
+			const double increments = static_cast<double>(frameCount * depth * incrementsPerList);
+			const double frames = static_cast<double>(frameCount);
+			Benchmark::Report("-- ActionLists nested 32 deep, 4 increments of a root attribute each --"s);
+			Benchmark::Report("Update (per increment)"s, update / increments);
+			Benchmark::Report("Search from the deepest list (per search)"s, uncached / frames);
+			Benchmark::Report("Cached search from the deepest list (per search)"s, cached / frames);
+		}
+	};
+}
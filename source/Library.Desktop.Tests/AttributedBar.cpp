@@ -35,7 +35,7 @@ namespace UnitTests
     {
         return
         {
-            { "ExternalInteger", DatumTypes::Integer, true, Signature::ExternalInfo{1, offsetof(AttributedBar, ExternalInteger)} }
+            { "ExternalInteger"_sym, DatumTypes::Integer, true, Signature::ExternalInfo{1, offsetof(AttributedBar, ExternalInteger)} }
         };
     }
 }
\ No newline at end of file
@@ -0,0 +1,102 @@
+#include "pch.h"
+#include "CppUnitTest.h"
+#include "Benchmark.h"
+#include "GameObject.h"
+#include "ActionList.h"
+#include "ReactionAttributed.h"
+
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+using namespace FieaGameEngine;
+using namespace UnitTests;
+using namespace std;
+using namespace std::string_literals;
+
+namespace LibraryDesktopTests
+{
+	TEST_CLASS(AttributedBenchmarks)
+	{
+	public:
+		TEST_METHOD(GameObjectUpdatePrescribedLookups)
+		{
+			Factory<Scope>::Add(make_unique<GameObjectFactory>());
+			Factory<Scope>::Add(make_unique<ActionListFactory>());
+			{
+				// A shallow tree: every child has a single empty action list, so Update is dominated by attribute lookups
+				GameObject root;
+				for (size_t i = 0; i < 64; ++i)
+				{
+					GameObject& child = static_cast<GameObject&>(root.AppendScope("Children"s, "GameObject"s));
+					child.CreateAction("ActionList"s);
+				}
+				GameTime time;
+
+				// The three lookups one GameObject::Update tick made before slots, and the same reads through slots
+				size_t visited = 0;
+				const double byName = Benchmark::Measure(4096, [&root, &visited]()
+				{
+					Datum& children = root.At("Children"_sym);
+					for (size_t i = 0; i < children.Size(); ++i)
+					{
+						Scope& child = *children.Get<shared_ptr<Scope>>(i);
+						visited += child.At("Children"_sym).Size() + child.At("Actions"_sym).Size();
+						Scope& actionList = *child.At("Actions"_sym).Get<shared_ptr<Scope>>();
+						visited += actionList.At("Actions"_sym).Size();
+					}
+				});
+				const double bySlot = Benchmark::Measure(4096, [&root, &visited]()
+				{
+					Datum& children = root.Slot<GameObject::Slots::Children>();
+					for (size_t i = 0; i < children.Size(); ++i)
+					{
+						GameObject& child = static_cast<GameObject&>(*children.Get<shared_ptr<Scope>>(i));
+						visited += child.Slot<GameObject::Slots::Children>().Size() + child.Slot<GameObject::Slots::Actions>().Size();
+						ActionList& actionList = static_cast<ActionList&>(*child.Slot<GameObject::Slots::Actions>().Get<shared_ptr<Scope>>());
+						visited += actionList.Slot<ActionList::Slots::Actions>().Size();
+					}
+				});
+				Assert::AreEqual(size_t(64) * 4097 * 2, visited);
+
+				const double update = Benchmark::Measure(4096, [&root, &time]()
+				{
+					root.Update(time);
+				});
+
+				Benchmark::Report("-- GameObject::Update, 64 children with one action list each --"s);
+				Benchmark::Report("Prescribed lookups by name (per tick)"s, byName);
+				Benchmark::Report("Prescribed lookups by slot (per tick)"s, bySlot);
+				Benchmark::Report("GameObject::Update with slots (per tick)"s, update);
+			}
+			Factory<Scope>::Clear();
+		}
+
+		TEST_METHOD(ConstructAndCopy)
+		{
+			Benchmark::Report("-- Attributed construction and copy (per object) --"s);
+			RunConstructAndCopy<GameObject>("GameObject"s);
+			RunConstructAndCopy<Transform>("Transform"s);
+			RunConstructAndCopy<ActionList>("ActionList"s);
+			RunConstructAndCopy<ReactionAttributed>("ReactionAttributed"s);
+		}
+
+	private:
+		template <typename T>
+		static void RunConstructAndCopy(const string& label)
+		{
+			const double construct = Benchmark::Measure(4096, []()
+			{
+				T attributed;
+				Benchmark::DoNotOptimize(attributed);
+			});
+
+			const T prototype;
+			const double copy = Benchmark::Measure(4096, [&prototype]()
+			{
+				T attributed(prototype);
+				Benchmark::DoNotOptimize(attributed);
+			});
+
+			Benchmark::Report(label + " construct"s, construct);
+			Benchmark::Report(label + " copy"s, copy);
+		}
+	};
+}
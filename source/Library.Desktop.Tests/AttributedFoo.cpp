@@ -55,18 +55,18 @@ namespace UnitTests
     {
         return Vector<Signature>(
         {
-            { "ExternalInteger", DatumTypes::Integer, true, Signature::ExternalInfo{1, offsetof(AttributedFoo, ExternalInteger)}},
-            { "ExternalFloat", DatumTypes::Float, true, Signature::ExternalInfo{1, offsetof(AttributedFoo, ExternalFloat)}},
-            { "ExternalString", DatumTypes::String, true, Signature::ExternalInfo{1, offsetof(AttributedFoo, ExternalString)}},
-            { "ExternalVector", DatumTypes::Vector, true, Signature::ExternalInfo{1, offsetof(AttributedFoo, ExternalVector)}},
-            { "ExternalMatrix", DatumTypes::Matrix, true, Signature::ExternalInfo{1, offsetof(AttributedFoo, ExternalMatrix)}},
-            { "ExternalScope", DatumTypes::TablePointer, true, Signature::ExternalInfo{1, offsetof(AttributedFoo, ExternalScope)}},
+            { "ExternalInteger"_sym, DatumTypes::Integer, true, Signature::ExternalInfo{1, offsetof(AttributedFoo, ExternalInteger)}},
+            { "ExternalFloat"_sym, DatumTypes::Float, true, Signature::ExternalInfo{1, offsetof(AttributedFoo, ExternalFloat)}},
+            { "ExternalString"_sym, DatumTypes::String, true, Signature::ExternalInfo{1, offsetof(AttributedFoo, ExternalString)}},
+            { "ExternalVector"_sym, DatumTypes::Vector, true, Signature::ExternalInfo{1, offsetof(AttributedFoo, ExternalVector)}},
+            { "ExternalMatrix"_sym, DatumTypes::Matrix, true, Signature::ExternalInfo{1, offsetof(AttributedFoo, ExternalMatrix)}},
+            { "ExternalScope"_sym, DatumTypes::TablePointer, true, Signature::ExternalInfo{1, offsetof(AttributedFoo, ExternalScope)}},
 
-            { "ExternalIntegerArray", DatumTypes::Integer, true, Signature::ExternalInfo{2, offsetof(AttributedFoo, ExternalIntegerArray) }},
-            { "ExternalFloatArray", DatumTypes::Float, true, Signature::ExternalInfo{2, offsetof(AttributedFoo, ExternalFloatArray) }},
-            { "ExternalStringArray", DatumTypes::String, true, Signature::ExternalInfo{2, offsetof(AttributedFoo, ExternalStringArray) }},
-            { "ExternalVectorArray", DatumTypes::Vector, true, Signature::ExternalInfo{2, offsetof(AttributedFoo, ExternalVectorArray) }},
-            { "ExternalMatrixArray", DatumTypes::Matrix, true, Signature::ExternalInfo{2, offsetof(AttributedFoo, ExternalMatrixArray) }},
+            { "ExternalIntegerArray"_sym, DatumTypes::Integer, true, Signature::ExternalInfo{2, offsetof(AttributedFoo, ExternalIntegerArray) }},
+            { "ExternalFloatArray"_sym, DatumTypes::Float, true, Signature::ExternalInfo{2, offsetof(AttributedFoo, ExternalFloatArray) }},
+            { "ExternalStringArray"_sym, DatumTypes::String, true, Signature::ExternalInfo{2, offsetof(AttributedFoo, ExternalStringArray) }},
+            { "ExternalVectorArray"_sym, DatumTypes::Vector, true, Signature::ExternalInfo{2, offsetof(AttributedFoo, ExternalVectorArray) }},
+            { "ExternalMatrixArray"_sym, DatumTypes::Matrix, true, Signature::ExternalInfo{2, offsetof(AttributedFoo, ExternalMatrixArray) }},
         });
     }
 }
\ No newline at end of file
@@ -239,6 +239,13 @@ namespace LibraryDesktopTests
 			// Add aux
 			attributedFoo.AppendAuxilaryAttribute("AuxInt");
 			Assert::IsTrue(attributedFoo.IsAttribute("AuxInt"));
+
+			// Views
+			const string buffer = "ExternalIntegerArray"s;
+			Assert::IsTrue(attributedFoo.IsAttribute(string_view(buffer.data(), 15)));
+			Assert::IsTrue(attributedFoo.IsPrescribedAttribute(string_view(buffer.data(), 15)));
+			Assert::IsFalse(attributedFoo.IsAuxilaryAttribute(string_view(buffer.data(), 15)));
+			Assert::IsFalse(attributedFoo.IsAttribute(string_view(buffer.data(), 8)));
 		}
 
 		TEST_METHOD(IsPrescribedAttribute)
@@ -335,7 +342,7 @@ namespace LibraryDesktopTests
 				set<std::string> attributedFooExpectedAttributes;
 				for (Signature signature : AttributedFoo::AllSignatures())
 				{
-					attributedFooExpectedAttributes.insert(signature.Name);
+					attributedFooExpectedAttributes.insert(signature.Name.Str());
 				}
 				attributedFooExpectedAttributes.insert("AuxInt");
 				attributedFooExpectedAttributes.insert("this");
@@ -343,9 +350,9 @@ namespace LibraryDesktopTests
 				// Get attributes from foreach
 				set<std::string> attributes;
 				attributedFoo.ForEachAttribute(
-					[&attributes, &attributedFoo](std::pair<const string, Datum>* attributeKeyPair)
+					[&attributes, &attributedFoo](std::pair<const Symbol, Datum>* attributeKeyPair)
 					{
-						attributes.insert(attributeKeyPair->first);
+						attributes.insert(attributeKeyPair->first.Str());
 						Assert::IsTrue(attributedFoo.IsAttribute(attributeKeyPair->first));
 						return false;
 					});
@@ -364,7 +371,7 @@ namespace LibraryDesktopTests
 				set<std::string> attributedFooExpectedAttributes;
 				for (Signature signature : AttributedFoo::AllSignatures())
 				{
-					attributedFooExpectedAttributes.insert(signature.Name);
+					attributedFooExpectedAttributes.insert(signature.Name.Str());
 				}
 				attributedFooExpectedAttributes.insert("AuxInt");
 				attributedFooExpectedAttributes.insert("this");
@@ -372,9 +379,9 @@ namespace LibraryDesktopTests
 				// Get attributes from foreach
 				set<std::string> attributes;
 				const_cast<const AttributedFoo&>(attributedFoo).ForEachAttribute(
-					[&attributes, &attributedFoo](const std::pair<const string, Datum>* attributeKeyPair)
+					[&attributes, &attributedFoo](const std::pair<const Symbol, Datum>* attributeKeyPair)
 					{
-						attributes.insert(attributeKeyPair->first);
+						attributes.insert(attributeKeyPair->first.Str());
 						Assert::IsTrue(attributedFoo.IsAttribute(attributeKeyPair->first));
 						return false;
 					});
@@ -390,7 +397,7 @@ namespace LibraryDesktopTests
 				AttributedFoo attributedFoo;
 
 				attributedFoo.ForEachAttribute(
-					[&counter](std::pair<const string, Datum>*)
+					[&counter](std::pair<const Symbol, Datum>*)
 					{
 						++counter;
 						return true;
@@ -401,7 +408,7 @@ namespace LibraryDesktopTests
 				counter = 0;
 
 				const_cast<const AttributedFoo&>(attributedFoo).ForEachAttribute(
-					[&counter](const std::pair<const string, Datum>*)
+					[&counter](const std::pair<const Symbol, Datum>*)
 					{
 						++counter;
 						return true;
@@ -422,15 +429,15 @@ namespace LibraryDesktopTests
 				set<std::string> attributedFooExpectedAttributes;
 				for (Signature signature : AttributedFoo::AllSignatures())
 				{
-					attributedFooExpectedAttributes.insert(signature.Name);
+					attributedFooExpectedAttributes.insert(signature.Name.Str());
 				}
 
 				// Get attributes from foreach
 				set<std::string> attributes;
 				attributedFoo.ForEachPrescribedAttribute(
-					[&attributes, &attributedFoo](std::pair<const string, Datum>* attributeKeyPair)
+					[&attributes, &attributedFoo](std::pair<const Symbol, Datum>* attributeKeyPair)
 					{
-						attributes.insert(attributeKeyPair->first);
+						attributes.insert(attributeKeyPair->first.Str());
 						Assert::IsTrue(attributedFoo.IsPrescribedAttribute(attributeKeyPair->first));
 						return false;
 					});
@@ -449,15 +456,15 @@ namespace LibraryDesktopTests
 				set<std::string> attributedFooExpectedAttributes;
 				for (Signature signature : AttributedFoo::AllSignatures())
 				{
-					attributedFooExpectedAttributes.insert(signature.Name);
+					attributedFooExpectedAttributes.insert(signature.Name.Str());
 				}
 
 				// Get attributes from foreach
 				set<std::string> attributes;
 				const_cast<const AttributedFoo&>(attributedFoo).ForEachPrescribedAttribute(
-					[&attributes, &attributedFoo](const std::pair<const string, Datum>* attributeKeyPair)
+					[&attributes, &attributedFoo](const std::pair<const Symbol, Datum>* attributeKeyPair)
 					{
-						attributes.insert(attributeKeyPair->first);
+						attributes.insert(attributeKeyPair->first.Str());
 						Assert::IsTrue(attributedFoo.IsPrescribedAttribute(attributeKeyPair->first));
 						return false;
 					});
@@ -473,7 +480,7 @@ namespace LibraryDesktopTests
 				AttributedFoo attributedFoo;
 
 				attributedFoo.ForEachPrescribedAttribute(
-					[&counter](std::pair<const string, Datum>*)
+					[&counter](std::pair<const Symbol, Datum>*)
 					{
 						++counter;
 						return true;
@@ -484,7 +491,7 @@ namespace LibraryDesktopTests
 				counter = 0;
 
 				const_cast<const AttributedFoo&>(attributedFoo).ForEachPrescribedAttribute(
-					[&counter](const std::pair<const string, Datum>*)
+					[&counter](const std::pair<const Symbol, Datum>*)
 					{
 						++counter;
 						return true;
@@ -507,9 +514,9 @@ namespace LibraryDesktopTests
 				// Get attributes from foreach
 				set<std::string> attributes;
 				attributedFoo.ForEachAuxiliaryAttribute(
-					[&attributes, &attributedFoo](std::pair<const string, Datum>* attributeKeyPair)
+					[&attributes, &attributedFoo](std::pair<const Symbol, Datum>* attributeKeyPair)
 					{
-						attributes.insert(attributeKeyPair->first);
+						attributes.insert(attributeKeyPair->first.Str());
 						Assert::IsTrue(attributedFoo.IsAuxilaryAttribute(attributeKeyPair->first));
 						return false;
 					});
@@ -530,9 +537,9 @@ namespace LibraryDesktopTests
 				// Get attributes from foreach
 				set<std::string> attributes;
 				const_cast<const AttributedFoo&>(attributedFoo).ForEachAuxiliaryAttribute(
-					[&attributes, &attributedFoo](const std::pair<const string, Datum>* attributeKeyPair)
+					[&attributes, &attributedFoo](const std::pair<const Symbol, Datum>* attributeKeyPair)
 					{
-						attributes.insert(attributeKeyPair->first);
+						attributes.insert(attributeKeyPair->first.Str());
 						Assert::IsTrue(attributedFoo.IsAuxilaryAttribute(attributeKeyPair->first));
 						return false;
 					});
@@ -551,7 +558,7 @@ namespace LibraryDesktopTests
 				attributedFoo.AppendAuxilaryAttribute("Aux3");
 
 				attributedFoo.ForEachAuxiliaryAttribute(
-					[&counter](std::pair<const string, Datum>*)
+					[&counter](std::pair<const Symbol, Datum>*)
 					{
 						++counter;
 						return true;
@@ -562,7 +569,7 @@ namespace LibraryDesktopTests
 				counter = 0;
 
 				const_cast<const AttributedFoo&>(attributedFoo).ForEachAuxiliaryAttribute(
-					[&counter](const std::pair<const string, Datum>*)
+					[&counter](const std::pair<const Symbol, Datum>*)
 					{
 						++counter;
 						return true;
@@ -0,0 +1,62 @@
+#pragma once
+
+#include <chrono>
+#include <string>
+#include <sstream>
+#include <iomanip>
+#include "CppUnitTest.h"
+
+namespace UnitTests::Benchmark
+{
+	/// <summary>
+	/// Runs a function a number of times and returns the average time of one run in nanoseconds
+	/// </summary>
+	/// <param name="repetitions">Number of times to run the function</param>
+	/// <param name="func">Function to time</param>
+	/// <returns>Average nanoseconds per run</returns>
+	template <typename TFunc>
+	inline double Measure(std::size_t repetitions, TFunc func)
+	{
+		// Warm up caches and the allocator
+		func();
+
+		const auto start = std::chrono::high_resolution_clock::now();
+		for (std::size_t i = 0; i < repetitions; ++i)
+		{
+			func();
+		}
+		const auto end = std::chrono::high_resolution_clock::now();
+		return std::chrono::duration<double, std::nano>(end - start).count() / static_cast<double>(repetitions);
+	}
+
+	/// <summary>
+	/// Writes a single timing result to the test output
+	/// </summary>
+	/// <param name="label">What was measured</param>
+	/// <param name="nanoseconds">Time per run</param>
+	inline void Report(const std::string& label, double nanoseconds)
+	{
+		std::ostringstream oss;
+		oss << std::left << std::setw(56) << label << std::right << std::fixed << std::setprecision(1) << std::setw(14) << nanoseconds << " ns";
+		Microsoft::VisualStudio::CppUnitTestFramework::Logger::WriteMessage(oss.str().c_str());
+	}
+
+	/// <summary>
+	/// Writes a free form line to the test output
+	/// </summary>
+	/// <param name="message">Line to write</param>
+	inline void Report(const std::string& message)
+	{
+		Microsoft::VisualStudio::CppUnitTestFramework::Logger::WriteMessage(message.c_str());
+	}
+
+	/// <summary>
+	/// Keeps a value alive so the optimizer cannot remove the work that produced it
+	/// </summary>
+	template <typename T>
+	inline void DoNotOptimize(const T& value)
+	{
+		static volatile const void* sink;
+		sink = &value;
+	}
+}
@@ -0,0 +1,186 @@
+#include "pch.h"
+#include "CppUnitTest.h"
+#include "Literals.h"
+#include "ToStringSpecializations.h"
+#include "BulkOps.h"
+#include "Datum.h"
+#include <stdexcept>
+
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+using namespace FieaGameEngine;
+using namespace UnitTests;
+using namespace std;
+using namespace glm;
+
+namespace LibraryDesktopTests
+{
+	TEST_CLASS(BulkOpsTests)
+	{
+	public:
+		TEST_METHOD_INITIALIZE(Initialize)
+		{
+#if defined(DEBUG) || defined(_DEBUG)
+			_CrtSetDbgFlag(_CRTDBG_ALLOC_MEM_DF);
+			_CrtMemCheckpoint(&_startMemState);
+#endif
+		}
+
+		TEST_METHOD_CLEANUP(Cleanup)
+		{
+#if defined(DEBUG) || defined(_DEBUG)
+			_CrtMemState endMemState, diffMemState;
+			_CrtMemCheckpoint(&endMemState);
+			if (_CrtMemDifference(&diffMemState, &_startMemState,
+				&endMemState))
+			{
+				_CrtMemDumpStatistics(&diffMemState);
+				Assert::Fail(L"Memory Leaks!");
+			}
+#endif
+		}
+
+		TEST_METHOD(FloatArithmetic)
+		{
+			// Sizes that leave remainders after the 8 and 4 wide loops
+			for (size_t size : { 0_z, 1_z, 3_z, 4_z, 7_z, 8_z, 13_z, 19_z })
+			{
+				Datum lhs = MakeFloats(size, 1.0f);
+				const Datum rhs = MakeFloats(size, -2.0f);
+
+				BulkOps::Add(lhs.AsSpan<float>(), rhs.AsSpan<float>());
+				for (size_t i = 0; i < size; ++i)
+				{
+					Assert::AreEqual(Float(i, 1.0f) + Float(i, -2.0f), lhs.Get<float>(i));
+				}
+
+				BulkOps::Scale(lhs.AsSpan<float>(), 2.0f);
+				BulkOps::MultiplyAdd(lhs.AsSpan<float>(), rhs.AsSpan<float>(), 0.5f);
+				for (size_t i = 0; i < size; ++i)
+				{
+					Assert::AreEqual((Float(i, 1.0f) + Float(i, -2.0f)) * 2.0f + Float(i, -2.0f) * 0.5f, lhs.Get<float>(i));
+				}
+
+				Datum minimum = MakeFloats(size, 1.0f);
+				Datum maximum = MakeFloats(size, 1.0f);
+				BulkOps::Min(minimum.AsSpan<float>(), rhs.AsSpan<float>());
+				BulkOps::Max(maximum.AsSpan<float>(), rhs.AsSpan<float>());
+				float expectedDot = 0.0f;
+				for (size_t i = 0; i < size; ++i)
+				{
+					Assert::AreEqual(std::min(Float(i, 1.0f), Float(i, -2.0f)), minimum.Get<float>(i));
+					Assert::AreEqual(std::max(Float(i, 1.0f), Float(i, -2.0f)), maximum.Get<float>(i));
+					expectedDot += Float(i, 1.0f) * Float(i, -2.0f);
+				}
+
+				// Small integers keep every partial sum exact, whatever order the lanes are added in
+				const Datum ones = MakeFloats(size, 1.0f);
+				Assert::AreEqual(expectedDot, BulkOps::Dot(ones.AsSpan<float>(), rhs.AsSpan<float>()));
+			}
+		}
+
+		TEST_METHOD(VectorArithmetic)
+		{
+			for (size_t size : { 0_z, 1_z, 2_z, 3_z, 5_z })
+			{
+				Datum lhs = MakeVectors(size, 1.0f);
+				const Datum rhs = MakeVectors(size, -1.0f);
+
+				BulkOps::Add(lhs.AsSpan<vec4>(), rhs.AsSpan<vec4>());
+				BulkOps::Scale(lhs.AsSpan<vec4>(), 3.0f);
+				BulkOps::MultiplyAdd(lhs.AsSpan<vec4>(), rhs.AsSpan<vec4>(), 2.0f);
+				for (size_t i = 0; i < size; ++i)
+				{
+					Assert::AreEqual((Vector(i, 1.0f) + Vector(i, -1.0f)) * 3.0f + Vector(i, -1.0f) * 2.0f, lhs.Get<vec4>(i));
+				}
+
+				Datum minimum = MakeVectors(size, 1.0f);
+				Datum maximum = MakeVectors(size, 1.0f);
+				BulkOps::Min(minimum.AsSpan<vec4>(), rhs.AsSpan<vec4>());
+				BulkOps::Max(maximum.AsSpan<vec4>(), rhs.AsSpan<vec4>());
+				Datum dots = MakeFloats(size, 0.0f);
+				BulkOps::Dot(dots.AsSpan<float>(), minimum.AsSpan<vec4>(), maximum.AsSpan<vec4>());
+				for (size_t i = 0; i < size; ++i)
+				{
+					Assert::AreEqual(glm::min(Vector(i, 1.0f), Vector(i, -1.0f)), minimum.Get<vec4>(i));
+					Assert::AreEqual(glm::max(Vector(i, 1.0f), Vector(i, -1.0f)), maximum.Get<vec4>(i));
+					Assert::AreEqual(dot(minimum.Get<vec4>(i), maximum.Get<vec4>(i)), dots.Get<float>(i));
+				}
+			}
+		}
+
+		TEST_METHOD(Transform)
+		{
+			const mat4 matrix(vec4(1, 2, 3, 4), vec4(5, 6, 7, 8), vec4(9, 10, 11, 12), vec4(13, 14, 15, 16));
+			for (size_t size : { 0_z, 1_z, 2_z, 5_z })
+			{
+				const Datum source = MakeVectors(size, 1.0f);
+				Datum destination = MakeVectors(size, 0.0f);
+				BulkOps::Transform(destination.AsSpan<vec4>(), matrix, source.AsSpan<vec4>());
+				for (size_t i = 0; i < size; ++i)
+				{
+					Assert::AreEqual(matrix * source.Get<vec4>(i), destination.Get<vec4>(i));
+				}
+
+				// In place
+				BulkOps::Transform(destination.AsSpan<vec4>(), matrix, destination.AsSpan<vec4>());
+				for (size_t i = 0; i < size; ++i)
+				{
+					Assert::AreEqual(matrix * (matrix * source.Get<vec4>(i)), destination.Get<vec4>(i));
+				}
+			}
+		}
+
+		TEST_METHOD(MismatchedSizes)
+		{
+			Datum floats = MakeFloats(4, 1.0f);
+			const Datum fewerFloats = MakeFloats(3, 1.0f);
+			Datum vectors = MakeVectors(2, 1.0f);
+			const Datum fewerVectors = MakeVectors(1, 1.0f);
+
+			Assert::ExpectException<runtime_error>([&floats, &fewerFloats]() { BulkOps::Add(floats.AsSpan<float>(), fewerFloats.AsSpan<float>()); });
+			Assert::ExpectException<runtime_error>([&floats, &fewerFloats]() { BulkOps::MultiplyAdd(floats.AsSpan<float>(), fewerFloats.AsSpan<float>(), 1.0f); });
+			Assert::ExpectException<runtime_error>([&floats, &fewerFloats]() { BulkOps::Min(floats.AsSpan<float>(), fewerFloats.AsSpan<float>()); });
+			Assert::ExpectException<runtime_error>([&floats, &fewerFloats]() { BulkOps::Max(floats.AsSpan<float>(), fewerFloats.AsSpan<float>()); });
+			Assert::ExpectException<runtime_error>([&floats, &fewerFloats]() { auto dot = BulkOps::Dot(floats.AsSpan<float>(), fewerFloats.AsSpan<float>()); UNREFERENCED_LOCAL(dot); });
+			Assert::ExpectException<runtime_error>([&vectors, &fewerVectors]() { BulkOps::Add(vectors.AsSpan<vec4>(), fewerVectors.AsSpan<vec4>()); });
+			Assert::ExpectException<runtime_error>([&vectors, &fewerVectors]() { BulkOps::Transform(vectors.AsSpan<vec4>(), mat4(1), fewerVectors.AsSpan<vec4>()); });
+			Assert::ExpectException<runtime_error>([&floats, &vectors]() { BulkOps::Dot(floats.AsSpan<float>(), vectors.AsSpan<vec4>(), vectors.AsSpan<vec4>()); });
+
+			// Nothing was written before the check
+			Assert::AreEqual(Float(3, 1.0f), floats.Get<float>(3));
+		}
+
+	private:
+		static float Float(size_t index, float sign)
+		{
+			return sign * static_cast<float>(index % 5 + 1);
+		}
+
+		static vec4 Vector(size_t index, float sign)
+		{
+			return vec4(Float(index, sign), Float(index + 1, -sign), Float(index + 2, sign), Float(index + 3, -sign));
+		}
+
+		static Datum MakeFloats(size_t size, float sign)
+		{
+			Datum datum(DatumTypes::Float);
+			for (size_t i = 0; i < size; ++i)
+			{
+				datum.PushBack(Float(i, sign));
+			}
+			return datum;
+		}
+
+		static Datum MakeVectors(size_t size, float sign)
+		{
+			Datum datum(DatumTypes::Vector);
+			for (size_t i = 0; i < size; ++i)
+			{
+				datum.PushBack(Vector(i, sign));
+			}
+			return datum;
+		}
+
+		inline static _CrtMemState _startMemState;
+	};
+}
@@ -0,0 +1,45 @@
+#pragma once
+
+#include <cstddef>
+#include <memory_resource>
+
+namespace UnitTests
+{
+	/// <summary>
+	/// Memory resource that forwards to another resource and counts what passes through it
+	/// </summary>
+	class CountingResource final : public std::pmr::memory_resource
+	{
+	public:
+		explicit CountingResource(std::pmr::memory_resource* upstream = std::pmr::new_delete_resource()) :
+			_upstream(upstream)
+		{
+		}
+
+		std::size_t Allocations = 0;
+		std::size_t Deallocations = 0;
+		std::size_t BytesInUse = 0;
+
+	private:
+		void* do_allocate(std::size_t bytes, std::size_t alignment) override
+		{
+			++Allocations;
+			BytesInUse += bytes;
+			return _upstream->allocate(bytes, alignment);
+		}
+
+		void do_deallocate(void* p, std::size_t bytes, std::size_t alignment) override
+		{
+			++Deallocations;
+			BytesInUse -= bytes;
+			_upstream->deallocate(p, bytes, alignment);
+		}
+
+		bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override
+		{
+			return this == &other;
+		}
+
+		std::pmr::memory_resource* _upstream;
+	};
+}
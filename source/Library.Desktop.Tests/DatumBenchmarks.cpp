@@ -0,0 +1,297 @@
+#include "pch.h"
+#include "CppUnitTest.h"
+#include "Benchmark.h"
+#include "Datum.h"
+#include "Scope.h"
+#include "Symbol.h"
+#include "BulkOps.h"
+#include "Monster.h"
+#include "JsonParseCoordinator.h"
+#include "JsonTableParseHelper.h"
+#include <sstream>
+
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+using namespace FieaGameEngine;
+using namespace UnitTests;
+using namespace std;
+using namespace std::string_literals;
+
+namespace LibraryDesktopTests
+{
+	TEST_CLASS(DatumBenchmarks)
+	{
+	public:
+		TEST_METHOD(SingleValueDatums)
+		{
+			Benchmark::Report("-- Datums holding one value (per datum) --"s);
+			RunSingleValue("int32_t"s, int32_t(7));
+			RunSingleValue("float"s, 7.0f);
+			RunSingleValue("glm::vec4"s, glm::vec4(7.0f));
+			RunSingleValue("RTTI*"s, static_cast<RTTI*>(nullptr));
+			RunSingleValue("std::string"s, "seven"s);
+		}
+
+		TEST_METHOD(ScopeOfSingleValues)
+		{
+			Vector<Symbol> names;
+			names.Reserve(64);
+			for (size_t i = 0; i < 64; ++i)
+			{
+				names.PushBack(Symbol("DatumBenchmarks"s + to_string(i)));
+			}
+
+			// Shaped like a parsed JSON table or an event payload: mostly one number or vector per key
+			const double build = Benchmark::Measure(1024, [&names]()
+			{
+				Scope scope(names.Size());
+				for (size_t i = 0; i < names.Size(); ++i)
+				{
+					Datum& datum = scope.Append(names[i]);
+					switch (i % 3)
+					{
+					case 0:
+						datum = static_cast<int32_t>(i);
+						break;
+					case 1:
+						datum = static_cast<float>(i);
+						break;
+					default:
+						datum = glm::vec4(static_cast<float>(i));
+						break;
+					}
+				}
+				Benchmark::DoNotOptimize(scope);
+			});
+
+			Benchmark::Report("-- Scope of 64 single-value attributes --"s);
+			Benchmark::Report("Build and destroy (per attribute)"s, build / static_cast<double>(names.Size()));
+		}
+
+		TEST_METHOD(BulkArithmetic)
+		{
+			constexpr size_t count = 4096;
+			Datum positions(DatumTypes::Vector);
+			Datum velocities(DatumTypes::Vector);
+			Datum weights(DatumTypes::Float);
+			Datum scales(DatumTypes::Float);
+			for (size_t i = 0; i < count; ++i)
+			{
+				positions.PushBack(glm::vec4(static_cast<float>(i)));
+				velocities.PushBack(glm::vec4(1.0f, 0.0f, -1.0f, 0.0f));
+				weights.PushBack(static_cast<float>(i % 7));
+				scales.PushBack(0.5f);
+			}
+			const glm::mat4 rotation = glm::mat4(glm::vec4(0, 1, 0, 0), glm::vec4(-1, 0, 0, 0), glm::vec4(0, 0, 1, 0), glm::vec4(0, 0, 0, 1));
+			constexpr float deltaSeconds = 1.0f / 60.0f;
+
+			// What a script does today: one checked Get and Set per element
+			const double integrateBySet = Benchmark::Measure(256, [&positions, &velocities, deltaSeconds]()
+			{
+				for (size_t i = 0; i < positions.Size(); ++i)
+				{
+					positions.Set(positions.Get<glm::vec4>(i) + velocities.Get<glm::vec4>(i) * deltaSeconds, i);
+				}
+			});
+			const double integrateBulk = Benchmark::Measure(256, [&positions, &velocities, deltaSeconds]()
+			{
+				BulkOps::MultiplyAdd(positions.AsSpan<glm::vec4>(), std::as_const(velocities).AsSpan<glm::vec4>(), deltaSeconds);
+			});
+
+			const double transformBySet = Benchmark::Measure(256, [&positions, &rotation]()
+			{
+				for (size_t i = 0; i < positions.Size(); ++i)
+				{
+					positions.Set(rotation * positions.Get<glm::vec4>(i), i);
+				}
+			});
+			const double transformBulk = Benchmark::Measure(256, [&positions, &rotation]()
+			{
+				BulkOps::Transform(positions.AsSpan<glm::vec4>(), rotation, std::as_const(positions).AsSpan<glm::vec4>());
+			});
+
+			float dot = 0.0f;
+			const double dotByGet = Benchmark::Measure(256, [&weights, &scales, &dot]()
+			{
+				for (size_t i = 0; i < weights.Size(); ++i)
+				{
+					dot += weights.Get<float>(i) * scales.Get<float>(i);
+				}
+			});
+			const double dotBulk = Benchmark::Measure(256, [&weights, &scales, &dot]()
+			{
+				dot += BulkOps::Dot(std::as_const(weights).AsSpan<float>(), std::as_const(scales).AsSpan<float>());
+			});
+			Benchmark::DoNotOptimize(dot);
+			Benchmark::DoNotOptimize(positions);
+
+			const double elements = static_cast<double>(count);
+			Benchmark::Report("-- 4096 element arrays (per element) --"s);
+			Benchmark::Report("vec4 position += velocity * dt, Get/Set"s, integrateBySet / elements);
+			Benchmark::Report("vec4 position += velocity * dt, BulkOps"s, integrateBulk / elements);
+			Benchmark::Report("mat4 * vec4, Get/Set"s, transformBySet / elements);
+			Benchmark::Report("mat4 * vec4, BulkOps"s, transformBulk / elements);
+			Benchmark::Report("float dot product, Get"s, dotByGet / elements);
+			Benchmark::Report("float dot product, BulkOps"s, dotBulk / elements);
+		}
+
+		TEST_METHOD(LargeArrayCopies)
+		{
+			Benchmark::Report("-- Copying 4096 element arrays (per element) --"s);
+			RunArrayCopy("Datum of bool"s, true);
+			RunArrayCopy("Datum of float"s, 1.0f);
+			RunArrayCopy("Datum of glm::vec4"s, glm::vec4(1.0f));
+			RunArrayCopy("Datum of glm::mat4"s, glm::mat4(1.0f));
+			RunArrayCopy("Datum of std::string"s, "a string that does not fit in SSO"s);
+
+			Vector<float> floats(4096);
+			Vector<string> strings(4096);
+			for (size_t i = 0; i < 4096; ++i)
+			{
+				floats.PushBack(static_cast<float>(i));
+				strings.PushBack(to_string(i));
+			}
+			const double copyFloats = Benchmark::Measure(256, [&floats]()
+			{
+				Vector<float> copy(floats);
+				Benchmark::DoNotOptimize(copy);
+			});
+			const double copyStrings = Benchmark::Measure(256, [&strings]()
+			{
+				Vector<string> copy(strings);
+				Benchmark::DoNotOptimize(copy);
+			});
+			Benchmark::Report("Vector<float> copy"s, copyFloats / 4096.0);
+			Benchmark::Report("Vector<std::string> copy"s, copyStrings / 4096.0);
+
+			// Deep copy of a scope holding a few large numeric attributes
+			Scope scope;
+			for (size_t i = 0; i < 8; ++i)
+			{
+				Datum& datum = scope.Append(Symbol("DatumBenchmarksArray"s + to_string(i)));
+				datum.SetType(DatumTypes::Vector);
+				datum.Reserve(512);
+				for (size_t j = 0; j < 512; ++j)
+				{
+					datum.PushBack(glm::vec4(static_cast<float>(j)));
+				}
+			}
+			const double copyScope = Benchmark::Measure(256, [&scope]()
+			{
+				Scope copy(scope);
+				Benchmark::DoNotOptimize(copy);
+			});
+			Benchmark::Report("Scope of 8 x 512 glm::vec4 deep copy"s, copyScope / 4096.0);
+		}
+
+		TEST_METHOD(ParsedWorldFootprint)
+		{
+			Factory<Scope>::Add(make_unique<ScopeFactory>());
+			Factory<Scope>::Add(make_unique<GameObjectFactory>());
+			Factory<Scope>::Add(make_unique<MonsterFactory>());
+			{
+				// A world of monsters, each with a few children, shaped like GameObjectTest.json
+				ostringstream json;
+				json << R"({ "Name": { "type": "string", "value": "World" }, "Children": { "type": "table[]", "value": [)";
+				for (size_t i = 0; i < 512; ++i)
+				{
+					json << (i > 0 ? "," : "") << R"({ "type": "table", "class": "Monster", "value": {)"
+						<< R"("Name": { "type": "string", "value": "Monster)" << i << R"(" },)"
+						<< R"("Health": { "type": "integer", "value": 100 },)"
+						<< R"("Speed": { "type": "float", "value": 2.5 },)"
+						<< R"("Velocity": { "type": "vector", "value": [ 1, 0, 0, 0 ] },)"
+						<< R"("Children": { "type": "table[]", "value": [)";
+					for (size_t j = 0; j < 4; ++j)
+					{
+						json << (j > 0 ? "," : "") << R"({ "type": "table", "class": "GameObject", "value": { "Name": { "type": "string", "value": "Child" }, "Health": { "type": "integer", "value": 10 } } })";
+					}
+					json << "] } } }";
+				}
+				json << "] } }";
+
+				shared_ptr<JsonTableParseHelper::Wrapper> wrapper = make_shared<JsonTableParseHelper::Wrapper>();
+				wrapper->Data = make_shared<Monster>();
+				JsonParseCoordinator parseCoordinator(wrapper);
+				parseCoordinator.AddHelper(make_shared<JsonTableParseHelper>());
+				parseCoordinator.DeserializeObject(json.str());
+
+				size_t datumCount = 0;
+				size_t scopeCount = 0;
+				CountDatums(*wrapper->Data, datumCount, scopeCount);
+				Assert::IsTrue(scopeCount > 512 * 5);
+
+				// The layout before compaction: vtable pointer, data pointer, size_t size and capacity, type and external flag
+				struct LegacyDatumLayout
+				{
+					void* VTable;
+					std::byte* Data;
+					size_t Size;
+					size_t Capacity;
+					DatumTypes Type;
+					bool IsExternal;
+				};
+
+				Benchmark::Report("-- Datum footprint of a parsed world --"s);
+				Benchmark::Report("Scopes: "s + to_string(scopeCount) + ", datums: "s + to_string(datumCount));
+				Benchmark::Report("Datum headers at "s + to_string(sizeof(LegacyDatumLayout)) + " bytes: "s + to_string(datumCount * sizeof(LegacyDatumLayout)) + " bytes"s);
+				Benchmark::Report("Datum headers at "s + to_string(sizeof(Datum)) + " bytes: "s + to_string(datumCount * sizeof(Datum)) + " bytes"s);
+			}
+			Factory<Scope>::Clear();
+		}
+
+	private:
+		static void CountDatums(Scope& scope, size_t& datumCount, size_t& scopeCount)
+		{
+			++scopeCount;
+			datumCount += scope.Size();
+			for (size_t i = 0; i < scope.Size(); ++i)
+			{
+				Datum& datum = scope[i];
+				if (datum.Type() == DatumTypes::Table)
+				{
+					for (size_t j = 0; j < datum.Size(); ++j)
+					{
+						CountDatums(*datum.Get<shared_ptr<Scope>>(j), datumCount, scopeCount);
+					}
+				}
+			}
+		}
+
+		template <typename T>
+		static void RunArrayCopy(const string& label, const T& value)
+		{
+			Datum prototype(ToDatumType<T>());
+			prototype.Reserve(4096);
+			for (size_t i = 0; i < 4096; ++i)
+			{
+				prototype.PushBack(value);
+			}
+
+			const double copy = Benchmark::Measure(256, [&prototype]()
+			{
+				Datum datum(prototype);
+				Benchmark::DoNotOptimize(datum);
+			});
+			Benchmark::Report(label + " copy"s, copy / 4096.0);
+		}
+
+		template <typename T>
+		static void RunSingleValue(const string& label, const T& value)
+		{
+			const double construct = Benchmark::Measure(1 << 16, [&value]()
+			{
+				Datum datum = value;
+				Benchmark::DoNotOptimize(datum);
+			});
+
+			const Datum prototype = value;
+			const double copy = Benchmark::Measure(1 << 16, [&prototype]()
+			{
+				Datum datum = prototype;
+				Benchmark::DoNotOptimize(datum);
+			});
+
+			Benchmark::Report(label + " construct and destroy"s, construct);
+			Benchmark::Report(label + " copy and destroy"s, copy);
+		}
+	};
+}
@@ -1,6 +1,8 @@
 #include "pch.h"
 
 #include <initializer_list>
+#include <limits>
+#include <thread>
 #include "Literals.h"
 #include "CppUnitTest.h"
 #include "Foo.h"
@@ -220,12 +222,16 @@ namespace LibraryDesktopTests
 			{
 				const string data = "test"s;
 				const Datum datum = data;
-				const Datum datumCopy = datum;
-
-				Assert::AreEqual(DatumTypes::String, datumCopy.Type());
-				Assert::AreEqual(size_t(1), datumCopy.Size());
-				Assert::AreEqual(datum.Get<std::string>(), datumCopy.Get<std::string>());
+				Datum datumCopy = datum;
+				const Datum& constCopy = datumCopy;
+
+				Assert::AreEqual(DatumTypes::String, constCopy.Type());
+				Assert::AreEqual(size_t(1), constCopy.Size());
+				Assert::AreEqual(datum.Get<std::string>(), constCopy.Get<std::string>());
+				// Heap storage is shared until the copy is accessed for writing
+				Assert::AreSame(datum.Get<std::string>(), constCopy.Get<std::string>());
 				Assert::AreNotSame(datum.Get<std::string>(), datumCopy.Get<std::string>());
+				Assert::AreEqual(datum.Get<std::string>(), constCopy.Get<std::string>());
 			}
 
 			// Vec4
@@ -244,12 +250,16 @@ namespace LibraryDesktopTests
 			{
 				const glm::mat4 data(1.0f);
 				const Datum datum = data;
-				const Datum datumCopy = datum;
-
-				Assert::AreEqual(DatumTypes::Matrix, datumCopy.Type());
-				Assert::AreEqual(size_t(1), datumCopy.Size());
-				Assert::AreEqual(datum.Get<glm::mat4>(), datumCopy.Get<glm::mat4>());
+				Datum datumCopy = datum;
+				const Datum& constCopy = datumCopy;
+
+				Assert::AreEqual(DatumTypes::Matrix, constCopy.Type());
+				Assert::AreEqual(size_t(1), constCopy.Size());
+				Assert::AreEqual(datum.Get<glm::mat4>(), constCopy.Get<glm::mat4>());
+				// Heap storage is shared until the copy is accessed for writing
+				Assert::AreSame(datum.Get<glm::mat4>(), constCopy.Get<glm::mat4>());
 				Assert::AreNotSame(datum.Get<glm::mat4>(), datumCopy.Get<glm::mat4>());
+				Assert::AreEqual(datum.Get<glm::mat4>(), constCopy.Get<glm::mat4>());
 			}
 
 			// RTTI Pointer
@@ -1596,7 +1606,280 @@ namespace LibraryDesktopTests
 				reinterpret_cast<RTTI*>(&c),
 				reinterpret_cast<RTTI*>(&d) }, reinterpret_cast<RTTI*>(&b), reinterpret_cast<RTTI*>(&e), 0, 1);
 		}
-		
+
+		TEST_METHOD(InlineStorage)
+		{
+			// Single values are stored inline and spill to the heap when the datum grows
+			{
+				Datum datum = vec4(1);
+				Assert::AreEqual(1_z, datum.Capacity());
+				Assert::AreEqual(vec4(1), datum.Get<vec4>());
+
+				datum.PushBack(vec4(2));
+				datum.PushBack(vec4(3));
+				Assert::AreEqual(3_z, datum.Size());
+				Assert::AreEqual(vec4(1), datum.Get<vec4>(0));
+				Assert::AreEqual(vec4(3), datum.Get<vec4>(2));
+
+				// Shrinking to one value moves it back inline
+				datum.Resize(1);
+				Assert::AreEqual(1_z, datum.Capacity());
+				Assert::AreEqual(vec4(1), datum.Get<vec4>());
+
+				datum.Clear();
+				datum.ShrinkToFit();
+				Assert::AreEqual(0_z, datum.Capacity());
+				datum.PushBack(vec4(4));
+				Assert::AreEqual(vec4(4), datum.Front<vec4>());
+			}
+
+			// Values with destructors survive moves in and out of inline storage
+			{
+				shared_ptr<Scope> scope = make_shared<Scope>();
+				Datum datum = scope;
+				Assert::AreEqual(2l, scope.use_count());
+
+				Datum moved(std::move(datum));
+				Assert::AreEqual(0_z, datum.Size());
+				Assert::AreEqual(1_z, moved.Size());
+				Assert::IsTrue(moved.Get<shared_ptr<Scope>>() == scope);
+
+				Datum assigned;
+				assigned = std::move(moved);
+				Assert::IsTrue(assigned.Get<shared_ptr<Scope>>() == scope);
+				Assert::AreEqual(2l, scope.use_count());
+
+				Datum copy = assigned;
+				Assert::AreEqual(3l, scope.use_count());
+				copy.PushBack(make_shared<Scope>());
+				Assert::IsTrue(copy.Get<shared_ptr<Scope>>(0) == scope);
+				copy.PopBack();
+				copy.ShrinkToFit();
+				Assert::IsTrue(copy == assigned);
+			}
+			Assert::AreEqual(1l, make_shared<Scope>().use_count());
+
+			// Values larger than the inline storage always use the heap
+			{
+				Datum datum = mat4(2);
+				Assert::AreEqual(1_z, datum.Capacity());
+				Datum moved(std::move(datum));
+				Assert::AreEqual(mat4(2), moved.Get<mat4>());
+			}
+
+			// Reserved internal storage is released when switching to external storage
+			{
+				int32_t external = 5;
+				Datum datum(DatumTypes::Integer);
+				datum.Reserve(1);
+				datum.SetStorage(&external, 1);
+				Assert::IsTrue(datum.IsExternal());
+				Assert::AreEqual(5, datum.Get<int32_t>());
+
+				// Moves keep the datum external
+				Datum assigned = 3;
+				assigned = std::move(datum);
+				Assert::IsTrue(assigned.IsExternal());
+				Assert::AreEqual(&external, &assigned.Get<int32_t>());
+			}
+		}
+
+		TEST_METHOD(CompactLayout)
+		{
+			// No vtable, and small enough that a scope of datums stays cache friendly
+			Assert::IsFalse(std::is_polymorphic_v<Datum>);
+#ifndef DATUM_64BIT_SIZE
+			Assert::IsTrue(sizeof(Datum) <= 24);
+
+			Datum datum(DatumTypes::Integer);
+			Assert::ExpectException<runtime_error>([&datum]() { datum.Reserve(size_t(numeric_limits<uint32_t>::max()) + 1); });
+			Assert::AreEqual(0_z, datum.Capacity());
+#endif
+
+			// The packed type and flags round trip
+			for (DatumTypes type = DatumTypes::Boolean; type < DatumTypes::Unknown; type = static_cast<DatumTypes>(static_cast<uint8_t>(type) + 1))
+			{
+				Datum typed(type);
+				Assert::IsTrue(typed.Type() == type);
+				Assert::IsFalse(typed.IsExternal());
+			}
+
+			float external[3] = { 1.0f, 2.0f, 3.0f };
+			Datum floats;
+			floats.SetStorage(external, 3);
+			Assert::IsTrue(floats.Type() == DatumTypes::Float);
+			Assert::IsTrue(floats.IsExternal());
+			Assert::AreEqual(3_z, floats.Capacity());
+			Assert::AreEqual(3.0f, floats.Back<float>());
+		}
+
+		TEST_METHOD(AsSpan)
+		{
+			{
+				Datum datum = { 1, 2, 3 };
+				span<int32_t> values = datum.AsSpan<int32_t>();
+				Assert::AreEqual(3_z, values.size());
+				Assert::IsTrue(&datum.Get<int32_t>(0) == values.data());
+				values[2] = 5;
+				Assert::AreEqual(5, datum.Back<int32_t>());
+
+				const Datum& constDatum = datum;
+				span<const int32_t> constValues = constDatum.AsSpan<int32_t>();
+				Assert::IsTrue(&constDatum.Get<int32_t>(0) == constValues.data());
+
+				// Inline single values are viewed in place too
+				Datum single = vec4(1);
+				Assert::IsTrue(&single.Get<vec4>() == single.AsSpan<vec4>().data());
+
+				Assert::ExpectException<runtime_error>([&datum]() { auto wrong = datum.AsSpan<float>(); UNREFERENCED_LOCAL(wrong); });
+				Assert::ExpectException<runtime_error>([&constDatum]() { auto wrong = constDatum.AsSpan<float>(); UNREFERENCED_LOCAL(wrong); });
+			}
+
+			// Empty and external storage
+			{
+				Datum empty(DatumTypes::Float);
+				Assert::IsTrue(empty.AsSpan<float>().empty());
+
+				float external[] = { 1.0f, 2.0f };
+				Datum datum;
+				datum.SetStorage(external, 2);
+				span<float> values = datum.AsSpan<float>();
+				Assert::IsTrue(&external[0] == values.data());
+				Assert::AreEqual(2_z, values.size());
+			}
+		}
+
+		TEST_METHOD(Relocation)
+		{
+			static_assert(IsTriviallyRelocatableV<Datum>);
+
+			// Strings are moved to new storage rather than realloc'd, since short strings may point into themselves
+			Datum strings;
+			for (int32_t i = 0; i < 100; ++i)
+			{
+				strings.PushBack(to_string(i));
+			}
+			Assert::IsTrue(strings.RemoveAt(0));
+			strings.ShrinkToFit();
+			Assert::AreEqual(99_z, strings.Size());
+			Assert::AreEqual("1"s, strings.Front<string>());
+			Assert::AreEqual("50"s, strings.Get<string>(49));
+			Assert::AreEqual("99"s, strings.Back<string>());
+
+			// Datums themselves relocate bitwise, including inline values
+			Vector<Datum> datums;
+			for (int32_t i = 0; i < 50; ++i)
+			{
+				datums.PushBack(Datum{ i });
+				datums.PushBack(Datum{ to_string(i), "x"s });
+			}
+			datums.Remove(datums.begin());
+			Assert::AreEqual(99_z, datums.Size());
+			Assert::AreEqual("0"s, datums[0].Front<string>());
+			Assert::AreEqual(49, datums[97].Front<int32_t>());
+			Assert::AreEqual("49"s, datums[98].Front<string>());
+		}
+
+		TEST_METHOD(CopyOnWrite)
+		{
+			// Writing to a copy leaves the original alone
+			{
+				Datum original{ 1, 2, 3, 4 };
+				Datum copy = original;
+				const Datum& constCopy = copy;
+				const Datum& constOriginal = original;
+				Assert::AreSame(constOriginal.Get<int32_t>(), constCopy.Get<int32_t>());
+
+				copy.Set(10, 1);
+				Assert::AreEqual(2, original.Get<int32_t>(1));
+				Assert::AreEqual(10, copy.Get<int32_t>(1));
+				Assert::AreNotSame(constOriginal.Get<int32_t>(), constCopy.Get<int32_t>());
+			}
+
+			// Growing, removing and clearing a copy
+			{
+				Datum original{ "a"s, "b"s, "c"s };
+				Datum grown = original;
+				Datum removed = original;
+				Datum cleared = original;
+				Datum shrunk = original;
+
+				grown.PushBack("d"s);
+				removed.RemoveAt(0);
+				cleared.Clear();
+				shrunk.PopBack();
+				shrunk.PopBack();
+				shrunk.ShrinkToFit();
+
+				Assert::AreEqual(Datum{ "a"s, "b"s, "c"s }, original);
+				Assert::AreEqual(Datum{ "a"s, "b"s, "c"s, "d"s }, grown);
+				Assert::AreEqual(Datum{ "b"s, "c"s }, removed);
+				Assert::AreEqual(0_z, cleared.Size());
+				Assert::AreEqual(Datum{ "a"s }, shrunk);
+				Assert::AreEqual(1_z, shrunk.Capacity());
+			}
+
+			// The last copy keeps the values alive
+			{
+				Datum copy;
+				{
+					Datum original{ glm::mat4(1.0f), glm::mat4(2.0f) };
+					Datum assigned;
+					assigned = original;
+					copy = assigned;
+				}
+				Assert::AreEqual(2_z, copy.Size());
+				Assert::AreEqual(glm::mat4(2.0f), copy.Get<glm::mat4>(1));
+			}
+
+			// Copies of tables share the scopes, as they always have
+			{
+				shared_ptr<Scope> scope = make_shared<Scope>();
+				Datum original;
+				original.PushBack(scope);
+				original.PushBack(scope);
+				const long count = scope.use_count();
+				{
+					Datum copy = original;
+					Assert::AreEqual(count, scope.use_count());
+					copy.Get<shared_ptr<Scope>>(0);
+					Assert::AreEqual(count + 2, scope.use_count());
+				}
+				Assert::AreEqual(count, scope.use_count());
+			}
+
+			// Copies sharing storage can be written on different threads, and the last one frees it
+			{
+				constexpr size_t threadCount = 4;
+				Vector<Datum> copies(threadCount);
+				{
+					Datum original{ "Value that does not fit inline"s, "b"s, "c"s };
+					for (size_t i = 0; i < threadCount; ++i)
+					{
+						copies.PushBack(original);
+					}
+				}
+
+				Vector<std::thread> threads(threadCount);
+				for (size_t i = 0; i < threadCount; ++i)
+				{
+					threads.EmplaceBack([&copy = copies[i], i]()
+					{
+						copy.Set(std::to_string(i), 1);
+					});
+				}
+				for (std::thread& thread : threads)
+				{
+					thread.join();
+				}
+
+				for (size_t i = 0; i < threadCount; ++i)
+				{
+					Assert::AreEqual(Datum{ "Value that does not fit inline"s, std::to_string(i), "c"s }, copies[i]);
+				}
+			}
+		}
+
 	private:
 		inline static _CrtMemState _startMemState;
 	};
@@ -0,0 +1,71 @@
+#include "pch.h"
+#include "CppUnitTest.h"
+#include "Benchmark.h"
+#include "Game.h"
+#include "EventPublisher.h"
+#include "IEventSubscriber.h"
+#include "EventMessageAttributed.h"
+#include "ReactionAttributed.h"
+
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+using namespace FieaGameEngine;
+using namespace UnitTests;
+using namespace std;
+using namespace std::string_literals;
+
+namespace LibraryDesktopTests
+{
+	TEST_CLASS(EventBenchmarks)
+	{
+		struct CountingSubscriber final : IEventSubscriber
+		{
+			void Notify(const EventBase&) noexcept override
+			{
+				++Notifies;
+			}
+
+			size_t Notifies = 0;
+		};
+
+	public:
+		TEST_METHOD(SubscriberChurn)
+		{
+			constexpr size_t subscriberCount = 100000;
+			const double count = static_cast<double>(subscriberCount);
+
+			Benchmark::Report("-- Subscribing then unsubscribing in subscription order (per subscriber) --"s);
+			const double churn = Benchmark::Measure(4, []()
+			{
+				EventPublisher publisher;
+				Vector<CountingSubscriber> subscribers(subscriberCount);
+				for (size_t i = 0; i < subscriberCount; ++i)
+				{
+					publisher.Subscribe<Event<int32_t>>(*subscribers.EmplaceBack());
+				}
+				for (CountingSubscriber& subscriber : subscribers)
+				{
+					publisher.Unsubscribe<Event<int32_t>>(subscriber);
+				}
+				Benchmark::DoNotOptimize(publisher);
+			});
+			Benchmark::Report(to_string(subscriberCount) + " subscribers, Subscribe + Unsubscribe"s, churn / count);
+
+			// Destroying reactions is how subscribers usually leave the publisher
+			const double reactions = Benchmark::Measure(1, []()
+			{
+				Vector<unique_ptr<ReactionAttributed>> spawned(subscriberCount);
+				for (size_t i = 0; i < subscriberCount; ++i)
+				{
+					spawned.PushBack(make_unique<ReactionAttributed>());
+				}
+				for (auto& reaction : spawned)
+				{
+					reaction.reset();
+				}
+			});
+			Benchmark::Report(to_string(subscriberCount) + " ReactionAttributed, spawn + destroy"s, reactions / count);
+
+			Game::Reset();
+		}
+	};
+}
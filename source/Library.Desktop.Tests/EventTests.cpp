@@ -303,6 +303,87 @@ namespace LibraryDesktopTests
 			Assert::AreEqual(e.Message(), subscriber.LastFooMessageReceived);
 		}
 
+		TEST_METHOD(MultipleSubscriptions)
+		{
+			EventPublisher publisher;
+			TestSubscriber subscriber;
+			GameTime gameTime;
+
+			// One subscriber on several event types, and twice on one of them
+			publisher.Subscribe<Event<Foo>>(subscriber);
+			publisher.Subscribe<Event<int32_t>>(subscriber);
+			publisher.Subscribe<Event<Foo>>(subscriber);
+
+			publisher.Enqueue(Event<Foo>{ Foo{ 1 } }, gameTime);
+			publisher.Enqueue(Event<int32_t>{ 1 }, gameTime);
+			publisher.Update(gameTime);
+			Assert::AreEqual(3, subscriber.NotifiesReceived);
+			Assert::AreEqual(2, subscriber.FooEventsReceived);
+
+			// Unsubscribing removes one subscription at a time
+			publisher.Unsubscribe<Event<Foo>>(subscriber);
+			publisher.Enqueue(Event<Foo>{ Foo{ 2 } }, gameTime);
+			publisher.Enqueue(Event<int32_t>{ 2 }, gameTime);
+			publisher.Update(gameTime);
+			Assert::AreEqual(5, subscriber.NotifiesReceived);
+			Assert::AreEqual(3, subscriber.FooEventsReceived);
+
+			publisher.Unsubscribe<Event<int32_t>>(subscriber);
+			publisher.Unsubscribe<Event<Foo>>(subscriber);
+			publisher.Unsubscribe<Event<Foo>>(subscriber);
+			publisher.Enqueue(Event<Foo>{ Foo{ 3 } }, gameTime);
+			publisher.Enqueue(Event<int32_t>{ 3 }, gameTime);
+			publisher.Update(gameTime);
+			Assert::AreEqual(5, subscriber.NotifiesReceived);
+
+			// Unsubscribed subscribers can subscribe again
+			publisher.Subscribe<Event<int32_t>>(subscriber);
+			publisher.Enqueue(Event<int32_t>{ 4 }, gameTime);
+			publisher.Update(gameTime);
+			Assert::AreEqual(6, subscriber.NotifiesReceived);
+		}
+
+		TEST_METHOD(DestroyedSubscribersUnsubscribe)
+		{
+			EventPublisher publisher;
+			TestSubscriber survivor;
+			GameTime gameTime;
+			publisher.Subscribe<Event<Foo>>(survivor);
+			{
+				TestSubscriber subscriber;
+				publisher.Subscribe<Event<Foo>>(subscriber);
+				publisher.Subscribe<Event<int32_t>>(subscriber);
+
+				// Copies do not inherit subscriptions
+				TestSubscriber copy(subscriber);
+				publisher.Enqueue(Event<Foo>{ Foo{} }, gameTime);
+				publisher.Update(gameTime);
+				Assert::AreEqual(1, subscriber.NotifiesReceived);
+				Assert::AreEqual(0, copy.NotifiesReceived);
+
+				// Assignment keeps the destination's subscriptions
+				subscriber = copy;
+				publisher.Enqueue(Event<int32_t>{ 1 }, gameTime);
+				publisher.Update(gameTime);
+				Assert::AreEqual(1, subscriber.NotifiesReceived);
+			}
+
+			publisher.Enqueue(Event<Foo>{ Foo{} }, gameTime);
+			publisher.Enqueue(Event<int32_t>{ 1 }, gameTime);
+			publisher.Update(gameTime);
+			Assert::AreEqual(2, survivor.NotifiesReceived);
+
+			// A subscriber destroyed by its own notification is skipped over safely
+			auto doomed = make_unique<CustomSubscriber>();
+			doomed->SetCustomFunction([&doomed](const EventBase&) { doomed.reset(); });
+			publisher.Subscribe<Event<Foo>>(*doomed);
+			publisher.Subscribe<Event<Foo>>(survivor);
+			publisher.Enqueue(Event<Foo>{ Foo{} }, gameTime);
+			publisher.Update(gameTime);
+			Assert::IsTrue(doomed == nullptr);
+			Assert::AreEqual(4, survivor.NotifiesReceived);
+		}
+
 		TEST_METHOD(QueueSize)
 		{
 			EventPublisher publisher;
@@ -3,6 +3,8 @@
 #include "Factory.h"
 #include "AttributedFoo.h"
 #include "ToStringSpecializations.h"
+#include "CountingResource.h"
+#include "Literals.h"
 
 using namespace Microsoft::VisualStudio::CppUnitTestFramework;
 using namespace UnitTests;
@@ -188,6 +190,21 @@ namespace LibraryDesktopTests
 				Assert::IsNotNull(createdObject.get());
 				Assert::AreEqual(Scope::TypeIdClass(), createdObject->TypeIdInstance());
 			}
+
+			// Create from a memory resource
+			{
+				CountingResource resource;
+				{
+					shared_ptr<Scope> createdObject = Factory<Scope>::Create("AttributedFoo", &resource);
+					Assert::IsNotNull(createdObject.get());
+					Assert::AreEqual(AttributedFoo::TypeIdClass(), createdObject->TypeIdInstance());
+					// The object and its control block are a single allocation
+					Assert::AreEqual(1_z, resource.Allocations);
+
+					Assert::IsNull(Factory<Scope>::Create("Missing", &resource).get());
+				}
+				Assert::AreEqual(1_z, resource.Deallocations);
+			}
 		}
 
 	private:
@@ -0,0 +1,694 @@
+#include "pch.h"
+#include "Literals.h"
+#include "CppUnitTest.h"
+#include "Foo.h"
+#include "FlatHashMap.h"
+#include "ToStringSpecializations.h"
+#include "HashSpecializations.h"
+
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+using namespace FieaGameEngine;
+using namespace UnitTests;
+using namespace std;
+using namespace std::string_literals;
+
+namespace Microsoft::VisualStudio::CppUnitTestFramework
+{
+	template<>
+	inline std::wstring ToString<FlatHashMap<Foo, Foo>::PairType>(const FlatHashMap<Foo, Foo>::PairType& pair)
+	{
+		return ToString(pair.first) + L","s + ToString(pair.second);
+	}
+
+	template<>
+	inline std::wstring ToString<FlatHashMap<Foo, Foo>::iterator>(const FlatHashMap<Foo, Foo>::iterator& t)
+	{
+		wstring value;
+		try
+		{
+			value = ToString(*t);
+		}
+		catch (const std::exception&)
+		{
+			value = L"end()"s;
+		}
+		return value;
+	}
+
+	template<>
+	inline std::wstring ToString<FlatHashMap<Foo, Foo>::const_iterator>(const FlatHashMap<Foo, Foo>::const_iterator& t)
+	{
+		wstring value;
+		try
+		{
+			value = ToString(*t);
+		}
+		catch (const std::exception&)
+		{
+			value = L"end()"s;
+		}
+		return value;
+	}
+}
+
+namespace LibraryDesktopTests
+{
+	TEST_CLASS(FlatHashMapTests)
+	{
+	public:
+		TEST_METHOD_INITIALIZE(Initialize)
+		{
+#if defined(DEBUG) || defined(_DEBUG)
+			_CrtSetDbgFlag(_CRTDBG_ALLOC_MEM_DF);
+			_CrtMemCheckpoint(&_startMemState);
+#endif
+		}
+
+		TEST_METHOD_CLEANUP(Cleanup)
+		{
+#if defined(DEBUG) || defined(_DEBUG)
+			_CrtMemState endMemState, diffMemState;
+			_CrtMemCheckpoint(&endMemState);
+			if (_CrtMemDifference(&diffMemState, &_startMemState,
+				&endMemState))
+			{
+				_CrtMemDumpStatistics(&diffMemState);
+				Assert::Fail(L"Memory Leaks!");
+			}
+#endif
+		}
+
+		TEST_METHOD(Constructor)
+		{
+			// No bucket count specified
+			{
+				const FlatHashMap<Foo, Foo> hashMap;
+				Assert::AreEqual(size_t(0), hashMap.Size());
+				Assert::AreEqual(0.0f, hashMap.LoadFactor());
+				Assert::AreEqual(hashMap.end(), hashMap.begin());
+			}
+
+			// Check bucket count
+			{
+				// Rounded up to a power of two number of slots
+				size_t expectedBucketCount = 32;
+				const FlatHashMap<Foo, Foo> hashMap(17);
+				Assert::AreEqual(expectedBucketCount, hashMap.BucketCount());
+				Assert::AreEqual(size_t(0), hashMap.Size());
+				Assert::AreEqual(0.0f, hashMap.LoadFactor());
+				Assert::AreEqual(hashMap.end(), hashMap.begin());
+			}
+		}
+
+		TEST_METHOD(CopySemantics)
+		{
+			FlatHashMap<Foo, Foo> hashMap;
+			hashMap.Insert(std::pair(Foo(1), Foo(2)));
+			hashMap.Insert(std::pair(Foo(3), Foo(4)));
+			// Copy
+			FlatHashMap<Foo, Foo> hashMapCopy = hashMap;
+			Assert::IsTrue(std::equal(hashMapCopy.begin(), hashMapCopy.end(), hashMap.begin()));
+		}
+
+		TEST_METHOD(Find)
+		{
+			// Non-const
+			{
+				FlatHashMap<Foo, Foo> hashMap;
+				hashMap.Insert(std::pair(Foo(1), Foo(2)));
+				hashMap.Insert(std::pair(Foo(3), Foo(4)));
+
+				// Should find
+				Assert::AreNotEqual(hashMap.end(), hashMap.Find(Foo(1)));
+				// Should not find
+				Assert::AreEqual(hashMap.end(), hashMap.Find(Foo(2)));
+				// Should find
+				Assert::AreNotEqual(hashMap.end(), hashMap.Find(Foo(3)));
+			}
+
+			// Const
+			{
+				FlatHashMap<Foo, Foo> hashMap;
+				hashMap.Insert(std::pair(Foo(1), Foo(2)));
+				hashMap.Insert(std::pair(Foo(3), Foo(4)));
+
+				const FlatHashMap<Foo, Foo>& constHashMap = hashMap;
+
+				// Should find
+				Assert::AreNotEqual(constHashMap.end(), constHashMap.Find(Foo(1)));
+				// Should not find
+				Assert::AreEqual(constHashMap.end(), constHashMap.Find(Foo(2)));
+				// Should find
+				Assert::AreNotEqual(constHashMap.end(), constHashMap.Find(Foo(3)));
+			}
+		}
+
+		TEST_METHOD(Insert)
+		{
+			std::pair<FlatHashMap<Foo, Foo>::iterator, bool> ret;
+			FlatHashMap<Foo, Foo>::iterator firstIt;
+			FlatHashMap<Foo, Foo> hashMap;
+			Assert::AreEqual(size_t(0), hashMap.Size());
+			ret = hashMap.Insert(std::pair(Foo(1), Foo(2)));
+			firstIt = ret.first;
+			Assert::AreEqual(true, ret.second);
+			Assert::AreNotEqual(hashMap.end(), ret.first);
+			Assert::AreEqual(size_t(1), hashMap.Size());
+			// Insert same key
+			ret = hashMap.Insert(std::pair(Foo(1), Foo(3)));
+			Assert::AreEqual(false, ret.second);
+			Assert::AreNotEqual(hashMap.end(), ret.first);
+			Assert::AreEqual(firstIt, ret.first);
+			Assert::AreEqual(size_t(1), hashMap.Size());
+			// Insert different key
+			ret = hashMap.Insert(std::pair(Foo(2), Foo(4)));
+			Assert::AreEqual(true, ret.second);
+			Assert::AreNotEqual(hashMap.end(), ret.first);
+			Assert::AreEqual(size_t(2), hashMap.Size());
+		}
+
+		TEST_METHOD(OperatorBracketBracket)
+		{
+			FlatHashMap<Foo, Foo> hashMap;
+			Assert::AreEqual(size_t(0), hashMap.Size());
+
+			// Get non inserted element
+			const Foo& value1 = hashMap[Foo(1)];
+			Assert::AreEqual(size_t(1), hashMap.Size());
+			// Check was default initialized
+			Assert::AreEqual(Foo{}, value1);
+
+			// Get inserted element
+			hashMap.Insert({Foo(2), Foo(100)});
+			Assert::AreEqual(size_t(2), hashMap.Size());
+			const Foo& value2 = hashMap[Foo(2)];
+			Assert::AreEqual(size_t(2), hashMap.Size());
+			Assert::AreEqual(Foo(100), value2);
+		}
+
+		TEST_METHOD(Remove)
+		{
+			FlatHashMap<Foo, Foo> hashMap;
+			bool ret;
+			Assert::AreEqual(size_t(0), hashMap.Size());
+
+			// Remove key not in hash map
+			ret = hashMap.Remove(Foo(1));
+			Assert::IsFalse(ret);
+			Assert::AreEqual(size_t(0), hashMap.Size());
+
+			// Insert key
+			hashMap.Insert({ Foo(1), Foo(2) });
+			Assert::AreEqual(size_t(1), hashMap.Size());
+
+			// Remove key just inserted
+			ret = hashMap.Remove(Foo(1));
+			Assert::IsTrue(ret);
+			Assert::AreEqual(size_t(0), hashMap.Size());
+		}
+
+		TEST_METHOD(Clear)
+		{
+			FlatHashMap<Foo, Foo> hashMap;
+			hashMap.Insert({ Foo(1), Foo(2) });
+			hashMap.Insert({ Foo(2), Foo(2) });
+			Assert::AreEqual(size_t(2), hashMap.Size());
+			Assert::IsTrue(hashMap.LoadFactor() > 0);
+			Assert::AreNotEqual(hashMap.end(), hashMap.Find(Foo(1)));
+
+			// Clear
+			hashMap.Clear();
+			Assert::AreEqual(size_t(0), hashMap.Size());
+			Assert::AreEqual(0.0f, hashMap.LoadFactor());
+			Assert::AreEqual(hashMap.end(), hashMap.Find(Foo(1)));
+		}
+
+		TEST_METHOD(Size)
+		{
+			FlatHashMap<Foo, Foo> hashMap;
+			Assert::AreEqual(size_t(0), hashMap.Size());
+			hashMap.Insert({ Foo(1), Foo(2) });
+			Assert::AreEqual(size_t(1), hashMap.Size());
+			hashMap.Insert({ Foo(2), Foo(2) });
+			Assert::AreEqual(size_t(2), hashMap.Size());
+			hashMap.Clear();
+			Assert::AreEqual(size_t(0), hashMap.Size());
+		}
+
+		TEST_METHOD(BucketCount)
+		{
+			FlatHashMap<Foo, Foo> hashMap(11);
+			Assert::AreEqual(size_t(16), hashMap.BucketCount());
+
+			FlatHashMap<Foo, Foo> hashMap2(64);
+			Assert::AreEqual(size_t(64), hashMap2.BucketCount());
+		}
+
+		TEST_METHOD(LoadFactor)
+		{
+			FlatHashMap<Foo, Foo> hashMap(11);
+			Assert::AreEqual(0.0f, const_cast<const FlatHashMap<Foo, Foo>&>(hashMap).LoadFactor());
+			Assert::AreEqual(0.0f, hashMap.LoadFactor());
+
+			hashMap.Insert({ Foo(1), Foo(2) });
+			Assert::IsTrue(const_cast<const FlatHashMap<Foo, Foo>&>(hashMap).LoadFactor() > 0.0f);
+			Assert::IsTrue(hashMap.LoadFactor() > 0.0f);
+
+			hashMap.Clear();
+			Assert::AreEqual(0.0f, const_cast<const FlatHashMap<Foo, Foo>&>(hashMap).LoadFactor());
+			Assert::AreEqual(0.0f, hashMap.LoadFactor());
+		}
+
+		TEST_METHOD(ContainsKey)
+		{
+			FlatHashMap<Foo, Foo> hashMap(11);
+			Assert::IsFalse(hashMap.ContainsKey(Foo(1)));
+			hashMap.Insert({Foo(1), Foo(2)});
+			Assert::IsTrue(hashMap.ContainsKey(Foo(1)));
+			hashMap.Remove(Foo(1));
+			Assert::IsFalse(hashMap.ContainsKey(Foo(1)));
+		}
+
+		TEST_METHOD(At)
+		{
+			// Non-const
+			{
+				const Foo key(1);
+				Foo value(2);
+				FlatHashMap<Foo, Foo> hashMap(11);
+				Assert::ExpectException<runtime_error>([&hashMap, &key]() { auto v = hashMap.At(key); UNREFERENCED_LOCAL(v); });
+
+				hashMap.Insert({ key, value });
+				Assert::AreEqual(value, hashMap.At(key));
+				Assert::AreNotSame(value, hashMap.At(key));
+			}
+
+			// Const
+			{
+				const Foo key(1);
+				Foo value(2);
+				FlatHashMap<Foo, Foo> hashMap(11);
+				Assert::ExpectException<runtime_error>([&hashMap, &key]() { auto v = const_cast<const FlatHashMap<Foo, Foo>&>(hashMap).At(key); UNREFERENCED_LOCAL(v); });
+
+				hashMap.Insert({ key, value });
+				Assert::AreEqual(value, const_cast<const FlatHashMap<Foo, Foo>&>(hashMap).At(key));
+				Assert::AreNotSame(value, const_cast<const FlatHashMap<Foo, Foo>&>(hashMap).At(key));
+			}
+		}
+
+		TEST_METHOD(Resize)
+		{
+			FlatHashMap<Foo, Foo> hashMap(11);
+			hashMap.Insert({Foo(1), Foo(2)});
+			Assert::AreEqual(size_t(16), hashMap.BucketCount());
+			hashMap.Resize(29);
+			Assert::AreEqual(size_t(32), hashMap.BucketCount());
+			Assert::ExpectException<runtime_error>([&hashMap]() { hashMap.Resize(16); });
+			Assert::IsTrue(hashMap.ContainsKey(Foo(1)));
+		}
+
+		TEST_METHOD(begin)
+		{
+			// Non-const
+			{
+				const FlatHashMap<Foo, Foo>::PairType pair{ Foo(1), Foo(2) };
+				FlatHashMap<Foo, Foo> hashMap(11);
+				Assert::AreEqual(hashMap.end(), hashMap.begin());
+				// Insert
+				hashMap.Insert(pair);
+				Assert::AreEqual(pair, *hashMap.begin());
+				// Remove
+				hashMap.Remove(pair.first);
+				Assert::AreEqual(hashMap.end(), hashMap.begin());
+			}
+
+			// Const
+			{
+				const FlatHashMap<Foo, Foo>::PairType pair{ Foo(1), Foo(2) };
+				FlatHashMap<Foo, Foo> hashMap(11);
+				Assert::AreEqual(const_cast<const FlatHashMap<Foo, Foo>&>(hashMap).end(), const_cast<const FlatHashMap<Foo, Foo>&>(hashMap).begin());
+				// Insert
+				hashMap.Insert(pair);
+				Assert::AreEqual(pair, *const_cast<const FlatHashMap<Foo, Foo>&>(hashMap).begin());
+				// Remove
+				hashMap.Remove(pair.first);
+				Assert::AreEqual(const_cast<const FlatHashMap<Foo, Foo>&>(hashMap).end(), const_cast<const FlatHashMap<Foo, Foo>&>(hashMap).begin());
+			}
+		}
+
+		TEST_METHOD(cbegin)
+		{
+			const FlatHashMap<Foo, Foo>::PairType pair{ Foo(1), Foo(2) };
+			FlatHashMap<Foo, Foo> hashMap(11);
+			Assert::AreEqual(hashMap.cend(), hashMap.cbegin());
+			// Insert
+			hashMap.Insert(pair);
+			Assert::AreEqual(pair, *hashMap.cbegin());
+			// Remove
+			hashMap.Remove(pair.first);
+			Assert::AreEqual(hashMap.cend(), hashMap.cbegin());
+		}
+
+		TEST_METHOD(end)
+		{
+			// Non-const
+			{
+				FlatHashMap<Foo, Foo> hashMap(11);
+				Assert::ExpectException<runtime_error>([&hashMap]() { auto& pair = *hashMap.end(); UNREFERENCED_LOCAL(pair); });
+				Assert::AreEqual(hashMap.begin(), hashMap.end());
+				hashMap.Insert({ Foo(1), Foo(2) });
+				Assert::AreNotEqual(hashMap.begin(), hashMap.end());
+				FlatHashMap<Foo, Foo>::iterator it = hashMap.begin();
+				++it;
+				Assert::AreEqual(it, hashMap.end());
+			}
+
+			// Const
+			{
+				FlatHashMap<Foo, Foo> hashMap(11);
+				const FlatHashMap<Foo, Foo>& constHashMap = hashMap;
+				Assert::ExpectException<runtime_error>([&constHashMap]() { auto& pair = *constHashMap.end(); UNREFERENCED_LOCAL(pair); });
+				Assert::AreEqual(constHashMap.begin(), constHashMap.end());
+				hashMap.Insert({ Foo(1), Foo(2) });
+				Assert::AreNotEqual(constHashMap.begin(), constHashMap.end());
+				FlatHashMap<Foo, Foo>::const_iterator it = constHashMap.begin();
+				++it;
+				Assert::AreEqual(it, constHashMap.end());
+			}
+		}
+
+		TEST_METHOD(cend)
+		{
+			FlatHashMap<Foo, Foo> hashMap(11);
+			Assert::ExpectException<runtime_error>([&hashMap]() { auto& pair = *hashMap.cend(); UNREFERENCED_LOCAL(pair); });
+			Assert::AreEqual(hashMap.cbegin(), hashMap.cend());
+			hashMap.Insert({ Foo(1), Foo(2) });
+			Assert::AreNotEqual(hashMap.cbegin(), hashMap.cend());
+			FlatHashMap<Foo, Foo>::const_iterator it = hashMap.cbegin();
+			++it;
+			Assert::AreEqual(it, hashMap.cend());
+		}
+
+		TEST_METHOD(const_iterator)
+		{
+			// iterator cast
+			{
+				FlatHashMap<Foo, Foo>::PairType pair(Foo(1), Foo(2));
+				FlatHashMap<Foo, Foo> hashMap;
+				hashMap.Insert(pair);
+				FlatHashMap<Foo, Foo>::iterator it = hashMap.begin();
+				FlatHashMap<Foo, Foo>::const_iterator constIt(it);
+				Assert::AreEqual(*it, *constIt);
+			}
+
+			// operator*
+			{
+				FlatHashMap<Foo, Foo>::PairType pair(Foo(1), Foo(2));
+				FlatHashMap<Foo, Foo> hashMap;
+				hashMap.Insert(pair);
+				FlatHashMap<Foo, Foo>::const_iterator it = hashMap.cbegin();
+				Assert::AreEqual(pair, *it);
+				Assert::AreEqual(pair.first, it->first);
+				++it;
+				Assert::ExpectException<runtime_error>([&it]() { const auto& pair = *it; UNREFERENCED_LOCAL(pair); });
+
+				// Default constructed
+				FlatHashMap<Foo, Foo>::const_iterator defaultIt;
+				Assert::ExpectException<runtime_error>([&defaultIt]() { const auto& pair = *defaultIt; UNREFERENCED_LOCAL(pair); });
+			}
+
+			// ++operator
+			{
+				const FlatHashMap<Foo, Foo>::PairType pair1(Foo(1), Foo(2));
+				const FlatHashMap<Foo, Foo>::PairType pair2(Foo(2), Foo(2));
+				FlatHashMap<Foo, Foo> hashMap;
+				hashMap.Insert(pair1);
+				hashMap.Insert(pair2);
+				FlatHashMap<Foo, Foo>::const_iterator oldIt;
+				FlatHashMap<Foo, Foo>::const_iterator it = hashMap.cbegin();
+
+				Assert::AreNotEqual(hashMap.cend(), it);
+				oldIt = ++it;
+				Assert::AreEqual(oldIt, it);
+				Assert::AreNotEqual(hashMap.cend(), it);
+				oldIt = ++it;
+				Assert::AreEqual(oldIt, it);
+				Assert::ExpectException<runtime_error>([&it]() { const auto& pair = *it; UNREFERENCED_LOCAL(pair); });
+				// Iterate past end
+				oldIt = ++it;
+				Assert::AreEqual(oldIt, it);
+				Assert::ExpectException<runtime_error>([&it]() { const auto& pair = *it; UNREFERENCED_LOCAL(pair); });
+
+				// Default constructed
+				FlatHashMap<Foo, Foo>::const_iterator defaultIt;
+				Assert::ExpectException<runtime_error>([&defaultIt]() { ++defaultIt; });
+			}
+
+			// operator++
+			{
+				const FlatHashMap<Foo, Foo>::PairType pair1(Foo(1), Foo(2));
+				const FlatHashMap<Foo, Foo>::PairType pair2(Foo(2), Foo(2));
+				FlatHashMap<Foo, Foo> hashMap;
+				hashMap.Insert(pair1);
+				hashMap.Insert(pair2);
+				FlatHashMap<Foo, Foo>::const_iterator oldIt;
+				FlatHashMap<Foo, Foo>::const_iterator it = hashMap.cbegin();
+
+				Assert::AreNotEqual(hashMap.cend(), it);
+				oldIt = it++;
+				Assert::AreNotEqual(oldIt, it);
+				Assert::AreNotEqual(hashMap.cend(), it);
+				Assert::AreEqual(hashMap.cbegin(), oldIt);
+				oldIt = it++;
+				Assert::AreNotEqual(oldIt, it);
+				Assert::AreEqual(hashMap.cend(), it);
+				Assert::ExpectException<runtime_error>([&it]() { const auto& pair = *it; UNREFERENCED_LOCAL(pair); });
+				// Iterate past end
+				oldIt = it++;
+				Assert::AreEqual(oldIt, it);
+				Assert::AreEqual(hashMap.cend(), it);
+				Assert::AreEqual(hashMap.cend(), oldIt);
+				Assert::ExpectException<runtime_error>([&it]() { const auto& pair = *it; UNREFERENCED_LOCAL(pair); });
+
+				// Default constructed
+				FlatHashMap<Foo, Foo>::const_iterator defaultIt;
+				Assert::ExpectException<runtime_error>([&defaultIt]() { ++defaultIt; });
+			}
+
+			// operator== && !=
+			{
+				const FlatHashMap<Foo, Foo>::PairType pair1(Foo(1), Foo(2));
+				FlatHashMap<Foo, Foo> hashMap;
+				hashMap.Insert(pair1);
+
+				Assert::AreEqual(hashMap.cbegin(), hashMap.cbegin());
+				Assert::AreEqual(hashMap.cend(), hashMap.cend());
+				Assert::IsTrue(hashMap.cbegin() != hashMap.cend());
+
+				Assert::AreEqual(FlatHashMap<Foo, Foo>::const_iterator{}, FlatHashMap<Foo, Foo>::const_iterator{});
+				Assert::AreNotEqual(FlatHashMap<Foo, Foo>::const_iterator{}, hashMap.cbegin());
+				Assert::AreNotEqual(FlatHashMap<Foo, Foo>::const_iterator{}, hashMap.cend());
+				Assert::IsTrue(FlatHashMap<Foo, Foo>::const_iterator{} != hashMap.cbegin());
+				Assert::IsTrue(FlatHashMap<Foo, Foo>::const_iterator{} != hashMap.cend());
+
+				// Another hashmap
+				FlatHashMap<Foo, Foo> hashMap2(hashMap);
+				Assert::AreNotEqual(hashMap2.cend(), hashMap.cend());
+				Assert::IsTrue(hashMap2.cend() != hashMap.cend());
+			}
+		}
+
+		TEST_METHOD(iterator)
+		{
+			// operator*
+			{
+				FlatHashMap<Foo, Foo>::PairType pair(Foo(1), Foo(2));
+				FlatHashMap<Foo, Foo> hashMap;
+				hashMap.Insert(pair);
+				FlatHashMap<Foo, Foo>::iterator it = hashMap.begin();
+				Assert::AreEqual(pair, *it);
+				Assert::AreEqual(pair.first, it->first);
+				++it;
+				Assert::ExpectException<runtime_error>([&it]() { const auto& pair = *it; UNREFERENCED_LOCAL(pair); });
+
+				// Default constructed
+				FlatHashMap<Foo, Foo>::iterator defaultIt;
+				Assert::ExpectException<runtime_error>([&defaultIt]() { const auto& pair = *defaultIt; UNREFERENCED_LOCAL(pair); });
+			}
+
+			// ++operator
+			{
+				const FlatHashMap<Foo, Foo>::PairType pair1(Foo(1), Foo(2));
+				const FlatHashMap<Foo, Foo>::PairType pair2(Foo(2), Foo(2));
+				FlatHashMap<Foo, Foo> hashMap;
+				hashMap.Insert(pair1);
+				hashMap.Insert(pair2);
+				FlatHashMap<Foo, Foo>::iterator oldIt;
+				FlatHashMap<Foo, Foo>::iterator it = hashMap.begin();
+
+				Assert::AreNotEqual(hashMap.end(), it);
+				oldIt = ++it;
+				Assert::AreEqual(oldIt, it);
+				Assert::AreNotEqual(hashMap.end(), it);
+				oldIt = ++it;
+				Assert::AreEqual(oldIt, it);
+				Assert::ExpectException<runtime_error>([&it]() { const auto& pair = *it; UNREFERENCED_LOCAL(pair); });
+				// Iterate past end
+				oldIt = ++it;
+				Assert::AreEqual(oldIt, it);
+				Assert::ExpectException<runtime_error>([&it]() { const auto& pair = *it; UNREFERENCED_LOCAL(pair); });
+
+				// Default constructed
+				FlatHashMap<Foo, Foo>::iterator defaultIt;
+				Assert::ExpectException<runtime_error>([&defaultIt]() { ++defaultIt; });
+			}
+
+			// operator++
+			{
+				const FlatHashMap<Foo, Foo>::PairType pair1(Foo(1), Foo(2));
+				const FlatHashMap<Foo, Foo>::PairType pair2(Foo(2), Foo(2));
+				FlatHashMap<Foo, Foo> hashMap;
+				hashMap.Insert(pair1);
+				hashMap.Insert(pair2);
+				FlatHashMap<Foo, Foo>::iterator oldIt;
+				FlatHashMap<Foo, Foo>::iterator it = hashMap.begin();
+
+				Assert::AreNotEqual(hashMap.end(), it);
+				oldIt = it++;
+				Assert::AreNotEqual(oldIt, it);
+				Assert::AreNotEqual(hashMap.end(), it);
+				Assert::AreEqual(hashMap.begin(), oldIt);
+				oldIt = it++;
+				Assert::AreNotEqual(oldIt, it);
+				Assert::AreEqual(hashMap.end(), it);
+				Assert::ExpectException<runtime_error>([&it]() { const auto& pair = *it; UNREFERENCED_LOCAL(pair); });
+				// Iterate past end
+				oldIt = it++;
+				Assert::AreEqual(oldIt, it);
+				Assert::AreEqual(hashMap.end(), it);
+				Assert::AreEqual(hashMap.end(), oldIt);
+				Assert::ExpectException<runtime_error>([&it]() { const auto& pair = *it; UNREFERENCED_LOCAL(pair); });
+
+				// Default constructed
+				FlatHashMap<Foo, Foo>::iterator defaultIt;
+				Assert::ExpectException<runtime_error>([&defaultIt]() { ++defaultIt; });
+			}
+
+			// operator== && !=
+			{
+				const FlatHashMap<Foo, Foo>::PairType pair1(Foo(1), Foo(2));
+				FlatHashMap<Foo, Foo> hashMap;
+				hashMap.Insert(pair1);
+
+				Assert::AreEqual(hashMap.begin(), hashMap.begin());
+				Assert::AreEqual(hashMap.end(), hashMap.end());
+				Assert::IsTrue(hashMap.begin() != hashMap.end());
+
+				Assert::AreEqual(FlatHashMap<Foo, Foo>::iterator{}, FlatHashMap<Foo, Foo>::iterator{});
+				Assert::AreNotEqual(FlatHashMap<Foo, Foo>::iterator{}, hashMap.begin());
+				Assert::AreNotEqual(FlatHashMap<Foo, Foo>::iterator{}, hashMap.end());
+				Assert::IsTrue(FlatHashMap<Foo, Foo>::iterator{} != hashMap.begin());
+				Assert::IsTrue(FlatHashMap<Foo, Foo>::iterator{} != hashMap.end());
+
+				// Another hashmap
+				FlatHashMap<Foo, Foo> hashMap2(hashMap);
+				Assert::AreNotEqual(hashMap2.end(), hashMap.end());
+				Assert::IsTrue(hashMap2.end() != hashMap.end());
+			}
+		}
+
+		TEST_METHOD(MoveSemantics)
+		{
+			FlatHashMap<Foo, Foo> hashMap;
+			hashMap.Insert(std::pair(Foo(1), Foo(2)));
+			hashMap.Insert(std::pair(Foo(3), Foo(4)));
+
+			FlatHashMap<Foo, Foo> movedHashMap = std::move(hashMap);
+			Assert::AreEqual(size_t(2), movedHashMap.Size());
+			Assert::AreEqual(Foo(4), movedHashMap.At(Foo(3)));
+
+			// Moved from container can be reused
+			hashMap = FlatHashMap<Foo, Foo>{};
+			hashMap.Insert(std::pair(Foo(5), Foo(6)));
+			movedHashMap = std::move(hashMap);
+			Assert::AreEqual(size_t(1), movedHashMap.Size());
+			Assert::AreEqual(Foo(6), movedHashMap.At(Foo(5)));
+		}
+
+		TEST_METHOD(Growth)
+		{
+			const int32_t count = 1000;
+			FlatHashMap<Foo, Foo> hashMap;
+			for (int32_t i = 0; i < count; ++i)
+			{
+				Assert::IsTrue(hashMap.Insert({ Foo(i), Foo(i * 2) }).second);
+			}
+			Assert::AreEqual(size_t(count), hashMap.Size());
+			Assert::IsTrue(hashMap.BucketCount() >= size_t(count));
+			Assert::IsTrue(hashMap.LoadFactor() <= 0.875f);
+
+			for (int32_t i = 0; i < count; ++i)
+			{
+				Assert::AreEqual(Foo(i * 2), hashMap.At(Foo(i)));
+			}
+
+			size_t iterated = 0;
+			for (const auto& pair : hashMap)
+			{
+				Assert::AreEqual(Foo(pair.first.Data() * 2), pair.second);
+				++iterated;
+			}
+			Assert::AreEqual(size_t(count), iterated);
+		}
+
+		TEST_METHOD(RemoveAndReinsert)
+		{
+			const int32_t count = 200;
+			FlatHashMap<Foo, Foo> hashMap;
+			for (int32_t i = 0; i < count; ++i)
+			{
+				hashMap.Insert({ Foo(i), Foo(i) });
+			}
+			const size_t bucketCount = hashMap.BucketCount();
+
+			// Churn through removes and inserts; deleted slots get reused
+			for (int32_t round = 0; round < 10; ++round)
+			{
+				for (int32_t i = 0; i < count; i += 2)
+				{
+					Assert::IsTrue(hashMap.Remove(Foo(i)));
+				}
+				Assert::AreEqual(size_t(count / 2), hashMap.Size());
+				for (int32_t i = 1; i < count; i += 2)
+				{
+					Assert::IsTrue(hashMap.ContainsKey(Foo(i)));
+				}
+				for (int32_t i = 0; i < count; i += 2)
+				{
+					Assert::IsFalse(hashMap.ContainsKey(Foo(i)));
+					Assert::IsTrue(hashMap.Insert({ Foo(i), Foo(i) }).second);
+				}
+			}
+			Assert::AreEqual(size_t(count), hashMap.Size());
+			Assert::AreEqual(bucketCount, hashMap.BucketCount());
+		}
+
+		TEST_METHOD(StringKeys)
+		{
+			FlatHashMap<std::string, int32_t> hashMap;
+			hashMap["Name"s] = 1;
+			hashMap["Transform"s] = 2;
+			hashMap.Emplace("Children"s, 3);
+			Assert::AreEqual(size_t(3), hashMap.Size());
+			Assert::AreEqual(1, hashMap.At("Name"s));
+			Assert::AreEqual(2, hashMap.At("Transform"s));
+			Assert::AreEqual(3, hashMap.At("Children"s));
+			Assert::IsFalse(hashMap.Emplace("Children"s, 4).second);
+			Assert::IsTrue(hashMap.Remove("Transform"s));
+			Assert::IsFalse(hashMap.ContainsKey("Transform"s));
+		}
+
+	private:
+		inline static _CrtMemState _startMemState;
+	};
+}
\ No newline at end of file
@@ -312,6 +312,31 @@ namespace LibraryDesktopTests
 			Assert::AreEqual("Child2"s, childMonster2->Name);
 		}
 
+		TEST_METHOD(Slots)
+		{
+			// Slot counts match the registered signatures
+			Assert::AreEqual(GameObject::AllSignatures().Size(), GameObject::SlotCount);
+			Assert::AreEqual(Monster::AllSignatures().Size(), Monster::SlotCount);
+			Assert::AreEqual(Transform::AllSignatures().Size(), Transform::SlotCount);
+
+			// Slots reach the same datums as lookups by name
+			Monster monster;
+			Assert::AreSame(monster.At("Name"), monster.Slot<GameObject::Slots::Name>());
+			Assert::AreSame(monster.At("Transform"), monster.Slot<GameObject::Slots::Transform>());
+			Assert::AreSame(monster.At("Children"), monster.Slot<Monster::Slots::Children>());
+			Assert::AreSame(monster.At("Actions"), monster.Slot<Monster::Slots::Actions>());
+			Assert::AreSame(monster.At("Reactions"), const_cast<const Monster&>(monster).Slot<Monster::Slots::Reactions>());
+
+			// Slots follow the attributes through copies
+			monster.AppendScope("Children", "GameObject");
+			Monster monsterCopy(monster);
+			Assert::AreSame(monsterCopy.At("Children"), monsterCopy.Slot<GameObject::Slots::Children>());
+			Assert::AreEqual(1_z, monsterCopy.Children().Size());
+
+			Transform& transform = *monster.Slot<GameObject::Slots::Transform>().Get<Scope*>()->As<Transform>();
+			Assert::AreSame(transform.At("Scale"), transform.Slot<Transform::Slots::Scale>());
+		}
+
 	private:
 		inline static _CrtMemState _startMemState;
 	};
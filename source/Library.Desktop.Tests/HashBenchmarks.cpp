@@ -0,0 +1,223 @@
+#include "pch.h"
+#include "CppUnitTest.h"
+#include "Benchmark.h"
+#include "DefaultHash.h"
+#include "HashMap.h"
+#include "Vector.h"
+#include "GameObject.h"
+#include "ActionList.h"
+#include "ActionIf.h"
+#include "ActionIncrement.h"
+#include "ActionEvent.h"
+#include "ReactionAttributed.h"
+#include "EventMessageAttributed.h"
+#include "AttributedFoo.h"
+#include "AttributedBar.h"
+#include <json/json.h>
+#include <fstream>
+
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+using namespace FieaGameEngine;
+using namespace UnitTests;
+using namespace std;
+using namespace std::string_literals;
+
+namespace LibraryDesktopTests
+{
+	TEST_CLASS(HashBenchmarks)
+	{
+	public:
+		/// <summary>
+		/// Collision and bucket occupancy report over attribute names actually used by the engine and its data
+		/// </summary>
+		TEST_METHOD(DistributionReport)
+		{
+			const Vector<string> prescribedNames = PrescribedAttributeNames();
+			const Vector<string> jsonNames = JsonAttributeNames();
+			const Vector<string> auxiliaryNames = AuxiliaryAttributeNames(prescribedNames, 64);
+
+			for (const auto& [label, corpus] : { pair{ "Prescribed attributes"s, &prescribedNames }, pair{ "Json file keys"s, &jsonNames }, pair{ "Indexed auxiliary attributes"s, &auxiliaryNames } })
+			{
+				Benchmark::Report("-- "s + label + ": "s + to_string(corpus->Size()) + " names --"s);
+				Report("Legacy additive hash"s, *corpus, LegacyAdditiveHash{});
+				const size_t fullCollisions = Report("DefaultHash"s, *corpus, DefaultHash<string>{});
+				Assert::AreEqual(size_t(0), fullCollisions);
+			}
+		}
+
+		TEST_METHOD(Throughput)
+		{
+			const Vector<string> names = AuxiliaryAttributeNames(PrescribedAttributeNames(), 16);
+			size_t totalBytes = 0;
+			for (const string& name : names)
+			{
+				totalBytes += name.size();
+			}
+
+			size_t checksum = 0;
+			const double legacy = Benchmark::Measure(2000, [&names, &checksum]()
+			{
+				LegacyAdditiveHash hash;
+				for (const string& name : names)
+				{
+					checksum += hash(name);
+				}
+			});
+			const double current = Benchmark::Measure(2000, [&names, &checksum]()
+			{
+				DefaultHash<string> hash;
+				for (const string& name : names)
+				{
+					checksum += hash(name);
+				}
+			});
+			Benchmark::DoNotOptimize(checksum);
+
+			Benchmark::Report("Legacy additive hash (per byte)"s, legacy / totalBytes);
+			Benchmark::Report("DefaultHash (per byte)"s, current / totalBytes);
+		}
+
+	private:
+		/// <summary>
+		/// The hash DefaultHash used before it processed 8 bytes per step. Kept for comparison
+		/// </summary>
+		struct LegacyAdditiveHash final
+		{
+			size_t operator()(const string& key) const
+			{
+				const size_t PRIME = 29;
+				size_t hashValue = 0;
+				for (char c : key)
+				{
+					hashValue += static_cast<size_t>(c) * PRIME;
+				}
+				return hashValue;
+			}
+		};
+
+		// Writes collision and chain length statistics for a hash over a corpus. Returns the number of full hash collisions
+		template <typename THash>
+		static size_t Report(const string& label, const Vector<string>& corpus, THash hash)
+		{
+			Vector<size_t> hashes;
+			hashes.Reserve(corpus.Size());
+			for (const string& name : corpus)
+			{
+				hashes.PushBack(hash(name));
+			}
+
+			size_t fullCollisions = 0;
+			Vector<size_t> sortedHashes = hashes;
+			sort(sortedHashes.begin(), sortedHashes.end());
+			for (size_t i = 1; i < sortedHashes.Size(); ++i)
+			{
+				if (sortedHashes[i] == sortedHashes[i - 1])
+				{
+					++fullCollisions;
+				}
+			}
+			Benchmark::Report(label + ": "s + to_string(fullCollisions) + " full collisions"s);
+
+			// Default bucket count and one bucket per key
+			for (size_t bucketCount : { size_t(11), corpus.Size() | 1 })
+			{
+				Vector<size_t> chainLengths(bucketCount);
+				chainLengths.Resize(bucketCount);
+				for (size_t hashValue : hashes)
+				{
+					++chainLengths[hashValue % bucketCount];
+				}
+
+				size_t bucketsInUse = 0;
+				size_t longestChain = 0;
+				for (size_t chainLength : chainLengths)
+				{
+					bucketsInUse += chainLength > 0 ? 1 : 0;
+					longestChain = std::max(longestChain, chainLength);
+				}
+
+				ostringstream oss;
+				oss << "    " << bucketCount << " buckets: " << bucketsInUse << " in use, longest chain " << longestChain
+					<< ", average chain " << static_cast<double>(corpus.Size()) / bucketsInUse;
+				Benchmark::Report(oss.str());
+			}
+			return fullCollisions;
+		}
+
+		static void AddUnique(Vector<string>& names, const string& name)
+		{
+			if (names.Find(name) == names.end())
+			{
+				names.PushBack(name);
+			}
+		}
+
+		static Vector<string> PrescribedAttributeNames()
+		{
+			Vector<string> names;
+			names.Reserve(64);
+			for (const Vector<Signature>& signatures : { GameObject::AllSignatures(), ActionList::AllSignatures(), ActionIf::AllSignatures(),
+				ActionIncrement::AllSignatures(), ActionEvent::AllSignatures(), ReactionAttributed::AllSignatures(),
+				EventMessageAttributed::AllSignatures(), AttributedFoo::AllSignatures(), AttributedBar::AllSignatures() })
+			{
+				for (const Signature& signature : signatures)
+				{
+					AddUnique(names, signature.Name.Str());
+				}
+			}
+			return names;
+		}
+
+		static void CollectJsonKeys(const Json::Value& value, Vector<string>& names)
+		{
+			if (value.isObject())
+			{
+				for (const string& member : value.getMemberNames())
+				{
+					if (member != "type"s && member != "value"s && member != "class"s)
+					{
+						AddUnique(names, member);
+					}
+					CollectJsonKeys(value[member], names);
+				}
+			}
+			else if (value.isArray())
+			{
+				for (const Json::Value& element : value)
+				{
+					CollectJsonKeys(element, names);
+				}
+			}
+		}
+
+		static Vector<string> JsonAttributeNames()
+		{
+			Vector<string> names;
+			names.Reserve(64);
+			for (const string& filename : { "JsonFiles/GameObjectTest.json"s, "JsonFiles/ActionListTest.json"s, "JsonFiles/ActionIfTest.json"s,
+				"JsonFiles/ActionIncrementTest.json"s, "JsonFiles/IntegerTest.json"s })
+			{
+				ifstream file(filename);
+				Json::Value root;
+				file >> root;
+				CollectJsonKeys(root, names);
+			}
+			return names;
+		}
+
+		// Auxiliary attributes added at runtime are often a base name plus an index ("Health12", "Health21")
+		static Vector<string> AuxiliaryAttributeNames(const Vector<string>& baseNames, size_t indicesPerName)
+		{
+			Vector<string> names;
+			names.Reserve(baseNames.Size() * indicesPerName);
+			for (const string& baseName : baseNames)
+			{
+				for (size_t i = 0; i < indicesPerName; ++i)
+				{
+					names.PushBack(baseName + to_string(i));
+				}
+			}
+			return names;
+		}
+	};
+}
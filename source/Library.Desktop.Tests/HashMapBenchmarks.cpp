@@ -0,0 +1,166 @@
+#include "pch.h"
+#include "CppUnitTest.h"
+#include "Benchmark.h"
+#include "HashMap.h"
+#include "FlatHashMap.h"
+#include "Vector.h"
+#include "Scope.h"
+#include "Symbol.h"
+
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+using namespace FieaGameEngine;
+using namespace UnitTests;
+using namespace std;
+using namespace std::string_literals;
+
+namespace LibraryDesktopTests
+{
+	TEST_CLASS(HashMapBenchmarks)
+	{
+	public:
+		TEST_METHOD(ChainedVersusFlat)
+		{
+			for (size_t keyCount : { size_t(16), size_t(256), size_t(4096) })
+			{
+				const Vector<string> keys = AttributeNames(keyCount);
+				Vector<string> missingKeys;
+				missingKeys.Reserve(keys.Size());
+				for (const string& key : keys)
+				{
+					missingKeys.PushBack(key + "_"s);
+				}
+
+				Benchmark::Report("-- "s + to_string(keyCount) + " attribute-sized keys --"s);
+				RunBenchmark<HashMap<string, int32_t>>("HashMap"s, keys, missingKeys);
+				RunBenchmark<FlatHashMap<string, int32_t>>("FlatHashMap"s, keys, missingKeys);
+			}
+		}
+
+		TEST_METHOD(ScopeStringVersusSymbolKeys)
+		{
+			const Vector<string> keys = AttributeNames(64);
+			Vector<Symbol> symbols;
+			symbols.Reserve(keys.Size());
+			Scope scope;
+			for (const string& key : keys)
+			{
+				scope.Append(key);
+				symbols.PushBack(Symbol(key));
+			}
+
+			size_t found = 0;
+			const double byString = Benchmark::Measure(4096, [&scope, &keys, &found]()
+			{
+				for (const string& key : keys)
+				{
+					found += scope.Find(key) != nullptr ? 1 : 0;
+				}
+			});
+			const double bySymbol = Benchmark::Measure(4096, [&scope, &symbols, &found]()
+			{
+				for (const Symbol& symbol : symbols)
+				{
+					found += scope.Find(symbol) != nullptr ? 1 : 0;
+				}
+			});
+			Assert::AreEqual(keys.Size() * 4097 * 2, found);
+
+			const double keyCount = static_cast<double>(keys.Size());
+			Benchmark::Report("Scope Find by string (per key)"s, byString / keyCount);
+			Benchmark::Report("Scope Find by symbol (per key)"s, bySymbol / keyCount);
+			Benchmark::Report("Key bytes per attribute: "s + to_string(sizeof(string)) + " as string, "s + to_string(sizeof(Symbol)) + " as symbol"s);
+		}
+
+		TEST_METHOD(PolicyFunctors)
+		{
+			using TypeErasedHash = function<size_t(const string_view&)>;
+			using TypeErasedEquality = function<bool(const string_view&, const string_view&)>;
+			using TypeErasedMap = HashMap<string, int32_t, TypeErasedHash, TypeErasedEquality>;
+			using TypeErasedFlatMap = FlatHashMap<string, int32_t, TypeErasedHash, TypeErasedEquality>;
+
+			Benchmark::Report("-- Hash maps with inlined versus std::function policies --"s);
+			Benchmark::Report("sizeof(HashMap): "s + to_string(sizeof(HashMap<string, int32_t>)) + " inlined, "s + to_string(sizeof(TypeErasedMap)) + " std::function"s);
+			Benchmark::Report("sizeof(FlatHashMap): "s + to_string(sizeof(FlatHashMap<string, int32_t>)) + " inlined, "s + to_string(sizeof(TypeErasedFlatMap)) + " std::function"s);
+			Benchmark::Report("sizeof(Scope): "s + to_string(sizeof(Scope)));
+
+			const Vector<string> keys = AttributeNames(256);
+			Vector<string> missingKeys;
+			missingKeys.Reserve(keys.Size());
+			for (const string& key : keys)
+			{
+				missingKeys.PushBack(key + "_"s);
+			}
+			RunBenchmark<HashMap<string, int32_t>>("HashMap inlined"s, keys, missingKeys);
+			RunBenchmark<TypeErasedMap>("HashMap std::function"s, keys, missingKeys, TypeErasedMap(11, DefaultHash<string>{}, DefaultEquality<string>{}));
+			RunBenchmark<FlatHashMap<string, int32_t>>("FlatHashMap inlined"s, keys, missingKeys);
+			RunBenchmark<TypeErasedFlatMap>("FlatHashMap std::function"s, keys, missingKeys, TypeErasedFlatMap(16, DefaultHash<string>{}, DefaultEquality<string>{}));
+		}
+
+	private:
+		// Names shaped like prescribed and auxiliary attributes: short, shared prefixes
+		static Vector<string> AttributeNames(size_t count)
+		{
+			static const string baseNames[] = { "Name"s, "Transform"s, "Children"s, "Actions"s, "Reactions"s, "Position"s, "Rotation"s,
+				"Scale"s, "Condition"s, "IfBlock"s, "ElseBlock"s, "Target"s, "Step"s, "Subtype"s, "Health"s, "Velocity"s };
+
+			Vector<string> names;
+			names.Reserve(count);
+			for (size_t i = 0; i < count; ++i)
+			{
+				const string& base = baseNames[i % size(baseNames)];
+				names.PushBack(i < size(baseNames) ? base : base + to_string(i / size(baseNames)));
+			}
+			return names;
+		}
+
+		// Maps are copied from emptyMap, so maps with type-erased policies can be handed their functors
+		template <typename TMap>
+		static void RunBenchmark(const string& label, const Vector<string>& keys, const Vector<string>& missingKeys, const TMap& emptyMap = TMap{})
+		{
+			const size_t repetitions = 4096 * 16 / keys.Size() + 1;
+			const double keyCount = static_cast<double>(keys.Size());
+
+			const double insert = Benchmark::Measure(repetitions, [&keys, &emptyMap]()
+			{
+				TMap map(emptyMap);
+				for (size_t i = 0; i < keys.Size(); ++i)
+				{
+					map.Insert({ keys[i], static_cast<int32_t>(i) });
+				}
+				Benchmark::DoNotOptimize(map);
+			});
+
+			TMap map(emptyMap);
+			for (size_t i = 0; i < keys.Size(); ++i)
+			{
+				map.Insert({ keys[i], static_cast<int32_t>(i) });
+			}
+
+			int64_t checksum = 0;
+			const double findHit = Benchmark::Measure(repetitions, [&map, &keys, &checksum]()
+			{
+				for (const string& key : keys)
+				{
+					checksum += map.Find(key)->second;
+				}
+			});
+
+			size_t misses = 0;
+			const double findMiss = Benchmark::Measure(repetitions, [&map, &missingKeys, &misses]()
+			{
+				for (const string& key : missingKeys)
+				{
+					misses += map.ContainsKey(key) ? 0 : 1;
+				}
+			});
+
+			Assert::AreEqual(keys.Size(), map.Size());
+			Assert::AreEqual(missingKeys.Size() * (repetitions + 1), misses);
+			Benchmark::DoNotOptimize(checksum);
+
+			Benchmark::Report(label + " Insert (per key)"s, insert / keyCount);
+			Benchmark::Report(label + " Find hit (per key)"s, findHit / keyCount);
+			Benchmark::Report(label + " Find miss (per key)"s, findMiss / keyCount);
+		}
+	};
+}
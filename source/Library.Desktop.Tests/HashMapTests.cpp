@@ -3,6 +3,7 @@
 #include "CppUnitTest.h"
 #include "Foo.h"
 #include "HashMap.h"
+#include "CountingResource.h"
 #include "ToStringSpecializations.h"
 #include "HashSpecializations.h"
 
@@ -166,6 +167,25 @@ namespace LibraryDesktopTests
 			Assert::AreEqual(size_t(2), hashMap.Size());
 		}
 
+		TEST_METHOD(EmplaceUnique)
+		{
+			HashMap<Foo, Foo> hashMap(3);
+			for (int32_t i = 0; i < 10; ++i)
+			{
+				HashMap<Foo, Foo>::iterator it = hashMap.EmplaceUnique(Foo(i), Foo(i * 2));
+				Assert::AreEqual(Foo(i), it->first);
+				Assert::AreEqual(Foo(i * 2), it->second);
+				Assert::AreEqual(size_t(i + 1), hashMap.Size());
+			}
+
+			// Grows like Emplace and every key stays reachable
+			Assert::IsTrue(hashMap.BucketCount() > size_t(3));
+			for (int32_t i = 0; i < 10; ++i)
+			{
+				Assert::AreEqual(Foo(i * 2), hashMap.At(Foo(i)));
+			}
+		}
+
 		TEST_METHOD(OperatorBracketBracket)
 		{
 			HashMap<Foo, Foo> hashMap;
@@ -268,6 +288,34 @@ namespace LibraryDesktopTests
 			Assert::IsFalse(hashMap.ContainsKey(Foo(1)));
 		}
 
+		TEST_METHOD(HeterogeneousLookup)
+		{
+			HashMap<string, int32_t> hashMap;
+			hashMap.Insert({ "Health"s, 10 });
+			hashMap.Insert({ "Velocity"s, 20 });
+			const HashMap<string, int32_t>& constHashMap = hashMap;
+
+			// Views that are not null terminated
+			const string buffer = "HealthVelocity"s;
+			const string_view health(buffer.data(), 6);
+			const string_view velocity(buffer.data() + 6, 8);
+
+			Assert::AreEqual(10, hashMap.Find(health)->second);
+			Assert::AreEqual(20, constHashMap.Find(velocity)->second);
+			Assert::AreEqual(10, hashMap.At("Health"));
+			Assert::AreEqual(20, constHashMap.At("Velocity"));
+			Assert::IsTrue(hashMap.ContainsKey("Health"));
+			Assert::IsFalse(hashMap.ContainsKey(string_view(buffer.data(), 5)));
+			Assert::IsTrue(hashMap.Find("Health"sv) == hashMap.Find("Health"s));
+			Assert::ExpectException<runtime_error>([&hashMap]() { auto v = hashMap.At("Missing"sv); UNREFERENCED_LOCAL(v); });
+
+			// Views and strings hash the same way
+			Assert::AreEqual(DefaultHash<string>{}("Health"s), DefaultHash<string_view>{}(health));
+
+			Assert::IsTrue(hashMap.Remove(velocity));
+			Assert::IsFalse(hashMap.ContainsKey("Velocity"));
+		}
+
 		TEST_METHOD(At)
 		{
 			// Non-const
@@ -302,8 +350,151 @@ namespace LibraryDesktopTests
 			Assert::AreEqual(size_t(11), hashMap.BucketCount());
 			hashMap.Resize(29);
 			Assert::AreEqual(size_t(29), hashMap.BucketCount());
-			Assert::ExpectException<runtime_error>([&hashMap]() { hashMap.Resize(11); });
 			Assert::IsTrue(hashMap.ContainsKey(Foo(1)));
+			// Shrinking is allowed
+			hashMap.Resize(7);
+			Assert::AreEqual(size_t(7), hashMap.BucketCount());
+			Assert::IsTrue(hashMap.ContainsKey(Foo(1)));
+			Assert::ExpectException<runtime_error>([&hashMap]() { hashMap.Resize(0); });
+		}
+
+		TEST_METHOD(AutomaticGrowth)
+		{
+			HashMap<Foo, Foo> hashMap;
+			const HashMap<Foo, Foo>::PairType* firstPair = &*hashMap.Insert({ Foo(0), Foo(0) }).first;
+			for (int32_t i = 1; i < 1000; ++i)
+			{
+				hashMap.Insert({ Foo(i), Foo(i) });
+				Assert::IsTrue(hashMap.LoadFactor() <= hashMap.MaxLoadFactor());
+			}
+			Assert::AreEqual(size_t(1000), hashMap.Size());
+			Assert::IsTrue(hashMap.BucketCount() >= size_t(1000));
+			for (int32_t i = 0; i < 1000; ++i)
+			{
+				Assert::AreEqual(Foo(i), hashMap.At(Foo(i)));
+			}
+			// Rehashing relinks nodes, so pairs do not move
+			Assert::IsTrue(firstPair == &*hashMap.Find(Foo(0)));
+		}
+
+		TEST_METHOD(AutomaticShrink)
+		{
+			HashMap<Foo, Foo> hashMap(11);
+			for (int32_t i = 0; i < 1000; ++i)
+			{
+				hashMap.Insert({ Foo(i), Foo(i) });
+			}
+			const size_t grownBucketCount = hashMap.BucketCount();
+
+			// Removing never rehashes, so iterators to the other elements stay valid
+			HashMap<Foo, Foo>::iterator last = hashMap.Find(Foo(999));
+			for (int32_t i = 0; i < 990; ++i)
+			{
+				Assert::IsTrue(hashMap.Remove(Foo(i)));
+			}
+			Assert::AreEqual(grownBucketCount, hashMap.BucketCount());
+			Assert::AreEqual(Foo(999), last->first);
+			size_t visited = 0;
+			for (auto it = hashMap.begin(); it != hashMap.end(); ++it)
+			{
+				++visited;
+			}
+			Assert::AreEqual(size_t(10), visited);
+
+			// The next insert shrinks
+			hashMap.Insert({ Foo(0), Foo(0) });
+			Assert::IsTrue(hashMap.BucketCount() < grownBucketCount);
+			Assert::IsTrue(hashMap.LoadFactor() >= hashMap.MinLoadFactor());
+			for (int32_t i = 990; i < 1000; ++i)
+			{
+				Assert::AreEqual(Foo(i), hashMap.At(Foo(i)));
+			}
+
+			// Never shrinks below the constructed bucket count
+			hashMap.Remove(Foo(0));
+			for (int32_t i = 990; i < 1000; ++i)
+			{
+				hashMap.Remove(Foo(i));
+			}
+			hashMap.ShrinkToFit();
+			Assert::AreEqual(size_t(11), hashMap.BucketCount());
+
+			// Shrinking explicitly
+			for (int32_t i = 0; i < 1000; ++i)
+			{
+				hashMap.Insert({ Foo(i), Foo(i) });
+			}
+			const size_t regrownBucketCount = hashMap.BucketCount();
+			for (int32_t i = 0; i < 900; ++i)
+			{
+				hashMap.Remove(Foo(i));
+			}
+			Assert::AreEqual(regrownBucketCount, hashMap.BucketCount());
+			hashMap.ShrinkToFit();
+			Assert::IsTrue(hashMap.BucketCount() < regrownBucketCount);
+			Assert::IsTrue(hashMap.LoadFactor() <= hashMap.MaxLoadFactor());
+			Assert::AreEqual(size_t(100), hashMap.Size());
+			hashMap.Clear();
+
+			// Clear keeps the buckets
+			hashMap.Reserve(100);
+			const size_t reservedBucketCount = hashMap.BucketCount();
+			hashMap.Clear();
+			Assert::AreEqual(reservedBucketCount, hashMap.BucketCount());
+		}
+
+		TEST_METHOD(Reserve)
+		{
+			HashMap<Foo, Foo> hashMap;
+			hashMap.Insert({ Foo(1), Foo(2) });
+			hashMap.Reserve(500);
+			const size_t bucketCount = hashMap.BucketCount();
+			Assert::IsTrue(bucketCount >= size_t(500));
+			Assert::IsTrue(hashMap.ContainsKey(Foo(1)));
+
+			// No rehash while inserting up to the reserved count
+			for (int32_t i = 2; i <= 500; ++i)
+			{
+				hashMap.Insert({ Foo(i), Foo(i) });
+			}
+			Assert::AreEqual(bucketCount, hashMap.BucketCount());
+
+			// Reserving less than the current capacity does nothing
+			hashMap.Reserve(10);
+			Assert::AreEqual(bucketCount, hashMap.BucketCount());
+		}
+
+		TEST_METHOD(LoadFactorLimits)
+		{
+			HashMap<Foo, Foo> hashMap;
+			Assert::AreEqual(1.0f, hashMap.MaxLoadFactor());
+			Assert::AreEqual(0.125f, hashMap.MinLoadFactor());
+
+			Assert::ExpectException<runtime_error>([&hashMap]() { hashMap.SetMaxLoadFactor(0.0f); });
+			Assert::ExpectException<runtime_error>([&hashMap]() { hashMap.SetMaxLoadFactor(0.25f); });
+			Assert::ExpectException<runtime_error>([&hashMap]() { hashMap.SetMinLoadFactor(-1.0f); });
+			Assert::ExpectException<runtime_error>([&hashMap]() { hashMap.SetMinLoadFactor(0.5f); });
+
+			for (int32_t i = 0; i < 40; ++i)
+			{
+				hashMap.Insert({ Foo(i), Foo(i) });
+			}
+
+			// Lowering the maximum rehashes right away
+			hashMap.SetMaxLoadFactor(0.5f);
+			Assert::AreEqual(0.5f, hashMap.MaxLoadFactor());
+			Assert::IsTrue(hashMap.LoadFactor() <= 0.5f);
+
+			hashMap.SetMinLoadFactor(0.0f);
+			Assert::AreEqual(0.0f, hashMap.MinLoadFactor());
+			const size_t bucketCount = hashMap.BucketCount();
+			for (int32_t i = 0; i < 40; ++i)
+			{
+				hashMap.Remove(Foo(i));
+			}
+			hashMap.Insert({ Foo(0), Foo(0) });
+			// Shrinking disabled
+			Assert::AreEqual(bucketCount, hashMap.BucketCount());
 		}
 
 		TEST_METHOD(begin)
@@ -409,11 +600,15 @@ namespace LibraryDesktopTests
 				Assert::AreEqual(pair, *it);
 				Assert::AreEqual(pair.first, it->first);
 				++it;
+#if FIEA_CHECKED_ITERATORS
 				Assert::ExpectException<runtime_error>([&it]() { const auto& pair = *it; UNREFERENCED_LOCAL(pair); });
+#endif
 
 				// Default constructed
 				HashMap<Foo, Foo>::const_iterator defaultIt;
+#if FIEA_CHECKED_ITERATORS
 				Assert::ExpectException<runtime_error>([&defaultIt]() { const auto& pair = *defaultIt; UNREFERENCED_LOCAL(pair); });
+#endif
 			}
 
 			// ++operator
@@ -432,15 +627,21 @@ namespace LibraryDesktopTests
 				Assert::AreNotEqual(hashMap.cend(), it);
 				oldIt = ++it;
 				Assert::AreEqual(oldIt, it);
+#if FIEA_CHECKED_ITERATORS
 				Assert::ExpectException<runtime_error>([&it]() { const auto& pair = *it; UNREFERENCED_LOCAL(pair); });
+#endif
 				// Iterate past end
 				oldIt = ++it;
 				Assert::AreEqual(oldIt, it);
+#if FIEA_CHECKED_ITERATORS
 				Assert::ExpectException<runtime_error>([&it]() { const auto& pair = *it; UNREFERENCED_LOCAL(pair); });
+#endif
 
 				// Default constructed
 				HashMap<Foo, Foo>::const_iterator defaultIt;
+#if FIEA_CHECKED_ITERATORS
 				Assert::ExpectException<runtime_error>([&defaultIt]() { ++defaultIt; });
+#endif
 			}
 
 			// operator++
@@ -461,17 +662,23 @@ namespace LibraryDesktopTests
 				oldIt = it++;
 				Assert::AreNotEqual(oldIt, it);
 				Assert::AreEqual(hashMap.cend(), it);
+#if FIEA_CHECKED_ITERATORS
 				Assert::ExpectException<runtime_error>([&it]() { const auto& pair = *it; UNREFERENCED_LOCAL(pair); });
+#endif
 				// Iterate past end
 				oldIt = it++;
 				Assert::AreEqual(oldIt, it);
 				Assert::AreEqual(hashMap.cend(), it);
 				Assert::AreEqual(hashMap.cend(), oldIt);
+#if FIEA_CHECKED_ITERATORS
 				Assert::ExpectException<runtime_error>([&it]() { const auto& pair = *it; UNREFERENCED_LOCAL(pair); });
+#endif
 
 				// Default constructed
 				HashMap<Foo, Foo>::const_iterator defaultIt;
+#if FIEA_CHECKED_ITERATORS
 				Assert::ExpectException<runtime_error>([&defaultIt]() { ++defaultIt; });
+#endif
 			}
 
 			// operator== && !=
@@ -508,11 +715,15 @@ namespace LibraryDesktopTests
 				Assert::AreEqual(pair, *it);
 				Assert::AreEqual(pair.first, it->first);
 				++it;
+#if FIEA_CHECKED_ITERATORS
 				Assert::ExpectException<runtime_error>([&it]() { const auto& pair = *it; UNREFERENCED_LOCAL(pair); });
+#endif
 
 				// Default constructed
 				HashMap<Foo, Foo>::iterator defaultIt;
+#if FIEA_CHECKED_ITERATORS
 				Assert::ExpectException<runtime_error>([&defaultIt]() { const auto& pair = *defaultIt; UNREFERENCED_LOCAL(pair); });
+#endif
 			}
 
 			// ++operator
@@ -531,15 +742,21 @@ namespace LibraryDesktopTests
 				Assert::AreNotEqual(hashMap.end(), it);
 				oldIt = ++it;
 				Assert::AreEqual(oldIt, it);
+#if FIEA_CHECKED_ITERATORS
 				Assert::ExpectException<runtime_error>([&it]() { const auto& pair = *it; UNREFERENCED_LOCAL(pair); });
+#endif
 				// Iterate past end
 				oldIt = ++it;
 				Assert::AreEqual(oldIt, it);
+#if FIEA_CHECKED_ITERATORS
 				Assert::ExpectException<runtime_error>([&it]() { const auto& pair = *it; UNREFERENCED_LOCAL(pair); });
+#endif
 
 				// Default constructed
 				HashMap<Foo, Foo>::iterator defaultIt;
+#if FIEA_CHECKED_ITERATORS
 				Assert::ExpectException<runtime_error>([&defaultIt]() { ++defaultIt; });
+#endif
 			}
 
 			// operator++
@@ -560,17 +777,23 @@ namespace LibraryDesktopTests
 				oldIt = it++;
 				Assert::AreNotEqual(oldIt, it);
 				Assert::AreEqual(hashMap.end(), it);
+#if FIEA_CHECKED_ITERATORS
 				Assert::ExpectException<runtime_error>([&it]() { const auto& pair = *it; UNREFERENCED_LOCAL(pair); });
+#endif
 				// Iterate past end
 				oldIt = it++;
 				Assert::AreEqual(oldIt, it);
 				Assert::AreEqual(hashMap.end(), it);
 				Assert::AreEqual(hashMap.end(), oldIt);
+#if FIEA_CHECKED_ITERATORS
 				Assert::ExpectException<runtime_error>([&it]() { const auto& pair = *it; UNREFERENCED_LOCAL(pair); });
+#endif
 
 				// Default constructed
 				HashMap<Foo, Foo>::iterator defaultIt;
+#if FIEA_CHECKED_ITERATORS
 				Assert::ExpectException<runtime_error>([&defaultIt]() { ++defaultIt; });
+#endif
 			}
 
 			// operator== && !=
@@ -596,7 +819,90 @@ namespace LibraryDesktopTests
 			}
 		}
 
+
+		TEST_METHOD(MemoryResource)
+		{
+			CountingResource resource;
+			CountingResource otherResource;
+			{
+				HashMap<Foo, Foo> hashMap(&resource, 3);
+				Assert::IsTrue(hashMap.GetAllocator().resource() == &resource);
+				for (int32_t i = 0; i < 20; ++i)
+				{
+					hashMap.Insert({ Foo(i), Foo(i * 2) });
+				}
+
+				// Growing splices nodes between buckets of the same resource
+				Assert::IsTrue(hashMap.BucketCount() > size_t(3));
+				Assert::IsTrue(resource.BytesInUse > 0);
+				for (int32_t i = 0; i < 20; ++i)
+				{
+					Assert::AreEqual(Foo(i * 2), hashMap.At(Foo(i)));
+				}
+
+				// Assignment keeps each map on its own resource
+				HashMap<Foo, Foo> other(&otherResource);
+				other = hashMap;
+				Assert::IsTrue(other.GetAllocator().resource() == &otherResource);
+				Assert::AreEqual(size_t(20), other.Size());
+				const size_t bytesInUse = resource.BytesInUse;
+				other = std::move(hashMap);
+				Assert::AreEqual(bytesInUse, resource.BytesInUse);
+				other.Insert({ Foo(20), Foo(40) });
+				Assert::AreEqual(Foo(40), other.At(Foo(20)));
+
+				HashMap<Foo, Foo> copy(other, &resource);
+				Assert::AreEqual(size_t(21), copy.Size());
+				Assert::AreEqual(Foo(38), copy.At(Foo(19)));
+			}
+			Assert::AreEqual(size_t(0), resource.BytesInUse);
+			Assert::AreEqual(size_t(0), otherResource.BytesInUse);
+		}
+
+		TEST_METHOD(Policies)
+		{
+			// Stateless policies take no space; type-erased ones carry their std::function storage
+			using TypeErasedMap = HashMap<string, int32_t, function<size_t(const string_view&)>, function<bool(const string_view&, const string_view&)>>;
+			Assert::IsTrue(sizeof(HashMap<string, int32_t>) < sizeof(TypeErasedMap));
+
+			HashMap<string, int32_t, CaseInsensitiveHash, CaseInsensitiveEquality> hashMap;
+			hashMap.Insert({ "Health"s, 10 });
+			hashMap.Insert({ "HEALTH"s, 20 });
+			Assert::AreEqual(size_t(1), hashMap.Size());
+			Assert::AreEqual(10, hashMap.At("health"sv));
+			Assert::IsTrue(hashMap.ContainsKey("hEaLtH"sv));
+
+			TypeErasedMap typeErased(11, DefaultHash<string>{}, DefaultEquality<string>{});
+			typeErased.Insert({ "Health"s, 10 });
+			Assert::AreEqual(10, typeErased.At("Health"sv));
+			Assert::IsFalse(typeErased.ContainsKey("health"sv));
+		}
+
 	private:
+		struct CaseInsensitiveHash final
+		{
+			size_t operator()(string_view key) const
+			{
+				size_t hash = 0;
+				for (char c : key)
+				{
+					hash = hash * 31 + static_cast<size_t>(tolower(static_cast<unsigned char>(c)));
+				}
+				return hash;
+			}
+		};
+
+		struct CaseInsensitiveEquality final
+		{
+			bool operator()(string_view lhs, string_view rhs) const
+			{
+				return lhs.size() == rhs.size() && equal(lhs.begin(), lhs.end(), rhs.begin(), [](char a, char b)
+				{
+					return tolower(static_cast<unsigned char>(a)) == tolower(static_cast<unsigned char>(b));
+				});
+			}
+		};
+
 		inline static _CrtMemState _startMemState;
 	};
 }
\ No newline at end of file
@@ -8,7 +8,7 @@ namespace FieaGameEngine
 	template <>
 	struct DefaultHash<UnitTests::Foo>
 	{
-		size_t operator()(const UnitTests::Foo& key)
+		size_t operator()(const UnitTests::Foo& key) const
 		{
 			return static_cast<size_t>(key.Data());
 		}
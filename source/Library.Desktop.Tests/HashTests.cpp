@@ -93,6 +93,27 @@ namespace LibraryDesktopTests
 			Assert::AreNotEqual(hashValueA, hashValueB);
 			Assert::AreNotEqual(hashValueB, hashValueC);
 		}
+
+		TEST_METHOD(StringOrderSensitive)
+		{
+			DefaultHash<string> defaultHash;
+			Assert::AreNotEqual(defaultHash("Position"s), defaultHash("Positoin"s));
+			Assert::AreNotEqual(defaultHash("Health12"s), defaultHash("Health21"s));
+			Assert::AreNotEqual(defaultHash("ab"s), defaultHash("ba"s));
+			// Differ only past the first 8 byte block
+			Assert::AreNotEqual(defaultHash("ExternalIntegerArray"s), defaultHash("ExternalIntegerArrax"s));
+			Assert::AreNotEqual(defaultHash(""s), defaultHash(string(1, '\0')));
+		}
+
+		TEST_METHOD(CharArrayMatchesString)
+		{
+			DefaultHash<const char*> charArrayHash;
+			DefaultHash<string> stringHash;
+			for (const char* key : { "", "A", "Name", "Transform", "ExternalIntegerArray" })
+			{
+				Assert::AreEqual(stringHash(string(key)), charArrayHash(key));
+			}
+		}
 	private:
 		inline static _CrtMemState _startMemState;
 	};
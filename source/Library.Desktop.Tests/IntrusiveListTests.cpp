@@ -0,0 +1,280 @@
+#include "pch.h"
+#include "CppUnitTest.h"
+#include <cstdint>
+#include "IntrusiveList.h"
+#include "Vector.h"
+#include "ToStringSpecializations.h"
+
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+using namespace FieaGameEngine;
+using namespace UnitTests;
+using namespace std;
+using namespace std::string_literals;
+
+namespace LibraryDesktopTests
+{
+	TEST_CLASS(IntrusiveListTests)
+	{
+		struct SecondList;
+
+		struct Element final : IntrusiveListHook<>
+		{
+			explicit Element(int32_t value = 0) : Value(value) {}
+			int32_t Value;
+		};
+
+		// Can be in one list of each kind at the same time
+		struct DualElement final : IntrusiveListHook<>, IntrusiveListHook<SecondList>
+		{
+			explicit DualElement(int32_t value = 0) : Value(value) {}
+			int32_t Value;
+		};
+
+		template <typename TList>
+		static bool HasValues(const TList& list, initializer_list<int32_t> expected)
+		{
+			return equal(list.begin(), list.end(), expected.begin(), expected.end(), [](const auto& element, int32_t value) { return element.Value == value; });
+		}
+
+	public:
+		TEST_METHOD_INITIALIZE(Initialize)
+		{
+#if defined(DEBUG) || defined(_DEBUG)
+			_CrtSetDbgFlag(_CRTDBG_ALLOC_MEM_DF);
+			_CrtMemCheckpoint(&_startMemState);
+#endif
+		}
+
+		TEST_METHOD_CLEANUP(Cleanup)
+		{
+#if defined(DEBUG) || defined(_DEBUG)
+			_CrtMemState endMemState, diffMemState;
+			_CrtMemCheckpoint(&endMemState);
+			if (_CrtMemDifference(&diffMemState, &_startMemState,
+				&endMemState))
+			{
+				_CrtMemDumpStatistics(&diffMemState);
+				Assert::Fail(L"Memory Leaks!");
+			}
+#endif
+		}
+
+		TEST_METHOD(Constructor)
+		{
+			IntrusiveList<Element> list;
+			Assert::IsTrue(list.IsEmpty());
+			Assert::AreEqual(size_t(0), list.Size());
+			Assert::IsTrue(list.begin() == list.end());
+			Assert::ExpectException<runtime_error>([&list]() { auto& front = list.Front(); UNREFERENCED_LOCAL(front); });
+			Assert::ExpectException<runtime_error>([&list]() { auto& back = list.Back(); UNREFERENCED_LOCAL(back); });
+			Assert::ExpectException<runtime_error>([&list]() { list.PopFront(); });
+			Assert::ExpectException<runtime_error>([&list]() { list.PopBack(); });
+		}
+
+		TEST_METHOD(PushAndPop)
+		{
+			Element a(1);
+			Element b(2);
+			Element c(3);
+			IntrusiveList<Element> list;
+
+			Assert::IsTrue(&*list.PushBack(b) == &b);
+			list.PushFront(a);
+			list.PushBack(c);
+			Assert::IsTrue(a.IsLinked());
+			Assert::AreEqual(size_t(3), list.Size());
+			Assert::IsTrue(&list.Front() == &a);
+			Assert::IsTrue(&list.Back() == &c);
+			Assert::IsTrue(HasValues(list, { 1, 2, 3 }));
+
+			// An element is in at most one list per hook
+			IntrusiveList<Element> other;
+			Assert::ExpectException<runtime_error>([&other, &a]() { other.PushBack(a); });
+
+			list.PopFront();
+			Assert::IsFalse(a.IsLinked());
+			list.PopBack();
+			Assert::IsFalse(c.IsLinked());
+			Assert::IsTrue(HasValues(list, { 2 }));
+
+			const IntrusiveList<Element>& constList = list;
+			Assert::AreEqual(2, constList.Front().Value);
+			Assert::AreEqual(2, constList.Back().Value);
+
+			// Unlinked elements can join another list
+			other.PushBack(a);
+			Assert::IsTrue(&other.Front() == &a);
+		}
+
+		TEST_METHOD(Remove)
+		{
+			Element elements[5] = { Element(0), Element(1), Element(2), Element(3), Element(4) };
+			IntrusiveList<Element> list;
+			for (Element& element : elements)
+			{
+				list.PushBack(element);
+			}
+
+			Assert::IsTrue(list.Remove(elements[2]));
+			Assert::IsFalse(list.Remove(elements[2]));
+			Assert::IsTrue(HasValues(list, { 0, 1, 3, 4 }));
+
+			// Unlinking through the hook needs no list
+			elements[0].Unlink();
+			list.Remove(elements[4]);
+			Assert::IsTrue(HasValues(list, { 1, 3 }));
+
+			list.InsertBefore(++list.begin(), elements[2]);
+			list.InsertBefore(list.end(), elements[4]);
+			Assert::IsTrue(HasValues(list, { 1, 2, 3, 4 }));
+
+			list.Clear();
+			Assert::IsTrue(list.IsEmpty());
+			for (const Element& element : elements)
+			{
+				Assert::IsFalse(element.IsLinked());
+			}
+		}
+
+		TEST_METHOD(AutoUnlink)
+		{
+			IntrusiveList<Element> list;
+			Element first(1);
+			{
+				Element second(2);
+				list.PushBack(first);
+				list.PushBack(second);
+				Element third(3);
+				list.PushBack(third);
+				Assert::AreEqual(size_t(3), list.Size());
+			}
+			// Destroyed elements leave the list
+			Assert::IsTrue(HasValues(list, { 1 }));
+
+			// Destroying the list unlinks the elements that outlive it
+			{
+				Element outlives(4);
+				{
+					IntrusiveList<Element> shortLived;
+					shortLived.PushBack(outlives);
+				}
+				Assert::IsFalse(outlives.IsLinked());
+			}
+		}
+
+		TEST_METHOD(CopyAndMove)
+		{
+			Element a(1);
+			Element b(2);
+			IntrusiveList<Element> list;
+			list.PushBack(a);
+			list.PushBack(b);
+
+			// Copies of elements start out unlinked, and assigning keeps the destination's links
+			Element copy(a);
+			Assert::IsFalse(copy.IsLinked());
+			Element assigned(3);
+			assigned = a;
+			Assert::IsFalse(assigned.IsLinked());
+			a = Element(9);
+			Assert::IsTrue(a.IsLinked());
+
+			IntrusiveList<Element> moved(std::move(list));
+#pragma warning(push)
+#pragma warning(disable:26800)
+			Assert::IsTrue(list.IsEmpty());
+#pragma warning(pop)
+			Assert::IsTrue(HasValues(moved, { 9, 2 }));
+
+			IntrusiveList<Element> assignedList;
+			Element c(3);
+			assignedList.PushBack(c);
+			assignedList = std::move(moved);
+			Assert::IsFalse(c.IsLinked());
+			Assert::IsTrue(HasValues(assignedList, { 9, 2 }));
+
+			// Lists can live in containers that move them around
+			Vector<IntrusiveList<Element>> lists;
+			lists.EmplaceBack();
+			lists[0].PushBack(c);
+			for (int32_t i = 0; i < 32; ++i)
+			{
+				lists.EmplaceBack();
+			}
+			Assert::IsTrue(&lists[0].Front() == &c);
+			lists[0].PopFront();
+			Assert::IsFalse(c.IsLinked());
+		}
+
+		TEST_METHOD(Iterators)
+		{
+			Element a(1);
+			Element b(2);
+			Element c(3);
+			IntrusiveList<Element> list;
+			list.PushBack(a);
+			list.PushBack(b);
+			list.PushBack(c);
+
+			IntrusiveList<Element>::iterator it = list.begin();
+			Assert::AreEqual(1, it->Value);
+			Assert::AreEqual(1, (it++)->Value);
+			Assert::AreEqual(3, (++it)->Value);
+			Assert::AreEqual(3, (it--)->Value);
+			Assert::AreEqual(1, (--it)->Value);
+			(*it).Value = 10;
+			Assert::AreEqual(10, a.Value);
+
+			IntrusiveList<Element>::const_iterator constIt = list.begin();
+			Assert::IsTrue(constIt == list.cbegin());
+			Assert::AreEqual(10, (*constIt).Value);
+			Assert::AreEqual(10, (constIt++)->Value);
+			Assert::AreEqual(3, (++constIt)->Value);
+			Assert::AreEqual(3, (constIt--)->Value);
+			Assert::AreEqual(10, (--constIt)->Value);
+			Assert::IsTrue(--list.cend() == IntrusiveList<Element>::const_iterator(--list.end()));
+
+			// Reverse iteration through the sentinel
+			Vector<int32_t> reversed;
+			for (auto reverse = list.end(); reverse != list.begin();)
+			{
+				reversed.PushBack((--reverse)->Value);
+			}
+			const int32_t expected[] = { 3, 2, 10 };
+			Assert::IsTrue(equal(reversed.begin(), reversed.end(), begin(expected), end(expected)));
+
+#if FIEA_CHECKED_ITERATORS
+			const IntrusiveList<Element>& constList = list;
+			Assert::ExpectException<runtime_error>([&list]() { auto& value = *list.end(); UNREFERENCED_LOCAL(value); });
+			Assert::ExpectException<runtime_error>([&constList]() { auto& value = *constList.end(); UNREFERENCED_LOCAL(value); });
+			Assert::ExpectException<runtime_error>([]() { IntrusiveList<Element>::iterator unassociated; ++unassociated; });
+			Assert::ExpectException<runtime_error>([]() { IntrusiveList<Element>::const_iterator unassociated; --unassociated; });
+			IntrusiveList<Element> other;
+			Assert::ExpectException<runtime_error>([&list, &other, &a]() { list.InsertBefore(other.end(), a); });
+#endif
+		}
+
+		TEST_METHOD(MultipleHooks)
+		{
+			DualElement a(1);
+			DualElement b(2);
+			IntrusiveList<DualElement> first;
+			IntrusiveList<DualElement, SecondList> second;
+			first.PushBack(a);
+			first.PushBack(b);
+			second.PushBack(b);
+			second.PushBack(a);
+
+			Assert::IsTrue(HasValues(first, { 1, 2 }));
+			Assert::IsTrue(HasValues(second, { 2, 1 }));
+
+			second.Remove(a);
+			Assert::IsTrue(a.IntrusiveListHook<>::IsLinked());
+			Assert::IsFalse(a.IntrusiveListHook<SecondList>::IsLinked());
+			Assert::IsTrue(HasValues(first, { 1, 2 }));
+		}
+
+	private:
+		inline static _CrtMemState _startMemState;
+	};
+}
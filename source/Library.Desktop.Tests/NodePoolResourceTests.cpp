@@ -0,0 +1,257 @@
+#include "pch.h"
+#include "CppUnitTest.h"
+#include <cstdint>
+#include "Foo.h"
+#include "SList.h"
+#include "HashMap.h"
+#include "UnrolledSList.h"
+#include "NodePoolResource.h"
+#include "CountingResource.h"
+#include "ToStringSpecializations.h"
+
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+using namespace FieaGameEngine;
+using namespace UnitTests;
+using namespace std;
+using namespace std::string_literals;
+
+namespace LibraryDesktopTests
+{
+	TEST_CLASS(NodePoolResourceTests)
+	{
+	public:
+		TEST_METHOD_INITIALIZE(Initialize)
+		{
+#if defined(DEBUG) || defined(_DEBUG)
+			_CrtSetDbgFlag(_CRTDBG_ALLOC_MEM_DF);
+			_CrtMemCheckpoint(&_startMemState);
+#endif
+		}
+
+		TEST_METHOD_CLEANUP(Cleanup)
+		{
+#if defined(DEBUG) || defined(_DEBUG)
+			_CrtMemState endMemState, diffMemState;
+			_CrtMemCheckpoint(&endMemState);
+			if (_CrtMemDifference(&diffMemState, &_startMemState,
+				&endMemState))
+			{
+				_CrtMemDumpStatistics(&diffMemState);
+				Assert::Fail(L"Memory Leaks!");
+			}
+#endif
+		}
+
+		TEST_METHOD(Constructor)
+		{
+			CountingResource upstream;
+			{
+				NodePoolResource pool(24, 8, 16, &upstream);
+				Assert::AreEqual(size_t(24), pool.NodeSize());
+				Assert::AreEqual(size_t(0), pool.SlabCount());
+				Assert::AreEqual(size_t(0), pool.NodesInUse());
+				Assert::IsTrue(pool.Upstream() == &upstream);
+				Assert::AreEqual(size_t(0), upstream.Allocations);
+			}
+
+			Assert::ExpectException<runtime_error>([]() { NodePoolResource pool(0); });
+			Assert::ExpectException<runtime_error>([]() { NodePoolResource pool(16, 8, 0); });
+			Assert::ExpectException<runtime_error>([]() { NodePoolResource pool(16, 12); });
+			Assert::ExpectException<runtime_error>([]() { NodePoolResource pool(16, 8, 16, nullptr); });
+		}
+
+		TEST_METHOD(AllocateAndReuse)
+		{
+			CountingResource upstream;
+			{
+				NodePoolResource pool(24, 8, 4, &upstream);
+
+				void* nodes[4];
+				for (void*& node : nodes)
+				{
+					node = pool.allocate(24, 8);
+					Assert::IsTrue(node != nullptr);
+					Assert::AreEqual(uintptr_t(0), reinterpret_cast<uintptr_t>(node) % 8);
+				}
+				Assert::AreEqual(size_t(1), pool.SlabCount());
+				Assert::AreEqual(size_t(4), pool.NodesInUse());
+				Assert::AreEqual(size_t(1), upstream.Allocations);
+
+				// Nodes of one slab are distinct
+				for (size_t i = 1; i < 4; ++i)
+				{
+					Assert::IsTrue(nodes[i] != nodes[i - 1]);
+				}
+
+				// Released nodes are handed out again before a new slab is carved
+				pool.deallocate(nodes[2], 24, 8);
+				Assert::AreEqual(size_t(3), pool.NodesInUse());
+				void* reused = pool.allocate(16, 8);
+				Assert::IsTrue(reused == nodes[2]);
+				Assert::AreEqual(size_t(1), pool.SlabCount());
+
+				void* fifth = pool.allocate(24, 8);
+				Assert::AreEqual(size_t(2), pool.SlabCount());
+				Assert::AreEqual(size_t(2), upstream.Allocations);
+				pool.deallocate(fifth, 24, 8);
+
+				pool.Release();
+				Assert::AreEqual(size_t(0), pool.SlabCount());
+				Assert::AreEqual(size_t(0), pool.NodesInUse());
+				Assert::AreEqual(size_t(0), upstream.BytesInUse);
+
+				// The pool can be used again after a release
+				void* again = pool.allocate(24, 8);
+				Assert::AreEqual(size_t(1), pool.SlabCount());
+				pool.deallocate(again, 24, 8);
+			}
+			Assert::AreEqual(size_t(0), upstream.BytesInUse);
+			Assert::AreEqual(upstream.Allocations, upstream.Deallocations);
+		}
+
+		TEST_METHOD(OversizedRequests)
+		{
+			CountingResource upstream;
+			{
+				NodePoolResource pool(16, 8, 8, &upstream);
+
+				void* large = pool.allocate(256, 8);
+				Assert::AreEqual(size_t(0), pool.SlabCount());
+				Assert::AreEqual(size_t(0), pool.NodesInUse());
+				Assert::AreEqual(size_t(256), upstream.BytesInUse);
+				pool.deallocate(large, 256, 8);
+				Assert::AreEqual(size_t(0), upstream.BytesInUse);
+
+				void* overaligned = pool.allocate(16, 64);
+				Assert::AreEqual(uintptr_t(0), reinterpret_cast<uintptr_t>(overaligned) % 64);
+				Assert::AreEqual(size_t(0), pool.SlabCount());
+				pool.deallocate(overaligned, 16, 64);
+			}
+			Assert::AreEqual(size_t(0), upstream.BytesInUse);
+		}
+
+		TEST_METHOD(Equality)
+		{
+			NodePoolResource pool(16);
+			NodePoolResource otherPool(16);
+			Assert::IsTrue(pool.is_equal(pool));
+			Assert::IsFalse(pool.is_equal(otherPool));
+		}
+
+		TEST_METHOD(SListOnPool)
+		{
+			CountingResource upstream;
+			{
+				NodePoolResource pool(SList<Foo>::NodeSize, SList<Foo>::NodeAlignment, 16, &upstream);
+				SList<Foo> list(&pool);
+				for (int32_t i = 0; i < 40; ++i)
+				{
+					list.PushBack(Foo(i));
+				}
+				Assert::AreEqual(size_t(40), pool.NodesInUse());
+				Assert::AreEqual(size_t(3), pool.SlabCount());
+
+				int32_t expected = 0;
+				for (const Foo& foo : list)
+				{
+					Assert::AreEqual(Foo(expected++), foo);
+				}
+
+				// Popped nodes are recycled by the next pushes
+				for (int32_t i = 0; i < 10; ++i)
+				{
+					list.PopFront();
+				}
+				for (int32_t i = 0; i < 10; ++i)
+				{
+					list.PushFront(Foo(i));
+				}
+				Assert::AreEqual(size_t(3), pool.SlabCount());
+				Assert::AreEqual(size_t(3), upstream.Allocations);
+
+				SList<Foo> copy(list, &pool);
+				Assert::AreEqual(size_t(80), pool.NodesInUse());
+				list.Clear();
+				Assert::AreEqual(size_t(40), pool.NodesInUse());
+				Assert::AreEqual(Foo(39), copy.Back());
+			}
+			Assert::AreEqual(size_t(0), upstream.BytesInUse);
+		}
+
+		TEST_METHOD(HashMapOnPool)
+		{
+			using Map = HashMap<int32_t, Foo>;
+
+			CountingResource upstream;
+			{
+				NodePoolResource pool(Map::NodeSize, Map::NodeAlignment, 32, &upstream);
+				Map map(&pool, 256);
+				const size_t bucketAllocations = upstream.Allocations;
+				for (int32_t i = 0; i < 100; ++i)
+				{
+					map.Insert({ i, Foo(i) });
+				}
+				Assert::AreEqual(size_t(100), pool.NodesInUse());
+				Assert::AreEqual(size_t(4), pool.SlabCount());
+
+				// Chain nodes only reach the upstream resource a slab at a time
+				Assert::AreEqual(bucketAllocations + pool.SlabCount(), upstream.Allocations);
+
+				for (int32_t i = 0; i < 100; i += 2)
+				{
+					map.Remove(i);
+				}
+				Assert::AreEqual(size_t(50), pool.NodesInUse());
+				Assert::AreEqual(Foo(51), map.At(51));
+			}
+			Assert::AreEqual(size_t(0), upstream.BytesInUse);
+		}
+
+		TEST_METHOD(UnrolledSListOnPool)
+		{
+			using List = UnrolledSList<int32_t, 8>;
+
+			CountingResource upstream;
+			{
+				NodePoolResource pool(List::NodeSize, List::NodeAlignment, 4, &upstream);
+				List list(&pool);
+				for (int32_t i = 0; i < 64; ++i)
+				{
+					list.PushBack(i);
+				}
+				Assert::AreEqual(size_t(8), pool.NodesInUse());
+				Assert::AreEqual(size_t(2), pool.SlabCount());
+			}
+			Assert::AreEqual(size_t(0), upstream.BytesInUse);
+		}
+
+		TEST_METHOD(ThreadNodePool)
+		{
+			NodePoolResource& pool = SList<Foo>::ThreadNodePool();
+			Assert::IsTrue(&pool == &SList<Foo>::ThreadNodePool());
+			Assert::AreEqual(SList<Foo>::NodeSize, pool.NodeSize());
+			{
+				SList<Foo> list(&pool);
+				SList<Foo> otherList(&pool);
+				for (int32_t i = 0; i < 8; ++i)
+				{
+					list.PushBack(Foo(i));
+					otherList.PushFront(Foo(i));
+				}
+				Assert::AreEqual(size_t(16), pool.NodesInUse());
+
+				// Lists on the same pool share an allocator, so moves relink nodes
+				list = std::move(otherList);
+				Assert::AreEqual(size_t(8), pool.NodesInUse());
+				Assert::AreEqual(Foo(7), list.Front());
+			}
+			Assert::AreEqual(size_t(0), pool.NodesInUse());
+
+			// Slabs otherwise live until the thread exits
+			pool.Release();
+		}
+
+	private:
+		inline static _CrtMemState _startMemState;
+	};
+}
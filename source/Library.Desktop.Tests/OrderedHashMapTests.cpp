@@ -0,0 +1,359 @@
+#include "pch.h"
+#include "CppUnitTest.h"
+#include "Foo.h"
+#include "OrderedHashMap.h"
+#include "CountingResource.h"
+#include "ToStringSpecializations.h"
+#include "HashSpecializations.h"
+
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+using namespace FieaGameEngine;
+using namespace UnitTests;
+using namespace std;
+using namespace std::string_literals;
+
+namespace LibraryDesktopTests
+{
+	TEST_CLASS(OrderedHashMapTests)
+	{
+		using Map = OrderedHashMap<Foo, Foo>;
+
+		// Keys are appended as 0, 1, 2... with values ten times the key
+		template <typename TMap>
+		static void Fill(TMap& map, int32_t count)
+		{
+			for (int32_t i = 0; i < count; ++i)
+			{
+				map.Emplace(Foo(i), i * 10);
+			}
+		}
+
+		static bool IsInInsertionOrder(const Map& map, int32_t count)
+		{
+			int32_t expected = 0;
+			for (const auto& [key, value] : map)
+			{
+				if (key.Data() != expected || value.Data() != expected * 10)
+				{
+					return false;
+				}
+				++expected;
+			}
+			return expected == count;
+		}
+
+	public:
+		TEST_METHOD_INITIALIZE(Initialize)
+		{
+#if defined(DEBUG) || defined(_DEBUG)
+			_CrtSetDbgFlag(_CRTDBG_ALLOC_MEM_DF);
+			_CrtMemCheckpoint(&_startMemState);
+#endif
+		}
+
+		TEST_METHOD_CLEANUP(Cleanup)
+		{
+#if defined(DEBUG) || defined(_DEBUG)
+			_CrtMemState endMemState, diffMemState;
+			_CrtMemCheckpoint(&endMemState);
+			if (_CrtMemDifference(&diffMemState, &_startMemState,
+				&endMemState))
+			{
+				_CrtMemDumpStatistics(&diffMemState);
+				Assert::Fail(L"Memory Leaks!");
+			}
+#endif
+		}
+
+		TEST_METHOD(Constructor)
+		{
+			{
+				const Map map;
+				Assert::AreEqual(size_t(0), map.Size());
+				Assert::AreEqual(size_t(0), map.Capacity());
+				Assert::IsTrue(map.IsEmpty());
+				Assert::IsTrue(map.begin() == map.end());
+				Assert::IsNull(map.Find(Foo(1)));
+			}
+
+			{
+				const Map map(20);
+				Assert::AreEqual(size_t(20), map.Capacity());
+				Assert::IsTrue(map.IsEmpty());
+			}
+		}
+
+		TEST_METHOD(Emplace)
+		{
+			Map map;
+			auto [entry, wasInserted] = map.Emplace(Foo(1), 10);
+			Assert::IsTrue(wasInserted);
+			Assert::AreEqual(Foo(1), entry->first);
+			Assert::AreEqual(Foo(10), entry->second);
+
+			// Existing keys are returned without constructing a value
+			auto [existing, wasInsertedAgain] = map.Emplace(Foo(1), 20);
+			Assert::IsFalse(wasInsertedAgain);
+			Assert::IsTrue(entry == existing);
+			Assert::AreEqual(Foo(10), existing->second);
+
+			Map::PairType& unique = map.EmplaceUnique(Foo(2));
+			Assert::AreEqual(Foo(0), unique.second);
+			Assert::AreEqual(size_t(2), map.Size());
+		}
+
+		TEST_METHOD(Find)
+		{
+			Map map;
+			Fill(map, 100);
+			const Map& constMap = map;
+			for (int32_t i = 0; i < 100; ++i)
+			{
+				Map::PairType* entry = map.Find(Foo(i));
+				Assert::IsNotNull(entry);
+				Assert::AreEqual(Foo(i * 10), entry->second);
+				Assert::IsTrue(entry == constMap.Find(Foo(i)));
+				Assert::IsTrue(map.ContainsKey(Foo(i)));
+				Assert::AreEqual(Foo(i * 10), map.At(Foo(i)));
+				Assert::AreEqual(Foo(i * 10), constMap.At(Foo(i)));
+			}
+			Assert::IsNull(map.Find(Foo(100)));
+			Assert::IsNull(constMap.Find(Foo(-1)));
+			Assert::IsFalse(map.ContainsKey(Foo(100)));
+			Assert::ExpectException<runtime_error>([&map]() { auto& value = map.At(Foo(100)); UNREFERENCED_LOCAL(value); });
+			Assert::ExpectException<runtime_error>([&constMap]() { auto& value = constMap.At(Foo(100)); UNREFERENCED_LOCAL(value); });
+		}
+
+		TEST_METHOD(EntryAt)
+		{
+			Map map;
+			Fill(map, 40);
+			const Map& constMap = map;
+			for (int32_t i = 0; i < 40; ++i)
+			{
+				Assert::AreEqual(Foo(i), map.EntryAt(i).first);
+				Assert::AreEqual(Foo(i * 10), constMap.EntryAt(i).second);
+				Assert::AreEqual(static_cast<size_t>(i), constMap.IndexOf(Foo(i)));
+			}
+			Assert::AreEqual(map.Size(), map.IndexOf(Foo(40)));
+			Assert::AreEqual(size_t(0), Map().IndexOf(Foo(0)));
+			Assert::ExpectException<runtime_error>([&map]() { auto& entry = map.EntryAt(40); UNREFERENCED_LOCAL(entry); });
+			Assert::ExpectException<runtime_error>([&constMap]() { auto& entry = constMap.EntryAt(40); UNREFERENCED_LOCAL(entry); });
+		}
+
+		TEST_METHOD(Growth)
+		{
+			Map map;
+			map.Emplace(Foo(0), 0);
+			Map::PairType* first = map.Find(Foo(0));
+			Fill(map, 1000);
+
+			// Growing adds segments, so entries never move
+			Assert::IsTrue(first == map.Find(Foo(0)));
+			Assert::AreEqual(size_t(1000), map.Size());
+			Assert::IsTrue(map.Capacity() >= map.Size());
+			Assert::IsTrue(IsInInsertionOrder(map, 1000));
+			for (int32_t i = 0; i < 1000; ++i)
+			{
+				Assert::AreEqual(Foo(i * 10), map.At(Foo(i)));
+			}
+		}
+
+		TEST_METHOD(LinearSearch)
+		{
+			// Every other key has the same hash, so both the scan and the probe have to compare keys
+			struct CollidingHash final
+			{
+				size_t operator()(const Foo& key) const
+				{
+					return static_cast<size_t>(key.Data() % 2);
+				}
+			};
+
+			// Scans until the capacity passes the threshold, then hashes
+			OrderedHashMap<Foo, Foo, CollidingHash> colliding;
+			for (int32_t i = 0; i < 40; ++i)
+			{
+				Assert::IsTrue(colliding.Emplace(Foo(i), i * 10).second);
+				for (int32_t j = 0; j <= i; ++j)
+				{
+					Assert::AreEqual(Foo(j * 10), colliding.At(Foo(j)));
+				}
+				Assert::IsFalse(colliding.ContainsKey(Foo(i + 1)));
+				Assert::IsFalse(colliding.Emplace(Foo(i), 0).second);
+			}
+
+			// Copies scan or hash by their own capacity
+			OrderedHashMap<Foo, Foo, CollidingHash> reserved(40);
+			Fill(reserved, 10);
+			OrderedHashMap<Foo, Foo, CollidingHash> reservedCopy(reserved);
+			Assert::AreEqual(size_t(10), reservedCopy.Capacity());
+			Assert::AreEqual(Foo(70), reservedCopy.At(Foo(7)));
+			Assert::IsNull(reservedCopy.Find(Foo(10)));
+			OrderedHashMap<Foo, Foo, CollidingHash> tinyCopy;
+			tinyCopy.Emplace(Foo(7), 70);
+			tinyCopy = OrderedHashMap<Foo, Foo, CollidingHash>(tinyCopy);
+			Assert::AreEqual(Foo(70), tinyCopy.At(Foo(7)));
+
+			// Never scanning
+			OrderedHashMap<Foo, Foo, DefaultHash<Foo>, DefaultEquality<Foo>, 0> hashed;
+			for (int32_t i = 0; i < 10; ++i)
+			{
+				hashed.Emplace(Foo(i), i * 10);
+			}
+			Assert::AreEqual(Foo(90), hashed.At(Foo(9)));
+			Assert::IsNull(hashed.Find(Foo(10)));
+		}
+
+		TEST_METHOD(Reserve)
+		{
+			CountingResource resource;
+			{
+				Map map(&resource);
+				Assert::AreEqual(size_t(0), resource.Allocations);
+
+				// The reserved capacity is one segment plus the index
+				map.Reserve(50);
+				Assert::AreEqual(size_t(50), map.Capacity());
+				Assert::AreEqual(size_t(2), resource.Allocations);
+				Fill(map, 50);
+				Assert::AreEqual(size_t(2), resource.Allocations);
+
+				map.Reserve(10);
+				Assert::AreEqual(size_t(50), map.Capacity());
+
+				// Reserving a non-empty container adds a segment
+				Map::PairType& first = map.EntryAt(0);
+				map.Reserve(80);
+				Assert::AreEqual(size_t(80), map.Capacity());
+				Assert::IsTrue(&first == &map.EntryAt(0));
+				map.Emplace(Foo(50), 500);
+				Assert::IsTrue(IsInInsertionOrder(map, 51));
+			}
+			Assert::AreEqual(size_t(0), resource.BytesInUse);
+		}
+
+		TEST_METHOD(CopySemantics)
+		{
+			CountingResource resource;
+			{
+				Map map;
+				Fill(map, 100);
+
+				// Copies hold every entry in one segment
+				Map copy(map, &resource);
+				Assert::AreEqual(size_t(2), resource.Allocations);
+				Assert::AreEqual(size_t(100), copy.Capacity());
+				Assert::IsTrue(IsInInsertionOrder(copy, 100));
+				Assert::AreEqual(Foo(990), copy.At(Foo(99)));
+				copy.Emplace(Foo(100), 1000);
+				Assert::IsTrue(IsInInsertionOrder(copy, 101));
+
+				Map defaultCopy = map;
+				Assert::IsTrue(defaultCopy.GetAllocator() == Map::Allocator{});
+				Assert::IsTrue(IsInInsertionOrder(defaultCopy, 100));
+
+				// Assignment keeps allocating from the destination's resource
+				Map assigned(&resource);
+				Fill(assigned, 3);
+				assigned = map;
+				Assert::IsTrue(assigned.GetAllocator().resource() == &resource);
+				Assert::IsTrue(IsInInsertionOrder(assigned, 100));
+
+				Map empty;
+				Map emptyCopy(empty);
+				Assert::IsTrue(emptyCopy.IsEmpty());
+			}
+			Assert::AreEqual(size_t(0), resource.BytesInUse);
+		}
+
+		TEST_METHOD(MoveSemantics)
+		{
+			CountingResource resource;
+			{
+				Map map(&resource);
+				Fill(map, 20);
+				Map::PairType* first = map.Find(Foo(0));
+
+				Map moved(std::move(map));
+#pragma warning(push)
+#pragma warning(disable:26800)
+				Assert::IsTrue(map.IsEmpty());
+				Assert::IsNull(map.Find(Foo(0)));
+#pragma warning(pop)
+				Assert::IsTrue(first == moved.Find(Foo(0)));
+				Assert::IsTrue(IsInInsertionOrder(moved, 20));
+
+				// Same resource, so the entries are taken
+				Map assigned(&resource);
+				Fill(assigned, 5);
+				assigned = std::move(moved);
+				Assert::IsTrue(first == assigned.Find(Foo(0)));
+				Assert::IsTrue(IsInInsertionOrder(assigned, 20));
+
+				// Containers on different resources are copied rather than moved
+				Map other;
+				other = assigned;
+				Assert::IsTrue(other.GetAllocator() == Map::Allocator{});
+				Assert::IsTrue(IsInInsertionOrder(other, 20));
+			}
+			Assert::AreEqual(size_t(0), resource.BytesInUse);
+		}
+
+		TEST_METHOD(Clear)
+		{
+			Map map;
+			Fill(map, 30);
+			map.Clear();
+			Assert::IsTrue(map.IsEmpty());
+			Assert::AreEqual(size_t(0), map.Capacity());
+			Assert::IsTrue(map.begin() == map.end());
+			Assert::IsNull(map.Find(Foo(1)));
+
+			Fill(map, 30);
+			Assert::IsTrue(IsInInsertionOrder(map, 30));
+		}
+
+		TEST_METHOD(Iterators)
+		{
+			Map map;
+			Fill(map, 20);
+
+			// Walks across segment boundaries in insertion order
+			Map::iterator it = map.begin();
+			for (int32_t i = 0; i < 20; ++i)
+			{
+				Assert::AreEqual(Foo(i), it->first);
+				Assert::AreEqual(Foo(i * 10), (*it).second);
+				it++;
+			}
+			Assert::IsTrue(it == map.end());
+			Assert::IsTrue(++it == map.end());
+
+			it = map.begin();
+			it->second = Foo(5);
+			Assert::AreEqual(Foo(5), map.At(Foo(0)));
+
+			Map::const_iterator constIt = map.begin();
+			Assert::IsTrue(constIt == map.cbegin());
+			Assert::AreEqual(Foo(0), (constIt++)->first);
+			Assert::AreEqual(Foo(1), (*constIt).first);
+			Assert::AreEqual(Foo(2), (++constIt)->first);
+			Assert::IsTrue(Map::const_iterator(map.end()) == map.cend());
+			Assert::AreEqual(size_t(20), size_t(std::distance(map.cbegin(), map.cend())));
+
+#if FIEA_CHECKED_ITERATORS
+			const Map& constMap = map;
+			Assert::ExpectException<runtime_error>([&map]() { auto& entry = *map.end(); UNREFERENCED_LOCAL(entry); });
+			Assert::ExpectException<runtime_error>([&constMap]() { auto& entry = *constMap.end(); UNREFERENCED_LOCAL(entry); });
+			Assert::ExpectException<runtime_error>([]() { Map::iterator unassociated; auto& entry = *unassociated; UNREFERENCED_LOCAL(entry); });
+			Assert::ExpectException<runtime_error>([]() { Map::iterator unassociated; ++unassociated; });
+			Assert::ExpectException<runtime_error>([]() { Map::const_iterator unassociated; auto& entry = *unassociated; UNREFERENCED_LOCAL(entry); });
+			Assert::ExpectException<runtime_error>([]() { Map::const_iterator unassociated; ++unassociated; });
+#endif
+		}
+
+	private:
+		inline static _CrtMemState _startMemState;
+	};
+}
@@ -0,0 +1,94 @@
+#include "pch.h"
+#include "CppUnitTest.h"
+#include "Benchmark.h"
+#include "SList.h"
+#include "UnrolledSList.h"
+#include "NodePoolResource.h"
+
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+using namespace FieaGameEngine;
+using namespace UnitTests;
+using namespace std;
+using namespace std::string_literals;
+
+namespace LibraryDesktopTests
+{
+	TEST_CLASS(SListBenchmarks)
+	{
+	public:
+		TEST_METHOD(NodeAllocation)
+		{
+			using Unrolled = UnrolledSList<int32_t>;
+
+			Benchmark::Report("-- SList node allocation (per element), "s + to_string(_elementCount) + " int32_t elements --"s);
+			Benchmark::Report("Unrolled nodes hold "s + to_string(Unrolled::NodeCapacity) + " elements in "s + to_string(Unrolled::NodeSize) + " bytes"s);
+
+			RunList<SList<int32_t>>("SList, default resource"s, nullptr);
+			{
+				NodePoolResource pool(SList<int32_t>::NodeSize, SList<int32_t>::NodeAlignment);
+				RunList<SList<int32_t>>("SList, NodePoolResource"s, &pool);
+			}
+			RunList<SList<int32_t>>("SList, ThreadNodePool"s, &SList<int32_t>::ThreadNodePool());
+			SList<int32_t>::ThreadNodePool().Release();
+
+			RunList<Unrolled>("UnrolledSList, default resource"s, nullptr);
+			{
+				NodePoolResource pool(Unrolled::NodeSize, Unrolled::NodeAlignment);
+				RunList<Unrolled>("UnrolledSList, NodePoolResource"s, &pool);
+			}
+		}
+
+	private:
+		static constexpr size_t _elementCount = 10000;
+
+		template <typename TList>
+		static void RunList(const string& label, pmr::memory_resource* resource)
+		{
+			typename TList::Allocator allocator(resource != nullptr ? resource : pmr::get_default_resource());
+			const double count = static_cast<double>(_elementCount);
+
+			// Filling from empty, including freeing the nodes again
+			const double pushBack = Benchmark::Measure(64, [&allocator]()
+			{
+				TList list(allocator);
+				for (size_t i = 0; i < _elementCount; ++i)
+				{
+					list.PushBack(static_cast<int32_t>(i));
+				}
+				Benchmark::DoNotOptimize(list);
+			});
+
+			// Steady state queue: every PopFront frees a node the next PushBack needs
+			TList queue(allocator);
+			for (size_t i = 0; i < _elementCount; ++i)
+			{
+				queue.PushBack(static_cast<int32_t>(i));
+			}
+			const double popFront = Benchmark::Measure(64, [&queue]()
+			{
+				for (size_t i = 0; i < _elementCount; ++i)
+				{
+					const int32_t front = queue.Front();
+					queue.PopFront();
+					queue.PushBack(front);
+				}
+			});
+
+			int64_t sum = 0;
+			const double iteration = Benchmark::Measure(256, [&queue, &sum]()
+			{
+				int64_t local = 0;
+				for (int32_t value : queue)
+				{
+					local += value;
+				}
+				sum += local;
+			});
+			Benchmark::DoNotOptimize(sum);
+
+			Benchmark::Report(label + ": PushBack"s, pushBack / count);
+			Benchmark::Report(label + ": PopFront + PushBack"s, popFront / count);
+			Benchmark::Report(label + ": range-for"s, iteration / count);
+		}
+	};
+}
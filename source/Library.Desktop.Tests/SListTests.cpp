@@ -4,6 +4,7 @@
 #include <cstdint>
 #include "Foo.h"
 #include "SList.h"
+#include "CountingResource.h"
 #include "ToStringSpecializations.h"
 
 using namespace Microsoft::VisualStudio::CppUnitTestFramework;
@@ -266,6 +267,37 @@ namespace LibraryDesktopTests
 			Assert::AreEqual(false, list.IsEmpty());
 		}
 
+		TEST_METHOD(SpliceFrontToBack)
+		{
+			SList<Foo> source{ Foo(1), Foo(2) };
+			SList<Foo> destination{ Foo(3) };
+			const Foo* firstElement = &source.Front();
+
+			SList<Foo>::iterator it = destination.SpliceFrontToBack(source);
+			Assert::AreEqual(Foo(1), *it);
+			Assert::AreEqual(size_t(1), source.Size());
+			Assert::AreEqual(size_t(2), destination.Size());
+			Assert::AreEqual(Foo(2), source.Front());
+			Assert::AreEqual(Foo(3), destination.Front());
+			Assert::AreEqual(Foo(1), destination.Back());
+			// Element was relinked, not copied
+			Assert::IsTrue(firstElement == &destination.Back());
+
+			destination.SpliceFrontToBack(source);
+			Assert::IsTrue(source.IsEmpty());
+			Assert::AreEqual(size_t(3), destination.Size());
+			Assert::AreEqual(Foo(2), destination.Back());
+			Assert::ExpectException<runtime_error>([&source, &destination]() { destination.SpliceFrontToBack(source); });
+
+			// Into an empty list
+			SList<Foo> empty;
+			empty.SpliceFrontToBack(destination);
+			Assert::AreEqual(Foo(3), empty.Front());
+			Assert::AreEqual(Foo(3), empty.Back());
+			empty.PushBack(Foo(4));
+			Assert::AreEqual(Foo(4), empty.Back());
+		}
+
 		TEST_METHOD(PopFront)
 		{
 			Foo a(1);
@@ -729,6 +761,18 @@ namespace LibraryDesktopTests
 				Assert::ExpectException<std::runtime_error>([&oneElementList]() { auto& back = oneElementList.Back(); UNREFERENCED_LOCAL(back); });
 			}
 
+			// Element before the back, whose removal frees the back node
+			{
+				SList<Foo> list = { Foo(1), Foo(2), Foo(3) };
+				Assert::IsTrue(list.Remove(Foo(2)));
+				Assert::AreEqual(Foo(3), list.Back());
+				list.PushBack(Foo(4));
+				Assert::AreEqual(size_t(3), list.Size());
+				Assert::AreEqual(Foo(4), list.Back());
+				Assert::IsTrue(list.Remove(Foo(3)));
+				Assert::AreEqual(Foo(4), list.Back());
+			}
+
 			// Iterator
 			{
 				Foo a(1);
@@ -1039,6 +1083,39 @@ namespace LibraryDesktopTests
 			}
 		}
 
+
+		TEST_METHOD(MemoryResource)
+		{
+			CountingResource resource;
+			CountingResource otherResource;
+			{
+				SList<Foo> list(&resource);
+				Assert::IsTrue(list.GetAllocator().resource() == &resource);
+				for (int32_t i = 0; i < 4; ++i)
+				{
+					list.PushBack(Foo(i));
+				}
+				Assert::AreEqual(size_t(4), resource.Allocations);
+
+				SList<Foo> copy(list, &otherResource);
+				Assert::AreEqual(size_t(4), otherResource.Allocations);
+				Assert::AreEqual(list.Back(), copy.Back());
+
+				// Moves take the nodes along with the allocator
+				SList<Foo> moved(std::move(list));
+				Assert::IsTrue(moved.GetAllocator().resource() == &resource);
+				Assert::AreEqual(size_t(4), resource.Allocations);
+
+				// Move assignment across resources moves the elements into our nodes
+				copy = std::move(moved);
+				Assert::IsTrue(copy.GetAllocator().resource() == &otherResource);
+				Assert::AreEqual(size_t(4), copy.Size());
+				Assert::AreEqual(Foo(3), copy.Back());
+				Assert::AreEqual(size_t(0), resource.BytesInUse);
+			}
+			Assert::AreEqual(size_t(0), otherResource.BytesInUse);
+		}
+
 	private:
 		inline static _CrtMemState _startMemState;
 	};
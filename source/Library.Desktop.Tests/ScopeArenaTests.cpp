@@ -0,0 +1,183 @@
+#include "pch.h"
+#include "CppUnitTest.h"
+#include "ScopeArena.h"
+#include "Literals.h"
+#include "ToStringSpecializations.h"
+#include "CountingResource.h"
+
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+using namespace FieaGameEngine;
+using namespace UnitTests;
+using namespace std;
+using namespace std::string_literals;
+
+namespace LibraryDesktopTests
+{
+	TEST_CLASS(ScopeArenaTests)
+	{
+		// Counts how many of its kind were destroyed
+		class CountingScope final : public Scope
+		{
+		public:
+			explicit CountingScope(size_t& destroyed) :
+				_destroyed(destroyed)
+			{
+			}
+
+			~CountingScope()
+			{
+				++_destroyed;
+			}
+
+		private:
+			size_t& _destroyed;
+		};
+
+	public:
+		TEST_METHOD_INITIALIZE(Initialize)
+		{
+#if defined(DEBUG) || defined(_DEBUG)
+			_CrtSetDbgFlag(_CRTDBG_ALLOC_MEM_DF);
+			_CrtMemCheckpoint(&_startMemState);
+#endif
+			Factory<Scope>::Add(make_unique<ScopeFactory>());
+		}
+
+		TEST_METHOD_CLEANUP(Cleanup)
+		{
+			Factory<Scope>::Clear();
+#if defined(DEBUG) || defined(_DEBUG)
+			_CrtMemState endMemState, diffMemState;
+			_CrtMemCheckpoint(&endMemState);
+			if (_CrtMemDifference(&diffMemState, &_startMemState,
+				&endMemState))
+			{
+				_CrtMemDumpStatistics(&diffMemState);
+				Assert::Fail(L"Memory Leaks!");
+			}
+#endif
+		}
+
+		TEST_METHOD(Binding)
+		{
+			ScopeArena arena;
+			ScopeArena otherArena;
+			Assert::IsNull(BoundArena());
+			{
+				ScopeArena::Binding binding(arena);
+				Assert::IsTrue(arena.Resource() == BoundArena());
+				{
+					ScopeArena::Binding nestedBinding(otherArena);
+					Assert::IsTrue(otherArena.Resource() == BoundArena());
+				}
+				Assert::IsTrue(arena.Resource() == BoundArena());
+			}
+			Assert::IsNull(BoundArena());
+
+			// Scopes created while bound allocate from the arena
+			Assert::IsTrue(arena.Resource() == arena.Root().GetAllocator().resource());
+			Scope unbound;
+			Assert::IsTrue(arena.Resource() != unbound.GetAllocator().resource());
+			{
+				ScopeArena::Binding binding(arena);
+				Scope& nested = arena.Root().AppendScope("Nested"_sym);
+				Assert::IsTrue(arena.Resource() == nested.GetAllocator().resource());
+				Scope bound;
+				Assert::IsTrue(arena.Resource() == bound.GetAllocator().resource());
+			}
+			shared_ptr<Scope> made = arena.MakeShared<Scope>(4_z);
+			Assert::IsTrue(arena.Resource() == made->GetAllocator().resource());
+		}
+
+		TEST_METHOD(DatumStorage)
+		{
+			std::pmr::monotonic_buffer_resource monotonic;
+			CountingResource counting(&monotonic);
+
+			Datum datum;
+			std::pmr::memory_resource* previous = BindArena(&counting);
+			datum.PushBack(1);
+			datum.PushBack(2);
+			datum.PushBack(3);
+			Assert::IsTrue(counting.Allocations > 0);
+			BindArena(previous);
+
+			// Growing after the arena is unbound moves the values to the heap
+			const size_t allocations = counting.Allocations;
+			datum.Reserve(64);
+			datum.PushBack(4);
+			Assert::AreEqual(allocations, counting.Allocations);
+			Assert::AreEqual(4_z, datum.Size());
+			for (int32_t i = 0; i < 4; ++i)
+			{
+				Assert::AreEqual(i + 1, datum.Get<int32_t>(i));
+			}
+
+			// Copies of arena datums allocate wherever they are made
+			Datum copy = datum;
+			Assert::AreEqual(datum, copy);
+
+			// Arena blocks are never returned one by one
+			previous = BindArena(&counting);
+			{
+				Datum strings;
+				strings.PushBack("a"s);
+				strings.PushBack("b"s);
+				strings.ShrinkToFit();
+				strings.Clear();
+				strings.ShrinkToFit();
+			}
+			BindArena(previous);
+			Assert::AreEqual(0_z, counting.Deallocations);
+		}
+
+		TEST_METHOD(ClearAndRelease)
+		{
+			size_t destroyed = 0;
+			ScopeArena arena(1024);
+			auto build = [&arena, &destroyed]()
+			{
+				ScopeArena::Binding binding(arena);
+				for (int32_t i = 0; i < 10; ++i)
+				{
+					shared_ptr<CountingScope> object = arena.MakeShared<CountingScope>(destroyed);
+					object->Append("Health"_sym) = i;
+					object->Append("Tag"_sym) = "Enemy"s;
+					object->Append("Position"_sym) = glm::vec4(static_cast<float>(i));
+					Datum& path = object->Append("Path"_sym);
+					path.SetType(DatumTypes::Vector);
+					path.Resize(8, glm::vec4(1.0f));
+					object->AppendScope("Components"_sym).Append("Speed"_sym) = 2.0f;
+					arena.Root().Adopt(std::move(object), "Children"_sym);
+				}
+			};
+
+			build();
+			Assert::AreEqual(10_z, arena.Root().Find("Children"_sym)->Size());
+
+			// Clear runs every destructor
+			arena.Clear();
+			Assert::AreEqual(10_z, destroyed);
+			Assert::AreEqual(0_z, arena.Root().Size());
+			Assert::IsTrue(arena.Resource() == arena.Root().GetAllocator().resource());
+
+			// Release runs none, and scopes built again in the same memory do not reuse cached searches
+			build();
+			Scope::SearchCache cache;
+			Assert::IsNotNull(arena.Root().Find("Children"_sym)->Get<shared_ptr<Scope>>()->Search("Children"_sym, cache));
+			arena.Release();
+			Assert::AreEqual(10_z, destroyed);
+			Assert::AreEqual(0_z, arena.Root().Size());
+
+			// The arena is reusable, and destroying it runs the destructors of what is left
+			build();
+			Datum* children = arena.Root().Find("Children"_sym);
+			Assert::AreEqual(children, children->Get<shared_ptr<Scope>>()->Search("Children"_sym, cache));
+			arena.Release();
+			build();
+		}
+
+	private:
+		inline static _CrtMemState _startMemState;
+	};
+}
@@ -0,0 +1,444 @@
+#include "pch.h"
+#include "CppUnitTest.h"
+#include "Benchmark.h"
+#include "Scope.h"
+#include "Symbol.h"
+#include "Vector.h"
+#include "OrderedHashMap.h"
+#include "ScopeArena.h"
+#include "ScopePath.h"
+#include <memory_resource>
+#include <chrono>
+
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+using namespace FieaGameEngine;
+using namespace UnitTests;
+using namespace std;
+using namespace std::string_literals;
+
+namespace LibraryDesktopTests
+{
+	TEST_CLASS(ScopeBenchmarks)
+	{
+	public:
+		TEST_METHOD(WorldOnMonotonicResource)
+		{
+			constexpr size_t objectCount = 10000;
+
+			const double heap = Benchmark::Measure(8, []()
+			{
+				Scope world;
+				for (size_t i = 0; i < objectCount; ++i)
+				{
+					shared_ptr<Scope> object = make_shared<Scope>(6);
+					PopulateObject(*object, i);
+					world.Adopt(std::move(object), "Children"_sym);
+				}
+				Benchmark::DoNotOptimize(world);
+			});
+
+			const double monotonic = Benchmark::Measure(8, []()
+			{
+				// Destroyed after the world, which releases everything at once
+				std::pmr::monotonic_buffer_resource resource(objectCount * 512);
+				Scope world(&resource);
+				for (size_t i = 0; i < objectCount; ++i)
+				{
+					shared_ptr<Scope> object = allocate_shared<Scope>(std::pmr::polymorphic_allocator<Scope>(&resource), 6, &resource);
+					PopulateObject(*object, i);
+					world.Adopt(std::move(object), "Children"_sym);
+				}
+				Benchmark::DoNotOptimize(world);
+			});
+
+			Benchmark::Report("-- Build and destroy a world of 10000 scopes --"s);
+			Benchmark::Report("Default heap (per world)"s, heap);
+			Benchmark::Report("monotonic_buffer_resource (per world)"s, monotonic);
+		}
+
+		TEST_METHOD(LevelLoadAndUnload)
+		{
+			constexpr size_t objectCount = 10000;
+			constexpr size_t repetitions = 8;
+
+			auto loadLevel = [](Scope& world, auto makeObject)
+			{
+				for (size_t i = 0; i < objectCount; ++i)
+				{
+					shared_ptr<Scope> object = makeObject();
+					PopulateObject(*object, i);
+					object->AppendScope("Components"_sym).Append("Speed"_sym) = 2.0f;
+					world.Adopt(std::move(object), "Children"_sym);
+				}
+			};
+
+			Factory<Scope>::Add(make_unique<ScopeFactory>());
+
+			unique_ptr<Scope> world;
+			const auto [heapLoad, heapUnload] = MeasureLevel(repetitions,
+				[&world, &loadLevel]()
+				{
+					world = make_unique<Scope>();
+					loadLevel(*world, []() { return make_shared<Scope>(6); });
+				},
+				[&world]()
+				{
+					world.reset();
+				});
+
+			ScopeArena arena(objectCount * 1024);
+			auto loadArenaLevel = [&arena, &loadLevel]()
+			{
+				ScopeArena::Binding binding(arena);
+				loadLevel(arena.Root(), [&arena]() { return arena.MakeShared<Scope>(6); });
+			};
+			const auto [arenaLoad, arenaClear] = MeasureLevel(repetitions, loadArenaLevel, [&arena]()
+			{
+				arena.Clear();
+			});
+			const auto [releaseLoad, arenaRelease] = MeasureLevel(repetitions, loadArenaLevel, [&arena]()
+			{
+				arena.Release();
+			});
+
+			Factory<Scope>::Clear();
+
+			Benchmark::Report("-- Load then unload a level of 10000 objects (per level) --"s);
+			Benchmark::Report("Load, default heap"s, heapLoad);
+			Benchmark::Report("Load, ScopeArena"s, (arenaLoad + releaseLoad) / 2.0);
+			Benchmark::Report("Unload, default heap"s, heapUnload);
+			Benchmark::Report("Unload, ScopeArena::Clear (destructors)"s, arenaClear);
+			Benchmark::Report("Unload, ScopeArena::Release (no destructors)"s, arenaRelease);
+		}
+
+		TEST_METHOD(CopyCompareAndFind)
+		{
+			constexpr size_t attributeCount = 32;
+			constexpr size_t scopeCount = 1000;
+
+			Vector<Symbol> names(attributeCount);
+			Scope prototype;
+			for (size_t i = 0; i < attributeCount; ++i)
+			{
+				names.PushBack(Symbol("Attribute"s + to_string(i)));
+				prototype.Append(names.Back()) = static_cast<int32_t>(i);
+			}
+
+			// Copies grown one datum at a time, like scopes built by the parser
+			Vector<Scope> scopes(scopeCount);
+			for (size_t i = 0; i < scopeCount; ++i)
+			{
+				Scope& scope = *scopes.EmplaceBack();
+				for (size_t j = 0; j < attributeCount; ++j)
+				{
+					scope.Append(names[j]) = static_cast<int32_t>(j);
+				}
+			}
+
+			const double copy = Benchmark::Measure(8, [&scopes]()
+			{
+				for (const Scope& scope : scopes)
+				{
+					Scope copy(scope);
+					Benchmark::DoNotOptimize(copy);
+				}
+			});
+
+			const double compare = Benchmark::Measure(8, [&scopes, &prototype]()
+			{
+				size_t equal = 0;
+				for (const Scope& scope : scopes)
+				{
+					equal += scope == prototype ? 1 : 0;
+				}
+				Benchmark::DoNotOptimize(equal);
+			});
+
+			const double find = Benchmark::Measure(8, [&scopes, &names]()
+			{
+				int32_t sum = 0;
+				for (const Scope& scope : scopes)
+				{
+					for (const Symbol& name : names)
+					{
+						sum += scope.Find(name)->Get<int32_t>();
+					}
+				}
+				Benchmark::DoNotOptimize(sum);
+			});
+
+			const double count = static_cast<double>(scopeCount);
+			Benchmark::Report("-- 1000 scopes of 32 integer datums (per scope) --"s);
+			Benchmark::Report("Copy"s, copy / count);
+			Benchmark::Report("operator== (ordered walk)"s, compare / count);
+			Benchmark::Report("Find every datum"s, find / count);
+		}
+
+		TEST_METHOD(Reparenting)
+		{
+			constexpr size_t childCount = 2000;
+
+			// Children spread over a few datums of a large parent, moved to another parent and back
+			Scope parent;
+			Scope other;
+			const Symbol datumNames[] = { "Enemies"_sym, "Pickups"_sym, "Props"_sym, "Lights"_sym };
+			Vector<shared_ptr<Scope>> children(childCount);
+			for (size_t i = 0; i < childCount; ++i)
+			{
+				shared_ptr<Scope> child = make_shared<Scope>(6);
+				PopulateObject(*child, i);
+				parent.Adopt(child, datumNames[i % std::size(datumNames)]);
+				children.PushBack(std::move(child));
+			}
+
+			const double adopt = Benchmark::Measure(8, [&parent, &other, &children, &datumNames]()
+			{
+				for (const shared_ptr<Scope>& child : children)
+				{
+					other.Adopt(child, "Children"_sym);
+				}
+				for (size_t i = 0; i < childCount; ++i)
+				{
+					parent.Adopt(children[i], datumNames[i % std::size(datumNames)]);
+				}
+			});
+
+			const double adoptNewestFirst = Benchmark::Measure(8, [&parent, &other, &children, &datumNames]()
+			{
+				for (size_t i = childCount; i-- > 0;)
+				{
+					other.Adopt(children[i], "Children"_sym);
+				}
+				for (size_t i = childCount; i-- > 0;)
+				{
+					parent.Adopt(children[i], datumNames[i % std::size(datumNames)]);
+				}
+			});
+
+			const double adoptAll = Benchmark::Measure(8, [&parent, &other, &children, &datumNames]()
+			{
+				other.AdoptAll(children.AsSpan(), "Children"_sym);
+				for (size_t i = 0; i < std::size(datumNames); ++i)
+				{
+					Vector<shared_ptr<Scope>> group(childCount / std::size(datumNames));
+					for (size_t j = i; j < childCount; j += std::size(datumNames))
+					{
+						group.PushBack(children[j]);
+					}
+					parent.AdoptAll(group.AsSpan(), datumNames[i]);
+				}
+			});
+
+			const double count = static_cast<double>(2 * childCount);
+			Benchmark::Report("-- Move 2000 children between parents (per child) --"s);
+			Benchmark::Report("Adopt, oldest first"s, adopt / count);
+			Benchmark::Report("Adopt, newest first"s, adoptNewestFirst / count);
+			Benchmark::Report("AdoptAll"s, adoptAll / count);
+		}
+
+		TEST_METHOD(PathQueries)
+		{
+			constexpr size_t objectCount = 1000;
+
+			Factory<Scope>::Add(make_unique<ScopeFactory>());
+
+			Scope world;
+			for (size_t i = 0; i < objectCount; ++i)
+			{
+				Scope& object = world.AppendScope("Children"_sym);
+				PopulateObject(object, i);
+				object.AppendScope("Physics"_sym).Append("Velocity"_sym) = glm::vec4(static_cast<float>(i));
+			}
+
+			// Each component looked up by name on every access, as scripts do
+			const double chained = Benchmark::Measure(8, [&world]()
+			{
+				float sum = 0.0f;
+				Datum& children = world["Children"];
+				for (size_t i = 0; i < children.Size(); ++i)
+				{
+					Scope& physics = *(*children.Get<shared_ptr<Scope>>(i))["Physics"].Get<shared_ptr<Scope>>();
+					sum += physics["Velocity"].Get<glm::vec4>().x;
+				}
+				Benchmark::DoNotOptimize(sum);
+			});
+
+			// Each component found at the entry it was last found at
+			ScopePath path("Children[*].Physics.Velocity");
+			const double compiled = Benchmark::Measure(8, [&world, &path]()
+			{
+				float sum = 0.0f;
+				for (Datum* velocity : path.ResolveAll(world))
+				{
+					sum += velocity->Get<glm::vec4>().x;
+				}
+				Benchmark::DoNotOptimize(sum);
+			});
+
+			Factory<Scope>::Clear();
+
+			const double count = static_cast<double>(objectCount);
+			Benchmark::Report("-- Read Children[*].Physics.Velocity of 1000 objects (per object) --"s);
+			Benchmark::Report("Lookups by name"s, chained / count);
+			Benchmark::Report("ScopePath"s, compiled / count);
+		}
+
+		TEST_METHOD(PrefabInstancing)
+		{
+			constexpr size_t instanceCount = 1000;
+
+			Factory<Scope>::Add(make_unique<ScopeFactory>());
+
+			// A prefab with a few large datums that instances rarely change
+			Scope prefab;
+			prefab.Append("Health"_sym) = 100;
+			Datum& path = prefab.Append("Path"_sym);
+			path.SetType(DatumTypes::Vector);
+			path.Resize(256, glm::vec4(1.0f));
+			Datum& tags = prefab.Append("Tags"_sym);
+			for (size_t i = 0; i < 32; ++i)
+			{
+				tags.PushBack("Tag that does not fit inline "s + to_string(i));
+			}
+			Datum& weights = prefab.AppendScope("Components"_sym).Append("Weights"_sym);
+			weights.SetType(DatumTypes::Float);
+			weights.Resize(512, 0.5f);
+
+			Vector<unique_ptr<Scope>> instances(instanceCount);
+			const double clone = Benchmark::Measure(8, [&prefab, &instances]()
+			{
+				instances.Clear();
+				for (size_t i = 0; i < instanceCount; ++i)
+				{
+					instances.PushBack(prefab.Clone());
+				}
+			});
+
+			const double cloneAndWrite = Benchmark::Measure(8, [&prefab, &instances]()
+			{
+				instances.Clear();
+				for (size_t i = 0; i < instanceCount; ++i)
+				{
+					unique_ptr<Scope> instance = prefab.Clone();
+					instance->Find("Health"_sym)->Set(static_cast<int32_t>(i));
+					instance->Find("Path"_sym)->Set(glm::vec4(static_cast<float>(i)));
+					instances.PushBack(std::move(instance));
+				}
+			});
+			instances.Clear();
+
+			Factory<Scope>::Clear();
+
+			const double count = static_cast<double>(instanceCount);
+			Benchmark::Report("-- Clone a prefab with 256 vectors, 32 strings and 512 floats (per instance) --"s);
+			Benchmark::Report("Clone"s, clone / count);
+			Benchmark::Report("Clone, then write the health and path"s, cloneAndWrite / count);
+		}
+
+		TEST_METHOD(LinearSearchCrossover)
+		{
+			// Capacities small enough to always scan, or large enough to never scan
+			using Scanned = OrderedHashMap<Symbol, Datum, DefaultHash<Symbol>, DefaultEquality<Symbol>, 1024>;
+			using Hashed = OrderedHashMap<Symbol, Datum, DefaultHash<Symbol>, DefaultEquality<Symbol>, 0>;
+
+			Benchmark::Report("-- Scopes of N datums: find every datum, and build (per datum) --"s);
+			for (size_t size : { 2, 4, 8, 12, 16, 24, 32, 48 })
+			{
+				const auto [scannedFind, scannedBuild] = MeasureTable<Scanned>(size);
+				const auto [hashedFind, hashedBuild] = MeasureTable<Hashed>(size);
+				Benchmark::Report("N = "s + to_string(size) + ", find scanning"s, scannedFind);
+				Benchmark::Report("N = "s + to_string(size) + ", find hashing"s, hashedFind);
+				Benchmark::Report("N = "s + to_string(size) + ", build scanning"s, scannedBuild);
+				Benchmark::Report("N = "s + to_string(size) + ", build hashing"s, hashedBuild);
+			}
+		}
+
+	private:
+		// Times loading and unloading separately. The first run warms up and is not counted
+		template <typename TLoad, typename TUnload>
+		static std::pair<double, double> MeasureLevel(size_t repetitions, TLoad load, TUnload unload)
+		{
+			using Clock = std::chrono::high_resolution_clock;
+			Clock::duration loadTime{};
+			Clock::duration unloadTime{};
+			for (size_t i = 0; i <= repetitions; ++i)
+			{
+				const auto start = Clock::now();
+				load();
+				const auto loaded = Clock::now();
+				unload();
+				const auto unloaded = Clock::now();
+				if (i > 0)
+				{
+					loadTime += loaded - start;
+					unloadTime += unloaded - loaded;
+				}
+			}
+
+			const double count = static_cast<double>(repetitions);
+			return { std::chrono::duration<double, std::nano>(loadTime).count() / count, std::chrono::duration<double, std::nano>(unloadTime).count() / count };
+		}
+
+		template <typename TTable>
+		static std::pair<double, double> MeasureTable(size_t size)
+		{
+			constexpr size_t tableCount = 512;
+
+			Vector<Symbol> names(size);
+			for (size_t i = 0; i < size; ++i)
+			{
+				names.PushBack(Symbol("Attribute"s + to_string(i)));
+			}
+
+			Vector<TTable> tables(tableCount);
+			for (size_t i = 0; i < tableCount; ++i)
+			{
+				TTable& table = *tables.EmplaceBack();
+				for (const Symbol& name : names)
+				{
+					table.EmplaceUnique(name);
+				}
+			}
+
+			const double lookups = static_cast<double>(tableCount * size);
+			const double find = Benchmark::Measure(16, [&tables, &names]()
+			{
+				size_t found = 0;
+				for (const TTable& table : tables)
+				{
+					for (const Symbol& name : names)
+					{
+						found += table.Find(name) != nullptr ? 1 : 0;
+					}
+				}
+				Benchmark::DoNotOptimize(found);
+			});
+
+			const double build = Benchmark::Measure(16, [&names]()
+			{
+				for (size_t i = 0; i < tableCount; ++i)
+				{
+					// Grown one datum at a time, like Append does
+					TTable table;
+					for (const Symbol& name : names)
+					{
+						table.Emplace(name);
+					}
+					Benchmark::DoNotOptimize(table);
+				}
+			});
+
+			return { find / lookups, build / lookups };
+		}
+
+		static void PopulateObject(Scope& object, size_t index)
+		{
+			object.Append("Name"_sym) = "Object"s + to_string(index);
+			object.Append("Health"_sym) = static_cast<int32_t>(index % 100);
+			object.Append("Position"_sym) = glm::vec4(static_cast<float>(index));
+			object.Append("Velocity"_sym) = glm::vec4(1.0f, 0.0f, 0.0f, 0.0f);
+			object.Append("Tag"_sym) = "Enemy"s;
+			object.Append("Transform"_sym) = glm::mat4(1.0f);
+		}
+	};
+}
@@ -0,0 +1,176 @@
+#include "pch.h"
+#include "CppUnitTest.h"
+#include "ScopePath.h"
+#include "Literals.h"
+#include "ToStringSpecializations.h"
+
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+using namespace FieaGameEngine;
+using namespace UnitTests;
+using namespace std;
+using namespace std::string_literals;
+
+namespace LibraryDesktopTests
+{
+	TEST_CLASS(ScopePathTests)
+	{
+	public:
+		TEST_METHOD_INITIALIZE(Initialize)
+		{
+#if defined(DEBUG) || defined(_DEBUG)
+			_CrtSetDbgFlag(_CRTDBG_ALLOC_MEM_DF);
+			_CrtMemCheckpoint(&_startMemState);
+#endif
+			Factory<Scope>::Add(make_unique<ScopeFactory>());
+		}
+
+		TEST_METHOD_CLEANUP(Cleanup)
+		{
+			Factory<Scope>::Clear();
+#if defined(DEBUG) || defined(_DEBUG)
+			_CrtMemState endMemState, diffMemState;
+			_CrtMemCheckpoint(&endMemState);
+			if (_CrtMemDifference(&diffMemState, &_startMemState,
+				&endMemState))
+			{
+				_CrtMemDumpStatistics(&diffMemState);
+				Assert::Fail(L"Memory Leaks!");
+			}
+#endif
+		}
+
+		TEST_METHOD(Compile)
+		{
+			Assert::IsFalse(ScopePath("Position").HasWildcard());
+			Assert::IsFalse(ScopePath("Children[3].Transform.Position").HasWildcard());
+			Assert::IsTrue(ScopePath("Children[*].Transform").HasWildcard());
+
+			for (string_view path : { ""sv, "."sv, "Children."sv, ".Children"sv, "Children..Transform"sv, "Children[3]"sv,
+				"Children[].Transform"sv, "Children[x].Transform"sv, "Children[3.Transform"sv, "Children[3]x.Transform"sv,
+				"Children[3][4].Transform"sv, "Children]3.Transform"sv, "[3].Transform"sv, "Children[-1].Transform"sv })
+			{
+				Assert::ExpectException<runtime_error>([path]() { ScopePath scopePath(path); });
+			}
+		}
+
+		TEST_METHOD(Resolve)
+		{
+			Scope root;
+			Datum& health = root.Append("Health"_sym);
+			health = 10;
+			for (int32_t i = 0; i < 4; ++i)
+			{
+				Scope& child = root.AppendScope("Children"_sym);
+				child.Append("Index"_sym) = i;
+				child.AppendScope("Transform"_sym).Append("Position"_sym) = glm::vec4(static_cast<float>(i));
+			}
+
+			ScopePath healthPath("Health");
+			Assert::AreEqual(&health, healthPath.Resolve(root));
+
+			// An index picks a scope, no index picks the first
+			ScopePath positionPath("Children[2].Transform.Position");
+			Datum* position = positionPath.Resolve(root);
+			Assert::IsNotNull(position);
+			Assert::AreEqual(glm::vec4(2.0f), position->Get<glm::vec4>());
+			ScopePath firstPath("Children.Transform.Position");
+			Assert::AreEqual(glm::vec4(0.0f), firstPath.Resolve(root)->Get<glm::vec4>());
+
+			// Missing names, indices past the end and datums that are not tables resolve to nothing
+			Assert::IsNull(ScopePath("Mana").Resolve(root));
+			Assert::IsNull(ScopePath("Children[4].Transform.Position").Resolve(root));
+			Assert::IsNull(ScopePath("Health.Transform").Resolve(root));
+			Assert::IsNull(ScopePath("Children[1].Transform.Rotation").Resolve(root));
+
+			// Paths with wildcards go through ResolveAll
+			Assert::ExpectException<runtime_error>([&root]() { ScopePath path("Children[*].Index"); Datum* datum = path.Resolve(root); UNREFERENCED_LOCAL(datum); });
+
+			// Scopes nested by pointer are followed too
+			Scope shared;
+			Datum& speed = shared.Append("Speed"_sym);
+			speed = 2.0f;
+			root.Adopt(&shared, "Shared"_sym);
+			Assert::AreEqual(&speed, ScopePath("Shared.Speed").Resolve(root));
+
+			// Empty slots in a datum of scopes resolve to nothing
+			Datum& pointers = root.Append("Pointers"_sym);
+			pointers.PushBack(static_cast<Scope*>(nullptr));
+			pointers.PushBack(&shared);
+			Assert::IsNull(ScopePath("Pointers.Speed").Resolve(root));
+			Assert::AreEqual(&speed, ScopePath("Pointers[1].Speed").Resolve(root));
+			Assert::AreEqual(1_z, ScopePath("Pointers[*].Speed").ResolveAll(root).size());
+			Datum& tables = root.Append("Tables"_sym);
+			tables.PushBack(shared_ptr<Scope>());
+			Assert::AreEqual(0_z, ScopePath("Tables[*].Speed").ResolveAll(root).size());
+
+			// The same path resolves from any root, and from scopes whose datums are in another order
+			Scope other;
+			other.Append("Padding"_sym);
+			Scope& otherChild = other.AppendScope("Children"_sym);
+			otherChild.Append("Padding"_sym);
+			Datum& otherPosition = otherChild.AppendScope("Transform"_sym).Append("Position"_sym);
+			otherPosition = glm::vec4(5.0f);
+			Assert::AreEqual(&otherPosition, firstPath.Resolve(other));
+			Assert::AreEqual(glm::vec4(0.0f), firstPath.Resolve(root)->Get<glm::vec4>());
+		}
+
+		TEST_METHOD(ResolveAll)
+		{
+			Scope root;
+			Vector<shared_ptr<Scope>> children(4);
+			for (int32_t i = 0; i < 4; ++i)
+			{
+				shared_ptr<Scope> child = make_shared<Scope>();
+				child->Append("Index"_sym) = i;
+				for (int32_t j = 0; j < 2; ++j)
+				{
+					child->AppendScope("Parts"_sym).Append("Mass"_sym) = static_cast<float>(i * 2 + j);
+				}
+				root.Adopt(child, "Children"_sym);
+				children.PushBack(std::move(child));
+			}
+
+			// Datums are gathered in the order the scopes are nested
+			ScopePath massPath("Children[*].Parts[*].Mass");
+			std::span<Datum* const> masses = massPath.ResolveAll(root);
+			Assert::AreEqual(8_z, masses.size());
+			for (size_t i = 0; i < masses.size(); ++i)
+			{
+				Assert::AreEqual(static_cast<float>(i), masses[i]->Get<float>());
+			}
+
+			ScopePath indexPath("Children[*].Index");
+			Assert::AreEqual(4_z, indexPath.ResolveAll(root).size());
+			Assert::AreEqual(1_z, ScopePath("Children[1].Index").ResolveAll(root).size());
+			Assert::AreEqual(0_z, ScopePath("Children[*].Missing").ResolveAll(root).size());
+
+			// Every resolve sees the current structure, including scopes put into a table datum directly
+			masses[0]->Set(10.0f);
+			Assert::AreEqual(10.0f, massPath.ResolveAll(root)[0]->Get<float>());
+			shared_ptr<Scope> pushed = make_shared<Scope>();
+			pushed->Append("Index"_sym) = 4;
+			root.At("Children"_sym).PushBack(pushed);
+			Assert::AreEqual(5_z, indexPath.ResolveAll(root).size());
+			Assert::AreEqual(4, indexPath.ResolveAll(root)[4]->Get<int32_t>());
+			root.At("Children"_sym).PopBack();
+
+			Scope other;
+			other.Adopt(children[1], "Children"_sym);
+			std::span<Datum* const> indices = indexPath.ResolveAll(root);
+			Assert::AreEqual(3_z, indices.size());
+			// The last child takes the slot of the one that left
+			Assert::AreEqual(0, indices[0]->Get<int32_t>());
+			Assert::AreEqual(3, indices[1]->Get<int32_t>());
+			Assert::AreEqual(2, indices[2]->Get<int32_t>());
+			Assert::AreEqual(6_z, massPath.ResolveAll(root).size());
+
+			root.Adopt(children[1], "Children"_sym);
+			indices = indexPath.ResolveAll(root);
+			Assert::AreEqual(4_z, indices.size());
+			Assert::AreEqual(1, indices[3]->Get<int32_t>());
+		}
+
+	private:
+		inline static _CrtMemState _startMemState;
+	};
+}
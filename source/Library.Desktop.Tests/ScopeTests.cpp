@@ -5,6 +5,7 @@
 #include "ToStringSpecializations.h"
 #include "CppUnitTest.h"
 #include "Scope.h"
+#include "CountingResource.h"
 #include "Foo.h"
 
 using namespace Microsoft::VisualStudio::CppUnitTestFramework;
@@ -208,6 +209,30 @@ namespace LibraryDesktopTests
 			Assert::IsNull(foundDatum);
 		}
 
+		TEST_METHOD(FindByView)
+		{
+			Scope scope;
+			Datum& healthDatum = scope.Append("Health");
+			Scope& nestedScope = scope.AppendScope("Nested");
+			const Scope& constScope = scope;
+
+			// Views that are not null terminated
+			const string buffer = "HealthNested"s;
+			const string_view health(buffer.data(), 6);
+			const string_view nested(buffer.data() + 6, 6);
+
+			Assert::AreEqual(&healthDatum, scope.Find(health));
+			Assert::IsTrue(&healthDatum == constScope.Find(health));
+			Assert::IsNull(scope.Find(string_view(buffer.data(), 4)));
+			Assert::AreEqual(&healthDatum, &scope.At(health));
+			Assert::IsTrue(&healthDatum == &constScope.At("Health"));
+			Assert::ExpectException<runtime_error>([&scope]() { auto& datum = scope.At("Missing"sv); UNREFERENCED_LOCAL(datum); });
+
+			Assert::AreEqual(&healthDatum, nestedScope.Search(health));
+			Assert::IsNotNull(nestedScope.Search(nested));
+			Assert::IsNull(nestedScope.Search("Missing"));
+		}
+
 		TEST_METHOD(Search)
 		{
 			// With scope pointer
@@ -253,6 +278,88 @@ namespace LibraryDesktopTests
 				Assert::IsNotNull(datumFound);
 				Assert::AreEqual(&datum, datumFound);
 			}
+
+			// With cache
+			{
+				Scope scope;
+				Datum& datum = scope.Append("myInt");
+				datum.PushBack(1);
+				Scope& nestedScope = scope.AppendScope("nestedScope");
+				Scope& deepScope = nestedScope.AppendScope("deepScope");
+
+				const Symbol myInt("myInt");
+				Scope::SearchCache cache;
+				Assert::AreEqual(&datum, deepScope.Search(myInt, cache));
+				Assert::IsTrue(&scope == cache.Owner);
+				const std::uint64_t generation = cache.Generation;
+				const std::uint64_t branchGeneration = cache.BranchGeneration;
+				Assert::AreEqual(deepScope.StructureGeneration(), generation);
+
+				// Steady state reuses the result
+				Assert::AreEqual(&datum, deepScope.Search(myInt, cache));
+				Assert::AreEqual(generation, cache.Generation);
+				Assert::AreEqual(branchGeneration, cache.BranchGeneration);
+
+				// Scopes elsewhere being created, changed and destroyed leave the searched scopes alone
+				for (int32_t i = 0; i < 4; ++i)
+				{
+					Scope unrelated;
+					unrelated.Append(myInt) = i;
+					unrelated.AppendScope("nestedScope").Append("other");
+					Scope copy = unrelated;
+					Scope moved = std::move(copy);
+				}
+				Assert::AreEqual(&datum, deepScope.Search(myInt, cache));
+				Assert::AreEqual(generation, cache.Generation);
+				Assert::AreEqual(branchGeneration, cache.BranchGeneration);
+
+				// Leaves elsewhere changing leave it alone even while they are nested
+				Scope& leaf = scope.AppendScope("leaf");
+				Assert::AreEqual(&datum, deepScope.Search(myInt, cache));
+				const std::uint64_t leafBranchGeneration = cache.BranchGeneration;
+				leaf.Append("other");
+				leaf.Append(myInt) = 2;
+				Assert::AreEqual(&datum, deepScope.Search(myInt, cache));
+				Assert::AreEqual(leafBranchGeneration, cache.BranchGeneration);
+
+				// Changing a value is not structural, appending a datum is
+				const std::uint64_t scopeGeneration = scope.StructureGeneration();
+				datum.Set(5);
+				Assert::AreEqual(scopeGeneration, scope.StructureGeneration());
+				nestedScope.Append("other");
+				Assert::IsTrue(nestedScope.StructureGeneration() > scopeGeneration);
+
+				// Shadowing the key in a closer scope is picked up
+				Datum& shadow = nestedScope.Append(myInt);
+				shadow.PushBack(3);
+				Assert::AreEqual(&shadow, deepScope.Search(myInt, cache));
+				Assert::IsTrue(&nestedScope == cache.Owner);
+
+				// Another searcher or another key resolves again
+				Assert::AreEqual(&datum, scope.Search(myInt, cache));
+				Assert::IsNull(deepScope.Search(Symbol("Missing"), cache));
+				Assert::IsNull(cache.Owner);
+
+				// Moving the searcher to another parent is picked up
+				Assert::AreEqual(&shadow, deepScope.Search(myInt, cache));
+				Datum* deepDatum = nestedScope.Find("deepScope");
+				shared_ptr<Scope> deep = deepDatum->Get<shared_ptr<Scope>>();
+				scope.Adopt(deep, "deepScope");
+				Assert::AreEqual(&datum, deepScope.Search(myInt, cache));
+				Assert::IsTrue(&scope == cache.Owner);
+
+				// A searcher that outlives its parent is left without one
+				shared_ptr<Scope> survivor;
+				{
+					Scope parent;
+					parent.Append(myInt);
+					parent.AppendScope("child");
+					survivor = parent.Find("child")->Get<shared_ptr<Scope>>();
+					Assert::IsNotNull(survivor->Search(myInt, cache));
+				}
+				Assert::IsNull(survivor->GetParent());
+				Assert::IsNull(survivor->Search(myInt, cache));
+			}
 		}
 
 		TEST_METHOD(Append)
@@ -277,6 +384,15 @@ namespace LibraryDesktopTests
 			Datum& datumRef3 = scope.Append("datum2");
 			Assert::AreEqual(Datum{}, datumRef);
 			Assert::AreNotSame(datumRef, datumRef3);
+
+			// Datums are not moved when the scope grows
+			for (int32_t i = 0; i < 100; ++i)
+			{
+				scope.Append("grow"s + to_string(i)) = i;
+			}
+			Assert::AreSame(datumRef, *scope.Find("datum"));
+			Assert::AreSame(datumRef3, scope[1]);
+			Assert::AreEqual(99, scope[101].Get<int32_t>());
 		}
 
 		TEST_METHOD(AppendScope)
@@ -357,6 +473,150 @@ namespace LibraryDesktopTests
 			Datum& notTableDatum = parentScope1->Append("notTable");
 			notTableDatum.SetType(DatumTypes::Float);
 			Assert::ExpectException<runtime_error>([&parentScope1, &nestedScope]() { parentScope1->Adopt(nestedScope, "notTable"); });
+
+			// Orphan out of the middle of a datum, then out of a datum edited directly
+			{
+				Scope parent;
+				Vector<shared_ptr<Scope>> children(4);
+				for (int32_t i = 0; i < 4; ++i)
+				{
+					shared_ptr<Scope> child = make_shared<Scope>();
+					child->Append("Index"_sym) = i;
+					parent.Adopt(child, "Children"_sym);
+					children.PushBack(std::move(child));
+				}
+				Scope other;
+				other.Adopt(children[1], "Children"_sym);
+				const Datum& remaining = *parent.Find("Children"_sym);
+				// The last child fills the emptied slot
+				Assert::AreEqual(3_z, remaining.Size());
+				Assert::AreEqual(children[3].get(), remaining.Get<shared_ptr<Scope>>(1).get());
+				Assert::AreEqual(children[2].get(), remaining.Get<shared_ptr<Scope>>(2).get());
+				Assert::AreEqual(&parent.At("Children"_sym), parent.FindContainedScope(*children[3]).first);
+				Assert::AreEqual(1_z, parent.FindContainedScope(*children[3]).second);
+
+				parent.At("Children"_sym).RemoveAt(0);
+				other.Adopt(children[3], "Children"_sym);
+				Assert::AreEqual(1_z, remaining.Size());
+				Assert::AreEqual(children[2].get(), remaining.Get<shared_ptr<Scope>>(0).get());
+				Assert::AreEqual(2_z, other.At("Children"_sym).Size());
+			}
+		}
+
+		TEST_METHOD(ParentSlot)
+		{
+			const size_t count = 16;
+			Scope parent1;
+			Scope parent2;
+			Vector<shared_ptr<Scope>> children(count);
+			for (size_t i = 0; i < count; ++i)
+			{
+				shared_ptr<Scope> child = make_shared<Scope>();
+				parent1.Adopt(child, "Children"_sym);
+				Assert::IsTrue(child->GetParentSlot() == pair{ &parent1.At("Children"_sym), i });
+				children.PushBack(std::move(child));
+			}
+			Assert::IsTrue(Scope().GetParentSlot() == pair<Datum*, size_t>{ nullptr, 0 });
+
+			// Every child's recorded slot holds it, in whichever parent it is in
+			auto checkSlots = [&children]()
+			{
+				for (const shared_ptr<Scope>& child : children)
+				{
+					const auto [datum, index] = child->GetParentSlot();
+					Assert::IsNotNull(datum);
+					Assert::IsTrue(index < datum->Size());
+					Assert::AreEqual(child.get(), datum->Get<shared_ptr<Scope>>(index).get());
+					Assert::IsTrue(child->GetParent()->FindContainedScope(*child) == pair{ datum, index });
+				}
+			};
+
+			// Move children one at a time from the front, middle and back of the old datum
+			for (size_t i = 0; i < count; ++i)
+			{
+				const Datum& from = parent1.At("Children"_sym);
+				const size_t index = (i % 3 == 0) ? 0 : (i % 3 == 1) ? from.Size() / 2 : from.Size() - 1;
+				parent2.Adopt(from.Get<shared_ptr<Scope>>(index), "Children"_sym);
+				Assert::AreEqual(count - i - 1, from.Size());
+				Assert::AreEqual(i + 1, parent2.At("Children"_sym).Size());
+				checkSlots();
+			}
+
+			// And back again, in the order they were moved
+			for (size_t i = 0; i < count; ++i)
+			{
+				parent1.Adopt(parent2.At("Children"_sym).Get<shared_ptr<Scope>>(0), "Children"_sym);
+				checkSlots();
+			}
+			Assert::AreEqual(0_z, parent2.At("Children"_sym).Size());
+		}
+
+		TEST_METHOD(AdoptAll)
+		{
+			Scope parent1;
+			Scope parent2;
+			Vector<shared_ptr<Scope>> children(6);
+			for (int32_t i = 0; i < 6; ++i)
+			{
+				shared_ptr<Scope> child = make_shared<Scope>();
+				child->Append("Index"_sym) = i;
+				(i % 2 == 0 ? parent1 : parent2).Adopt(child, "Children"_sym);
+				children.PushBack(std::move(child));
+			}
+			shared_ptr<Scope> unparented = make_shared<Scope>();
+
+			// Scopes move in the given order, from any parent or none, and each is adopted once
+			Scope target;
+			const shared_ptr<Scope> moved[] = { children[4], children[1], unparented, children[0], children[4] };
+			target.AdoptAll(moved, "Children"_sym);
+
+			const Datum& adopted = target.At("Children"_sym);
+			Assert::AreEqual(4_z, adopted.Size());
+			Assert::AreEqual(children[4].get(), adopted.Get<shared_ptr<Scope>>(0).get());
+			Assert::AreEqual(children[1].get(), adopted.Get<shared_ptr<Scope>>(1).get());
+			Assert::AreEqual(unparented.get(), adopted.Get<shared_ptr<Scope>>(2).get());
+			Assert::AreEqual(children[0].get(), adopted.Get<shared_ptr<Scope>>(3).get());
+			for (size_t i = 0; i < adopted.Size(); ++i)
+			{
+				const Scope& child = *adopted.Get<shared_ptr<Scope>>(i);
+				Assert::AreEqual(&target, child.GetParent());
+				Assert::AreEqual(i, target.FindContainedScope(child).second);
+			}
+
+			// The parents keep the rest in order
+			const Datum& left1 = parent1.At("Children"_sym);
+			Assert::AreEqual(1_z, left1.Size());
+			Assert::AreEqual(children[2].get(), left1.Get<shared_ptr<Scope>>(0).get());
+			const Datum& left2 = parent2.At("Children"_sym);
+			Assert::AreEqual(2_z, left2.Size());
+			Assert::AreEqual(children[3].get(), left2.Get<shared_ptr<Scope>>(0).get());
+			Assert::AreEqual(children[5].get(), left2.Get<shared_ptr<Scope>>(1).get());
+			Assert::AreEqual(1_z, parent2.FindContainedScope(*children[5]).second);
+
+			// Scopes can be adopted straight from the table datum that holds them, even as its only owner
+			Scope& sibling = target.AppendScope("Sibling"_sym);
+			for (int32_t i = 0; i < 3; ++i)
+			{
+				Datum& index = sibling.AppendScope("Children"_sym).Append("Index"_sym);
+				index = 10 + i;
+			}
+			target.AdoptAll(sibling.At("Children"_sym).AsSpan<shared_ptr<Scope>>().subspan(1), "Children"_sym);
+			Assert::AreEqual(6_z, adopted.Size());
+			Assert::AreEqual(11, adopted.Get<shared_ptr<Scope>>(4)->At("Index"_sym).Get<int32_t>());
+			Assert::AreEqual(12, adopted.Get<shared_ptr<Scope>>(5)->At("Index"_sym).Get<int32_t>());
+			Assert::AreEqual(&target, adopted.Get<shared_ptr<Scope>>(5)->GetParent());
+			const Datum& leftSibling = sibling.At("Children"_sym);
+			Assert::AreEqual(1_z, leftSibling.Size());
+			Assert::AreEqual(10, leftSibling.Get<shared_ptr<Scope>>(0)->At("Index"_sym).Get<int32_t>());
+
+			// Nothing moves when a scope cannot be adopted
+			const shared_ptr<Scope> self[] = { children[2], children[4] };
+			Assert::ExpectException<runtime_error>([&self]() { self[1]->AdoptAll(self, "Children"_sym); });
+			Assert::ExpectException<runtime_error>([&self]() { self[0]->AdoptAll(self, Symbol()); });
+			parent1.Append("Value"_sym) = 1;
+			Assert::ExpectException<runtime_error>([&parent1, &self]() { parent1.AdoptAll(self, "Value"_sym); });
+			Assert::AreEqual(&parent1, children[2]->GetParent());
+			Assert::AreEqual(&target, children[4]->GetParent());
 		}
 
 		TEST_METHOD(IsAncestor)
@@ -491,6 +751,51 @@ namespace LibraryDesktopTests
 			Assert::IsTrue(scope != scope1);
 			Assert::IsFalse(scope.Equals(&scope1));
 		}
+
+		TEST_METHOD(MemoryResource)
+		{
+			CountingResource resource;
+			CountingResource otherResource;
+			{
+				Scope scope(&resource);
+				Assert::IsTrue(scope.GetAllocator().resource() == &resource);
+				scope.Append("Health"_sym) = 100;
+				scope.Append("Name"_sym) = "Monster"s;
+				Assert::IsTrue(resource.BytesInUse > 0);
+
+				// Nested scopes built on the resource and adopted
+				shared_ptr<Scope> child = make_shared<Scope>(4, &resource);
+				child->Append("Speed"_sym) = 2.5f;
+				scope.Adopt(child, "Children"_sym);
+				Assert::IsTrue(&scope == child->GetParent());
+
+				// The copy's datums and their index are one allocation each
+				Scope copy(scope, &otherResource);
+				Assert::IsTrue(copy == scope);
+				Assert::AreEqual(size_t(2), otherResource.Allocations);
+
+				// Assignment keeps each scope on its own resource
+				Scope other(&otherResource);
+				other = scope;
+				Assert::IsTrue(other == scope);
+				Assert::IsTrue(other.GetAllocator().resource() == &otherResource);
+
+				Scope moved(&otherResource);
+				moved = std::move(copy);
+				Assert::IsTrue(moved == scope);
+				Assert::IsTrue(&moved == moved["Children"_sym].Get<shared_ptr<Scope>>()->GetParent());
+
+				// Scopes on different resources are copied rather than moved
+				Scope movedAcross(&resource);
+				movedAcross = moved;
+				Assert::IsTrue(movedAcross == scope);
+				Assert::IsTrue(movedAcross.GetAllocator().resource() == &resource);
+				Assert::IsTrue(&movedAcross == movedAcross["Children"_sym].Get<shared_ptr<Scope>>()->GetParent());
+			}
+			Assert::AreEqual(size_t(0), resource.BytesInUse);
+			Assert::AreEqual(size_t(0), otherResource.BytesInUse);
+		}
+
 	private:
 		inline static _CrtMemState _startMemState;
 	};
@@ -0,0 +1,189 @@
+#include "pch.h"
+#include "CppUnitTest.h"
+#include "Symbol.h"
+#include "HashMap.h"
+#include "Scope.h"
+#include "Vector.h"
+#include <thread>
+#include <atomic>
+
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+using namespace FieaGameEngine;
+using namespace std;
+using namespace std::string_literals;
+
+namespace LibraryDesktopTests
+{
+	TEST_CLASS(SymbolTests)
+	{
+	public:
+		TEST_METHOD_INITIALIZE(Initialize)
+		{
+#if defined(DEBUG) || defined(_DEBUG)
+			_CrtSetDbgFlag(_CRTDBG_ALLOC_MEM_DF);
+			_CrtMemCheckpoint(&_startMemState);
+#endif
+		}
+
+		TEST_METHOD_CLEANUP(Cleanup)
+		{
+#if defined(DEBUG) || defined(_DEBUG)
+			_CrtMemState endMemState, diffMemState;
+			_CrtMemCheckpoint(&endMemState);
+			if (_CrtMemDifference(&diffMemState, &_startMemState,
+				&endMemState))
+			{
+				_CrtMemDumpStatistics(&diffMemState);
+				Assert::Fail(L"Memory Leaks!");
+			}
+#endif
+		}
+
+		TEST_METHOD(Empty)
+		{
+			const Symbol symbol;
+			Assert::IsTrue(symbol.IsEmpty());
+			Assert::AreEqual(0u, symbol.Id());
+			Assert::AreEqual(""s, symbol.Str());
+			Assert::IsTrue(Symbol("") == symbol);
+			Assert::IsTrue(Symbol::Find("") == symbol);
+		}
+
+		TEST_METHOD(Interning)
+		{
+			const Symbol first("SymbolTestsInterning");
+			const size_t count = Symbol::Count();
+			Assert::IsFalse(first.IsEmpty());
+			Assert::AreEqual("SymbolTestsInterning"s, first.Str());
+
+			// Same string maps to the same id and storage
+			const string copy = "SymbolTestsInterning"s;
+			const Symbol second(copy);
+			Assert::AreEqual(first.Id(), second.Id());
+			Assert::AreEqual(first.Hash(), second.Hash());
+			Assert::AreSame(first.Str(), second.Str());
+			Assert::IsTrue(first == second);
+			Assert::AreEqual(count, Symbol::Count());
+
+			// Different strings map to different ids
+			const Symbol other("SymbolTestsInterning2");
+			Assert::AreNotEqual(first.Id(), other.Id());
+			Assert::IsFalse(first == other);
+			Assert::AreEqual(count + 1, Symbol::Count());
+
+			// Comparing against strings
+			Assert::IsTrue(first == "SymbolTestsInterning"sv);
+			Assert::IsTrue(first == copy);
+			Assert::IsFalse(first == "SymbolTestsInterning2");
+		}
+
+		TEST_METHOD(Threads)
+		{
+			// Threads interning the same names get the same symbols
+			constexpr size_t threadCount = 4;
+			constexpr size_t nameCount = 200;
+			Vector<Vector<Symbol>> interned(threadCount);
+			for (size_t i = 0; i < threadCount; ++i)
+			{
+				interned.EmplaceBack(nameCount);
+			}
+			std::atomic<size_t> mismatches = 0;
+			{
+				Vector<std::thread> threads(threadCount);
+				for (size_t i = 0; i < threadCount; ++i)
+				{
+					threads.EmplaceBack([&symbols = interned[i], &mismatches]()
+					{
+						for (size_t j = 0; j < nameCount; ++j)
+						{
+							const string name = "SymbolTestsThreads"s + to_string(j);
+							symbols.PushBack(Symbol(name));
+							// Reading while other threads intern
+							if (symbols.Back().Str() != name || Symbol::Find(name) != symbols.Back() || symbols.Front().Str() != "SymbolTestsThreads0"s)
+							{
+								++mismatches;
+							}
+						}
+					});
+				}
+				for (std::thread& thread : threads)
+				{
+					thread.join();
+				}
+			}
+			Assert::AreEqual(size_t(0), mismatches.load());
+
+			for (size_t j = 0; j < nameCount; ++j)
+			{
+				const Symbol symbol = Symbol::Find("SymbolTestsThreads"s + to_string(j));
+				Assert::AreEqual("SymbolTestsThreads"s + to_string(j), symbol.Str());
+				for (const Vector<Symbol>& symbols : interned)
+				{
+					Assert::IsTrue(symbols[j] == symbol);
+				}
+			}
+		}
+
+		TEST_METHOD(Find)
+		{
+			Assert::IsTrue(Symbol::Find("SymbolTestsNeverInterned").IsEmpty());
+			const size_t count = Symbol::Count();
+			Assert::IsTrue(Symbol::Find("SymbolTestsNeverInterned").IsEmpty());
+			Assert::AreEqual(count, Symbol::Count());
+
+			const Symbol symbol("SymbolTestsFind");
+			Assert::IsTrue(Symbol::Find("SymbolTestsFind") == symbol);
+
+			// Views that are not null terminated
+			const string buffer = "SymbolTestsFindMore"s;
+			Assert::IsTrue(Symbol::Find(string_view(buffer.data(), 15)) == symbol);
+		}
+
+		TEST_METHOD(Literal)
+		{
+			const Symbol symbol = "SymbolTestsLiteral"_sym;
+			Assert::AreEqual("SymbolTestsLiteral"s, symbol.Str());
+			Assert::IsTrue(symbol == Symbol("SymbolTestsLiteral"));
+
+			// The literal interns once and returns the same symbol each time
+			for (size_t i = 0; i < 3; ++i)
+			{
+				Assert::IsTrue("SymbolTestsLiteral"_sym == symbol);
+			}
+		}
+
+		TEST_METHOD(Hash)
+		{
+			const Symbol symbol("SymbolTestsHash");
+			Assert::AreEqual(symbol.Hash(), DefaultHash<Symbol>{}(symbol));
+			Assert::AreEqual(symbol.Hash(), DefaultHash<const Symbol>{}(symbol));
+
+			HashMap<Symbol, int32_t> hashMap;
+			hashMap.Insert({ "SymbolTestsHashA"_sym, 1 });
+			hashMap.Insert({ "SymbolTestsHashB"_sym, 2 });
+			Assert::AreEqual(1, hashMap.At(Symbol("SymbolTestsHashA")));
+			Assert::AreEqual(2, hashMap.At("SymbolTestsHashB"_sym));
+			Assert::IsFalse(hashMap.ContainsKey(symbol));
+		}
+
+		TEST_METHOD(ScopeKeys)
+		{
+			Scope first;
+			Scope second;
+			first.Append("SymbolTestsKey");
+			second.Append("SymbolTestsKey"s);
+
+			const Symbol key("SymbolTestsKey");
+			Assert::IsNotNull(first.Find(key));
+			Assert::IsNotNull(second.Find(key));
+			Assert::IsTrue(first.Find(key) == first.Find("SymbolTestsKey"));
+
+			// Empty names are rejected for symbols and strings alike
+			Assert::ExpectException<runtime_error>([&first]() { first.Append(Symbol()); });
+			Assert::ExpectException<runtime_error>([&first]() { first.Append(""); });
+		}
+
+	private:
+		inline static _CrtMemState _startMemState;
+	};
+}
@@ -0,0 +1,131 @@
+#include "pch.h"
+#include "CppUnitTest.h"
+#include "TypeRegistry.h"
+#include "Monster.h"
+#include "ActionList.h"
+#include "ActionIf.h"
+#include "ActionIncrement.h"
+#include "ActionEvent.h"
+#include "ReactionAttributed.h"
+#include "AttributedFoo.h"
+#include <stdexcept>
+
+using namespace UnitTests;
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+using namespace FieaGameEngine;
+using namespace std;
+using namespace std::string_literals;
+
+namespace LibraryDesktopTests
+{
+	TEST_CLASS(TypeRegistryTests)
+	{
+	public:
+		TEST_METHOD_INITIALIZE(Initialize)
+		{
+#if defined(DEBUG) || defined(_DEBUG)
+			_CrtSetDbgFlag(_CRTDBG_ALLOC_MEM_DF);
+			_CrtMemCheckpoint(&_startMemState);
+#endif
+		}
+
+		TEST_METHOD_CLEANUP(Cleanup)
+		{
+#if defined(DEBUG) || defined(_DEBUG)
+			_CrtMemState endMemState, diffMemState;
+			_CrtMemCheckpoint(&endMemState);
+			if (_CrtMemDifference(&diffMemState, &_startMemState,
+				&endMemState))
+			{
+				_CrtMemDumpStatistics(&diffMemState);
+				Assert::Fail(L"Memory Leaks!");
+			}
+#endif
+		}
+
+		TEST_METHOD(Registration)
+		{
+			// Classes register at static initialization
+			Assert::IsTrue(TypeRegistry::Size() > 0);
+			Assert::IsNotNull(TypeRegistry::Find(Attributed::TypeIdClass()));
+			Assert::IsNotNull(TypeRegistry::Find(GameObject::TypeIdClass()));
+			Assert::IsNotNull(TypeRegistry::Find(AttributedFoo::TypeIdClass()));
+			Assert::IsNull(TypeRegistry::Find(Scope::TypeIdClass()));
+
+			const TypeRegistry::TypeInfo& typeInfo = TypeRegistry::Get(Monster::TypeIdClass());
+			Assert::IsTrue(&Monster::RegisteredType() == &typeInfo);
+			Assert::AreEqual(Monster::TypeIdClass(), typeInfo.TypeId);
+			Assert::AreEqual(GameObject::TypeIdClass(), typeInfo.ParentTypeId);
+			Assert::AreEqual(Attributed::TypeIdClass(), TypeRegistry::Get(GameObject::TypeIdClass()).ParentTypeId);
+
+			Assert::ExpectException<runtime_error>([]() { auto& unregistered = TypeRegistry::Get(Scope::TypeIdClass()); UNREFERENCED_LOCAL(unregistered); });
+		}
+
+		TEST_METHOD(Register)
+		{
+			// Registering again returns the existing entry
+			const size_t size = TypeRegistry::Size();
+			const TypeRegistry::TypeInfo& typeInfo = TypeRegistry::Register(GameObject::TypeIdClass(), &Attributed::RegisteredType(), {});
+			Assert::IsTrue(&GameObject::RegisteredType() == &typeInfo);
+			Assert::AreEqual(size, TypeRegistry::Size());
+			Assert::AreEqual(size_t(5), typeInfo.Signatures.Size());
+		}
+
+		TEST_METHOD(FlattenedSignatures)
+		{
+			// Parent signatures come first
+			const Vector<Signature>& signatures = ActionList::AllSignatures();
+			Assert::AreEqual(size_t(2), signatures.Size());
+			Assert::AreEqual("Name"s, signatures[0].Name.Str());
+			Assert::AreEqual("Actions"s, signatures[1].Name.Str());
+			Assert::IsTrue(signatures[1].Type == DatumTypes::Table);
+
+			// A class without signatures of its own has its parent's
+			Assert::AreEqual(GameObject::AllSignatures().Size(), Monster::AllSignatures().Size());
+			Assert::IsTrue(Attributed::AllSignatures().IsEmpty());
+
+			// The table is built once and shared by every call and instance
+			Assert::IsTrue(&ActionList::AllSignatures() == &ActionList::AllSignatures());
+			ActionList actionList;
+			const RTTI& rtti = actionList;
+			Assert::IsTrue(&ActionList::AllSignatures() == &TypeRegistry::Get(rtti.TypeIdInstance()).Signatures);
+		}
+
+		TEST_METHOD(IndexOf)
+		{
+			const TypeRegistry::TypeInfo& typeInfo = GameObject::RegisteredType();
+			for (size_t i = 0; i < typeInfo.Signatures.Size(); ++i)
+			{
+				Assert::AreEqual(i, typeInfo.IndexOf(typeInfo.Signatures[i].Name));
+				Assert::IsTrue(typeInfo.IsPrescribed(typeInfo.Signatures[i].Name));
+			}
+
+			Assert::AreEqual(typeInfo.Signatures.Size(), typeInfo.IndexOf(Symbol("TypeRegistryTestsMissing")));
+			Assert::AreEqual(typeInfo.Signatures.Size(), typeInfo.IndexOf("this"_sym));
+			Assert::AreEqual(typeInfo.Signatures.Size(), typeInfo.IndexOf(Symbol()));
+			Assert::IsFalse(typeInfo.IsPrescribed("this"_sym));
+			Assert::IsFalse(typeInfo.IsPrescribed(Symbol()));
+		}
+
+		TEST_METHOD(SlotCounts)
+		{
+			// Each Slots enum must list every registered signature
+			Assert::AreEqual(Attributed::AllSignatures().Size(), Attributed::SlotCount);
+			Assert::AreEqual(Action::AllSignatures().Size(), Action::SlotCount);
+			Assert::AreEqual(ActionList::AllSignatures().Size(), ActionList::SlotCount);
+			Assert::AreEqual(ActionIf::AllSignatures().Size(), ActionIf::SlotCount);
+			Assert::AreEqual(ActionIncrement::AllSignatures().Size(), ActionIncrement::SlotCount);
+			Assert::AreEqual(ActionEvent::AllSignatures().Size(), ActionEvent::SlotCount);
+			Assert::AreEqual(Reaction::AllSignatures().Size(), Reaction::SlotCount);
+			Assert::AreEqual(ReactionAttributed::AllSignatures().Size(), ReactionAttributed::SlotCount);
+
+			const TypeRegistry::TypeInfo& typeInfo = ActionIf::RegisteredType();
+			Assert::AreEqual(static_cast<size_t>(ActionIf::Slots::Condition), typeInfo.IndexOf("Condition"_sym));
+			Assert::AreEqual(static_cast<size_t>(ActionIf::Slots::ElseBlock), typeInfo.IndexOf("ElseBlock"_sym));
+			Assert::AreEqual(static_cast<size_t>(ActionList::Slots::Actions), ActionList::RegisteredType().IndexOf("Actions"_sym));
+		}
+
+	private:
+		inline static _CrtMemState _startMemState;
+	};
+}
@@ -0,0 +1,266 @@
+#include "pch.h"
+#include "CppUnitTest.h"
+#include <cstdint>
+#include "Foo.h"
+#include "UnrolledSList.h"
+#include "CountingResource.h"
+#include "ToStringSpecializations.h"
+
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+using namespace FieaGameEngine;
+using namespace UnitTests;
+using namespace std;
+using namespace std::string_literals;
+
+namespace LibraryDesktopTests
+{
+	TEST_CLASS(UnrolledSListTests)
+	{
+		// Small nodes so a handful of elements spans several of them
+		using List = UnrolledSList<Foo, 4>;
+
+	public:
+		TEST_METHOD_INITIALIZE(Initialize)
+		{
+#if defined(DEBUG) || defined(_DEBUG)
+			_CrtSetDbgFlag(_CRTDBG_ALLOC_MEM_DF);
+			_CrtMemCheckpoint(&_startMemState);
+#endif
+		}
+
+		TEST_METHOD_CLEANUP(Cleanup)
+		{
+#if defined(DEBUG) || defined(_DEBUG)
+			_CrtMemState endMemState, diffMemState;
+			_CrtMemCheckpoint(&endMemState);
+			if (_CrtMemDifference(&diffMemState, &_startMemState,
+				&endMemState))
+			{
+				_CrtMemDumpStatistics(&diffMemState);
+				Assert::Fail(L"Memory Leaks!");
+			}
+#endif
+		}
+
+		TEST_METHOD(Constructor)
+		{
+			List list;
+			Assert::AreEqual(size_t(0), list.Size());
+			Assert::AreEqual(size_t(0), list.NodeCount());
+			Assert::IsTrue(list.IsEmpty());
+			Assert::IsTrue(list.begin() == list.end());
+			Assert::ExpectException<runtime_error>([&list]() { auto& front = list.Front(); UNREFERENCED_LOCAL(front); });
+			Assert::ExpectException<runtime_error>([&list]() { auto& back = list.Back(); UNREFERENCED_LOCAL(back); });
+			Assert::ExpectException<runtime_error>([&list]() { list.PopFront(); });
+			Assert::ExpectException<runtime_error>([&list]() { list.PopBack(); });
+
+			List initialized{ Foo(1), Foo(2), Foo(3), Foo(4), Foo(5) };
+			Assert::AreEqual(size_t(5), initialized.Size());
+			Assert::AreEqual(size_t(2), initialized.NodeCount());
+			Assert::AreEqual(Foo(1), initialized.Front());
+			Assert::AreEqual(Foo(5), initialized.Back());
+
+			static_assert(DefaultUnrolledNodeCapacity<int32_t> == 28);
+			static_assert(UnrolledSList<int32_t>::NodeSize == 128);
+		}
+
+		TEST_METHOD(PushBackAndPopFront)
+		{
+			List list;
+			for (int32_t i = 0; i < 10; ++i)
+			{
+				auto it = list.PushBack(Foo(i));
+				Assert::AreEqual(Foo(i), *it);
+				Assert::AreEqual(Foo(i), list.Back());
+				Assert::AreEqual(Foo(0), list.Front());
+			}
+			Assert::AreEqual(size_t(10), list.Size());
+			Assert::AreEqual(size_t(3), list.NodeCount());
+
+			for (int32_t i = 0; i < 10; ++i)
+			{
+				Assert::AreEqual(Foo(i), list.Front());
+				list.PopFront();
+			}
+			Assert::IsTrue(list.IsEmpty());
+			Assert::AreEqual(size_t(0), list.NodeCount());
+
+			// Elements are constructed in place
+			const Foo& emplaced = *list.EmplaceBack(7);
+			Assert::AreEqual(Foo(7), emplaced);
+			const Foo copy(8);
+			list.PushBack(copy);
+			Assert::AreEqual(copy, list.Back());
+		}
+
+		TEST_METHOD(PushFrontAndPopBack)
+		{
+			List list;
+			for (int32_t i = 0; i < 10; ++i)
+			{
+				auto it = list.PushFront(Foo(i));
+				Assert::AreEqual(Foo(i), *it);
+				Assert::AreEqual(Foo(i), list.Front());
+				Assert::AreEqual(Foo(0), list.Back());
+			}
+			Assert::AreEqual(size_t(3), list.NodeCount());
+
+			for (int32_t i = 0; i < 10; ++i)
+			{
+				Assert::AreEqual(Foo(i), list.Back());
+				list.PopBack();
+			}
+			Assert::IsTrue(list.IsEmpty());
+			Assert::AreEqual(size_t(0), list.NodeCount());
+
+			const Foo& emplaced = *list.EmplaceFront(3);
+			Assert::AreEqual(Foo(3), emplaced);
+			const Foo copy(4);
+			list.PushFront(copy);
+			Assert::AreEqual(copy, list.Front());
+			Assert::AreEqual(Foo(3), list.Back());
+		}
+
+		TEST_METHOD(MixedEnds)
+		{
+			List list;
+			list.PushBack(Foo(2));
+			list.PushFront(Foo(1));
+			list.PushBack(Foo(3));
+			list.PushFront(Foo(0));
+
+			int32_t expected = 0;
+			for (const Foo& foo : list)
+			{
+				Assert::AreEqual(Foo(expected++), foo);
+			}
+			Assert::AreEqual(4, expected);
+
+			// References stay put while other elements come and go
+			Foo& two = *(++(++list.begin()));
+			for (int32_t i = 4; i < 20; ++i)
+			{
+				list.PushBack(Foo(i));
+			}
+			list.PopFront();
+			list.PopFront();
+			Assert::AreEqual(Foo(2), two);
+			Assert::IsTrue(&two == &list.Front());
+
+			list.Clear();
+			Assert::AreEqual(size_t(0), list.Size());
+			Assert::AreEqual(size_t(0), list.NodeCount());
+			Assert::IsTrue(list.begin() == list.end());
+		}
+
+		TEST_METHOD(Iterators)
+		{
+			List list{ Foo(0), Foo(1), Foo(2), Foo(3), Foo(4), Foo(5) };
+			List::iterator it = list.begin();
+			Assert::AreEqual(Foo(0), *it);
+			Assert::AreEqual(Foo(0), *it++);
+			Assert::AreEqual(Foo(1), *it);
+			Assert::AreEqual(Foo(2), *++it);
+			*it = Foo(20);
+			Assert::AreEqual(Foo(20), *it);
+
+			const List& constList = list;
+			List::const_iterator constIt = constList.begin();
+			Assert::IsTrue(constIt == list.cbegin());
+			List::const_iterator converted = list.begin();
+			Assert::IsTrue(converted == constIt);
+			Assert::AreEqual(0, constIt->Data());
+			size_t count = 0;
+			for (; constIt != constList.end(); ++constIt)
+			{
+				++count;
+			}
+			Assert::AreEqual(size_t(6), count);
+			Assert::IsTrue(constIt == list.cend());
+
+			// Incrementing the end stays at the end
+			List::iterator end = list.end();
+			++end;
+			Assert::IsTrue(end == list.end());
+
+#if FIEA_CHECKED_ITERATORS
+			List other;
+			Assert::IsFalse(list.end() == other.end());
+			Assert::ExpectException<runtime_error>([&list]() { auto& value = *list.end(); UNREFERENCED_LOCAL(value); });
+			Assert::ExpectException<runtime_error>([&constList]() { auto& value = *constList.end(); UNREFERENCED_LOCAL(value); });
+			Assert::ExpectException<runtime_error>([]() { List::iterator unassociated; ++unassociated; });
+			Assert::ExpectException<runtime_error>([]() { List::const_iterator unassociated; ++unassociated; });
+#endif
+		}
+
+		TEST_METHOD(CopySemantics)
+		{
+			List list{ Foo(0), Foo(1), Foo(2), Foo(3), Foo(4) };
+			list.PushFront(Foo(-1));
+
+			List copy(list);
+			Assert::AreEqual(list.Size(), copy.Size());
+			Assert::IsTrue(equal(list.begin(), list.end(), copy.begin()));
+			Assert::IsTrue(&list.Front() != &copy.Front());
+
+			List assigned{ Foo(9) };
+			assigned = list;
+			Assert::AreEqual(list.Size(), assigned.Size());
+			Assert::IsTrue(equal(list.begin(), list.end(), assigned.begin()));
+		}
+
+		TEST_METHOD(MoveSemantics)
+		{
+			List list{ Foo(0), Foo(1), Foo(2), Foo(3), Foo(4) };
+			Foo* front = &list.Front();
+
+			List moved(std::move(list));
+			Assert::AreEqual(size_t(5), moved.Size());
+			Assert::AreEqual(size_t(2), moved.NodeCount());
+			Assert::IsTrue(front == &moved.Front());
+#pragma warning(push)
+#pragma warning(disable:26800)
+			Assert::IsTrue(list.IsEmpty());
+			Assert::AreEqual(size_t(0), list.NodeCount());
+#pragma warning(pop)
+
+			List assigned{ Foo(9) };
+			assigned = std::move(moved);
+			Assert::AreEqual(size_t(5), assigned.Size());
+			Assert::IsTrue(front == &assigned.Front());
+		}
+
+		TEST_METHOD(MemoryResource)
+		{
+			CountingResource resource;
+			CountingResource otherResource;
+			{
+				List list(&resource);
+				Assert::IsTrue(list.GetAllocator().resource() == &resource);
+				for (int32_t i = 0; i < 8; ++i)
+				{
+					list.PushBack(Foo(i));
+				}
+				// One allocation per node rather than per element
+				Assert::AreEqual(size_t(2), resource.Allocations);
+				Assert::AreEqual(size_t(2) * List::NodeSize, resource.BytesInUse);
+
+				List copy(list, &otherResource);
+				Assert::AreEqual(size_t(2), otherResource.Allocations);
+				Assert::AreEqual(list.Back(), copy.Back());
+
+				// Move assignment across resources moves the elements into our nodes
+				copy.PopBack();
+				copy = std::move(list);
+				Assert::IsTrue(copy.GetAllocator().resource() == &otherResource);
+				Assert::AreEqual(size_t(8), copy.Size());
+				Assert::AreEqual(Foo(7), copy.Back());
+				Assert::AreEqual(size_t(0), resource.BytesInUse);
+			}
+			Assert::AreEqual(size_t(0), otherResource.BytesInUse);
+		}
+
+	private:
+		inline static _CrtMemState _startMemState;
+	};
+}
@@ -0,0 +1,152 @@
+#include "pch.h"
+#include "CppUnitTest.h"
+#include "Benchmark.h"
+#include "Vector.h"
+#include "HashMap.h"
+#include "Datum.h"
+
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+using namespace FieaGameEngine;
+using namespace UnitTests;
+using namespace std;
+using namespace std::string_literals;
+
+namespace LibraryDesktopTests
+{
+	TEST_CLASS(VectorBenchmarks)
+	{
+	public:
+		TEST_METHOD(GrowthByRelocation)
+		{
+			constexpr size_t elementCount = 10000;
+			shared_ptr<int32_t> shared = make_shared<int32_t>(7);
+
+			Benchmark::Report("-- PushBack 10000 elements from empty (per vector) --"s);
+			RunGrowth("int32_t (trivially copyable)"s, elementCount, []() { return int32_t(7); });
+			RunGrowth("shared_ptr (relocatable by specialization)"s, elementCount, [&shared]() { return shared; });
+			RunGrowth("Datum (relocatable by opt in)"s, elementCount, []() { return Datum{ 7 }; });
+			RunGrowth("std::string (moved and destroyed)"s, elementCount, []() { return "seven"s; });
+		}
+
+		TEST_METHOD(PolicyFunctors)
+		{
+			constexpr size_t elementCount = 10000;
+			using TypeErasedVector = Vector<int32_t, DynamicReserveStrategy, function<bool(const int32_t&, const int32_t&)>>;
+
+			Benchmark::Report("-- Vector with inlined versus std::function policies --"s);
+			Benchmark::Report("sizeof(Vector<int32_t>): "s + to_string(sizeof(Vector<int32_t>)) + " inlined, "s + to_string(sizeof(TypeErasedVector)) + " std::function"s);
+
+			const double growInlined = Benchmark::Measure(64, []()
+			{
+				Vector<int32_t> vector;
+				for (size_t i = 0; i < elementCount; ++i)
+				{
+					vector.PushBack(static_cast<int32_t>(i));
+				}
+				Benchmark::DoNotOptimize(vector);
+			});
+			const double growTypeErased = Benchmark::Measure(64, []()
+			{
+				TypeErasedVector vector(0, DefaultReserveStrategy{});
+				for (size_t i = 0; i < elementCount; ++i)
+				{
+					vector.PushBack(static_cast<int32_t>(i));
+				}
+				Benchmark::DoNotOptimize(vector);
+			});
+			Benchmark::Report("PushBack 10000, inlined strategy (per vector)"s, growInlined);
+			Benchmark::Report("PushBack 10000, std::function strategy (per vector)"s, growTypeErased);
+
+			Vector<int32_t> inlined;
+			TypeErasedVector typeErased(0, DefaultReserveStrategy{});
+			for (size_t i = 0; i < elementCount; ++i)
+			{
+				inlined.PushBack(static_cast<int32_t>(i));
+				typeErased.PushBack(static_cast<int32_t>(i));
+			}
+			size_t found = 0;
+			const double findInlined = Benchmark::Measure(64, [&inlined, &found]()
+			{
+				found += inlined.Find(-1) == inlined.end() ? 1 : 0;
+			});
+			const double findTypeErased = Benchmark::Measure(64, [&typeErased, &found]()
+			{
+				found += typeErased.Find(-1, DefaultEquality<int32_t>{}) == typeErased.end() ? 1 : 0;
+			});
+			Assert::AreEqual(size_t(130), found);
+			Benchmark::Report("Find miss in 10000, inlined equality"s, findInlined);
+			Benchmark::Report("Find miss in 10000, std::function equality"s, findTypeErased);
+		}
+
+		TEST_METHOD(IterationThroughput)
+		{
+			Benchmark::Report("-- Summing integers (per element), iterators are "s + (FIEA_CHECKED_ITERATORS ? "checked"s : "unchecked"s) + " --"s);
+			for (size_t elementCount : { size_t(64), size_t(4096), size_t(262144) })
+			{
+				Vector<int32_t> vector(elementCount);
+				for (size_t i = 0; i < elementCount; ++i)
+				{
+					vector.PushBack(static_cast<int32_t>(i % 7));
+				}
+				HashMap<int32_t, int32_t> hashMap(elementCount);
+				for (size_t i = 0; i < elementCount; ++i)
+				{
+					hashMap.Insert({ static_cast<int32_t>(i), static_cast<int32_t>(i % 7) });
+				}
+
+				const size_t repetitions = 4 * 1024 * 1024 / elementCount;
+				const double count = static_cast<double>(elementCount);
+				int64_t sum = 0;
+				const double iterators = Benchmark::Measure(repetitions, [&vector, &sum]()
+				{
+					int64_t local = 0;
+					for (int32_t value : vector)
+					{
+						local += value;
+					}
+					sum += local;
+				});
+				const double span = Benchmark::Measure(repetitions, [&vector, &sum]()
+				{
+					int64_t local = 0;
+					for (int32_t value : vector.AsSpan())
+					{
+						local += value;
+					}
+					sum += local;
+				});
+				const double hashMapIterators = Benchmark::Measure(repetitions, [&hashMap, &sum]()
+				{
+					int64_t local = 0;
+					for (const auto& [key, value] : hashMap)
+					{
+						local += value;
+					}
+					sum += local;
+				});
+				Benchmark::DoNotOptimize(sum);
+
+				const string size = to_string(elementCount);
+				Benchmark::Report("Vector range-for, "s + size + " elements"s, iterators / count);
+				Benchmark::Report("Vector AsSpan, "s + size + " elements"s, span / count);
+				Benchmark::Report("HashMap range-for, "s + size + " elements"s, hashMapIterators / count);
+			}
+		}
+
+	private:
+		template <typename TMake>
+		static void RunGrowth(const string& label, size_t elementCount, TMake make)
+		{
+			const double time = Benchmark::Measure(64, [&]()
+			{
+				Vector<decltype(make())> vector;
+				for (size_t i = 0; i < elementCount; ++i)
+				{
+					vector.PushBack(make());
+				}
+				Benchmark::DoNotOptimize(vector);
+			});
+			Benchmark::Report(label, time);
+		}
+	};
+}
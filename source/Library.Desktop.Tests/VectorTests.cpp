@@ -3,6 +3,8 @@
 #include "CppUnitTest.h"
 #include "Foo.h"
 #include "Vector.h"
+#include "SList.h"
+#include "CountingResource.h"
 #include "ToStringSpecializations.h"
 
 using namespace Microsoft::VisualStudio::CppUnitTestFramework;
@@ -13,8 +15,8 @@ using namespace std::string_literals;
 
 namespace Microsoft::VisualStudio::CppUnitTestFramework
 {
-	template<>
-	inline std::wstring ToString<Vector<Foo>::iterator>(const Vector<Foo>::iterator& t)
+	template <typename TIterator>
+	inline std::wstring VectorIteratorToString(const TIterator& t)
 	{
 		wstring value;
 		try
@@ -28,19 +30,22 @@ namespace Microsoft::VisualStudio::CppUnitTestFramework
 		return value;
 	}
 
+	template<>
+	inline std::wstring ToString<Vector<Foo>::iterator>(const Vector<Foo>::iterator& t)
+	{
+		return VectorIteratorToString(t);
+	}
+
 	template<>
 	inline std::wstring ToString<Vector<Foo>::const_iterator>(const Vector<Foo>::const_iterator& t)
 	{
-		wstring value;
-		try
-		{
-			value = ToString(*t);
-		}
-		catch (const std::exception&)
-		{
-			value = L"end()"s;
-		}
-		return value;
+		return VectorIteratorToString(t);
+	}
+
+	template<>
+	inline std::wstring ToString<Vector<Foo, DynamicReserveStrategy>::iterator>(const Vector<Foo, DynamicReserveStrategy>::iterator& t)
+	{
+		return VectorIteratorToString(t);
 	}
 }
 
@@ -119,6 +124,26 @@ namespace LibraryDesktopTests
 
 			Assert::IsTrue(std::equal(vector1.begin(), vector1.end(), vector2.begin()));
 			Assert::AreEqual(vector2.Size(), vector1.Size());
+
+			// Trivially copyable values are copied in bulk
+			Vector<int> ints = { 1, 2, 3 };
+			Vector<int> intsCopy(ints);
+			Assert::IsTrue(std::equal(ints.begin(), ints.end(), intsCopy.begin()));
+			intsCopy[0] = 4;
+			Assert::AreEqual(1, ints[0]);
+
+			Vector<int> empty;
+			Vector<int> emptyCopy(empty);
+			Assert::IsTrue(emptyCopy.IsEmpty());
+
+			// Appending a vector to itself copies from the grown storage
+			vector1.Append(vector1);
+			Assert::AreEqual(size_t(4), vector1.Size());
+			Assert::AreEqual(a, vector1[2]);
+			Assert::AreEqual(b, vector1[3]);
+			ints.Append(ints);
+			Assert::AreEqual(size_t(6), ints.Size());
+			Assert::AreEqual(3, ints[5]);
 		}
 		
 		TEST_METHOD(MoveSemantics)
@@ -316,7 +341,7 @@ namespace LibraryDesktopTests
 
 		TEST_METHOD(Capacity)
 		{
-			Vector<Foo> vector(0, [](size_t capacity) { return capacity + 1; });
+			Vector<Foo, DynamicReserveStrategy> vector(0, [](size_t capacity) { return capacity + 1; });
 			Assert::AreEqual(size_t(0), vector.Capacity());
 			vector.PushBack(Foo(10));
 			Assert::AreEqual(size_t(1), vector.Capacity());
@@ -347,10 +372,10 @@ namespace LibraryDesktopTests
 			{
 				const Foo a(1);
 				const Foo b(2);
-				Vector<Foo>::iterator it1;
-				Vector<Foo>::iterator it2;
+				Vector<Foo, DynamicReserveStrategy>::iterator it1;
+				Vector<Foo, DynamicReserveStrategy>::iterator it2;
 
-				Vector<Foo> vector(0, [](size_t capacity) { return capacity + 1; });
+				Vector<Foo, DynamicReserveStrategy> vector(0, [](size_t capacity) { return capacity + 1; });
 				Assert::AreEqual(size_t(0), vector.Capacity());
 
 				it1 = vector.PushBack(a);
@@ -381,7 +406,7 @@ namespace LibraryDesktopTests
 			// Reserve strategy + 2
 			{
 				const Foo a(1);
-				Vector<Foo> vector(0, [](size_t capacity) { return capacity + 2; });
+				Vector<Foo, DynamicReserveStrategy> vector(0, [](size_t capacity) { return capacity + 2; });
 				Assert::AreEqual(size_t(0), vector.Capacity());
 				vector.PushBack(a);
 				Assert::AreEqual(size_t(2), vector.Capacity());
@@ -414,7 +439,7 @@ namespace LibraryDesktopTests
 			// Bad strategy
 			{
 				const Foo a(1);
-				Vector<Foo> vector(0, [](size_t capacity) { return capacity == 0 ? capacity : capacity - 1; });
+				Vector<Foo, DynamicReserveStrategy> vector(0, [](size_t capacity) { return capacity == 0 ? capacity : capacity - 1; });
 				Assert::AreEqual(size_t(0), vector.Capacity());
 
 				vector.PushBack(a);
@@ -431,10 +456,10 @@ namespace LibraryDesktopTests
 		TEST_METHOD(RValueReferencePushBack)
 		{
 			{
-				Vector<Foo>::iterator it1;
-				Vector<Foo>::iterator it2;
+				Vector<Foo, DynamicReserveStrategy>::iterator it1;
+				Vector<Foo, DynamicReserveStrategy>::iterator it2;
 
-				Vector<Foo> vector(0, [](size_t capacity) { return capacity + 1; });
+				Vector<Foo, DynamicReserveStrategy> vector(0, [](size_t capacity) { return capacity + 1; });
 				Assert::AreEqual(size_t(0), vector.Capacity());
 
 				it1 = vector.PushBack(Foo(1));
@@ -464,7 +489,7 @@ namespace LibraryDesktopTests
 
 			// Reserve strategy + 2
 			{
-				Vector<Foo> vector(0, [](size_t capacity) { return capacity + 2; });
+				Vector<Foo, DynamicReserveStrategy> vector(0, [](size_t capacity) { return capacity + 2; });
 				Assert::AreEqual(size_t(0), vector.Capacity());
 				vector.PushBack(Foo(1));
 				Assert::AreEqual(size_t(2), vector.Capacity());
@@ -495,7 +520,7 @@ namespace LibraryDesktopTests
 
 			// Bad strategy
 			{
-				Vector<Foo> vector(0, [](size_t capacity) { return capacity == 0 ? capacity : capacity - 1; });
+				Vector<Foo, DynamicReserveStrategy> vector(0, [](size_t capacity) { return capacity == 0 ? capacity : capacity - 1; });
 				Assert::AreEqual(size_t(0), vector.Capacity());
 
 				vector.PushBack(Foo(1));
@@ -512,10 +537,10 @@ namespace LibraryDesktopTests
 		TEST_METHOD(EmplaceBack)
 		{
 			{
-				Vector<Foo>::iterator it1;
-				Vector<Foo>::iterator it2;
+				Vector<Foo, DynamicReserveStrategy>::iterator it1;
+				Vector<Foo, DynamicReserveStrategy>::iterator it2;
 
-				Vector<Foo> vector(0, [](size_t capacity) { return capacity + 1; });
+				Vector<Foo, DynamicReserveStrategy> vector(0, [](size_t capacity) { return capacity + 1; });
 				Assert::AreEqual(size_t(0), vector.Capacity());
 
 				it1 = vector.EmplaceBack(1);
@@ -545,7 +570,7 @@ namespace LibraryDesktopTests
 
 			// Reserve strategy + 2
 			{
-				Vector<Foo> vector(0, [](size_t capacity) { return capacity + 2; });
+				Vector<Foo, DynamicReserveStrategy> vector(0, [](size_t capacity) { return capacity + 2; });
 				Assert::AreEqual(size_t(0), vector.Capacity());
 				vector.EmplaceBack(1);
 				Assert::AreEqual(size_t(2), vector.Capacity());
@@ -576,7 +601,7 @@ namespace LibraryDesktopTests
 
 			// Bad strategy
 			{
-				Vector<Foo> vector(0, [](size_t capacity) { return capacity == 0 ? capacity : capacity - 1; });
+				Vector<Foo, DynamicReserveStrategy> vector(0, [](size_t capacity) { return capacity == 0 ? capacity : capacity - 1; });
 				Assert::AreEqual(size_t(0), vector.Capacity());
 
 				vector.EmplaceBack(1);
@@ -807,25 +832,37 @@ namespace LibraryDesktopTests
 				vector.Clear();
 
 				it = vector.begin();
+#if FIEA_CHECKED_ITERATORS
 				Assert::ExpectException<runtime_error>([&it]() { auto& value = *it; UNREFERENCED_LOCAL(value); });
+#endif
 
 				constIt = const_cast<const Vector<Foo>&>(vector).begin();
+#if FIEA_CHECKED_ITERATORS
 				Assert::ExpectException<runtime_error>([&constIt]() { auto& value = *constIt; UNREFERENCED_LOCAL(value); });
+#endif
 
 				constIt = vector.cbegin();
+#if FIEA_CHECKED_ITERATORS
 				Assert::ExpectException<runtime_error>([&constIt]() { auto& value = *constIt; UNREFERENCED_LOCAL(value); });
+#endif
 
 				// Shrink to fit.
 				vector.ShrinkToFit();
 
 				it = vector.begin();
+#if FIEA_CHECKED_ITERATORS
 				Assert::ExpectException<runtime_error>([&it]() { auto& value = *it; UNREFERENCED_LOCAL(value); });
+#endif
 
 				constIt = const_cast<const Vector<Foo>&>(vector).begin();
+#if FIEA_CHECKED_ITERATORS
 				Assert::ExpectException<runtime_error>([&constIt]() { auto& value = *constIt; UNREFERENCED_LOCAL(value); });
+#endif
 
 				constIt = vector.cbegin();
+#if FIEA_CHECKED_ITERATORS
 				Assert::ExpectException<runtime_error>([&constIt]() { auto& value = *constIt; UNREFERENCED_LOCAL(value); });
+#endif
 			}
 		}
 
@@ -840,13 +877,19 @@ namespace LibraryDesktopTests
 
 				// Dereference end
 				it = vector.end();
+#if FIEA_CHECKED_ITERATORS
 				Assert::ExpectException<runtime_error>([&it]() { auto& value = *it; UNREFERENCED_LOCAL(value); });
+#endif
 
 				constIt = const_cast<const Vector<Foo>&>(vector).end();
+#if FIEA_CHECKED_ITERATORS
 				Assert::ExpectException<runtime_error>([&constIt]() { auto& value = *constIt; UNREFERENCED_LOCAL(value); });
+#endif
 
 				constIt = vector.cend();
+#if FIEA_CHECKED_ITERATORS
 				Assert::ExpectException<runtime_error>([&constIt]() { auto& value = *constIt; UNREFERENCED_LOCAL(value); });
+#endif
 
 				// Get last element
 				it = vector.end();
@@ -880,25 +923,37 @@ namespace LibraryDesktopTests
 				vector.Clear();
 
 				it = vector.end();
+#if FIEA_CHECKED_ITERATORS
 				Assert::ExpectException<runtime_error>([&it]() { auto& value = *(it - 1); UNREFERENCED_LOCAL(value); });
+#endif
 
 				constIt = const_cast<const Vector<Foo>&>(vector).end();
+#if FIEA_CHECKED_ITERATORS
 				Assert::ExpectException<runtime_error>([&constIt]() { auto& value = *(constIt - 1); UNREFERENCED_LOCAL(value); });
+#endif
 
 				constIt = vector.cend();
+#if FIEA_CHECKED_ITERATORS
 				Assert::ExpectException<runtime_error>([&constIt]() { auto& value = *(constIt - 1); UNREFERENCED_LOCAL(value); });
+#endif
 
 				// Shrink to fit.
 				vector.ShrinkToFit();
 
 				it = vector.end();
+#if FIEA_CHECKED_ITERATORS
 				Assert::ExpectException<runtime_error>([&it]() { auto& value = *(it - 1); UNREFERENCED_LOCAL(value); });
+#endif
 
 				constIt = const_cast<const Vector<Foo>&>(vector).end();
+#if FIEA_CHECKED_ITERATORS
 				Assert::ExpectException<runtime_error>([&constIt]() { auto& value = *(constIt - 1); UNREFERENCED_LOCAL(value); });
+#endif
 
 				constIt = vector.cend();
+#if FIEA_CHECKED_ITERATORS
 				Assert::ExpectException<runtime_error>([&constIt]() { auto& value = *(constIt - 1); UNREFERENCED_LOCAL(value); });
+#endif
 			}
 		}
 
@@ -908,14 +963,18 @@ namespace LibraryDesktopTests
 			{
 				// Default constructed iterator
 				Vector<Foo>::const_iterator it;
+#if FIEA_CHECKED_ITERATORS
 				Assert::ExpectException<std::runtime_error>([&it]() { auto& foo = *it; UNREFERENCED_LOCAL(foo); });
+#endif
 
 				// const_iterator from vector
 				const Foo a(1);
 				Vector<Foo> vector = { a };
 
 				it = vector.end();
+#if FIEA_CHECKED_ITERATORS
 				Assert::ExpectException<std::runtime_error>([&it]() { auto& foo = *it; UNREFERENCED_LOCAL(foo); });
+#endif
 
 				it = vector.begin();
 				Assert::AreEqual(a, *it);
@@ -926,7 +985,9 @@ namespace LibraryDesktopTests
 				// Default constructed const_iterator
 				Vector<Foo>::const_iterator it;
 				Vector<Foo>::const_iterator previousIt;
+#if FIEA_CHECKED_ITERATORS
 				Assert::ExpectException<std::runtime_error>([&it]() { it++; });
+#endif
 
 				// const_iterator from vector
 				const Foo a(1);
@@ -947,15 +1008,19 @@ namespace LibraryDesktopTests
 				previousIt = it++;
 
 				// end
+#if FIEA_CHECKED_ITERATORS
 				Assert::ExpectException<std::runtime_error>([&it]() { auto& foo = *it; UNREFERENCED_LOCAL(foo); });
+#endif
 				Assert::AreEqual(vector.end(), it);
 				Assert::AreEqual(b, *previousIt);
 
 				previousIt = it++;
 
 				// end
+#if FIEA_CHECKED_ITERATORS
 				Assert::ExpectException<std::runtime_error>([&it]() { auto& foo = *it; UNREFERENCED_LOCAL(foo); });
 				Assert::ExpectException<std::runtime_error>([&previousIt]() { auto& foo = *previousIt; UNREFERENCED_LOCAL(foo); });
+#endif
 				Assert::AreEqual(vector.end() + 1, it);
 				Assert::AreEqual(vector.end(), previousIt);
 			}
@@ -966,7 +1031,9 @@ namespace LibraryDesktopTests
 				Vector<Foo>::const_iterator it;
 				Vector<Foo>::const_iterator it2;
 				Vector<Foo>::const_iterator previousIt;
+#if FIEA_CHECKED_ITERATORS
 				Assert::ExpectException<std::runtime_error>([&it]() { ++it; });
+#endif
 
 				// const_iterator from vector
 				const Foo a(1);
@@ -986,17 +1053,25 @@ namespace LibraryDesktopTests
 				it2 = ++it;
 
 				// end
+#if FIEA_CHECKED_ITERATORS
 				Assert::ExpectException<std::runtime_error>([&it]() { auto& foo = *it; UNREFERENCED_LOCAL(foo); });
+#endif
 				Assert::AreEqual(vector.end(), it);
+#if FIEA_CHECKED_ITERATORS
 				Assert::ExpectException<std::runtime_error>([&it2]() { auto& foo = *it2; UNREFERENCED_LOCAL(foo); });
+#endif
 				Assert::AreEqual(vector.end(), it2);
 
 				it2 = ++it;
 
 				// end
+#if FIEA_CHECKED_ITERATORS
 				Assert::ExpectException<std::runtime_error>([&it]() { auto& foo = *it; UNREFERENCED_LOCAL(foo); });
+#endif
 				Assert::AreEqual(vector.end() + 1, it);
+#if FIEA_CHECKED_ITERATORS
 				Assert::ExpectException<std::runtime_error>([&it2]() { auto& foo = *it2; UNREFERENCED_LOCAL(foo); });
+#endif
 				Assert::AreEqual(vector.end() + 1, it2);
 			}
 
@@ -1005,7 +1080,9 @@ namespace LibraryDesktopTests
 				// Default constructed const_iterator
 				Vector<Foo>::const_iterator it;
 				Vector<Foo>::const_iterator previousIt;
+#if FIEA_CHECKED_ITERATORS
 				Assert::ExpectException<std::runtime_error>([&it]() { --it; });
+#endif
 
 				// const_iterator from vector
 				const Foo a(1);
@@ -1013,7 +1090,9 @@ namespace LibraryDesktopTests
 				const Vector<Foo> vector = { a, b };
 
 				it = vector.end();
+#if FIEA_CHECKED_ITERATORS
 				Assert::ExpectException<std::runtime_error>([&it]() { auto& foo = *it; UNREFERENCED_LOCAL(foo); });
+#endif
 
 				previousIt = --it;
 
@@ -1036,14 +1115,18 @@ namespace LibraryDesktopTests
 				// begin - 1
 				Assert::AreEqual(vector.begin() - 1, it);
 				Assert::AreEqual(vector.begin() - 1, previousIt);
+#if FIEA_CHECKED_ITERATORS
 				Assert::ExpectException<std::runtime_error>([&it]() { auto& foo = *it; UNREFERENCED_LOCAL(foo); });
 				Assert::ExpectException<std::runtime_error>([&previousIt]() { auto& foo = *previousIt; UNREFERENCED_LOCAL(foo); });
+#endif
 
 				previousIt = --it;
 
 				// begin - 2
+#if FIEA_CHECKED_ITERATORS
 				Assert::ExpectException<std::runtime_error>([&it]() { auto& foo = *it; UNREFERENCED_LOCAL(foo); });
 				Assert::ExpectException<std::runtime_error>([&previousIt]() { auto& foo = *previousIt; UNREFERENCED_LOCAL(foo); });
+#endif
 				Assert::AreEqual(vector.begin() - 2, it);
 				Assert::AreEqual(vector.begin() - 2, previousIt);
 			}
@@ -1053,7 +1136,9 @@ namespace LibraryDesktopTests
 				// Default constructed const_iterator
 				Vector<Foo>::const_iterator it;
 				Vector<Foo>::const_iterator previousIt;
+#if FIEA_CHECKED_ITERATORS
 				Assert::ExpectException<std::runtime_error>([&it]() { it--; });
+#endif
 
 				// const_iterator from vector
 				const Foo a(1);
@@ -1061,7 +1146,9 @@ namespace LibraryDesktopTests
 				const Vector<Foo> vector = { a, b };
 
 				it = vector.end();
+#if FIEA_CHECKED_ITERATORS
 				Assert::ExpectException<std::runtime_error>([&it]() { auto& foo = *it; UNREFERENCED_LOCAL(foo); });
+#endif
 
 				previousIt = it--;
 
@@ -1069,7 +1156,9 @@ namespace LibraryDesktopTests
 				Assert::AreEqual(vector.end() - 1, it);
 				Assert::AreEqual(vector.end(), previousIt);
 				Assert::AreEqual(b, *it);
+#if FIEA_CHECKED_ITERATORS
 				Assert::ExpectException<std::runtime_error>([&previousIt]() { auto& foo = *previousIt; UNREFERENCED_LOCAL(foo); });
+#endif
 
 				previousIt = it--;
 
@@ -1084,14 +1173,18 @@ namespace LibraryDesktopTests
 				// begin - 1
 				Assert::AreEqual(vector.begin() - 1, it);
 				Assert::AreEqual(vector.begin(), previousIt);
+#if FIEA_CHECKED_ITERATORS
 				Assert::ExpectException<std::runtime_error>([&it]() { auto& foo = *it; UNREFERENCED_LOCAL(foo); });
+#endif
 				Assert::AreEqual(a, *previousIt);
 
 				previousIt = it--;
 
 				// begin - 2
+#if FIEA_CHECKED_ITERATORS
 				Assert::ExpectException<std::runtime_error>([&it]() { auto& foo = *it; UNREFERENCED_LOCAL(foo); });
 				Assert::ExpectException<std::runtime_error>([&previousIt]() { auto& foo = *previousIt; UNREFERENCED_LOCAL(foo); });
+#endif
 				Assert::AreEqual(vector.begin() - 2, it);
 				Assert::AreEqual(vector.begin() - 1, previousIt);
 			}
@@ -1127,8 +1220,10 @@ namespace LibraryDesktopTests
 			{
 				// Default constructed
 				Vector<Foo>::const_iterator it;
+#if FIEA_CHECKED_ITERATORS
 				Assert::ExpectException<runtime_error>([&it]() {  auto temp = it + 1; UNREFERENCED_LOCAL(temp); });
 				Assert::ExpectException<runtime_error>([&it]() { it += 1; });
+#endif
 
 				// Non default constructed
 				const Foo a(1);
@@ -1143,8 +1238,10 @@ namespace LibraryDesktopTests
 			{
 				// Default constructed
 				Vector<Foo>::const_iterator it;
+#if FIEA_CHECKED_ITERATORS
 				Assert::ExpectException<runtime_error>([&it]() { auto temp = it - 1; UNREFERENCED_LOCAL(temp); });
 				Assert::ExpectException<runtime_error>([&it]() { it -= 1; });
+#endif
 
 				// Non default constructed
 				const Foo a(1);
@@ -1165,7 +1262,9 @@ namespace LibraryDesktopTests
 				Vector<Foo>::const_iterator it2 = vector2.begin();
 
 				// subtract two iterators from different containers
+#if FIEA_CHECKED_ITERATORS
 				Assert::ExpectException<runtime_error>([&it, &it2]() { auto b = it - it2; UNREFERENCED_LOCAL(b); });
+#endif
 
 				// subtract two iterators from same container
 				Assert::AreEqual(size_t(2), vector.end() - vector.begin());
@@ -1181,10 +1280,12 @@ namespace LibraryDesktopTests
 				Vector<Foo>::const_iterator it2 = vector2.begin();
 
 				// compare two iterators from different containers
+#if FIEA_CHECKED_ITERATORS
 				Assert::ExpectException<runtime_error>([&it, &it2]() { auto b = it < it2; UNREFERENCED_LOCAL(b); });
 				Assert::ExpectException<runtime_error>([&it, &it2]() { auto b = it <= it2; UNREFERENCED_LOCAL(b); });
 				Assert::ExpectException<runtime_error>([&it, &it2]() { auto b = it > it2; UNREFERENCED_LOCAL(b); });
 				Assert::ExpectException<runtime_error>([&it, &it2]() { auto b = it >= it2; UNREFERENCED_LOCAL(b); });
+#endif
 
 				// compare two iterators from same container
 				Assert::IsTrue(vector.begin() < vector.end());
@@ -1207,13 +1308,19 @@ namespace LibraryDesktopTests
 				const Foo a(1);
 				const Foo b(2);
 				const Vector<Foo> vector{ a, b };
-				Vector<Foo>::const_iterator it = vector.end();
+				Vector<Foo>::const_iterator it = vector.begin();
 				Assert::AreEqual(a, it[0]);
 				Assert::AreEqual(b, it[1]);
+				Assert::AreEqual(b, (it + 1)[0]);
+#if FIEA_CHECKED_ITERATORS
+				Assert::ExpectException<runtime_error>([&vector]() { const auto& v = vector.end()[0]; UNREFERENCED_LOCAL(v); });
+#endif
 
 				// default constructed
 				Vector<Foo>::const_iterator itDefault;
+#if FIEA_CHECKED_ITERATORS
 				Assert::ExpectException<runtime_error>([&itDefault]() { const auto& v = itDefault[0]; UNREFERENCED_LOCAL(v); });
+#endif
 			}
 		}
 
@@ -1223,14 +1330,18 @@ namespace LibraryDesktopTests
 			{
 				// Default constructed iterator
 				Vector<Foo>::iterator it;
+#if FIEA_CHECKED_ITERATORS
 				Assert::ExpectException<std::runtime_error>([&it]() { auto& foo = *it; UNREFERENCED_LOCAL(foo); });
+#endif
 
 				// Iterator from vector
 				const Foo a(1);
 				Vector<Foo> vector = { a };
 
 				it = vector.end();
+#if FIEA_CHECKED_ITERATORS
 				Assert::ExpectException<std::runtime_error>([&it]() { auto& foo = *it; UNREFERENCED_LOCAL(foo); });
+#endif
 
 				it = vector.begin();
 				Assert::AreEqual(a, *it);
@@ -1241,7 +1352,9 @@ namespace LibraryDesktopTests
 				// Default constructed iterator
 				Vector<Foo>::iterator it;
 				Vector<Foo>::iterator previousIt;
+#if FIEA_CHECKED_ITERATORS
 				Assert::ExpectException<std::runtime_error>([&it]() { it++; });
+#endif
 
 				// Iterator from vector
 				const Foo a(1);
@@ -1262,15 +1375,19 @@ namespace LibraryDesktopTests
 				previousIt = it++;
 
 				// end
+#if FIEA_CHECKED_ITERATORS
 				Assert::ExpectException<std::runtime_error>([&it]() { auto& foo = *it; UNREFERENCED_LOCAL(foo); });
+#endif
 				Assert::AreEqual(vector.end(), it);
 				Assert::AreEqual(b, *previousIt);
 
 				previousIt = it++;
 
 				// end
+#if FIEA_CHECKED_ITERATORS
 				Assert::ExpectException<std::runtime_error>([&it]() { auto& foo = *it; UNREFERENCED_LOCAL(foo); });
 				Assert::ExpectException<std::runtime_error>([&previousIt]() { auto& foo = *previousIt; UNREFERENCED_LOCAL(foo); });
+#endif
 				Assert::AreEqual(vector.end() + 1, it);
 				Assert::AreEqual(vector.end(), previousIt);
 			}
@@ -1281,7 +1398,9 @@ namespace LibraryDesktopTests
 				Vector<Foo>::iterator it;
 				Vector<Foo>::iterator it2;
 				Vector<Foo>::iterator previousIt;
+#if FIEA_CHECKED_ITERATORS
 				Assert::ExpectException<std::runtime_error>([&it]() { ++it; });
+#endif
 
 				// Iterator from vector
 				const Foo a(1);
@@ -1301,17 +1420,25 @@ namespace LibraryDesktopTests
 				it2 = ++it;
 
 				// end
+#if FIEA_CHECKED_ITERATORS
 				Assert::ExpectException<std::runtime_error>([&it]() { auto& foo = *it; UNREFERENCED_LOCAL(foo); });
+#endif
 				Assert::AreEqual(vector.end(), it);
+#if FIEA_CHECKED_ITERATORS
 				Assert::ExpectException<std::runtime_error>([&it2]() { auto& foo = *it2; UNREFERENCED_LOCAL(foo); });
+#endif
 				Assert::AreEqual(vector.end(), it2);
 
 				it2 = ++it;
 
 				// end
+#if FIEA_CHECKED_ITERATORS
 				Assert::ExpectException<std::runtime_error>([&it]() { auto& foo = *it; UNREFERENCED_LOCAL(foo); });
+#endif
 				Assert::AreEqual(vector.end() + 1, it);
+#if FIEA_CHECKED_ITERATORS
 				Assert::ExpectException<std::runtime_error>([&it2]() { auto& foo = *it2; UNREFERENCED_LOCAL(foo); });
+#endif
 				Assert::AreEqual(vector.end() + 1, it2);
 			}
 
@@ -1320,7 +1447,9 @@ namespace LibraryDesktopTests
 				// Default constructed iterator
 				Vector<Foo>::iterator it;
 				Vector<Foo>::iterator previousIt;
+#if FIEA_CHECKED_ITERATORS
 				Assert::ExpectException<std::runtime_error>([&it]() { --it; });
+#endif
 
 				// Iterator from vector
 				const Foo a(1);
@@ -1328,7 +1457,9 @@ namespace LibraryDesktopTests
 				Vector<Foo> vector = { a, b };
 
 				it = vector.end();
+#if FIEA_CHECKED_ITERATORS
 				Assert::ExpectException<std::runtime_error>([&it]() { auto& foo = *it; UNREFERENCED_LOCAL(foo); });
+#endif
 
 				previousIt = --it;
 
@@ -1351,14 +1482,18 @@ namespace LibraryDesktopTests
 				// begin - 1
 				Assert::AreEqual(vector.begin() - 1, it);
 				Assert::AreEqual(vector.begin() - 1, previousIt);
+#if FIEA_CHECKED_ITERATORS
 				Assert::ExpectException<std::runtime_error>([&it]() { auto& foo = *it; UNREFERENCED_LOCAL(foo); });
 				Assert::ExpectException<std::runtime_error>([&previousIt]() { auto& foo = *previousIt; UNREFERENCED_LOCAL(foo); });
+#endif
 
 				previousIt = --it;
 
 				// begin - 2
+#if FIEA_CHECKED_ITERATORS
 				Assert::ExpectException<std::runtime_error>([&it]() { auto& foo = *it; UNREFERENCED_LOCAL(foo); });
 				Assert::ExpectException<std::runtime_error>([&previousIt]() { auto& foo = *previousIt; UNREFERENCED_LOCAL(foo); });
+#endif
 				Assert::AreEqual(vector.begin() - 2, it);
 				Assert::AreEqual(vector.begin() - 2, previousIt);
 			}
@@ -1368,7 +1503,9 @@ namespace LibraryDesktopTests
 				// Default constructed iterator
 				Vector<Foo>::iterator it;
 				Vector<Foo>::iterator previousIt;
+#if FIEA_CHECKED_ITERATORS
 				Assert::ExpectException<std::runtime_error>([&it]() { it--; });
+#endif
 
 				// Iterator from vector
 				const Foo a(1);
@@ -1376,7 +1513,9 @@ namespace LibraryDesktopTests
 				Vector<Foo> vector = { a, b };
 
 				it = vector.end();
+#if FIEA_CHECKED_ITERATORS
 				Assert::ExpectException<std::runtime_error>([&it]() { auto& foo = *it; UNREFERENCED_LOCAL(foo); });
+#endif
 
 				previousIt = it--;
 
@@ -1384,7 +1523,9 @@ namespace LibraryDesktopTests
 				Assert::AreEqual(vector.end() - 1, it);
 				Assert::AreEqual(vector.end(), previousIt);
 				Assert::AreEqual(b, *it);
+#if FIEA_CHECKED_ITERATORS
 				Assert::ExpectException<std::runtime_error>([&previousIt]() { auto& foo = *previousIt; UNREFERENCED_LOCAL(foo); });
+#endif
 
 				previousIt = it--;
 
@@ -1399,14 +1540,18 @@ namespace LibraryDesktopTests
 				// begin - 1
 				Assert::AreEqual(vector.begin() - 1, it);
 				Assert::AreEqual(vector.begin(), previousIt);
+#if FIEA_CHECKED_ITERATORS
 				Assert::ExpectException<std::runtime_error>([&it]() { auto& foo = *it; UNREFERENCED_LOCAL(foo); });
+#endif
 				Assert::AreEqual(a, *previousIt);
 
 				previousIt = it--;
 
 				// begin - 2
+#if FIEA_CHECKED_ITERATORS
 				Assert::ExpectException<std::runtime_error>([&it]() { auto& foo = *it; UNREFERENCED_LOCAL(foo); });
 				Assert::ExpectException<std::runtime_error>([&previousIt]() { auto& foo = *previousIt; UNREFERENCED_LOCAL(foo); });
+#endif
 				Assert::AreEqual(vector.begin() - 2, it);
 				Assert::AreEqual(vector.begin() - 1, previousIt);
 			}
@@ -1442,8 +1587,10 @@ namespace LibraryDesktopTests
 			{
 				// Default constructed
 				Vector<Foo>::iterator it;
+#if FIEA_CHECKED_ITERATORS
 				Assert::ExpectException<runtime_error>([&it]() {  auto temp = it + 1; UNREFERENCED_LOCAL(temp); });
 				Assert::ExpectException<runtime_error>([&it]() { it += 1; });
+#endif
 
 				// Non default constructed
 				const Foo a(1);
@@ -1458,8 +1605,10 @@ namespace LibraryDesktopTests
 			{
 				// Default constructed
 				Vector<Foo>::iterator it;
+#if FIEA_CHECKED_ITERATORS
 				Assert::ExpectException<runtime_error>([&it]() { auto temp = it - 1; UNREFERENCED_LOCAL(temp); });
 				Assert::ExpectException<runtime_error>([&it]() { it -= 1; });
+#endif
 
 				// Non default constructed
 				const Foo a(1);
@@ -1481,7 +1630,9 @@ namespace LibraryDesktopTests
 				Vector<Foo>::iterator it2 = vector2.begin();
 
 				// subtract two iterators from different containers
+#if FIEA_CHECKED_ITERATORS
 				Assert::ExpectException<runtime_error>([&it, &it2]() { auto b = it - it2; UNREFERENCED_LOCAL(b); });
+#endif
 
 				// subtract two iterators from same container
 				Assert::AreEqual(size_t(2), vector.end() - vector.begin());
@@ -1497,10 +1648,12 @@ namespace LibraryDesktopTests
 				Vector<Foo>::iterator it2 = vector2.begin();
 				
 				// compare two iterators from different containers
+#if FIEA_CHECKED_ITERATORS
 				Assert::ExpectException<runtime_error>([&it, &it2]() { auto b = it < it2; UNREFERENCED_LOCAL(b); });
 				Assert::ExpectException<runtime_error>([&it, &it2]() { auto b = it <= it2; UNREFERENCED_LOCAL(b); });
 				Assert::ExpectException<runtime_error>([&it, &it2]() { auto b = it > it2; UNREFERENCED_LOCAL(b); });
 				Assert::ExpectException<runtime_error>([&it, &it2]() { auto b = it >= it2; UNREFERENCED_LOCAL(b); });
+#endif
 
 				// compare two iterators from same container
 				Assert::IsTrue(vector.begin() < vector.end());
@@ -1523,17 +1676,188 @@ namespace LibraryDesktopTests
 				const Foo a(1);
 				const Foo b(2);
 				Vector<Foo> vector{ a, b };
-				Vector<Foo>::iterator it = vector.end();
+				Vector<Foo>::iterator it = vector.begin();
 				Assert::AreEqual(a, it[0]);
 				Assert::AreEqual(b, it[1]);
+				Assert::AreEqual(b, (it + 1)[0]);
+#if FIEA_CHECKED_ITERATORS
+				Assert::ExpectException<runtime_error>([&vector]() { const auto& v = vector.end()[0]; UNREFERENCED_LOCAL(v); });
+#endif
 
 				// default constructed
 				Vector<Foo>::iterator itDefault;
+#if FIEA_CHECKED_ITERATORS
 				Assert::ExpectException<runtime_error>([&itDefault]() { auto& v = itDefault[0]; UNREFERENCED_LOCAL(v); });
+#endif
+			}
+		}
+
+
+		TEST_METHOD(MemoryResource)
+		{
+			CountingResource resource;
+			CountingResource otherResource;
+			{
+				Vector<Foo> vector(&resource);
+				Assert::IsTrue(vector.GetAllocator().resource() == &resource);
+				for (int32_t i = 0; i < 10; ++i)
+				{
+					vector.PushBack(Foo(i));
+				}
+				Assert::IsTrue(resource.Allocations > 0);
+				Assert::AreEqual(vector.Capacity() * sizeof(Foo), resource.BytesInUse);
+
+				// Copies use the default resource unless given one
+				Vector<Foo> copy(vector);
+				Assert::IsTrue(copy.GetAllocator().resource() == std::pmr::get_default_resource());
+				Vector<Foo> otherCopy(vector, &otherResource);
+				Assert::IsTrue(otherCopy.GetAllocator().resource() == &otherResource);
+				Assert::IsTrue(std::equal(vector.begin(), vector.end(), otherCopy.begin()));
+
+				// Moves take the storage along with the allocator
+				const size_t allocations = resource.Allocations;
+				Vector<Foo> moved(std::move(vector));
+				Assert::IsTrue(moved.GetAllocator().resource() == &resource);
+				Assert::AreEqual(allocations, resource.Allocations);
+
+				// Move assignment across resources moves the elements into our storage
+				otherCopy = std::move(moved);
+				Assert::IsTrue(otherCopy.GetAllocator().resource() == &otherResource);
+				Assert::AreEqual(size_t(10), otherCopy.Size());
+				Assert::AreEqual(Foo(9), otherCopy.Back());
+				Assert::AreEqual(size_t(0), moved.Size());
+
+				otherCopy.ShrinkToFit();
+				Assert::AreEqual(size_t(10) * sizeof(Foo), otherResource.BytesInUse);
 			}
+			Assert::AreEqual(size_t(0), resource.BytesInUse);
+			Assert::AreEqual(size_t(0), otherResource.BytesInUse);
+			Assert::AreEqual(resource.Allocations, resource.Deallocations);
+		}
+
+		TEST_METHOD(Relocation)
+		{
+			static_assert(IsTriviallyRelocatableV<int32_t>);
+			static_assert(IsTriviallyRelocatableV<shared_ptr<Foo>>);
+			static_assert(IsTriviallyRelocatableV<SList<Foo>>);
+			static_assert(IsTriviallyRelocatableV<pair<const int32_t, shared_ptr<Foo>>>);
+			static_assert(!IsTriviallyRelocatableV<string>);
+			static_assert(!IsTriviallyRelocatableV<SelfReferencing>);
+
+			// Short strings may point into themselves, so growth must move them rather than copy their bytes
+			{
+				Vector<string> vector;
+				for (int32_t i = 0; i < 100; ++i)
+				{
+					vector.PushBack(to_string(i));
+				}
+				Assert::IsTrue(vector.Remove(vector.begin() + 10, vector.begin() + 20));
+				vector.ShrinkToFit();
+				Assert::AreEqual(size_t(90), vector.Size());
+				Assert::AreEqual("9"s, vector[9]);
+				Assert::AreEqual("20"s, vector[10]);
+				Assert::AreEqual("99"s, vector.Back());
+			}
+
+			{
+				Vector<SelfReferencing> vector;
+				for (int32_t i = 0; i < 50; ++i)
+				{
+					vector.EmplaceBack();
+				}
+				vector.Remove(vector.begin());
+				for (const SelfReferencing& value : vector)
+				{
+					Assert::IsTrue(value.Self == &value);
+				}
+			}
+
+			// Relocated shared pointers keep their counts
+			{
+				shared_ptr<Foo> foo = make_shared<Foo>(1);
+				Vector<shared_ptr<Foo>> vector;
+				for (int32_t i = 0; i < 50; ++i)
+				{
+					vector.PushBack(foo);
+				}
+				Assert::AreEqual(51L, foo.use_count());
+				vector.Remove(vector.begin(), vector.begin() + 25);
+				Assert::AreEqual(26L, foo.use_count());
+			}
+
+			{
+				Vector<SList<Foo>> vector;
+				for (int32_t i = 0; i < 20; ++i)
+				{
+					vector.PushBack(SList<Foo>{ Foo(i), Foo(i + 1) });
+				}
+				Assert::AreEqual(Foo(19), vector.Back().Front());
+				Assert::AreEqual(Foo(20), vector.Back().Back());
+			}
+		}
+
+		TEST_METHOD(DataAndSpan)
+		{
+			Vector<Foo> vector;
+			Assert::IsTrue(vector.AsSpan().empty());
+
+			vector = { Foo(1), Foo(2), Foo(3) };
+			Assert::IsTrue(vector.Data() == &vector.Front());
+			span<Foo> values = vector.AsSpan();
+			Assert::AreEqual(size_t(3), values.size());
+			values[1].SetData(20);
+			Assert::AreEqual(Foo(20), vector[1]);
+
+			const Vector<Foo>& constVector = vector;
+			span<const Foo> constValues = constVector.AsSpan();
+			Assert::IsTrue(constVector.Data() == constValues.data());
+			Assert::AreEqual(Foo(3), constValues.back());
+
+			// Iterators compile down to pointers when unchecked
+#if !FIEA_CHECKED_ITERATORS
+			Assert::AreEqual(sizeof(Foo*), sizeof(Vector<Foo>::iterator));
+#endif
+		}
+
+		TEST_METHOD(Policies)
+		{
+			// The default policies are empty and take no space
+			Assert::AreEqual(sizeof(Vector<Foo>::Allocator) + sizeof(Foo*) + 2 * sizeof(size_t), sizeof(Vector<Foo>));
+			Assert::IsTrue(sizeof(Vector<Foo>) < sizeof(Vector<Foo, DynamicReserveStrategy>));
+
+			Vector<Foo, DefaultReserveStrategy, SameParity> vector = { Foo(1), Foo(2), Foo(3) };
+			Assert::AreEqual(Foo(2), *vector.Find(Foo(4)));
+			Assert::AreEqual(Foo(1), *vector.Find(Foo(5)));
+			Assert::IsTrue(vector.Remove(Foo(7)));
+			Assert::AreEqual(size_t(2), vector.Size());
+			Assert::AreEqual(Foo(3), *vector.Find(Foo(9)));
+
+			// Copies keep a run-time strategy
+			Vector<Foo, DynamicReserveStrategy> growByThree(0, [](size_t capacity) { return capacity + 3; });
+			Vector<Foo, DynamicReserveStrategy> copy(growByThree);
+			copy.PushBack(Foo(1));
+			Assert::AreEqual(size_t(3), copy.Capacity());
 		}
 
 	private:
+		struct SameParity final
+		{
+			bool operator()(const Foo& lhs, const Foo& rhs) const
+			{
+				return lhs.Data() % 2 == rhs.Data() % 2;
+			}
+		};
+
+		struct SelfReferencing final
+		{
+			SelfReferencing() = default;
+			SelfReferencing(const SelfReferencing&) noexcept {}
+			SelfReferencing& operator=(const SelfReferencing&) noexcept { return *this; }
+			~SelfReferencing() = default;
+
+			SelfReferencing* Self = this;
+		};
+
 		inline static _CrtMemState _startMemState;
 	};
 }
\ No newline at end of file
@@ -12,7 +12,7 @@ namespace FieaGameEngine
     {
         return
         {
-            {"Name", DatumTypes::String, true, Signature::ExternalInfo{1, offsetof(Action, Name)}}
+            {"Name"_sym, DatumTypes::String, true, Signature::ExternalInfo{1, offsetof(Action, Name)}}
         };
     }
 }
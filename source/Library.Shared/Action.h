@@ -10,6 +10,15 @@ namespace FieaGameEngine
         ATTRIBUTED_DECLARATIONS(Action, FieaGameEngine::Attributed);
 
     public:
+        /// <summary>
+        /// Slots of the prescribed attributes, in Signatures() order. See Attributed::Slot
+        /// </summary>
+        enum class Slots : std::size_t
+        {
+            Name = FieaGameEngine::Attributed::SlotCount
+        };
+        static constexpr std::size_t SlotCount = static_cast<std::size_t>(Slots::Name) + 1;
+
         /// <summary>
         /// Name of the Action
         /// </summary>
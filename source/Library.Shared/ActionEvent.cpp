@@ -34,7 +34,7 @@ namespace FieaGameEngine
 
 		// Copy aux attributes to message
 		ForEachAuxiliaryAttribute(
-			[&message](const std::pair<const std::string, Datum>* datumPair)
+			[&message](const std::pair<const Symbol, Datum>* datumPair)
 			{
 				Datum& attribute = message.AppendAuxilaryAttribute(datumPair->first);
 				attribute = datumPair->second;
@@ -54,8 +54,8 @@ namespace FieaGameEngine
 	{
 		return
 		{
-			{"Subtype", DatumTypes::Integer, true, Signature::ExternalInfo{1, offsetof(ActionEvent, Subtype)}},
-			{"Delay", DatumTypes::Integer, true, Signature::ExternalInfo{1, offsetof(ActionEvent, Delay)}}
+			{"Subtype"_sym, DatumTypes::Integer, true, Signature::ExternalInfo{1, offsetof(ActionEvent, Subtype)}},
+			{"Delay"_sym, DatumTypes::Integer, true, Signature::ExternalInfo{1, offsetof(ActionEvent, Delay)}}
 		};
 	}
 }
\ No newline at end of file
@@ -9,6 +9,16 @@ namespace FieaGameEngine
 		ATTRIBUTED_DECLARATIONS(ActionEvent, Action);
 
 	public:
+		/// <summary>
+		/// Slots of the prescribed attributes, in Signatures() order. See Attributed::Slot
+		/// </summary>
+		enum class Slots : std::size_t
+		{
+			Subtype = Action::SlotCount,
+			Delay
+		};
+		static constexpr std::size_t SlotCount = static_cast<std::size_t>(Slots::Delay) + 1;
+
 		ActionEvent();
 		ActionEvent(const ActionEvent& rhs);
 		ActionEvent(ActionEvent&& rhs) noexcept;
@@ -18,12 +28,12 @@ namespace FieaGameEngine
 		/// <summary>
 		/// Subtype of the event message attributed
 		/// </summary>
-		int32_t Subtype;
+		int32_t Subtype = 0;
 
 		/// <summary>
 		/// Delay of the event
 		/// </summary>
-		int32_t Delay;
+		int32_t Delay = 0;
     
 		/// <summary>
 		/// Game loop called every tick
@@ -33,9 +33,9 @@ namespace FieaGameEngine
     {
         return
         {
-            {"Condition", DatumTypes::Boolean, true, Signature::ExternalInfo{1, offsetof(ActionIf, Condition)}},
-            {"IfBlock", DatumTypes::Table, false},
-            {"ElseBlock", DatumTypes::Table, false}
+            {"Condition"_sym, DatumTypes::Boolean, true, Signature::ExternalInfo{1, offsetof(ActionIf, Condition)}},
+            {"IfBlock"_sym, DatumTypes::Table, false},
+            {"ElseBlock"_sym, DatumTypes::Table, false}
         };
     }
 
@@ -43,16 +43,16 @@ namespace FieaGameEngine
     {
         if (Condition)
         {
-            Scope& ifBlock = *At("IfBlock").Get<shared_ptr<Scope>>();
+            Scope& ifBlock = *Slot<Slots::IfBlock>().Get<shared_ptr<Scope>>();
             assert(ifBlock.Is(Action::TypeIdClass()));
             static_cast<Action&>(ifBlock).Update(time);
         }
         else
         {
-            Datum* elseBlockDatum = Find("ElseBlock");
-            if (elseBlockDatum != nullptr)
+            Datum& elseBlockDatum = Slot<Slots::ElseBlock>();
+            if (elseBlockDatum.Size() > 0)
             {
-                Scope& elseBlock = *elseBlockDatum->Get<shared_ptr<Scope>>();
+                Scope& elseBlock = *elseBlockDatum.Get<shared_ptr<Scope>>();
                 assert(elseBlock.Is(Action::TypeIdClass()));
                 static_cast<Action&>(elseBlock).Update(time);
             }
@@ -9,6 +9,17 @@ namespace FieaGameEngine
         ATTRIBUTED_DECLARATIONS(ActionIf, FieaGameEngine::Action);
 
     public:
+        /// <summary>
+        /// Slots of the prescribed attributes, in Signatures() order. See Attributed::Slot
+        /// </summary>
+        enum class Slots : std::size_t
+        {
+            Condition = FieaGameEngine::Action::SlotCount,
+            IfBlock,
+            ElseBlock
+        };
+        static constexpr std::size_t SlotCount = static_cast<std::size_t>(Slots::ElseBlock) + 1;
+
         ActionIf();
         ActionIf(const ActionIf& rhs);
         ActionIf(ActionIf&& rhs) noexcept;
@@ -33,16 +33,20 @@ namespace FieaGameEngine
     {
         return
         {
-            {"Target", DatumTypes::String, true, Signature::ExternalInfo{1, offsetof(ActionIncrement, Target)}},
-            {"Step", DatumTypes::Unknown, false}
+            {"Target"_sym, DatumTypes::String, true, Signature::ExternalInfo{1, offsetof(ActionIncrement, Target)}},
+            {"Step"_sym, DatumTypes::Unknown, false}
         };
     }
 
     void ActionIncrement::Update(const GameTime&)
     {
-        // Get target
-        string targetName = At("Target"s).Get<string>();
-        Datum* targetDatum = Search(targetName);
+        // Get target. The search is cached until the scope hierarchy changes
+        const string& targetName = Slot<Slots::Target>().Get<string>();
+        if (_target != targetName)
+        {
+            _target = Symbol::Find(targetName);
+        }
+        Datum* targetDatum = Search(_target, _targetCache);
         if (targetDatum == nullptr)
         {
             throw runtime_error(format("Target {} does not exist", targetName));
@@ -53,7 +57,7 @@ namespace FieaGameEngine
         }
 
         // Get step amount
-        Datum& stepDatum = this->Append("Step"s);
+        Datum& stepDatum = Slot<Slots::Step>();
         if (stepDatum.Type() == DatumTypes::Unknown)
         {
             // If step doesn't exist, default to 1
@@ -9,6 +9,16 @@ namespace FieaGameEngine
         ATTRIBUTED_DECLARATIONS(ActionIncrement, FieaGameEngine::Action);
 
     public:
+        /// <summary>
+        /// Slots of the prescribed attributes, in Signatures() order. See Attributed::Slot
+        /// </summary>
+        enum class Slots : std::size_t
+        {
+            Target = FieaGameEngine::Action::SlotCount,
+            Step
+        };
+        static constexpr std::size_t SlotCount = static_cast<std::size_t>(Slots::Step) + 1;
+
         ActionIncrement();
         ActionIncrement(const ActionIncrement& rhs);
         ActionIncrement(ActionIncrement&& rhs) noexcept;
@@ -39,6 +49,10 @@ namespace FieaGameEngine
         void Update(const GameTime& time) override;
 
     private:
+        // Target as a symbol, looked up again only when the name changes
+        Symbol _target;
+        Scope::SearchCache _targetCache;
+
         template<typename T>
         void IncrementAs(Datum& targetDatum, const Datum& stepDatum);
     };
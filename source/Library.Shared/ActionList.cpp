@@ -24,12 +24,12 @@ namespace FieaGameEngine
 
     Datum& ActionList::Actions()
     {
-        return At("Actions"s);
+        return Slot<Slots::Actions>();
     }
 
     const Datum& ActionList::Actions() const
     {
-        return At("Actions"s);
+        return Slot<Slots::Actions>();
     }
 
     Action& ActionList::CreateAction(std::string actionClass, std::string name)
@@ -42,7 +42,7 @@ namespace FieaGameEngine
         assert(newAction->Is(Action::TypeIdClass()));
         Action& newActionRef = static_cast<Action&>(*newAction);
         newActionRef.Name = name;
-        Adopt(newAction, "Actions"s);
+        Adopt(newAction, "Actions"_sym);
         return newActionRef;
     }
 
@@ -55,13 +55,13 @@ namespace FieaGameEngine
     {
         return
         {
-            {"Actions", DatumTypes::Table, false}
+            {"Actions"_sym, DatumTypes::Table, false}
         };
     }
 
     void ActionList::Update(const GameTime& time)
     {
-        Datum& actions = (*this)["Actions"s];
+        Datum& actions = Actions();
         for (size_t i = 0; i < actions.Size(); ++i)
         {
             Scope& action = *actions.Get<shared_ptr<Scope>>(i);
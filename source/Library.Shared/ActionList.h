@@ -9,6 +9,15 @@ namespace FieaGameEngine
         ATTRIBUTED_DECLARATIONS(ActionList, FieaGameEngine::Action);
 
     public:
+        /// <summary>
+        /// Slots of the prescribed attributes, in Signatures() order. See Attributed::Slot
+        /// </summary>
+        enum class Slots : std::size_t
+        {
+            Actions = FieaGameEngine::Action::SlotCount
+        };
+        static constexpr std::size_t SlotCount = static_cast<std::size_t>(Slots::Actions) + 1;
+
         ActionList();
         ActionList(const ActionList& rhs);
         ActionList(ActionList&& rhs) noexcept;
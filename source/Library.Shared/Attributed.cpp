@@ -2,6 +2,8 @@
 
 #include "Attributed.h"
 #include <stdexcept>
+#include <algorithm>
+#include <iterator>
 
 using namespace std;
 
@@ -9,6 +11,23 @@ namespace FieaGameEngine
 {
     RTTI_DEFINITIONS(Attributed);
 
+	const Vector<Signature>& Attributed::AllSignatures()
+	{
+		return RegisteredType().Signatures;
+	}
+
+	const TypeRegistry::TypeInfo& Attributed::RegisteredType()
+	{
+		// Root of every Attributed hierarchy, with no prescribed attributes of its own
+		static const TypeRegistry::TypeInfo& typeInfo = TypeRegistry::Register(reinterpret_cast<RTTI::IdType>(&_typeId), nullptr, Signatures());
+		return typeInfo;
+	}
+
+	const Vector<Signature>& Attributed::_AllSignatures() const
+	{
+		return _RegisteredType().Signatures;
+	}
+
 	Attributed& Attributed::operator=(const Attributed& rhs)
 	{
 		Scope::operator=(rhs);
@@ -23,30 +42,39 @@ namespace FieaGameEngine
 		return *this;
 	}
 
-	bool Attributed::IsAttribute(const string& attributeName) const
+	bool Attributed::IsAttribute(Symbol attributeName) const
 	{
 		return Find(attributeName) != nullptr;
 	}
 
-	bool Attributed::IsPrescribedAttribute(const string& attributeName) const
+	bool Attributed::IsAttribute(string_view attributeName) const
 	{
-		for (Signature& signature : _AllSignatures())
-		{
-			if (signature.Name == attributeName)
-			{
-				return true;
-			}
-		}
+		return Find(attributeName) != nullptr;
+	}
+
+	bool Attributed::IsPrescribedAttribute(Symbol attributeName) const
+	{
+		return _RegisteredType().IsPrescribed(attributeName);
+	}
+
+	bool Attributed::IsPrescribedAttribute(string_view attributeName) const
+	{
+		// A string that was never interned cannot be the name of a signature
+		const Symbol symbol = Symbol::Find(attributeName);
+		return !symbol.IsEmpty() && IsPrescribedAttribute(symbol);
+	}
 
-		return false;
+	bool Attributed::IsAuxilaryAttribute(Symbol attributeName) const
+	{
+		return IsAttribute(attributeName) && !IsPrescribedAttribute(attributeName) && attributeName != "this"_sym;
 	}
 
-	bool Attributed::IsAuxilaryAttribute(const string& attributeName) const
+	bool Attributed::IsAuxilaryAttribute(string_view attributeName) const
 	{
-		return IsAttribute(attributeName) && !IsPrescribedAttribute(attributeName) && attributeName != "this";
+		return IsAuxilaryAttribute(Symbol::Find(attributeName));
 	}
 
-	Datum& Attributed::AppendAuxilaryAttribute(const string& attributedName)
+	Datum& Attributed::AppendAuxilaryAttribute(Symbol attributedName)
 	{
 		if (IsPrescribedAttribute(attributedName))
 		{
@@ -55,12 +83,17 @@ namespace FieaGameEngine
 		return Append(attributedName);
 	}
 
+	Datum& Attributed::AppendAuxilaryAttribute(string_view attributedName)
+	{
+		return AppendAuxilaryAttribute(Symbol(attributedName));
+	}
+
 	void Attributed::ForEachAttribute(AttributeCallback callback)
 	{
-		for (auto stringDatumPointer : _orderedList)
+		for (auto& entry : _entries)
 		{
 			// Early out if callback returns true
-			if (callback(stringDatumPointer))
+			if (callback(&entry))
 			{
 				return;
 			}
@@ -69,10 +102,10 @@ namespace FieaGameEngine
 
 	void Attributed::ForEachAttribute(ConstAttributeCallback callback) const
 	{
-		for (auto stringDatumPointer : _orderedList)
+		for (const auto& entry : _entries)
 		{
 			// Early out if callback returns true
-			if (callback(stringDatumPointer))
+			if (callback(&entry))
 			{
 				return;
 			}
@@ -81,11 +114,12 @@ namespace FieaGameEngine
 
 	void Attributed::ForEachPrescribedAttribute(AttributeCallback callback)
 	{
-		size_t prescribedAttributeEnd = _AllSignatures().size() + 1;
-		for (size_t i = 1; i < prescribedAttributeEnd; ++i)
+		size_t prescribedAttributeEnd = _AllSignatures().Size() + 1;
+		auto it = ++_entries.begin();
+		for (size_t i = 1; i < prescribedAttributeEnd; ++i, ++it)
 		{
 			// Early out if callback returns true
-			if (callback(_orderedList[i]))
+			if (callback(&*it))
 			{
 				return;
 			}
@@ -94,11 +128,12 @@ namespace FieaGameEngine
 
 	void Attributed::ForEachPrescribedAttribute(ConstAttributeCallback callback) const
 	{
-		size_t prescribedAttributeEnd = _AllSignatures().size() + 1;
-		for (size_t i = 1; i < prescribedAttributeEnd; ++i)
+		size_t prescribedAttributeEnd = _AllSignatures().Size() + 1;
+		auto it = ++_entries.begin();
+		for (size_t i = 1; i < prescribedAttributeEnd; ++i, ++it)
 		{
 			// Early out if callback returns true
-			if (callback(_orderedList[i]))
+			if (callback(&*it))
 			{
 				return;
 			}
@@ -107,11 +142,11 @@ namespace FieaGameEngine
 
 	void Attributed::ForEachAuxiliaryAttribute(AttributeCallback callback)
 	{
-		size_t prescribedAttributeEnd = _AllSignatures().size() + 1;
-		for (size_t i = prescribedAttributeEnd; i < _orderedList.Size(); ++i)
+		size_t prescribedAttributeEnd = _AllSignatures().Size() + 1;
+		for (auto it = std::next(_entries.begin(), prescribedAttributeEnd); it != _entries.end(); ++it)
 		{
 			// Early out if callback returns true
-			if (callback(_orderedList[i]))
+			if (callback(&*it))
 			{
 				return;
 			}
@@ -120,11 +155,11 @@ namespace FieaGameEngine
 
 	void Attributed::ForEachAuxiliaryAttribute(ConstAttributeCallback callback) const
 	{
-		size_t prescribedAttributeEnd = _AllSignatures().size() + 1;
-		for (size_t i = prescribedAttributeEnd; i < _orderedList.Size(); ++i)
+		size_t prescribedAttributeEnd = _AllSignatures().Size() + 1;
+		for (auto it = std::next(_entries.begin(), prescribedAttributeEnd); it != _entries.end(); ++it)
 		{
 			// Early out if callback returns true
-			if (callback(_orderedList[i]))
+			if (callback(&*it))
 			{
 				return;
 			}
@@ -133,21 +168,13 @@ namespace FieaGameEngine
 
 	bool Attributed::operator==(const Attributed& rhs) const
 	{
-		if (_orderedList.Size() != rhs._orderedList.Size())
+		if (_entries.Size() != rhs._entries.Size())
 		{
 			return false;
 		}
 
 		// Skip this pointer
-		for (std::size_t i = 1; i < _orderedList.Size(); ++i)
-		{
-			if (*_orderedList[i] != *rhs._orderedList[i])
-			{
-				return false;
-			}
-		}
-
-		return true;
+		return _entries.IsEmpty() || std::equal(++_entries.begin(), _entries.end(), ++rhs._entries.begin());
 	}
 
 	bool Attributed::operator!=(const Attributed& rhs) const
@@ -167,44 +194,127 @@ namespace FieaGameEngine
 	void Attributed::Populate(const Vector<Signature>& signatures)
 	{
 		// Add 'this' to scope
-		Datum& thisDatum = Append("this");
+		Datum& thisDatum = Append("this"_sym);
 		thisDatum = static_cast<RTTI*>(this);
 		// Add each prescribed signature
 		for (const Signature& signature : signatures)
 		{
+			Datum& datum = Append(signature.Name);
 			if (signature.IsExternal)
 			{
-				Signature::ExternalInfo externalInfo = std::get<Signature::ExternalInfo>(signature.SigInfo);
-				if (signature.Type == DatumTypes::TablePointer)
-				{
-					Datum& datum = Append(signature.Name);
-					datum.Clear();
-					datum.SetType(signature.Type);
-					datum.Reserve(externalInfo.Size);
-					for (size_t i = 0; i < externalInfo.Size; ++i)
-					{
-						// TODO: pointer arthimetic will be wrong if derived from scope and i > 0
-						Scope* pointerToScope = reinterpret_cast<Scope*>(reinterpret_cast<std::byte*>(this) + externalInfo.Offset) + i;		
-						Adopt(pointerToScope, signature.Name);
-					}
-				}
-				else
-				{
-					Datum& datum = Append(signature.Name);
-					datum.SetStorage(
-						signature.Type,
-						reinterpret_cast<std::byte*>(this) + externalInfo.Offset,
-						externalInfo.Size);
-				}
+				_BindExternal(datum, signature);
 			}
-			else
+			else if (signature.Type != DatumTypes::Unknown)
 			{
-				Datum& datum = Append(signature.Name);
-				if (signature.Type != DatumTypes::Unknown)
-				{
-					datum.SetType(signature.Type);
-				}
+				datum.SetType(signature.Type);
 			}
 		}
 	}
+
+	void Attributed::_Instantiate(const TypeRegistry::TypeInfo& typeInfo)
+	{
+		if (!typeInfo.HasUniqueNames)
+		{
+			Populate(typeInfo.Signatures);
+			return;
+		}
+
+		assert(_entries.IsEmpty());
+		_entries.Reserve(typeInfo.Signatures.Size() + 1);
+
+		Datum& thisDatum = _AppendUnique("this"_sym);
+		thisDatum = static_cast<RTTI*>(this);
+		for (const Signature& signature : typeInfo.Signatures)
+		{
+			Datum& datum = _AppendUnique(signature.Name);
+			if (signature.IsExternal)
+			{
+				_BindExternal(datum, signature);
+			}
+			else if (signature.Type != DatumTypes::Unknown)
+			{
+				datum.SetType(signature.Type);
+			}
+		}
+	}
+
+	void Attributed::_CopyAttributes(const Attributed& rhs, const TypeRegistry::TypeInfo& typeInfo)
+	{
+		if (!typeInfo.HasUniqueNames)
+		{
+			for (const auto& [name, datum] : rhs._entries)
+			{
+				_CopyDatum(Append(name), datum);
+			}
+			Populate(typeInfo.Signatures);
+			return;
+		}
+
+		// One segment holds every attribute of the copy
+		_entries.Reserve(rhs._entries.Size());
+		_Instantiate(typeInfo);
+		// rhs is this class or derived from it, so its prescribed attributes come first and in the same order
+		const size_t prescribedAttributeEnd = typeInfo.Signatures.Size() + 1;
+		auto entry = ++_entries.begin();
+		auto entryToCopy = ++rhs._entries.begin();
+		for (size_t i = 1; i < prescribedAttributeEnd; ++i, ++entry, ++entryToCopy)
+		{
+			assert(entry->first == entryToCopy->first);
+			// External attributes are already bound to the members the derived class copies
+			if (!typeInfo.Signatures[i - 1].IsExternal)
+			{
+				_CopyDatum(entry->second, entryToCopy->second);
+			}
+		}
+		for (; entryToCopy != rhs._entries.end(); ++entryToCopy)
+		{
+			_CopyDatum(_AppendUnique(entryToCopy->first), entryToCopy->second);
+		}
+	}
+
+	void Attributed::_Rebase(const TypeRegistry::TypeInfo& typeInfo)
+	{
+		if (!typeInfo.HasUniqueNames)
+		{
+			Populate(typeInfo.Signatures);
+			return;
+		}
+
+		// The moved scope keeps its layout, only the pointers into the old object change
+		assert(_entries.Size() > typeInfo.Signatures.Size());
+		auto entry = _entries.begin();
+		entry->second = static_cast<RTTI*>(this);
+		for (const Signature& signature : typeInfo.Signatures)
+		{
+			++entry;
+			if (signature.IsExternal)
+			{
+				_BindExternal(entry->second, signature);
+			}
+		}
+	}
+
+	void Attributed::_BindExternal(Datum& datum, const Signature& signature)
+	{
+		const Signature::ExternalInfo& externalInfo = std::get<Signature::ExternalInfo>(signature.SigInfo);
+		if (signature.Type == DatumTypes::TablePointer)
+		{
+			datum.Clear();
+			datum.SetType(signature.Type);
+			datum.Reserve(externalInfo.Size);
+			for (size_t i = 0; i < externalInfo.Size; ++i)
+			{
+				// TODO: pointer arthimetic will be wrong if derived from scope and i > 0
+				Scope* pointerToScope = reinterpret_cast<Scope*>(reinterpret_cast<std::byte*>(this) + externalInfo.Offset) + i;
+				Adopt(pointerToScope, signature.Name);
+			}
+		}
+		else
+		{
+			datum.SetStorage(
+				signature.Type,
+				reinterpret_cast<std::byte*>(this) + externalInfo.Offset,
+				externalInfo.Size);
+		}
+	}
 }
\ No newline at end of file
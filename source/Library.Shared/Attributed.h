@@ -1,10 +1,13 @@
 #pragma once
 
 #include <concepts>
+#include <type_traits>
+#include <cassert>
 #include <vector>
 #include <string>
 #include "Scope.h"
 #include "Signature.h"
+#include "TypeRegistry.h"
 
 namespace FieaGameEngine
 {
@@ -22,7 +25,14 @@ namespace FieaGameEngine
 		/// </summary>
 		/// <param name="attributeName">Key to check</param>
 		/// <returns>True if the key is a attribute; otherwise false</returns>
-		bool IsAttribute(const std::string& attributeName) const;
+		bool IsAttribute(Symbol attributeName) const;
+
+		/// <summary>
+		/// Checks whether the table contains a member by a given key
+		/// </summary>
+		/// <param name="attributeName">Key to check</param>
+		/// <returns>True if the key is a attribute; otherwise false</returns>
+		bool IsAttribute(std::string_view attributeName) const;
 
 		/// <summary>
 		/// Checks whether the given key is a member that persists across all
@@ -31,7 +41,25 @@ namespace FieaGameEngine
 		/// </summary>
 		/// <param name="attributeName">Key to check</param>
 		/// <returns>True if the key is a prescribed attribute; otherwise false</returns>
-		bool IsPrescribedAttribute(const std::string& attributeName) const;
+		bool IsPrescribedAttribute(Symbol attributeName) const;
+
+		/// <summary>
+		/// Checks whether the given key is a member that persists across all
+		/// objects of this Attributed class.
+		/// The 'this' key is not considered a prescribed attribute 
+		/// </summary>
+		/// <param name="attributeName">Key to check</param>
+		/// <returns>True if the key is a prescribed attribute; otherwise false</returns>
+		bool IsPrescribedAttribute(std::string_view attributeName) const;
+
+		/// <summary>
+		/// Checks whether the given key is a member of the table but not
+		/// a prescribed attribute.
+		/// The 'this' key is not considered an auxilary attribute 
+		/// </summary>
+		/// <param name="attributeName">Key to check</param>
+		/// <returns>True if the key is an auxilary attribute; otherwise false</returns>
+		bool IsAuxilaryAttribute(Symbol attributeName) const;
 
 		/// <summary>
 		/// Checks whether the given key is a member of the table but not
@@ -40,7 +68,7 @@ namespace FieaGameEngine
 		/// </summary>
 		/// <param name="attributeName">Key to check</param>
 		/// <returns>True if the key is an auxilary attribute; otherwise false</returns>
-		bool IsAuxilaryAttribute(const std::string& attributeName) const;
+		bool IsAuxilaryAttribute(std::string_view attributeName) const;
 
 		/// <summary>
 		/// Adds an auxilary member to the table. If the key already exists as a prescribed member an exception is thrown.
@@ -48,10 +76,18 @@ namespace FieaGameEngine
 		/// <param name="attributeName">Auxilary key t oadd</param>
 		/// <exception cref="runtime_error">A prescribed attribute already exists with this name</exception>
 		/// <returns>Datum of the newly created auxilary member or a reference to a prexisting datum if the key already exists</returns>
-		Datum& AppendAuxilaryAttribute(const std::string& attributeName);
+		Datum& AppendAuxilaryAttribute(Symbol attributeName);
 
-		using AttributeCallback = std::function<bool(std::pair<const std::string, Datum>*)>;
-		using ConstAttributeCallback = std::function<bool(const std::pair<const std::string, Datum>*)>;
+		/// <summary>
+		/// Adds an auxilary member to the table. If the key already exists as a prescribed member an exception is thrown.
+		/// </summary>
+		/// <param name="attributeName">Auxilary key t oadd</param>
+		/// <exception cref="runtime_error">A prescribed attribute already exists with this name</exception>
+		/// <returns>Datum of the newly created auxilary member or a reference to a prexisting datum if the key already exists</returns>
+		Datum& AppendAuxilaryAttribute(std::string_view attributeName);
+
+		using AttributeCallback = std::function<bool(std::pair<const Symbol, Datum>*)>;
+		using ConstAttributeCallback = std::function<bool(const std::pair<const Symbol, Datum>*)>;
 		
 		/// <summary>
 		/// Iterates through all attributes of this table and calls a callback function provided for each.
@@ -121,11 +157,15 @@ namespace FieaGameEngine
 		/// This method returns signatures for both this class and signatures dervied from this class's parents
 		/// Derived classes MUST implement this method using the ATTRIBUTED_DECLARATIONS macro in the derived class's declaration
 		/// </summary>
-		/// <returns>Prescibed signatures for this class and parent classes</returns>
-		[[nodiscard]] static Vector<Signature> AllSignatures()
-		{
-			return Signatures();
-		}
+		/// <returns>Prescibed signatures for this class and parent classes, cached in the type registry</returns>
+		[[nodiscard]] static const Vector<Signature>& AllSignatures();
+
+		/// <summary>
+		/// Entry of this class in the type registry. Registers the class on first call.
+		/// Derived classes MUST implement this method using the ATTRIBUTED_DECLARATIONS macro in the derived class's declaration
+		/// </summary>
+		/// <returns>Registered signatures and name lookup for this class</returns>
+		[[nodiscard]] static const TypeRegistry::TypeInfo& RegisteredType();
 
 		/// <summary>
 		/// A list of signatures that describes each prescribed attribute for this class only.
@@ -136,6 +176,31 @@ namespace FieaGameEngine
 		{
 			return {};
 		}
+
+		/// <summary>
+		/// Number of prescribed attributes of this class and its parents.
+		/// Derived classes that prescribe attributes declare a Slots enum, in Signatures() order,
+		/// whose first value is the parent's SlotCount, and redeclare SlotCount after it.
+		/// </summary>
+		static constexpr std::size_t SlotCount = 0;
+
+		/// <summary>
+		/// Gets a prescribed attribute by its slot, without a hash lookup
+		/// </summary>
+		/// <typeparam name="SlotIndex">Value of a Slots enum, e.g. GameObject::Slots::Children</typeparam>
+		/// <returns>Datum of the prescribed attribute</returns>
+		template <auto SlotIndex>
+			requires std::is_enum_v<decltype(SlotIndex)>
+		[[nodiscard]] Datum& Slot();
+
+		/// <summary>
+		/// Gets a prescribed attribute by its slot, without a hash lookup
+		/// </summary>
+		/// <typeparam name="SlotIndex">Value of a Slots enum, e.g. GameObject::Slots::Children</typeparam>
+		/// <returns>Datum of the prescribed attribute</returns>
+		template <auto SlotIndex>
+			requires std::is_enum_v<decltype(SlotIndex)>
+		[[nodiscard]] const Datum& Slot() const;
 		
 		/// <summary>
 		/// Populates the scope with prescribed attributes
@@ -192,42 +257,71 @@ namespace FieaGameEngine
 		Attributed& operator=(Attributed&& rhs) noexcept;
 
 		/// <summary>
-		/// Virtual version of the static AllSignatures method
+		/// Signatures of the dynamic type of this object
 		/// </summary>
 		/// <returns>Signatures for this class plus parent class signatures</returns>
-		[[nodiscard]] virtual Vector<Signature> _AllSignatures() const = 0;
+		[[nodiscard]] const Vector<Signature>& _AllSignatures() const;
+
+		/// <summary>
+		/// Virtual version of the static RegisteredType method
+		/// </summary>
+		/// <returns>Registered signatures and name lookup for the dynamic type of this object</returns>
+		[[nodiscard]] virtual const TypeRegistry::TypeInfo& _RegisteredType() const = 0;
 
 		/// <summary>
 		/// Virtual version of the static Signatures method
 		/// </summary>
 		/// <returns>Signatures for this class only</returns>
 		[[nodiscard]] virtual Vector<Signature> _Signatures() const = 0;
+
+	private:
+		// Lays out 'this' and the prescribed attributes of an empty scope in one pass, reserving exact sizes
+		void _Instantiate(const TypeRegistry::TypeInfo& typeInfo);
+		// Lays out the prescribed attributes, then copies the internal prescribed and the auxiliary attributes of rhs
+		void _CopyAttributes(const Attributed& rhs, const TypeRegistry::TypeInfo& typeInfo);
+		// Points 'this' and the external attributes of a moved scope at this object
+		void _Rebase(const TypeRegistry::TypeInfo& typeInfo);
+		// Points a prescribed datum at the member a signature describes
+		void _BindExternal(Datum& datum, const Signature& signature);
 	};
 }
 																										   
-#define ATTRIBUTED_DECLARATIONS(Type, ParentType)	   													    \
-	RTTI_DECLARATIONS(Type, ParentType);											                        \
-    public:																						            \
-		[[nodiscard]] static FieaGameEngine::Vector<FieaGameEngine::Signature> AllSignatures();             \
-	protected:														        					            \
-		[[nodiscard]] virtual FieaGameEngine::Vector<FieaGameEngine::Signature> _AllSignatures() const;		\
+#define ATTRIBUTED_DECLARATIONS(Type, ParentType)                                                           \
+	RTTI_DECLARATIONS(Type, ParentType);                                                                    \
+    public:                                                                                                 \
+		[[nodiscard]] static const FieaGameEngine::Vector<FieaGameEngine::Signature>& AllSignatures();      \
+		[[nodiscard]] static const FieaGameEngine::TypeRegistry::TypeInfo& RegisteredType();                \
+	protected:                                                                                              \
+		[[nodiscard]] const FieaGameEngine::TypeRegistry::TypeInfo& _RegisteredType() const override;       \
 		[[nodiscard]] virtual FieaGameEngine::Vector<FieaGameEngine::Signature> _Signatures() const;
 
+// Registers the class at static initialization. The parent registers first through its own RegisteredType(),
+// so the order translation units initialize in does not matter. The type id is taken from the address of
+// _typeId because _typeId itself may not be initialized yet.
 #define ATTRIBUTED_DEFINITIONS(Type, ParentType)                                                            \
-	RTTI_DEFINITIONS(Type);																			        \
-	FieaGameEngine::Vector<FieaGameEngine::Signature> Type::AllSignatures()                                 \
-	{																										\
-		return ParentType::AllSignatures().Append(Signatures());                                            \
-	}																										\
-														        											\
-	FieaGameEngine::Vector<FieaGameEngine::Signature> Type::_AllSignatures() const		                    \
-	{																										\
-		return AllSignatures();																				\
-	}																										\
-																											\
-	FieaGameEngine::Vector<FieaGameEngine::Signature> Type::_Signatures() const			                    \
-	{																										\
-		return Signatures();																				\
-	}
-																																																																											
+	RTTI_DEFINITIONS(Type);                                                                                 \
+	const FieaGameEngine::TypeRegistry::TypeInfo& Type::RegisteredType()                                    \
+	{                                                                                                       \
+		static const FieaGameEngine::TypeRegistry::TypeInfo& typeInfo = FieaGameEngine::TypeRegistry::Register( \
+			reinterpret_cast<FieaGameEngine::RTTI::IdType>(&Type::_typeId), &ParentType::RegisteredType(), Signatures()); \
+		return typeInfo;                                                                                    \
+	}                                                                                                       \
+                                                                                                            \
+	const FieaGameEngine::Vector<FieaGameEngine::Signature>& Type::AllSignatures()                          \
+	{                                                                                                       \
+		return RegisteredType().Signatures;                                                                 \
+	}                                                                                                       \
+                                                                                                            \
+	const FieaGameEngine::TypeRegistry::TypeInfo& Type::_RegisteredType() const                            \
+	{                                                                                                       \
+		return RegisteredType();                                                                            \
+	}                                                                                                       \
+                                                                                                            \
+	FieaGameEngine::Vector<FieaGameEngine::Signature> Type::_Signatures() const                             \
+	{                                                                                                       \
+		return Signatures();                                                                                \
+	}                                                                                                       \
+                                                                                                            \
+	[[maybe_unused]] static const FieaGameEngine::TypeRegistry::TypeInfo& _##Type##Registration = Type::RegisteredType()
+
 #include "Attributed.inl"																					
\ No newline at end of file
@@ -5,18 +5,36 @@ namespace FieaGameEngine
 	template<std::derived_from<Attributed> T>
 	Attributed::Attributed(T*) : Scope()
 	{
-		Populate(T::AllSignatures());
+		_Instantiate(T::RegisteredType());
 	}
 
 	template<std::derived_from<Attributed> T>
-	Attributed::Attributed(const Attributed& rhs, T*) : Scope(rhs)
+	Attributed::Attributed(const Attributed& rhs, T*) : Scope()
 	{
-		Populate(T::AllSignatures());
+		_CopyAttributes(rhs, T::RegisteredType());
 	}
 
 	template<std::derived_from<Attributed> T>
 	Attributed::Attributed(Attributed&& rhs, T*) noexcept : Scope(std::move(rhs))
 	{
-		Populate(T::AllSignatures());
+		_Rebase(T::RegisteredType());
+	}
+
+	template <auto SlotIndex>
+		requires std::is_enum_v<decltype(SlotIndex)>
+	inline Datum& Attributed::Slot()
+	{
+		// Populate appends the prescribed attributes in order right after 'this'
+		constexpr std::size_t index = static_cast<std::size_t>(SlotIndex) + 1;
+		auto& entry = _entries.EntryAt(index);
+		assert(entry.first == _AllSignatures()[index - 1].Name);
+		return entry.second;
+	}
+
+	template <auto SlotIndex>
+		requires std::is_enum_v<decltype(SlotIndex)>
+	inline const Datum& Attributed::Slot() const
+	{
+		return const_cast<Attributed*>(this)->Slot<SlotIndex>();
 	}
 }
\ No newline at end of file
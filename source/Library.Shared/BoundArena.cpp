@@ -0,0 +1,19 @@
+#include "pch.h"
+#include "BoundArena.h"
+
+namespace FieaGameEngine
+{
+	static thread_local std::pmr::memory_resource* _boundArena = nullptr;
+
+	std::pmr::memory_resource* BoundArena() noexcept
+	{
+		return _boundArena;
+	}
+
+	std::pmr::memory_resource* BindArena(std::pmr::memory_resource* arena) noexcept
+	{
+		std::pmr::memory_resource* previous = _boundArena;
+		_boundArena = arena;
+		return previous;
+	}
+}
@@ -0,0 +1,21 @@
+#pragma once
+
+#include <memory_resource>
+
+namespace FieaGameEngine
+{
+	/// <summary>
+	/// Gets the arena bound to the calling thread. While one is bound, datum storage and the scopes created on
+	/// this thread allocate from it. Null when nothing is bound and they use the heap. See ScopeArena::Binding
+	/// </summary>
+	/// <returns>Arena bound to the calling thread, or null</returns>
+	[[nodiscard]] std::pmr::memory_resource* BoundArena() noexcept;
+
+	/// <summary>
+	/// Binds an arena to the calling thread. Blocks taken from it are never freed individually,
+	/// so it must release all of its memory at once, like std::pmr::monotonic_buffer_resource
+	/// </summary>
+	/// <param name="arena">Arena to bind, or null to allocate from the heap again</param>
+	/// <returns>Arena that was bound before</returns>
+	std::pmr::memory_resource* BindArena(std::pmr::memory_resource* arena) noexcept;
+}
@@ -0,0 +1,336 @@
+#include "pch.h"
+
+#include "BulkOps.h"
+#include <stdexcept>
+
+// Define FIEA_BULK_OPS_SCALAR to force the scalar loops, e.g. to compare against the vector paths
+#if !defined(FIEA_BULK_OPS_SCALAR)
+#if defined(__AVX__)
+#define FIEA_BULK_OPS_AVX
+#endif
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define FIEA_BULK_OPS_SSE
+#endif
+#endif
+
+#if defined(FIEA_BULK_OPS_AVX)
+#include <immintrin.h>
+#elif defined(FIEA_BULK_OPS_SSE)
+#include <emmintrin.h>
+#endif
+
+using namespace std;
+
+namespace FieaGameEngine
+{
+	// vec4 arrays are processed as float arrays four times as long
+	static_assert(sizeof(glm::vec4) == 4 * sizeof(float));
+	static_assert(sizeof(glm::mat4) == 4 * sizeof(glm::vec4));
+
+	namespace
+	{
+		void CheckSizes(size_t lhs, size_t rhs)
+		{
+			if (lhs != rhs)
+			{
+				throw runtime_error("Spans differ in size");
+			}
+		}
+
+		span<float> AsFloats(span<glm::vec4> values)
+		{
+			return span<float>(reinterpret_cast<float*>(values.data()), values.size() * 4);
+		}
+
+		span<const float> AsFloats(span<const glm::vec4> values)
+		{
+			return span<const float>(reinterpret_cast<const float*>(values.data()), values.size() * 4);
+		}
+
+		/// <summary>
+		/// Runs an operation over two float arrays, eight lanes at a time with AVX, then four with SSE, then one at a time.
+		/// The operation provides an Apply overload for each width it supports
+		/// </summary>
+		template <typename Operation>
+		void ApplyBinary(span<float> destination, span<const float> source, const Operation& operation)
+		{
+			CheckSizes(destination.size(), source.size());
+			float* const lhs = destination.data();
+			const float* const rhs = source.data();
+			const size_t size = destination.size();
+			size_t i = 0;
+
+#if defined(FIEA_BULK_OPS_AVX)
+			for (; i + 8 <= size; i += 8)
+			{
+				_mm256_storeu_ps(lhs + i, operation.Apply(_mm256_loadu_ps(lhs + i), _mm256_loadu_ps(rhs + i)));
+			}
+#endif
+#if defined(FIEA_BULK_OPS_SSE)
+			for (; i + 4 <= size; i += 4)
+			{
+				_mm_storeu_ps(lhs + i, operation.Apply(_mm_loadu_ps(lhs + i), _mm_loadu_ps(rhs + i)));
+			}
+#endif
+			for (; i < size; ++i)
+			{
+				lhs[i] = operation.Apply(lhs[i], rhs[i]);
+			}
+		}
+
+		struct AddOperation final
+		{
+#if defined(FIEA_BULK_OPS_AVX)
+			__m256 Apply(__m256 lhs, __m256 rhs) const { return _mm256_add_ps(lhs, rhs); }
+#endif
+#if defined(FIEA_BULK_OPS_SSE)
+			__m128 Apply(__m128 lhs, __m128 rhs) const { return _mm_add_ps(lhs, rhs); }
+#endif
+			float Apply(float lhs, float rhs) const { return lhs + rhs; }
+		};
+
+		struct MinOperation final
+		{
+#if defined(FIEA_BULK_OPS_AVX)
+			__m256 Apply(__m256 lhs, __m256 rhs) const { return _mm256_min_ps(lhs, rhs); }
+#endif
+#if defined(FIEA_BULK_OPS_SSE)
+			__m128 Apply(__m128 lhs, __m128 rhs) const { return _mm_min_ps(lhs, rhs); }
+#endif
+			float Apply(float lhs, float rhs) const { return rhs < lhs ? rhs : lhs; }
+		};
+
+		struct MaxOperation final
+		{
+#if defined(FIEA_BULK_OPS_AVX)
+			__m256 Apply(__m256 lhs, __m256 rhs) const { return _mm256_max_ps(lhs, rhs); }
+#endif
+#if defined(FIEA_BULK_OPS_SSE)
+			__m128 Apply(__m128 lhs, __m128 rhs) const { return _mm_max_ps(lhs, rhs); }
+#endif
+			float Apply(float lhs, float rhs) const { return rhs > lhs ? rhs : lhs; }
+		};
+
+		/// <summary>
+		/// Multiplies the right hand side by a scale and adds it to the left hand side.
+		/// Scaling alone is the same operation with the values on both sides and no add
+		/// </summary>
+		template <bool Accumulate>
+		struct ScaleOperation final
+		{
+			explicit ScaleOperation(float scale) :
+#if defined(FIEA_BULK_OPS_AVX)
+				Scale8(_mm256_set1_ps(scale)),
+#endif
+#if defined(FIEA_BULK_OPS_SSE)
+				Scale4(_mm_set1_ps(scale)),
+#endif
+				Scale(scale)
+			{
+			}
+
+#if defined(FIEA_BULK_OPS_AVX)
+			__m256 Apply(__m256 lhs, __m256 rhs) const
+			{
+				if constexpr (Accumulate)
+				{
+#if defined(__FMA__)
+					return _mm256_fmadd_ps(rhs, Scale8, lhs);
+#else
+					return _mm256_add_ps(lhs, _mm256_mul_ps(rhs, Scale8));
+#endif
+				}
+				else
+				{
+					return _mm256_mul_ps(rhs, Scale8);
+				}
+			}
+			__m256 Scale8;
+#endif
+#if defined(FIEA_BULK_OPS_SSE)
+			__m128 Apply(__m128 lhs, __m128 rhs) const
+			{
+				if constexpr (Accumulate)
+				{
+					return _mm_add_ps(lhs, _mm_mul_ps(rhs, Scale4));
+				}
+				else
+				{
+					return _mm_mul_ps(rhs, Scale4);
+				}
+			}
+			__m128 Scale4;
+#endif
+			float Apply(float lhs, float rhs) const
+			{
+				if constexpr (Accumulate)
+				{
+					return lhs + rhs * Scale;
+				}
+				else
+				{
+					return rhs * Scale;
+				}
+			}
+			float Scale;
+		};
+
+#if defined(FIEA_BULK_OPS_SSE)
+		float HorizontalSum(__m128 values)
+		{
+			__m128 shuffled = _mm_shuffle_ps(values, values, _MM_SHUFFLE(2, 3, 0, 1));
+			__m128 sums = _mm_add_ps(values, shuffled);
+			shuffled = _mm_movehl_ps(shuffled, sums);
+			sums = _mm_add_ss(sums, shuffled);
+			return _mm_cvtss_f32(sums);
+		}
+#endif
+	}
+
+	void BulkOps::Add(span<float> destination, span<const float> source)
+	{
+		ApplyBinary(destination, source, AddOperation{});
+	}
+
+	void BulkOps::Add(span<glm::vec4> destination, span<const glm::vec4> source)
+	{
+		CheckSizes(destination.size(), source.size());
+		ApplyBinary(AsFloats(destination), AsFloats(source), AddOperation{});
+	}
+
+	void BulkOps::Scale(span<float> values, float scale)
+	{
+		ApplyBinary(values, values, ScaleOperation<false>(scale));
+	}
+
+	void BulkOps::Scale(span<glm::vec4> values, float scale)
+	{
+		ApplyBinary(AsFloats(values), AsFloats(values), ScaleOperation<false>(scale));
+	}
+
+	void BulkOps::MultiplyAdd(span<float> destination, span<const float> source, float scale)
+	{
+		ApplyBinary(destination, source, ScaleOperation<true>(scale));
+	}
+
+	void BulkOps::MultiplyAdd(span<glm::vec4> destination, span<const glm::vec4> source, float scale)
+	{
+		CheckSizes(destination.size(), source.size());
+		ApplyBinary(AsFloats(destination), AsFloats(source), ScaleOperation<true>(scale));
+	}
+
+	void BulkOps::Min(span<float> destination, span<const float> source)
+	{
+		ApplyBinary(destination, source, MinOperation{});
+	}
+
+	void BulkOps::Min(span<glm::vec4> destination, span<const glm::vec4> source)
+	{
+		CheckSizes(destination.size(), source.size());
+		ApplyBinary(AsFloats(destination), AsFloats(source), MinOperation{});
+	}
+
+	void BulkOps::Max(span<float> destination, span<const float> source)
+	{
+		ApplyBinary(destination, source, MaxOperation{});
+	}
+
+	void BulkOps::Max(span<glm::vec4> destination, span<const glm::vec4> source)
+	{
+		CheckSizes(destination.size(), source.size());
+		ApplyBinary(AsFloats(destination), AsFloats(source), MaxOperation{});
+	}
+
+	float BulkOps::Dot(span<const float> lhs, span<const float> rhs)
+	{
+		CheckSizes(lhs.size(), rhs.size());
+		const size_t size = lhs.size();
+		size_t i = 0;
+		float sum = 0.0f;
+
+#if defined(FIEA_BULK_OPS_AVX)
+		__m256 sums8 = _mm256_setzero_ps();
+		for (; i + 8 <= size; i += 8)
+		{
+			sums8 = _mm256_add_ps(sums8, _mm256_mul_ps(_mm256_loadu_ps(lhs.data() + i), _mm256_loadu_ps(rhs.data() + i)));
+		}
+		sum += HorizontalSum(_mm_add_ps(_mm256_castps256_ps128(sums8), _mm256_extractf128_ps(sums8, 1)));
+#endif
+#if defined(FIEA_BULK_OPS_SSE)
+		__m128 sums4 = _mm_setzero_ps();
+		for (; i + 4 <= size; i += 4)
+		{
+			sums4 = _mm_add_ps(sums4, _mm_mul_ps(_mm_loadu_ps(lhs.data() + i), _mm_loadu_ps(rhs.data() + i)));
+		}
+		sum += HorizontalSum(sums4);
+#endif
+		for (; i < size; ++i)
+		{
+			sum += lhs[i] * rhs[i];
+		}
+
+		return sum;
+	}
+
+	void BulkOps::Dot(span<float> results, span<const glm::vec4> lhs, span<const glm::vec4> rhs)
+	{
+		CheckSizes(lhs.size(), rhs.size());
+		CheckSizes(results.size(), lhs.size());
+		for (size_t i = 0; i < results.size(); ++i)
+		{
+#if defined(FIEA_BULK_OPS_SSE)
+			results[i] = HorizontalSum(_mm_mul_ps(_mm_loadu_ps(&lhs[i].x), _mm_loadu_ps(&rhs[i].x)));
+#else
+			results[i] = glm::dot(lhs[i], rhs[i]);
+#endif
+		}
+	}
+
+	void BulkOps::Transform(span<glm::vec4> destination, const glm::mat4& matrix, span<const glm::vec4> source)
+	{
+		CheckSizes(destination.size(), source.size());
+		const size_t size = destination.size();
+		size_t i = 0;
+
+		// glm matrices are column major: the result is the sum of each column scaled by one component of the vector
+#if defined(FIEA_BULK_OPS_AVX)
+		{
+			// Two vectors per register, with the columns repeated in both halves
+			const __m256 column0 = _mm256_broadcast_ps(reinterpret_cast<const __m128*>(&matrix[0].x));
+			const __m256 column1 = _mm256_broadcast_ps(reinterpret_cast<const __m128*>(&matrix[1].x));
+			const __m256 column2 = _mm256_broadcast_ps(reinterpret_cast<const __m128*>(&matrix[2].x));
+			const __m256 column3 = _mm256_broadcast_ps(reinterpret_cast<const __m128*>(&matrix[3].x));
+			for (; i + 2 <= size; i += 2)
+			{
+				const __m256 vectors = _mm256_loadu_ps(&source[i].x);
+				__m256 result = _mm256_mul_ps(column0, _mm256_permute_ps(vectors, 0x00));
+				result = _mm256_add_ps(result, _mm256_mul_ps(column1, _mm256_permute_ps(vectors, 0x55)));
+				result = _mm256_add_ps(result, _mm256_mul_ps(column2, _mm256_permute_ps(vectors, 0xAA)));
+				result = _mm256_add_ps(result, _mm256_mul_ps(column3, _mm256_permute_ps(vectors, 0xFF)));
+				_mm256_storeu_ps(&destination[i].x, result);
+			}
+		}
+#endif
+#if defined(FIEA_BULK_OPS_SSE)
+		{
+			const __m128 column0 = _mm_loadu_ps(&matrix[0].x);
+			const __m128 column1 = _mm_loadu_ps(&matrix[1].x);
+			const __m128 column2 = _mm_loadu_ps(&matrix[2].x);
+			const __m128 column3 = _mm_loadu_ps(&matrix[3].x);
+			for (; i < size; ++i)
+			{
+				const __m128 vector = _mm_loadu_ps(&source[i].x);
+				__m128 result = _mm_mul_ps(column0, _mm_shuffle_ps(vector, vector, _MM_SHUFFLE(0, 0, 0, 0)));
+				result = _mm_add_ps(result, _mm_mul_ps(column1, _mm_shuffle_ps(vector, vector, _MM_SHUFFLE(1, 1, 1, 1))));
+				result = _mm_add_ps(result, _mm_mul_ps(column2, _mm_shuffle_ps(vector, vector, _MM_SHUFFLE(2, 2, 2, 2))));
+				result = _mm_add_ps(result, _mm_mul_ps(column3, _mm_shuffle_ps(vector, vector, _MM_SHUFFLE(3, 3, 3, 3))));
+				_mm_storeu_ps(&destination[i].x, result);
+			}
+		}
+#endif
+		for (; i < size; ++i)
+		{
+			destination[i] = matrix * source[i];
+		}
+	}
+}
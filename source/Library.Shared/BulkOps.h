@@ -0,0 +1,131 @@
+#pragma once
+
+#include <cstddef>
+#include <span>
+#pragma warning(push)
+#pragma warning(disable:4201)
+#include <glm/glm.hpp>
+#pragma warning(pop)
+
+namespace FieaGameEngine
+{
+	/// <summary>
+	/// Vectorized arithmetic over contiguous float, glm::vec4 and glm::mat4 arrays, such as the spans
+	/// returned by Datum::AsSpan. Uses AVX when the build targets it, SSE2 otherwise, and falls back
+	/// to scalar loops on other targets. Element wise operations allow the destination to be one of the sources.
+	/// </summary>
+	class BulkOps final
+	{
+	public:
+		BulkOps() = delete;
+
+		/// <summary>
+		/// Adds each source value to the destination value at the same index
+		/// </summary>
+		/// <param name="destination">Values to add to</param>
+		/// <param name="source">Values to add</param>
+		/// <exception cref="runtime_error">Spans differ in size</exception>
+		static void Add(std::span<float> destination, std::span<const float> source);
+
+		/// <summary>
+		/// Adds each source vector to the destination vector at the same index
+		/// </summary>
+		/// <param name="destination">Vectors to add to</param>
+		/// <param name="source">Vectors to add</param>
+		/// <exception cref="runtime_error">Spans differ in size</exception>
+		static void Add(std::span<glm::vec4> destination, std::span<const glm::vec4> source);
+
+		/// <summary>
+		/// Multiplies every value by a scale
+		/// </summary>
+		/// <param name="values">Values to scale</param>
+		/// <param name="scale">Scale to multiply by</param>
+		static void Scale(std::span<float> values, float scale);
+
+		/// <summary>
+		/// Multiplies every vector by a scale
+		/// </summary>
+		/// <param name="values">Vectors to scale</param>
+		/// <param name="scale">Scale to multiply by</param>
+		static void Scale(std::span<glm::vec4> values, float scale);
+
+		/// <summary>
+		/// Adds each source value multiplied by a scale to the destination value at the same index,
+		/// e.g. integrating positions from velocities
+		/// </summary>
+		/// <param name="destination">Values to add to</param>
+		/// <param name="source">Values to scale and add</param>
+		/// <param name="scale">Scale applied to the source values</param>
+		/// <exception cref="runtime_error">Spans differ in size</exception>
+		static void MultiplyAdd(std::span<float> destination, std::span<const float> source, float scale);
+
+		/// <summary>
+		/// Adds each source vector multiplied by a scale to the destination vector at the same index,
+		/// e.g. integrating positions from velocities
+		/// </summary>
+		/// <param name="destination">Vectors to add to</param>
+		/// <param name="source">Vectors to scale and add</param>
+		/// <param name="scale">Scale applied to the source vectors</param>
+		/// <exception cref="runtime_error">Spans differ in size</exception>
+		static void MultiplyAdd(std::span<glm::vec4> destination, std::span<const glm::vec4> source, float scale);
+
+		/// <summary>
+		/// Keeps the smaller of the destination and source value at each index
+		/// </summary>
+		/// <param name="destination">Values to clamp</param>
+		/// <param name="source">Upper bounds</param>
+		/// <exception cref="runtime_error">Spans differ in size</exception>
+		static void Min(std::span<float> destination, std::span<const float> source);
+
+		/// <summary>
+		/// Keeps the smaller of the destination and source component at each index
+		/// </summary>
+		/// <param name="destination">Vectors to clamp</param>
+		/// <param name="source">Upper bounds</param>
+		/// <exception cref="runtime_error">Spans differ in size</exception>
+		static void Min(std::span<glm::vec4> destination, std::span<const glm::vec4> source);
+
+		/// <summary>
+		/// Keeps the larger of the destination and source value at each index
+		/// </summary>
+		/// <param name="destination">Values to clamp</param>
+		/// <param name="source">Lower bounds</param>
+		/// <exception cref="runtime_error">Spans differ in size</exception>
+		static void Max(std::span<float> destination, std::span<const float> source);
+
+		/// <summary>
+		/// Keeps the larger of the destination and source component at each index
+		/// </summary>
+		/// <param name="destination">Vectors to clamp</param>
+		/// <param name="source">Lower bounds</param>
+		/// <exception cref="runtime_error">Spans differ in size</exception>
+		static void Max(std::span<glm::vec4> destination, std::span<const glm::vec4> source);
+
+		/// <summary>
+		/// Computes the dot product of two arrays
+		/// </summary>
+		/// <param name="lhs">First array</param>
+		/// <param name="rhs">Second array</param>
+		/// <exception cref="runtime_error">Spans differ in size</exception>
+		/// <returns>Sum of the products of the values at each index</returns>
+		[[nodiscard]] static float Dot(std::span<const float> lhs, std::span<const float> rhs);
+
+		/// <summary>
+		/// Computes the dot product of each pair of vectors
+		/// </summary>
+		/// <param name="results">Dot product of the vectors at each index</param>
+		/// <param name="lhs">First vectors</param>
+		/// <param name="rhs">Second vectors</param>
+		/// <exception cref="runtime_error">Spans differ in size</exception>
+		static void Dot(std::span<float> results, std::span<const glm::vec4> lhs, std::span<const glm::vec4> rhs);
+
+		/// <summary>
+		/// Transforms a batch of vectors by one matrix
+		/// </summary>
+		/// <param name="destination">Transformed vectors. May be the source</param>
+		/// <param name="matrix">Matrix to multiply by</param>
+		/// <param name="source">Vectors to transform</param>
+		/// <exception cref="runtime_error">Spans differ in size</exception>
+		static void Transform(std::span<glm::vec4> destination, const glm::mat4& matrix, std::span<const glm::vec4> source);
+	};
+}
@@ -0,0 +1,16 @@
+#pragma once
+
+/// <summary>
+/// When nonzero, container iterators remember their container and throw std::runtime_error on misuse:
+/// dereferencing out of bounds, moving a default constructed iterator, or comparing iterators of different containers.
+/// When zero, Vector iterators are bare pointers and HashMap iterators skip their checks, so loops over them
+/// compile to the same code as loops over arrays.
+/// Defaults to checked unless NDEBUG is defined. Define it for the whole program, since it changes iterator layout.
+/// </summary>
+#ifndef FIEA_CHECKED_ITERATORS
+#ifdef NDEBUG
+#define FIEA_CHECKED_ITERATORS 0
+#else
+#define FIEA_CHECKED_ITERATORS 1
+#endif
+#endif
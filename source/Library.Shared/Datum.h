@@ -1,15 +1,21 @@
 #pragma once
 
+#include <atomic>
 #include <cstddef>
 #include <type_traits>
 #include <functional>
+#include <memory>
+#include <utility>
 #include <initializer_list>
 #include <string>
+#include <span>
 #pragma warning(push)
 #pragma warning(disable:4201)
 #include <glm/gtx/string_cast.hpp>
 #pragma warning(pop)
 #include "DatumTypes.h"
+#include "TriviallyRelocatable.h"
+#include "BoundArena.h"
 
 namespace FieaGameEngine
 {
@@ -24,7 +30,12 @@ namespace FieaGameEngine
 
 	/// <summary>
 	/// Custom std::variant that uses dynamically allocated vectors
-	/// Can also point to external data
+	/// Can also point to external data.
+	/// Storage allocated while an arena is bound to the thread (see BoundArena) comes from the arena and is released with it.
+	/// Copies share heap storage until one of them is accessed through a non-const method, which gives it its own copy.
+	/// The count of datums sharing a block is atomic, so copies can be used on different threads.
+	/// As with reallocation, references, pointers and spans to the values are invalidated by copying the datum,
+	/// since writing through them would change the copy too, and by the first non-const access while the storage is shared.
 	/// </summary>
 	/// <typeparam name="...Types">Variant types</typeparam>
 	template <VariantDatumType... Types>
@@ -81,7 +92,7 @@ namespace FieaGameEngine
 		template <VariantDatumType T>
 		VariantDatum(std::initializer_list<T> list);
 
-		virtual ~VariantDatum();
+		~VariantDatum();
 
 		/// <summary>
 		/// Assignment from another datum
@@ -312,6 +323,26 @@ namespace FieaGameEngine
 		template <VariantDatumType T>
 		[[nodiscard]] const T& Back() const;
 
+		/// <summary>
+		/// Views the values of the container as a contiguous span. The type is checked once,
+		/// so loops over the span do no per element type or bounds checks.
+		/// The span is invalidated by anything that changes the size, capacity or storage of the datum
+		/// </summary>
+		/// <exception cref="runtime_error">Datum does not hold values of type T</exception>
+		/// <returns>Span over the internal or external storage</returns>
+		template <VariantDatumType T>
+		[[nodiscard]] std::span<T> AsSpan();
+
+		/// <summary>
+		/// Views the values of the container as a contiguous span. The type is checked once,
+		/// so loops over the span do no per element type or bounds checks.
+		/// The span is invalidated by anything that changes the size, capacity or storage of the datum
+		/// </summary>
+		/// <exception cref="runtime_error">Datum does not hold values of type T</exception>
+		/// <returns>Span over the internal or external storage</returns>
+		template <VariantDatumType T>
+		[[nodiscard]] std::span<const T> AsSpan() const;
+
 		// <summary>
 		/// Removes the first instance of an element from the container
 		/// </summary>
@@ -337,16 +368,83 @@ namespace FieaGameEngine
 		std::size_t Find(const T& value);
 
 	private:
-
-		std::byte* _data = nullptr;
-		std::size_t _size = 0;
-		std::size_t _capacity = 0;
-		DatumTypes _type = DatumTypes::Unknown;
-		bool _isExternal = false;
+#ifdef DATUM_64BIT_SIZE
+		using SizeType = std::size_t;
+#else
+		using SizeType = std::uint32_t;
+#endif
+
+		// Single values of these sizes are stored inside the datum instead of on the heap
+		static constexpr std::size_t _INLINE_SIZE = 16;
+		static constexpr std::size_t _INLINE_ALIGNMENT = alignof(std::byte*);
+
+		struct HeapStorage final
+		{
+			std::byte* Data = nullptr;
+			SizeType Capacity = 0;
+		};
+
+		// Inline storage always has a capacity of 1, so it can overlay the heap capacity too
+		union
+		{
+			HeapStorage _heap{};
+			alignas(_INLINE_ALIGNMENT) std::byte _inlineData[_INLINE_SIZE];
+		};
+		SizeType _size = 0;
+		DatumTypes _type : 6 = DatumTypes::Unknown;
+		bool _isExternal : 1 = false;
+		bool _isInline : 1 = false;
+		bool _isArena : 1 = false;
 
 		friend class Attributed;
+		friend class ScopeArena;
 		void SetStorage(DatumTypes type, void* data, std::size_t size);
 
+		// Whether one value of T fits in the inline storage. Inline values move with the datum's bytes, so T must be trivially relocatable
+		template <VariantDatumType T>
+		static constexpr bool _FitsInline = sizeof(T) <= _INLINE_SIZE && alignof(T) <= _INLINE_ALIGNMENT && IsTriviallyRelocatableV<T>;
+
+		// Moves the values to a heap block of the given capacity, in place with realloc when T is trivially relocatable
+		template <VariantDatumType T>
+		void _ReallocateHeap(std::size_t capacity);
+
+		// Heap blocks start with a count of the datums sharing them, padded to keep the values aligned
+		using ShareCountType = std::atomic<std::size_t>;
+		static constexpr std::size_t _HEADER_SIZE = alignof(std::max_align_t);
+		static_assert(sizeof(ShareCountType) <= _HEADER_SIZE && alignof(ShareCountType) <= _HEADER_SIZE);
+
+		// Allocates a heap block, shared by nothing else yet, from the bound arena if there is one, otherwise with malloc
+		[[nodiscard]] static std::byte* _AllocateHeap(std::size_t bytes, bool& fromArena);
+
+		// Frees a heap block of this datum. Arena blocks are left for their arena to release
+		void _FreeHeap(std::byte* data);
+
+		// Number of datums sharing a heap block
+		[[nodiscard]] static ShareCountType& _ShareCount(std::byte* data);
+
+		// Whether the heap storage is shared with another datum
+		[[nodiscard]] bool _IsShared() const;
+
+		// Gives this datum its own copy of the heap storage it shares, with the given capacity
+		void _Detach(std::size_t capacity);
+
+		// Drops this datum's share of a heap block holding its values. If the other datums dropped theirs meanwhile,
+		// the values are destroyed and the block freed
+		void _ReleaseShare(std::byte* data);
+
+		// Storage currently in use: inline, heap or external. Detaches shared storage first, since the caller may write to it
+		[[nodiscard]] std::byte* _Data();
+		[[nodiscard]] const std::byte* _Data() const;
+
+		// Takes the storage of another datum, leaving it empty
+		void _Steal(VariantDatum& other) noexcept;
+
+		// Copies the values of another datum of the same type into this empty datum, which must already have the capacity for them
+		void _CopyValues(const VariantDatum& other);
+
+		// Makes this empty datum a copy of another of the same type, sharing its heap storage when it has any outside an arena
+		void _CopyFrom(const VariantDatum& other);
+
 		template <typename Func, typename... Args>
 		inline void Visit(Func func, Args&&...args);
 
@@ -359,6 +457,7 @@ namespace FieaGameEngine
 	public:
 		using VariantDatum::VariantDatum;
 		using VariantDatum::operator=;
+		TRIVIALLY_RELOCATABLE(Datum);
 
 		/// <summary>
 		/// Gets a scope at the given index
@@ -367,6 +466,10 @@ namespace FieaGameEngine
 		/// <returns>Scope retrieved from the container at the index</returns>
 		[[nodiscard]] Scope& operator[](std::size_t index);
 	};
+
+#ifndef DATUM_64BIT_SIZE
+	static_assert(sizeof(Datum) <= 24, "Datum grew past 24 bytes; scopes hold thousands of them");
+#endif
 }
 
 #include "Datum.inl"
\ No newline at end of file
@@ -1,6 +1,12 @@
 #include "Datum.h"
 #include <utility>
 #include <stdexcept>
+#include <cstring>
+#include <cstdlib>
+#include <new>
+#include <limits>
+#include <memory>
+#include <cassert>
 
 namespace FieaGameEngine
 {
@@ -31,34 +37,19 @@ namespace FieaGameEngine
 	{
 		if (_isExternal)
 		{
-			_capacity = other._capacity;
+			_heap = other._heap;
 			_size = other._size;
-			_data = other._data;
 		}
 		else
 		{
-			Reserve(other._size);
-			Visit([&]<VariantDatumType T>()
-			{
-				T* const otherDataTyped = reinterpret_cast<T*>(other._data);
-				for (size_t i = 0; i < other._size; ++i)
-				{
-					PushBack(otherDataTyped[i]);
-				}
-			});
+			_CopyFrom(other);
 		}
 	}
 
 	template<VariantDatumType... Types>
-	inline VariantDatum<Types...>::VariantDatum(VariantDatum&& other) noexcept :
-		_capacity(other._capacity),
-		_size(other._size),
-		_type(other._type),
-		_data(other._data)
+	inline VariantDatum<Types...>::VariantDatum(VariantDatum&& other) noexcept
 	{
-		other._capacity = 0;
-		other._size = 0;
-		other._data = nullptr;
+		_Steal(other);
 	}
 
 	template <VariantDatumType... Types>
@@ -100,32 +91,21 @@ namespace FieaGameEngine
 		}
 		else
 		{
-			_capacity = 0;
+			_heap = HeapStorage{};
 			_size = 0;
 			_isExternal = false;
-			_data = nullptr;
 		}
 
 		// Copy
 		_type = rhs._type;
 		if (rhs._isExternal)
 		{
-			_data = rhs._data;
+			_heap = rhs._heap;
 			_size = rhs._size;
-			_capacity = rhs._capacity;
 		}
 		else
 		{
-			Clear();
-			Reserve(rhs._size);
-			Visit([&]<VariantDatumType T>()
-			{
-				T* const otherDataTyped = reinterpret_cast<T*>(rhs._data);
-				for (size_t i = 0; i < rhs._size; ++i)
-				{
-					PushBack(otherDataTyped[i]);
-				}
-			});
+			_CopyFrom(rhs);
 		}
 		_isExternal = rhs._isExternal;
 		return *this;
@@ -134,14 +114,16 @@ namespace FieaGameEngine
 	template<VariantDatumType... Types>
 	inline VariantDatum<Types...>& VariantDatum<Types...>::operator=(VariantDatum&& rhs) noexcept
 	{
-		_capacity = rhs._capacity;
-		_size = rhs._size;
-		_type = rhs._type;
-		_data = rhs._data;
-
-		rhs._capacity = 0;
-		rhs._size = 0;
-		rhs._data = nullptr;
+		if (this != &rhs)
+		{
+			// Delete old
+			if (!_isExternal)
+			{
+				Clear();
+				ShrinkToFit();
+			}
+			_Steal(rhs);
+		}
 		return *this;
 	}
 
@@ -157,10 +139,9 @@ namespace FieaGameEngine
 		}
 		else
 		{
-			_capacity = 0;
+			_heap = HeapStorage{};
 			_size = 0;
 			_isExternal = false;
-			_data = nullptr;
 		}
 
 		_type = ToDatumType<T>();
@@ -181,10 +162,9 @@ namespace FieaGameEngine
 		}
 		else
 		{
-			_capacity = 0;
+			_heap = HeapStorage{};
 			_size = 0;
 			_isExternal = false;
-			_data = nullptr;
 		}
 
 		_type = ToDatumType<T>();
@@ -224,7 +204,7 @@ namespace FieaGameEngine
 	template<VariantDatumType... Types>
 	inline std::size_t VariantDatum<Types...>::Capacity() const
 	{
-		return _capacity;
+		return _isInline ? 1 : _heap.Capacity;
 	}
 
 	template<VariantDatumType... Types>
@@ -251,15 +231,39 @@ namespace FieaGameEngine
 			throw std::runtime_error("Type is unknown");
 		}
 
-		if (capacity > _capacity)
+		if (capacity > std::numeric_limits<SizeType>::max())
+		{
+			throw std::runtime_error("Capacity exceeds the maximum datum size");
+		}
+
+		if (capacity > Capacity())
 		{
 			Visit([&]<VariantDatumType T>()
 			{
-				std::byte* const data = reinterpret_cast<std::byte*>(realloc(_data, capacity * sizeof(T)));
-				assert(data != nullptr);
-				_data = data;
+				if constexpr (_FitsInline<T>)
+				{
+					if (capacity == 1)
+					{
+						// A single value is stored inline, nothing to allocate
+						_isInline = true;
+						return;
+					}
+
+					if (_isInline)
+					{
+						// Spill the inline value to the heap
+						bool fromArena;
+						std::byte* const data = _AllocateHeap(capacity * sizeof(T), fromArena);
+						std::memcpy(data, _inlineData, _size * sizeof(T));
+						_isInline = false;
+						_isArena = fromArena;
+						_heap = HeapStorage{ data, static_cast<SizeType>(capacity) };
+						return;
+					}
+				}
+
+				_ReallocateHeap<T>(capacity);
 			});
-			_capacity = capacity;
 		}
 	}
 
@@ -355,13 +359,22 @@ namespace FieaGameEngine
 			throw std::runtime_error("Cannot clear external datum");
 		}
 
+		if (_IsShared())
+		{
+			// The values belong to the other datums sharing them
+			_ReleaseShare(_heap.Data);
+			_heap = HeapStorage{};
+			_size = 0;
+			return;
+		}
+
 		if (_type != DatumTypes::Unknown)
 		{
 			Visit([&]<VariantDatumType T>()
 			{
 				if (!std::is_trivially_destructible_v<T>)
 				{
-					T* const dataTyped = reinterpret_cast<T*>(_data);
+					T* const dataTyped = reinterpret_cast<T*>(_Data());
 					for (size_t i = 0; i < _size; ++i)
 					{
 						dataTyped[i].~T();
@@ -382,20 +395,47 @@ namespace FieaGameEngine
 
 		if (_size == 0)
 		{
-			free(_data);
-			_data = nullptr;
-			_capacity = 0;
+			if (_IsShared())
+			{
+				_ReleaseShare(_heap.Data);
+			}
+			else if (!_isInline)
+			{
+				_FreeHeap(_heap.Data);
+			}
+			_isInline = false;
+			_isArena = false;
+			_heap = HeapStorage{};
 		}
-		else if (_capacity > _size)
+		else if (Capacity() > _size)
 		{
+			// Inline storage holds a single value, so only heap storage can have spare capacity
+			assert(!_isInline);
 			Visit([&]<VariantDatumType T>()
 			{
-				std::byte* const data = reinterpret_cast<std::byte*>(std::realloc(_data, _size * sizeof(T)));
-				assert(data != nullptr);
-				_data = data;
-			});
+				if constexpr (_FitsInline<T>)
+				{
+					if (_size == 1)
+					{
+						// Move the last value inline and release the heap block, or copy it if the block is shared
+						std::byte* const data = _heap.Data;
+						if (_IsShared())
+						{
+							new (_inlineData) T(*reinterpret_cast<const T*>(data));
+							_ReleaseShare(data);
+						}
+						else
+						{
+							std::memcpy(_inlineData, data, sizeof(T));
+							_FreeHeap(data);
+						}
+						_isInline = true;
+						return;
+					}
+				}
 
-			_capacity = _size;
+				_ReallocateHeap<T>(_size);
+			});
 		}
 	}
 
@@ -430,8 +470,8 @@ namespace FieaGameEngine
 		Visit([&]<VariantDatumType T>()
 		{
 			DefaultEquality<T> equalityFunctor{};
-			T* const dataTyped = reinterpret_cast<T*>(_data);
-			T* const rhsDataTyped = reinterpret_cast<T*>(rhs._data);
+			const T* const dataTyped = reinterpret_cast<const T*>(_Data());
+			const T* const rhsDataTyped = reinterpret_cast<const T*>(rhs._Data());
 			for (std::size_t i = 0; i < _size; ++i)
 			{
 				if (!equalityFunctor(dataTyped[i], rhsDataTyped[i]))
@@ -485,7 +525,7 @@ namespace FieaGameEngine
 			throw std::runtime_error("Types does not match datum type");
 		}
 
-		reinterpret_cast<T*>(_data)[index] = T(value);
+		reinterpret_cast<T*>(_Data())[index] = T(value);
 	}
 
 	template <VariantDatumType... Types>
@@ -502,7 +542,7 @@ namespace FieaGameEngine
 			throw std::runtime_error("Types does not match datum type");
 		}
 		
-		reinterpret_cast<T*>(_data)[index] = T(std::forward<T>(value));
+		reinterpret_cast<T*>(_Data())[index] = T(std::forward<T>(value));
 	}
 
 	template <VariantDatumType... Types>
@@ -519,7 +559,7 @@ namespace FieaGameEngine
 			throw std::runtime_error("Index out of bounds");
 		}
 
-		return reinterpret_cast<T*>(_data)[index];
+		return reinterpret_cast<T*>(_Data())[index];
 	}
 
 	template <VariantDatumType... Types>
@@ -536,7 +576,7 @@ namespace FieaGameEngine
 			throw std::runtime_error("Index out of bounds");
 		}
 
-		return reinterpret_cast<T*>(_data)[index];
+		return reinterpret_cast<const T*>(_Data())[index];
 	}
 
 	template <VariantDatumType... Types>
@@ -582,13 +622,13 @@ namespace FieaGameEngine
 			throw std::runtime_error("Datum is external");
 		}
 
-		if (_size == _capacity)
+		if (_size == Capacity())
 		{
-			size_t newCapacity = _capacity > 0 ? _capacity * 2 : 1;
+			size_t newCapacity = _size > 0 ? std::size_t(_size) * 2 : 1;
 			Reserve(newCapacity);
 		}
 
-		new (_data + _size * sizeof(T)) T(std::forward<Args>(args)...);
+		new (_Data() + _size * sizeof(T)) T(std::forward<Args>(args)...);
 		++_size;
 	}
 
@@ -609,7 +649,7 @@ namespace FieaGameEngine
 		{
 			if (!std::is_trivially_destructible_v<T>)
 			{
-				T* const dataTyped = reinterpret_cast<T*>(_data);
+				T* const dataTyped = reinterpret_cast<T*>(_Data());
 				dataTyped[_size - 1].~T();
 			}
 		});
@@ -684,6 +724,30 @@ namespace FieaGameEngine
 		return Get<T>(_size - 1);
 	}
 
+	template <VariantDatumType... Types>
+	template<VariantDatumType T>
+	inline std::span<T> VariantDatum<Types...>::AsSpan()
+	{
+		if (_type != ToDatumType<T>())
+		{
+			throw std::runtime_error("Invalid type");
+		}
+
+		return std::span<T>(reinterpret_cast<T*>(_Data()), _size);
+	}
+
+	template <VariantDatumType... Types>
+	template<VariantDatumType T>
+	inline std::span<const T> VariantDatum<Types...>::AsSpan() const
+	{
+		if (_type != ToDatumType<T>())
+		{
+			throw std::runtime_error("Invalid type");
+		}
+
+		return std::span<const T>(reinterpret_cast<const T*>(_Data()), _size);
+	}
+
 	template <VariantDatumType... Types>
 	template<VariantDatumType T>
 	inline bool VariantDatum<Types...>::Remove(const T& value)
@@ -710,16 +774,12 @@ namespace FieaGameEngine
 
 		Visit([&]<VariantDatumType T>()
 		{
-			T* const dataTyped = reinterpret_cast<T*>(_data);
+			T* const dataTyped = reinterpret_cast<T*>(_Data());
 			if (!std::is_trivially_destructible_v<T>)
 			{
 				dataTyped[index].~T();
 			}
-			const std::size_t elementsToMove = _size - (index + 1);
-			if (elementsToMove > 0)
-			{
-				std::memmove(dataTyped + index, dataTyped + index + 1, elementsToMove * sizeof(T));
-			}
+			CloseGap(dataTyped + index, 1, _size - (index + 1));
 		});
 
 		_size -= 1;
@@ -732,7 +792,7 @@ namespace FieaGameEngine
 	{
 		for (size_t i = 0; i < _size; ++i)
 		{
-			const T& dataAtIndex = reinterpret_cast<T*>(_data)[i];
+			const T& dataAtIndex = reinterpret_cast<const T*>(std::as_const(*this)._Data())[i];
 			if (dataAtIndex == value)
 			{
 				return i;
@@ -755,13 +815,200 @@ namespace FieaGameEngine
 			throw std::runtime_error("Datum already contains internal data");
 		}
 
+		if (!_isExternal)
+		{
+			// Release reserved internal storage
+			ShrinkToFit();
+		}
+
+		if (size > std::numeric_limits<SizeType>::max())
+		{
+			throw std::runtime_error("Size exceeds the maximum datum size");
+		}
+
 		SetType(type);
-		_data = reinterpret_cast<std::byte*>(data);
-		_size = size;
-		_capacity = size;
+		_size = static_cast<SizeType>(size);
+		_heap = HeapStorage{ reinterpret_cast<std::byte*>(data), _size };
 		_isExternal = true;
 	}
 
+	template<VariantDatumType... Types>
+	inline std::byte* VariantDatum<Types...>::_Data()
+	{
+		if (_IsShared())
+		{
+			_Detach(_heap.Capacity);
+		}
+		return _isInline ? _inlineData : _heap.Data;
+	}
+
+	template<VariantDatumType... Types>
+	inline const std::byte* VariantDatum<Types...>::_Data() const
+	{
+		return _isInline ? _inlineData : _heap.Data;
+	}
+
+	template<VariantDatumType... Types>
+	inline void VariantDatum<Types...>::_CopyValues(const VariantDatum& other)
+	{
+		assert(_size == 0 && Capacity() >= other._size && _type == other._type);
+		Visit([&]<VariantDatumType T>()
+		{
+			const T* const otherDataTyped = reinterpret_cast<const T*>(other._Data());
+			if constexpr (std::is_trivially_copyable_v<T>)
+			{
+				if (other._size > 0)
+				{
+					std::memcpy(_Data(), otherDataTyped, other._size * sizeof(T));
+				}
+			}
+			else
+			{
+				std::uninitialized_copy(otherDataTyped, otherDataTyped + other._size, reinterpret_cast<T*>(_Data()));
+			}
+		});
+		_size = other._size;
+	}
+
+	template<VariantDatumType... Types>
+	template<VariantDatumType T>
+	inline void VariantDatum<Types...>::_ReallocateHeap(std::size_t capacity)
+	{
+		assert(!_isInline && !_isExternal && capacity >= _size);
+		if (_IsShared())
+		{
+			_Detach(capacity);
+			return;
+		}
+
+		if constexpr (IsTriviallyRelocatableV<T>)
+		{
+			if (!_isArena && BoundArena() == nullptr)
+			{
+				std::byte* const block = _heap.Data != nullptr ? _heap.Data - _HEADER_SIZE : nullptr;
+				std::byte* const newBlock = reinterpret_cast<std::byte*>(std::realloc(block, _HEADER_SIZE + capacity * sizeof(T)));
+				assert(newBlock != nullptr);
+				new (newBlock) ShareCountType(1);
+				_heap = HeapStorage{ newBlock + _HEADER_SIZE, static_cast<SizeType>(capacity) };
+				return;
+			}
+		}
+
+		// realloc may move the block, which is only safe for values that can be moved bytewise, and arena blocks cannot be reallocated
+		bool fromArena;
+		std::byte* const data = _AllocateHeap(capacity * sizeof(T), fromArena);
+		Relocate(reinterpret_cast<T*>(data), reinterpret_cast<T*>(_heap.Data), _size);
+		_FreeHeap(_heap.Data);
+		_isArena = fromArena;
+		_heap = HeapStorage{ data, static_cast<SizeType>(capacity) };
+	}
+
+	template<VariantDatumType... Types>
+	inline std::byte* VariantDatum<Types...>::_AllocateHeap(std::size_t bytes, bool& fromArena)
+	{
+		std::pmr::memory_resource* const arena = BoundArena();
+		fromArena = arena != nullptr;
+		const std::size_t blockSize = _HEADER_SIZE + bytes;
+		std::byte* const block = reinterpret_cast<std::byte*>(fromArena ? arena->allocate(blockSize, alignof(std::max_align_t)) : std::malloc(blockSize));
+		assert(block != nullptr);
+		new (block) ShareCountType(1);
+		return block + _HEADER_SIZE;
+	}
+
+	template<VariantDatumType... Types>
+	inline void VariantDatum<Types...>::_FreeHeap(std::byte* data)
+	{
+		if (!_isArena && data != nullptr)
+		{
+			std::free(data - _HEADER_SIZE);
+		}
+		_isArena = false;
+	}
+
+	template<VariantDatumType... Types>
+	inline typename VariantDatum<Types...>::ShareCountType& VariantDatum<Types...>::_ShareCount(std::byte* data)
+	{
+		return *std::launder(reinterpret_cast<ShareCountType*>(data - _HEADER_SIZE));
+	}
+
+	template<VariantDatumType... Types>
+	inline bool VariantDatum<Types...>::_IsShared() const
+	{
+		// Acquire, so a datum that finds itself the last owner sees the reads of those that detached before it writes
+		return !_isInline && !_isExternal && _heap.Data != nullptr && _ShareCount(_heap.Data).load(std::memory_order_acquire) > 1;
+	}
+
+	template<VariantDatumType... Types>
+	inline void VariantDatum<Types...>::_Detach(std::size_t capacity)
+	{
+		assert(_IsShared() && capacity >= _size);
+		Visit([&]<VariantDatumType T>()
+		{
+			bool fromArena;
+			std::byte* const data = _AllocateHeap(capacity * sizeof(T), fromArena);
+			std::uninitialized_copy_n(reinterpret_cast<const T*>(_heap.Data), _size, reinterpret_cast<T*>(data));
+			_ReleaseShare(_heap.Data);
+			_isArena = fromArena;
+			_heap = HeapStorage{ data, static_cast<SizeType>(capacity) };
+		});
+	}
+
+	template<VariantDatumType... Types>
+	inline void VariantDatum<Types...>::_ReleaseShare(std::byte* data)
+	{
+		assert(!_isArena);
+		if (_ShareCount(data).fetch_sub(1, std::memory_order_acq_rel) == 1)
+		{
+			Visit([&]<VariantDatumType T>()
+			{
+				std::destroy_n(reinterpret_cast<T*>(data), _size);
+			});
+			std::free(data - _HEADER_SIZE);
+		}
+	}
+
+	template<VariantDatumType... Types>
+	inline void VariantDatum<Types...>::_CopyFrom(const VariantDatum& other)
+	{
+		assert(_size == 0 && Capacity() == 0 && _type == other._type);
+		// Arena blocks are not shared, since the copy may outlive the arena
+		if (!other._isInline && !other._isExternal && !other._isArena && other._size > 0)
+		{
+			_ShareCount(other._heap.Data).fetch_add(1, std::memory_order_relaxed);
+			_heap = other._heap;
+			_size = other._size;
+			return;
+		}
+
+		Reserve(other._size);
+		_CopyValues(other);
+	}
+
+	template<VariantDatumType... Types>
+	inline void VariantDatum<Types...>::_Steal(VariantDatum& other) noexcept
+	{
+		_size = other._size;
+		_type = other._type;
+		_isExternal = other._isExternal;
+		_isInline = other._isInline;
+		_isArena = other._isArena;
+		if (_isInline)
+		{
+			// Only trivially relocatable values are stored inline, so their bytes can move
+			std::memcpy(_inlineData, other._inlineData, _INLINE_SIZE);
+		}
+		else
+		{
+			_heap = other._heap;
+		}
+
+		other._heap = HeapStorage{};
+		other._size = 0;
+		other._isExternal = false;
+		other._isInline = false;
+		other._isArena = false;
+	}
+
 	template<VariantDatumType... Types>
 	template <typename Func, typename... Args>
 	inline void VariantDatum<Types...>::Visit(Func func, Args&&...args)
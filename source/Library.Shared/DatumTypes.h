@@ -8,7 +8,7 @@
 
 namespace FieaGameEngine
 {
-    enum class DatumTypes
+    enum class DatumTypes : std::uint8_t
     {
         Boolean,
         Integer,
@@ -1,5 +1,8 @@
 #pragma once
 
+#include <string>
+#include <string_view>
+
 namespace FieaGameEngine
 {
 	/// <summary>
@@ -47,6 +50,24 @@ namespace FieaGameEngine
 	{
 		bool operator()(const char* lhs, const char* rhs) const;
 	};
+
+	/// <summary>
+	/// Compares two strings through views, so a string key can be compared against a view or literal
+	/// </summary>
+	template <>
+	struct DefaultEquality<std::string> final
+	{
+		bool operator()(std::string_view lhs, std::string_view rhs) const;
+	};
+
+	/// <summary>
+	/// Compares two strings through views, so a string key can be compared against a view or literal
+	/// </summary>
+	template <>
+	struct DefaultEquality<const std::string> final
+	{
+		bool operator()(std::string_view lhs, std::string_view rhs) const;
+	};
 }
 
 #include "DefaultEquality.inl"
\ No newline at end of file
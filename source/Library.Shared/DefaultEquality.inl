@@ -29,4 +29,14 @@ namespace FieaGameEngine
 	{
 		return strcmp(lhs, rhs) == 0;
 	}
+
+	inline bool DefaultEquality<std::string>::operator()(std::string_view lhs, std::string_view rhs) const
+	{
+		return lhs == rhs;
+	}
+
+	inline bool DefaultEquality<const std::string>::operator()(std::string_view lhs, std::string_view rhs) const
+	{
+		return lhs == rhs;
+	}
 }
\ No newline at end of file
@@ -1,16 +1,62 @@
 #pragma once
 
 #include <string>
+#include <string_view>
+#include <cstddef>
+#include <cstdint>
 
 namespace FieaGameEngine
 {
+	/// <summary>
+	/// Hashes a block of bytes. Consumes 8 bytes per step with a multiply-xorshift mix
+	/// (in the style of MurmurHash64A), so the result depends on byte order and is well distributed.
+	/// All DefaultHash specializations are built on this function.
+	/// </summary>
+	/// <param name="data">Start of the bytes to hash</param>
+	/// <param name="length">Number of bytes to hash</param>
+	/// <returns>Hash of the bytes</returns>
+	[[nodiscard]] std::size_t HashBytes(const void* data, std::size_t length);
+
+	/// <summary>
+	/// Type a hash map takes when looking up a key. By default this is the key type itself.
+	/// Keys that own their storage map to a non-owning view so lookups do not construct a key.
+	/// Hash and equality functors of a hash map take this type.
+	/// </summary>
+	/// <typeparam name="TKey">Key type stored in the hash map</typeparam>
+	template <typename TKey>
+	struct LookupKey
+	{
+		using Type = TKey;
+	};
+
+	/// <summary>
+	/// String keys are looked up by std::string_view, so string literals and views never allocate
+	/// </summary>
+	template <>
+	struct LookupKey<std::string>
+	{
+		using Type = std::string_view;
+	};
+
+	/// <summary>
+	/// String keys are looked up by std::string_view, so string literals and views never allocate
+	/// </summary>
+	template <>
+	struct LookupKey<const std::string>
+	{
+		using Type = std::string_view;
+	};
+
+	template <typename TKey>
+	using LookupKeyType = typename LookupKey<TKey>::Type;
+
 	/// <summary>
 	/// Default template for hash
 	/// </summary>
 	template <typename TKey>
 	struct DefaultHash
 	{
-		size_t operator()(const TKey& key);
+		size_t operator()(const TKey& key) const;
 	};
 
 	/// <summary>
@@ -19,7 +65,7 @@ namespace FieaGameEngine
 	template <>
 	struct DefaultHash<const char* const>
 	{
-		size_t operator()(const char* const key);
+		size_t operator()(const char* const key) const;
 	};
 
 	/// <summary>
@@ -28,7 +74,7 @@ namespace FieaGameEngine
 	template <>
 	struct DefaultHash<char* const>
 	{
-		size_t operator()(const char* const key);
+		size_t operator()(const char* const key) const;
 	};
 
 	/// <summary>
@@ -37,7 +83,7 @@ namespace FieaGameEngine
 	template <>
 	struct DefaultHash<const char*>
 	{
-		size_t operator()(const char* key);
+		size_t operator()(const char* key) const;
 	};
 
 	/// <summary>
@@ -46,25 +92,34 @@ namespace FieaGameEngine
 	template <>
 	struct DefaultHash<char*>
 	{
-		size_t operator()(const char* const key);
+		size_t operator()(const char* const key) const;
 	};
 
 	/// <summary>
-	/// String specialization
+	/// String specialization. Takes a view so strings, views and literals hash the same way
 	/// </summary>
 	template <>
 	struct DefaultHash<const std::string>
 	{
-		size_t operator()(const std::string& key);
+		size_t operator()(std::string_view key) const;
 	};
 
 	/// <summary>
-	/// String specialization
+	/// String specialization. Takes a view so strings, views and literals hash the same way
 	/// </summary>
 	template <>
 	struct DefaultHash<std::string>
 	{
-		size_t operator()(const std::string& key);
+		size_t operator()(std::string_view key) const;
+	};
+
+	/// <summary>
+	/// String view specialization
+	/// </summary>
+	template <>
+	struct DefaultHash<std::string_view>
+	{
+		size_t operator()(std::string_view key) const;
 	};
 }
 
@@ -1,79 +1,93 @@
 #include <DefaultHash.h>
 
+#include <cstring>
+
 namespace FieaGameEngine
 {
-	template <typename TKey>
-	inline size_t DefaultHash<TKey>::operator()(const TKey & key)
+	inline std::size_t HashBytes(const void* data, std::size_t length)
 	{
-		const size_t PRIME = 29;
-		size_t hashValue = 0;
-		const uint8_t* keyAsBytes = reinterpret_cast<const uint8_t*>(&key);
-		for (size_t i = 0; i < sizeof(TKey); ++i)
+		const std::uint64_t MULTIPLIER = 0xc6a4a7935bd1e995ull;
+		const int SHIFT = 47;
+
+		const unsigned char* bytes = static_cast<const unsigned char*>(data);
+		std::uint64_t hashValue = 0x9e3779b97f4a7c15ull ^ (length * MULTIPLIER);
+
+		// Body, 8 bytes per step
+		const std::size_t wordCount = length / sizeof(std::uint64_t);
+		for (std::size_t i = 0; i < wordCount; ++i)
 		{
-			hashValue += static_cast<size_t>(keyAsBytes[i]) * PRIME;
+			std::uint64_t word;
+			std::memcpy(&word, bytes + i * sizeof(std::uint64_t), sizeof(word));
+			word *= MULTIPLIER;
+			word ^= word >> SHIFT;
+			word *= MULTIPLIER;
+			hashValue ^= word;
+			hashValue *= MULTIPLIER;
 		}
-		return hashValue;
-	}
 
-	inline size_t DefaultHash<const char* const>::operator()(const char* key)
-	{
-		const size_t PRIME = 29;
-		size_t hashValue = 0;
-		for (size_t i = 0; i < strlen(key); ++i)
+		// Tail, remaining 0-7 bytes
+		const std::size_t tailLength = length % sizeof(std::uint64_t);
+		if (tailLength > 0)
 		{
-			hashValue += static_cast<const size_t>(key[i]) * PRIME;
+			std::uint64_t tail = 0;
+			std::memcpy(&tail, bytes + wordCount * sizeof(std::uint64_t), tailLength);
+			hashValue ^= tail;
+			hashValue *= MULTIPLIER;
 		}
-		return hashValue;
-	}
 
-	inline size_t DefaultHash<char* const>::operator()(const char* key)
-	{
-		const size_t PRIME = 29;
-		size_t hashValue = 0;
-		for (size_t i = 0; i < strlen(key); ++i)
+		// Finalize so every input bit affects every output bit
+		hashValue ^= hashValue >> SHIFT;
+		hashValue *= MULTIPLIER;
+		hashValue ^= hashValue >> SHIFT;
+
+		if constexpr (sizeof(std::size_t) < sizeof(std::uint64_t))
 		{
-			hashValue += static_cast<const size_t>(key[i]) * PRIME;
+			return static_cast<std::size_t>(hashValue ^ (hashValue >> 32));
+		}
+		else
+		{
+			return static_cast<std::size_t>(hashValue);
 		}
-		return hashValue;
 	}
 
-	inline size_t DefaultHash<const char*>::operator()(const char* key)
+	template <typename TKey>
+	inline size_t DefaultHash<TKey>::operator()(const TKey& key) const
 	{
-		const size_t PRIME = 29;
-		size_t hashValue = 0;
-		for (size_t i = 0; i < strlen(key); ++i)
-		{
-			hashValue += static_cast<const size_t>(key[i]) * PRIME;
-		}
-		return hashValue;
+		return HashBytes(&key, sizeof(TKey));
 	}
 
-	inline size_t DefaultHash<char*>::operator()(const char* key)
+	inline size_t DefaultHash<const char* const>::operator()(const char* key) const
 	{
-		const size_t PRIME = 29;
-		size_t hashValue = 0;
-		for (size_t i = 0; i < strlen(key); ++i)
-		{
-			hashValue += static_cast<const size_t>(key[i]) * PRIME;
-		}
-		return hashValue;
+		return HashBytes(key, std::strlen(key));
 	}
-	
-	inline size_t DefaultHash<const std::string>::operator()(const std::string& key) {
-		const size_t PRIME = 29;
-		size_t hashValue = 0;
-		for (size_t i = 0; i < key.length(); ++i) {
-			hashValue += static_cast<size_t>(key[i]) * PRIME;
-		}
-		return hashValue;
+
+	inline size_t DefaultHash<char* const>::operator()(const char* key) const
+	{
+		return HashBytes(key, std::strlen(key));
 	}
 
-	inline size_t DefaultHash<std::string>::operator()(const std::string& key) {
-		const size_t PRIME = 29;
-		size_t hashValue = 0;
-		for (size_t i = 0; i < key.length(); ++i) {
-			hashValue += static_cast<size_t>(key[i]) * PRIME;
-		}
-		return hashValue;
+	inline size_t DefaultHash<const char*>::operator()(const char* key) const
+	{
+		return HashBytes(key, std::strlen(key));
+	}
+
+	inline size_t DefaultHash<char*>::operator()(const char* key) const
+	{
+		return HashBytes(key, std::strlen(key));
+	}
+
+	inline size_t DefaultHash<const std::string>::operator()(std::string_view key) const
+	{
+		return HashBytes(key.data(), key.size());
+	}
+
+	inline size_t DefaultHash<std::string>::operator()(std::string_view key) const
+	{
+		return HashBytes(key.data(), key.size());
+	}
+
+	inline size_t DefaultHash<std::string_view>::operator()(std::string_view key) const
+	{
+		return HashBytes(key.data(), key.size());
 	}
-}
\ No newline at end of file
+}
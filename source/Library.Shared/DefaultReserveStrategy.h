@@ -1,6 +1,7 @@
 #pragma once
 
 #include <cstddef>
+#include <functional>
 
 namespace FieaGameEngine
 {
@@ -14,8 +15,13 @@ namespace FieaGameEngine
 		/// </summary>
 		/// <param name="capacity">Current capacity</param>
 		/// <returns>New capacity</returns>
-		inline size_t operator()(std::size_t capacity);
+		inline size_t operator()(std::size_t capacity) const;
 	};
+
+	/// <summary>
+	/// Reserve strategy chosen at run time, for vectors that take their growth functor as a constructor argument
+	/// </summary>
+	using DynamicReserveStrategy = std::function<std::size_t(std::size_t)>;
 }
 
 #include "DefaultReserveStrategy.inl"
\ No newline at end of file
@@ -2,7 +2,7 @@
 
 namespace FieaGameEngine
 {
-	inline size_t DefaultReserveStrategy::operator()(std::size_t capacity)
+	inline size_t DefaultReserveStrategy::operator()(std::size_t capacity) const
 	{
 		return capacity == 0 ? 1 : capacity * 2;
 	}
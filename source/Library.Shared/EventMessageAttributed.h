@@ -30,7 +30,7 @@ namespace FieaGameEngine
 		/// <summary>
 		/// Subtype of the event
 		/// </summary>
-		int32_t Subtype;
+		int32_t Subtype = 0;
 	};
 
 	ConcreteFactory(EventMessageAttributed, Scope);
@@ -1,8 +1,6 @@
 #include "pch.h"
 #include "EventPublisher.h"
 
-#include "IEventSubscriber.h"
-
 namespace FieaGameEngine
 {
 	RTTI_DEFINITIONS(EventPublisher);
@@ -62,13 +60,51 @@ namespace FieaGameEngine
 		auto it = _subscribers.Find(e.TypeIdInstance());
 		if (it != _subscribers.end())
 		{
-			for (IEventSubscriber& subscriber : it->second)
+			// Step past each subscription before notifying, in case the subscriber is destroyed by its own notification
+			auto& subscriptions = it->second;
+			for (auto subscription = subscriptions.begin(); subscription != subscriptions.end();)
 			{
+				IEventSubscriber& subscriber = *(subscription++)->Subscriber;
 				subscriber.Notify(e);
 			}
 		}
 	}
 
+	void EventPublisher::_Subscribe(IdType eventType, IEventSubscriber& subscriber)
+	{
+		IEventSubscriber::Subscription* subscription = &subscriber._subscription;
+		if (subscription->IsLinked())
+		{
+			// Extra subscriptions are chained right after the inline one
+			auto extra = std::make_unique<IEventSubscriber::Subscription>(subscriber);
+			extra->Next = std::move(subscription->Next);
+			subscription->Next = std::move(extra);
+			subscription = subscription->Next.get();
+		}
+		subscription->EventType = eventType;
+		_subscribers[eventType].PushBack(*subscription);
+	}
+
+	void EventPublisher::_Unsubscribe(IdType eventType, IEventSubscriber& subscriber)
+	{
+		IEventSubscriber::Subscription& inlineSubscription = subscriber._subscription;
+		if (inlineSubscription.IsLinked() && inlineSubscription.EventType == eventType)
+		{
+			inlineSubscription.Unlink();
+			return;
+		}
+
+		for (std::unique_ptr<IEventSubscriber::Subscription>* link = &inlineSubscription.Next; *link != nullptr; link = &(*link)->Next)
+		{
+			if ((*link)->EventType == eventType)
+			{
+				// Destroying the subscription unlinks it from the publisher
+				*link = std::move((*link)->Next);
+				return;
+			}
+		}
+	}
+
 	void EventPublisher::_ProcessPendingSubscribeInstructions()
 	{
 		for (auto& pendingSubscribeInstruction : _pendingSubscribeInstructions)
@@ -78,17 +114,11 @@ namespace FieaGameEngine
 			switch (pendingSubscribeInstruction.InstructionType)
 			{
 				case PendingSubscriptionInstructionTypes::SUBSCRIBE:
-					_subscribers[subscriptionData.first].PushBack(subscriptionData.second);
+					_Subscribe(subscriptionData.first, subscriptionData.second);
 					break;
 				case PendingSubscriptionInstructionTypes::UNSUBSCRIBE:
-				{
-					auto it = _subscribers.Find(subscriptionData.first);
-					if (it != _subscribers.end())
-					{
-						it->second.Remove(subscriptionData.second);
-					}
+					_Unsubscribe(subscriptionData.first, subscriptionData.second);
 					break;
-				}
 				default:
 					break;
 			}
@@ -3,15 +3,14 @@
 #include <concepts>
 #include <variant>
 #include "RTTI.h"
-#include "HashMap.h"
+#include "FlatHashMap.h"
 #include "Vector.h"
 #include "Event.h"
+#include "IEventSubscriber.h"
 #include "GameClock.h"
 
 namespace FieaGameEngine
 {
-	class IEventSubscriber;
-
 	class EventPublisher final : RTTI
 	{
 		RTTI_DECLARATIONS(EventPublisher, RTTI);
@@ -27,8 +26,9 @@ namespace FieaGameEngine
 		void Subscribe(IEventSubscriber& subscriber);
 
 		/// <summary>
-		/// Removes a subscriber for a specified event. If the update method is running, the subscriber will
+		/// Removes a subscriber for a specified event in constant time. If the update method is running, the subscriber will
 		/// be removed after the update method is complete.
+		/// Destroyed subscribers unsubscribe themselves, so this is only needed to stop listening early.
 		/// </summary>
 		/// <typeparam name="EventType"></typeparam>
 		template <std::derived_from<EventBase> EventType>
@@ -73,6 +73,8 @@ namespace FieaGameEngine
 		bool _isQueueUpdating = false;
 
 		void _Deliver(const EventBase& e);
+		void _Subscribe(IdType eventType, IEventSubscriber& subscriber);
+		void _Unsubscribe(IdType eventType, IEventSubscriber& subscriber);
 		void _ProcessPendingSubscribeInstructions();
 		void _ProcessPendingQueueInstructions();
 
@@ -81,6 +83,7 @@ namespace FieaGameEngine
 			std::chrono::high_resolution_clock::time_point TimeEnqueued;
 			std::chrono::milliseconds Delay;
 			std::shared_ptr<EventBase> Event;
+			TRIVIALLY_RELOCATABLE(QueuedEvent);
 
 			bool IsExpired(const GameTime& gameTime) const;
 
@@ -114,17 +117,12 @@ namespace FieaGameEngine
 		};
 
 		Vector<PendingSubscriptionInstruction> _pendingSubscribeInstructions; 
-		HashMap<IdType, Vector<std::reference_wrapper<IEventSubscriber>>> _subscribers;
+		// Subscriptions live in their subscribers, so subscribing and unsubscribing never search or allocate
+		FlatHashMap<IdType, IntrusiveList<IEventSubscriber::Subscription>> _subscribers;
 
 		Vector<PendingQueueInstruction> _pendingQueueInstructions;
 		Vector<QueuedEvent> _queuedEvents;
 	};
-
-	template<>
-	struct DefaultEquality<std::reference_wrapper<IEventSubscriber>> final
-	{
-		inline bool operator()(const std::reference_wrapper<IEventSubscriber>& lhs, const std::reference_wrapper<IEventSubscriber>& rhs) const;
-	};
 }
 
 #include "EventPublisher.inl"
\ No newline at end of file
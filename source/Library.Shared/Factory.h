@@ -2,8 +2,9 @@
 
 #include <string>
 #include <memory>
+#include <memory_resource>
 #include "RTTI.h"
-#include "HashMap.h"
+#include "FlatHashMap.h"
 
 namespace FieaGameEngine
 {
@@ -28,12 +29,27 @@ namespace FieaGameEngine
         /// <param name="className">Name of a class to instantiate an object from</param>
         /// <returns>Returns a default construct object of type class name. If the object cannot be created, nullptr is returned</returns>
         [[nodiscard]] static std::unique_ptr<T> Create(const std::string& className);
+
+        /// <summary>
+        /// Give a class name, creates an object of that type, allocating it and its shared_ptr control block from a memory resource.
+        /// </summary>
+        /// <param name="className">Name of a class to instantiate an object from</param>
+        /// <param name="allocator">Allocator, or the memory resource it allocates from. The resource must outlive the object</param>
+        /// <returns>Returns a default construct object of type class name. If the object cannot be created, nullptr is returned</returns>
+        [[nodiscard]] static std::shared_ptr<T> Create(const std::string& className, const std::pmr::polymorphic_allocator<>& allocator);
         
         /// <summary>
         /// Produces an object that this factory creates
         /// </summary>
         /// <returns>Newly created object</returns>
         [[nodiscard]] virtual std::unique_ptr<T> Create() const = 0;
+
+        /// <summary>
+        /// Produces an object that this factory creates, allocated with its control block from a memory resource
+        /// </summary>
+        /// <param name="allocator">Allocator, or the memory resource it allocates from</param>
+        /// <returns>Newly created object</returns>
+        [[nodiscard]] virtual std::shared_ptr<T> Create(const std::pmr::polymorphic_allocator<>& allocator) const = 0;
         
         /// <summary>
         /// Returns the class as a string that this factory makes instances of 
@@ -58,7 +74,7 @@ namespace FieaGameEngine
         /// </summary>
         static void Clear();
     private:
-        inline static HashMap<std::string, std::unique_ptr<Factory>> _factories;
+        inline static FlatHashMap<std::string, std::unique_ptr<Factory>> _factories;
     };
 }                                        
 
@@ -71,6 +87,13 @@ public:
         return std::unique_ptr<AbstractProductType>(std::make_unique<ConcreteProductType>());         \
     }                                                                                                 \
                                                                                                       \
+    [[nodiscard]] inline std::shared_ptr<AbstractProductType> Create(                                 \
+        const std::pmr::polymorphic_allocator<>& allocator) const override                            \
+    {                                                                                                 \
+        return std::allocate_shared<ConcreteProductType>(                                             \
+            std::pmr::polymorphic_allocator<ConcreteProductType>(allocator));                         \
+    }                                                                                                 \
+                                                                                                      \
     [[nodiscard]] inline std::string ClassName() const override                                       \
     {                                                                                                 \
         return #ConcreteProductType;                                                                  \
@@ -16,6 +16,13 @@ namespace FieaGameEngine
         return factory != nullptr ? factory->Create() : nullptr;
     }
 
+    template <typename T>
+    inline std::shared_ptr<T> Factory<T>::Create(const std::string& className, const std::pmr::polymorphic_allocator<>& allocator)
+    {
+        Factory* factory = Find(className);
+        return factory != nullptr ? factory->Create(allocator) : nullptr;
+    }
+
     template <typename T>
     inline void Factory<T>::Add(std::unique_ptr<Factory> factory)
     {
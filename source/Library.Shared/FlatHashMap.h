@@ -0,0 +1,434 @@
+#pragma once
+
+#include "DefaultHash.h"
+#include "DefaultEquality.h"
+#include "NoUniqueAddress.h"
+
+#include <functional>
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+#include <initializer_list>
+#include <new>
+#include <cstring>
+#include <algorithm>
+#include <stdexcept>
+#include <bit>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define FIEA_FLAT_HASH_MAP_SSE2
+#include <emmintrin.h>
+#endif
+
+namespace FieaGameEngine
+{
+	/// <summary>
+	/// Unordered associative array that uses open addressing.
+	/// Entries are stored inline in a single slot array and each slot has a metadata byte
+	/// holding 7 bits of the key's hash. Lookups probe the metadata 16 slots at a time
+	/// (with SSE2 when available) and only compare keys whose metadata matches.
+	/// Unlike HashMap, inserting may move entries, so references into the container are
+	/// invalidated whenever it grows.
+	/// </summary>
+	/// <typeparam name="TKey">Key type</typeparam>
+	/// <typeparam name="TData">Value type</typeparam>
+	/// <typeparam name="THash">Functor that hashes a LookupType</typeparam>
+	/// <typeparam name="TKeyEquality">Functor that compares two LookupTypes</typeparam>
+	template <typename TKey, typename TData, typename THash = DefaultHash<TKey>, typename TKeyEquality = DefaultEquality<TKey>>
+	class FlatHashMap final
+	{
+	public:
+		using PairType = std::pair<const TKey, TData>;
+		using size_type = std::size_t;
+		using value_type = PairType;
+		using reference = value_type&;
+		using const_reference = const value_type&;
+		using rvalue_reference = value_type&&;
+		using pointer = value_type*;
+		using const_pointer = const value_type*;
+		using LookupType = LookupKeyType<TKey>;
+		using Hash = THash;
+		using KeyEquality = TKeyEquality;
+
+	public:
+		class iterator;
+
+		/// <summary>
+		/// Iterator that when dereferenced returns a const version of a value in the container
+		/// </summary>
+		class const_iterator final
+		{
+			friend class FlatHashMap;
+
+		public:
+			using iterator_category = std::forward_iterator_tag;
+			using difference_type = std::ptrdiff_t;
+			using value_type = value_type;
+			using pointer = value_type*;
+			using reference = value_type&;
+
+			const_iterator() = default;
+			const_iterator& operator=(const const_iterator&) = default;
+
+			/// <summary>
+			/// Creates a constant iterator from a non-const iterator
+			/// </summary>
+			/// <param name="other">iterator to turn into a const_iterator</param>
+			const_iterator(const iterator& other);
+
+			/// <summary>
+			/// Gets a const version of the value in the container pointed to by this iterator
+			/// </summary>
+			/// <exception cref="runtime_error">If the iterator is not associated with a container or points to an element not within a container</exception>
+			/// <returns>value in the container</returns>
+			[[nodiscard]] const_reference operator*() const;
+
+			/// <summary>
+			/// Gets a const version of the value in the container pointed to by this iterator
+			/// </summary>
+			/// <exception cref="runtime_error">If the iterator is not associated with a container or points to an element not within a container</exception>
+			/// <returns>value in the container</returns>
+			[[nodiscard]] const value_type* operator->() const;
+
+			/// <summary>
+			/// Increments the iterator so the iterator points to the next element in the container
+			/// </summary>
+			/// <exception cref="runtime_error">Iterator is not associated with a container</exception>
+			/// <returns>Reference to the incremented iterator</returns>
+			const_iterator& operator++();
+
+			/// <summary>
+			/// Increments the iterator so the iterator points to the next element in the container
+			/// </summary>
+			/// <exception cref="runtime_error">Iterator is not associated with a container</exception>
+			/// <returns>Iterator before it is incremented</returns>
+			const_iterator operator++(int);
+
+			/// <summary>
+			/// Compares iterators. Iterators are equal if they are from the same container and point to the same slot
+			/// </summary>
+			/// <param name="other"></param>
+			/// <returns>Whether the iterators are equal</returns>
+			[[nodiscard]] bool operator==(const const_iterator& other) const;
+
+			/// <summary>
+			/// Compares iterators. Iterators are not equal if they are from different containers or point to different slots
+			/// </summary>
+			/// <param name="other"></param>
+			/// <returns>Whether the iterators are not equal</returns>
+			[[nodiscard]] bool operator!=(const const_iterator& other) const;
+
+		private:
+			/// <summary>
+			/// Creates an iterator associated with a container that points to a slot
+			/// </summary>
+			/// <param name="container">Container the iterator is associated with</param>
+			/// <param name="index">Slot the iterator points to</param>
+			const_iterator(const FlatHashMap& container, size_type index);
+
+			const FlatHashMap* _container = nullptr;
+			size_type _index = 0;
+		};
+
+		/// <summary>
+		/// Iterator that when dereferenced returns a non-const version of a value in the container
+		/// </summary>
+		class iterator final
+		{
+			friend FlatHashMap;
+			friend const_iterator;
+
+		public:
+			using iterator_category = std::forward_iterator_tag;
+			using difference_type = std::ptrdiff_t;
+			using value_type = value_type;
+			using pointer = value_type*;
+			using reference = value_type&;
+
+			iterator() = default;
+			iterator& operator=(const iterator&) = default;
+
+			/// <summary>
+			/// Gets a non-const version of the value in the container pointed to by this iterator
+			/// </summary>
+			/// <exception cref="runtime_error">If the iterator is not associated with a container or points to an element not within a container</exception>
+			/// <returns>value in the container</returns>
+			[[nodiscard]] reference operator*() const;
+
+			/// <summary>
+			/// Gets a non-const version of the value in the container pointed to by this iterator
+			/// </summary>
+			/// <exception cref="runtime_error">If the iterator is not associated with a container or points to an element not within a container</exception>
+			/// <returns>value in the container</returns>
+			[[nodiscard]] pointer operator->() const;
+
+			/// <summary>
+			/// Increments the iterator so the iterator points to the next element in the container
+			/// </summary>
+			/// <exception cref="runtime_error">Iterator is not associated with a container</exception>
+			/// <returns>Reference to the incremented iterator</returns>
+			iterator& operator++();
+
+			/// <summary>
+			/// Increments the iterator so the iterator points to the next element in the container
+			/// </summary>
+			/// <exception cref="runtime_error">Iterator is not associated with a container</exception>
+			/// <returns>Iterator before it is incremented</returns>
+			iterator operator++(int);
+
+			/// <summary>
+			/// Compares iterators. Iterators are equal if they are from the same container and point to the same slot
+			/// </summary>
+			/// <param name="other"></param>
+			/// <returns>Whether the iterators are equal</returns>
+			[[nodiscard]] bool operator==(const iterator& other) const;
+
+			/// <summary>
+			/// Compares iterators. Iterators are not equal if they are from different containers or point to different slots
+			/// </summary>
+			/// <param name="other"></param>
+			/// <returns>Whether the iterators are not equal</returns>
+			[[nodiscard]] bool operator!=(const iterator& other) const;
+
+		private:
+			/// <summary>
+			/// Creates an iterator associated with a container that points to a slot
+			/// </summary>
+			/// <param name="container">Container the iterator is associated with</param>
+			/// <param name="index">Slot the iterator points to</param>
+			iterator(FlatHashMap& container, size_type index);
+
+			FlatHashMap* _container = nullptr;
+			size_type _index = 0;
+		};
+
+		/// <summary>
+		/// Creates an empty container with room for at least bucketCount slots
+		/// </summary>
+		/// <param name="bucketCount">Minimum number of slots. Rounded up to a multiple of the probing group width</param>
+		/// <param name="hash">Hash function for keys</param>
+		/// <param name="keyEquality">Equality function for keys</param>
+		explicit FlatHashMap(size_type bucketCount = _DEFAULT_BUCKET_COUNT, Hash hash = Hash{}, KeyEquality keyEquality = KeyEquality{});
+		FlatHashMap(const FlatHashMap& other);
+		FlatHashMap(FlatHashMap&& other) noexcept;
+		FlatHashMap(std::initializer_list<PairType> list);
+		~FlatHashMap();
+
+		FlatHashMap& operator=(const FlatHashMap& rhs);
+		FlatHashMap& operator=(FlatHashMap&& rhs) noexcept;
+
+		/// <summary>
+		/// Gets an iterator pointing to the first element in the container
+		/// </summary>
+		/// <returns>iterator at the beginning of the container</returns>
+		[[nodiscard]] iterator begin();
+
+		/// <summary>
+		/// Gets a const_iterator pointing to the first element in the container
+		/// </summary>
+		/// <returns>const_iterator at the beginning of the container</returns>
+		[[nodiscard]] const_iterator begin() const;
+
+		/// <summary>
+		/// Gets an iterator pointing to one past the last element in the container
+		/// </summary>
+		/// <returns>iterator at the end of the container</returns>
+		[[nodiscard]] iterator end();
+
+		/// <summary>
+		/// Gets a const_iterator pointing to one past the last element in the container
+		/// </summary>
+		/// <returns>const_iterator at the end of the container</returns>
+		[[nodiscard]] const_iterator end() const;
+
+		/// <summary>
+		/// Gets a const_iterator pointing to the first element in the container
+		/// </summary>
+		/// <returns>const_iterator at the beginning of the container</returns>
+		[[nodiscard]] const_iterator cbegin() const;
+
+		/// <summary>
+		/// Gets a const_iterator pointing to one past the last element in the container
+		/// </summary>
+		/// <returns>const_iterator at the end of the container</returns>
+		[[nodiscard]] const_iterator cend() const;
+
+		/// <summary>
+		/// Finds a element in the containers and returns an iterator to the element.
+		/// If no element is found, an iterator pointing to the end of the container is returned.
+		/// </summary>
+		/// <param name="key">Key to find. String keys can be given as a std::string_view or literal without allocating</param>
+		/// <returns>Iterator pointing to the value found or to the end of the container</returns>
+		[[nodiscard]] iterator Find(const LookupType& key);
+
+		/// <summary>
+		/// Finds a element in the containers and returns an iterator to the element.
+		/// If no element is found, an iterator pointing to the end of the container is returned.
+		/// </summary>
+		/// <param name="key">Key to find. String keys can be given as a std::string_view or literal without allocating</param>
+		/// <returns>Iterator pointing to the value found or to the end of the container</returns>
+		[[nodiscard]] const_iterator Find(const LookupType& key) const;
+
+		/// <summary>
+		/// Adds a value at the key provided container. If the key already exists,
+		/// and iterator to the already existing key value pair is returned.
+		/// </summary>
+		/// <param name="keyValuePair">Key value pair to add</param>
+		/// <returns>Iterator pointing to the key value pair. Boolean indicates if the value was inserted</returns>
+		std::pair<iterator, bool> Insert(const PairType& keyValuePair);
+
+		/// <summary>
+		/// Adds a value at the key provided container. If the key already exists,
+		/// and iterator to the already existing key value pair is returned.
+		/// </summary>
+		/// <param name="keyValuePair">Key value pair to add</param>
+		/// <returns>Iterator pointing to the key value pair. Boolean indicates if the value was inserted</returns>
+		std::pair<iterator, bool> Insert(PairType&& keyValuePair);
+
+		/// <summary>
+		/// Constructs a key value pair from the arguments and adds it to the container. If the key already exists,
+		/// and iterator to the already existing key value pair is returned.
+		/// </summary>
+		/// <param name="args">Arguments forwarded to the key value pair constructor</param>
+		/// <returns>Iterator pointing to the key value pair. Boolean indicates if the value was inserted</returns>
+		template <typename... Args>
+		std::pair<iterator, bool> Emplace(Args&&... args);
+
+		/// <summary>
+		/// Gets the value at the specified key. If the key does not exist in the container,
+		/// a value is default constructed and inserted into the container at the key's location
+		/// </summary>
+		/// <param name="key">Key to get</param>
+		/// <returns>Data associated with the key in the container</returns>
+		TData& operator[](const TKey& key);
+
+		/// <summary>
+		/// Removes the key and value from the container given a key
+		/// </summary>
+		/// <param name="key">Key to remove</param>
+		/// <returns>Whether the key was found</returns>
+		bool Remove(const LookupType& key);
+
+		/// <summary>
+		/// Clears the containers of all keys and values. The slot array is kept.
+		/// </summary>
+		void Clear();
+
+		/// <summary>
+		/// Gets the number of elements in the container
+		/// </summary>
+		/// <returns>Number of elements in the container</returns>
+		[[nodiscard]] size_type Size() const;
+
+		/// <summary>
+		/// Gets the number of slots in the container
+		/// </summary>
+		/// <returns>Number of slots in the container</returns>
+		[[nodiscard]] size_type BucketCount() const;
+
+		/// <summary>
+		/// The percentage of slots in use in the container from [0, 1].
+		/// The container grows before the load factor passes 7/8.
+		/// </summary>
+		/// <returns>Percentage of slots in use from 0 to 1</returns>
+		[[nodiscard]] float LoadFactor() const;
+
+		/// <summary>
+		/// Checks if a key is in the container
+		/// </summary>
+		/// <param name="key"></param>
+		/// <returns>True if the key exists; otherwise false</returns>
+		[[nodiscard]] bool ContainsKey(const LookupType& key) const;
+
+		/// <summary>
+		/// Gets the value at the key.
+		/// </summary>
+		/// <param name="key"></param>
+		/// <exception cref="runtime_error">Key does not exist in the container</exception>
+		/// <returns>Data at the given key in the container</returns>
+		[[nodiscard]] TData& At(const LookupType& key);
+
+		/// <summary>
+		/// Gets the value at the key.
+		/// </summary>
+		/// <param name="key"></param>
+		/// <exception cref="runtime_error">Key does not exist in the container</exception>
+		/// <returns>Data at the given key in the container</returns>
+		[[nodiscard]] const TData& At(const LookupType& key) const;
+
+		/// <summary>
+		/// Resizes the number of slots in the container. Causes a rehash of all key value pairs
+		/// currently in the container
+		/// </summary>
+		/// <exception cref="runtime_error">New bucket count must be greater than current bucket count</exception>
+		/// <param name="bucketCount">New minimum slot count</param>
+		void Resize(size_type bucketCount);
+
+	private:
+		using ControlByte = std::int8_t;
+
+		/// <summary>
+		/// Sixteen metadata bytes that are probed together
+		/// </summary>
+		struct Group final
+		{
+			explicit Group(const ControlByte* control);
+
+			/// <summary>
+			/// Bit i is set if byte i equals the given metadata byte
+			/// </summary>
+			[[nodiscard]] std::uint32_t Match(ControlByte h2) const;
+
+			/// <summary>
+			/// Bit i is set if byte i is an empty slot
+			/// </summary>
+			[[nodiscard]] std::uint32_t MatchEmpty() const;
+
+			/// <summary>
+			/// Bit i is set if byte i is an empty or deleted slot
+			/// </summary>
+			[[nodiscard]] std::uint32_t MatchEmptyOrDeleted() const;
+
+#if defined(FIEA_FLAT_HASH_MAP_SSE2)
+			__m128i Control;
+#else
+			const ControlByte* Control;
+#endif
+		};
+
+		static constexpr ControlByte _EMPTY = static_cast<ControlByte>(-128);
+		static constexpr ControlByte _DELETED = static_cast<ControlByte>(-2);
+		static constexpr size_type _GROUP_WIDTH = 16;
+		static constexpr size_type _DEFAULT_BUCKET_COUNT = 16;
+
+		NO_UNIQUE_ADDRESS KeyEquality _keyEquality;
+		NO_UNIQUE_ADDRESS Hash _hash;
+		ControlByte* _control = nullptr;
+		PairType* _slots = nullptr;
+		size_type _capacity = 0;
+		size_type _numElements = 0;
+		size_type _growthLeft = 0;
+
+		// Mixes the user hash so weak hashes still spread over groups. Top 7 bits become the metadata byte
+		[[nodiscard]] static std::uint64_t _Mix(std::size_t hash);
+		[[nodiscard]] static ControlByte _H2(std::uint64_t mixed);
+		[[nodiscard]] static size_type _MaxElements(size_type capacity);
+		[[nodiscard]] size_type _FirstGroup(std::uint64_t mixed) const;
+
+		// Returns the slot holding key or _capacity if it does not exist
+		[[nodiscard]] size_type _FindIndex(const LookupType& key, std::uint64_t mixed) const;
+		// Returns the first empty or deleted slot on the key's probe sequence
+		[[nodiscard]] size_type _FindInsertIndex(std::uint64_t mixed) const;
+		// Constructs an entry for a key known to not be in the container. Grows if needed
+		template <typename... Args>
+		size_type _InsertUnique(std::uint64_t mixed, Args&&... args);
+		[[nodiscard]] size_type _NextFullIndex(size_type index) const;
+
+		void _Allocate(size_type capacity);
+		void _Rehash(size_type capacity);
+		void _DestroyAll();
+		void _Deallocate();
+	};
+}
+
+#include "FlatHashMap.inl"
@@ -0,0 +1,674 @@
+#include "FlatHashMap.h"
+
+namespace FieaGameEngine
+{
+#pragma region FlatHashMap
+	template <typename TKey, typename TData, typename THash, typename TKeyEquality>
+	inline FlatHashMap<TKey, TData, THash, TKeyEquality>::FlatHashMap(size_type bucketCount, Hash hash, KeyEquality keyEquality) :
+		_keyEquality(keyEquality),
+		_hash(hash)
+	{
+		assert(bucketCount > 0);
+		_Allocate(std::bit_ceil(std::max(bucketCount, _GROUP_WIDTH)));
+	}
+
+	template <typename TKey, typename TData, typename THash, typename TKeyEquality>
+	inline FlatHashMap<TKey, TData, THash, TKeyEquality>::FlatHashMap(const FlatHashMap& other) :
+		_keyEquality(other._keyEquality),
+		_hash(other._hash)
+	{
+		_Allocate(other._capacity);
+		if (_capacity == 0)
+		{
+			return;
+		}
+		// Same capacity and hash, so every entry keeps its slot
+		std::memcpy(_control, other._control, _capacity);
+		for (size_type i = 0; i < _capacity; ++i)
+		{
+			if (_control[i] >= 0)
+			{
+				new (_slots + i) PairType(other._slots[i]);
+			}
+		}
+		_numElements = other._numElements;
+		_growthLeft = other._growthLeft;
+	}
+
+	template <typename TKey, typename TData, typename THash, typename TKeyEquality>
+	inline FlatHashMap<TKey, TData, THash, TKeyEquality>::FlatHashMap(FlatHashMap&& other) noexcept :
+		_keyEquality(std::move(other._keyEquality)),
+		_hash(std::move(other._hash)),
+		_control(other._control),
+		_slots(other._slots),
+		_capacity(other._capacity),
+		_numElements(other._numElements),
+		_growthLeft(other._growthLeft)
+	{
+		other._control = nullptr;
+		other._slots = nullptr;
+		other._capacity = 0;
+		other._numElements = 0;
+		other._growthLeft = 0;
+	}
+
+	template <typename TKey, typename TData, typename THash, typename TKeyEquality>
+	inline FlatHashMap<TKey, TData, THash, TKeyEquality>::FlatHashMap(std::initializer_list<PairType> list) : FlatHashMap(list.size() + list.size() / 7)
+	{
+		for (const PairType& pair : list)
+		{
+			Insert(pair);
+		}
+	}
+
+	template <typename TKey, typename TData, typename THash, typename TKeyEquality>
+	inline FlatHashMap<TKey, TData, THash, TKeyEquality>::~FlatHashMap()
+	{
+		_DestroyAll();
+		_Deallocate();
+	}
+
+	template <typename TKey, typename TData, typename THash, typename TKeyEquality>
+	inline FlatHashMap<TKey, TData, THash, TKeyEquality>& FlatHashMap<TKey, TData, THash, TKeyEquality>::operator=(const FlatHashMap& rhs)
+	{
+		if (this != &rhs)
+		{
+			FlatHashMap copy(rhs);
+			*this = std::move(copy);
+		}
+		return *this;
+	}
+
+	template <typename TKey, typename TData, typename THash, typename TKeyEquality>
+	inline FlatHashMap<TKey, TData, THash, TKeyEquality>& FlatHashMap<TKey, TData, THash, TKeyEquality>::operator=(FlatHashMap&& rhs) noexcept
+	{
+		if (this != &rhs)
+		{
+			_DestroyAll();
+			_Deallocate();
+
+			_keyEquality = std::move(rhs._keyEquality);
+			_hash = std::move(rhs._hash);
+			_control = rhs._control;
+			_slots = rhs._slots;
+			_capacity = rhs._capacity;
+			_numElements = rhs._numElements;
+			_growthLeft = rhs._growthLeft;
+
+			rhs._control = nullptr;
+			rhs._slots = nullptr;
+			rhs._capacity = 0;
+			rhs._numElements = 0;
+			rhs._growthLeft = 0;
+		}
+		return *this;
+	}
+
+	template <typename TKey, typename TData, typename THash, typename TKeyEquality>
+	inline typename FlatHashMap<TKey, TData, THash, TKeyEquality>::iterator FlatHashMap<TKey, TData, THash, TKeyEquality>::begin()
+	{
+		return iterator(*this, _NextFullIndex(0));
+	}
+
+	template <typename TKey, typename TData, typename THash, typename TKeyEquality>
+	inline typename FlatHashMap<TKey, TData, THash, TKeyEquality>::const_iterator FlatHashMap<TKey, TData, THash, TKeyEquality>::begin() const
+	{
+		return const_iterator(*this, _NextFullIndex(0));
+	}
+
+	template <typename TKey, typename TData, typename THash, typename TKeyEquality>
+	inline typename FlatHashMap<TKey, TData, THash, TKeyEquality>::iterator FlatHashMap<TKey, TData, THash, TKeyEquality>::end()
+	{
+		return iterator(*this, _capacity);
+	}
+
+	template <typename TKey, typename TData, typename THash, typename TKeyEquality>
+	inline typename FlatHashMap<TKey, TData, THash, TKeyEquality>::const_iterator FlatHashMap<TKey, TData, THash, TKeyEquality>::end() const
+	{
+		return const_iterator(*this, _capacity);
+	}
+
+	template <typename TKey, typename TData, typename THash, typename TKeyEquality>
+	inline typename FlatHashMap<TKey, TData, THash, TKeyEquality>::const_iterator FlatHashMap<TKey, TData, THash, TKeyEquality>::cbegin() const
+	{
+		return begin();
+	}
+
+	template <typename TKey, typename TData, typename THash, typename TKeyEquality>
+	inline typename FlatHashMap<TKey, TData, THash, TKeyEquality>::const_iterator FlatHashMap<TKey, TData, THash, TKeyEquality>::cend() const
+	{
+		return end();
+	}
+
+	template <typename TKey, typename TData, typename THash, typename TKeyEquality>
+	inline typename FlatHashMap<TKey, TData, THash, TKeyEquality>::iterator FlatHashMap<TKey, TData, THash, TKeyEquality>::Find(const LookupType& key)
+	{
+		return iterator(*this, _FindIndex(key, _Mix(_hash(key))));
+	}
+
+	template <typename TKey, typename TData, typename THash, typename TKeyEquality>
+	inline typename FlatHashMap<TKey, TData, THash, TKeyEquality>::const_iterator FlatHashMap<TKey, TData, THash, TKeyEquality>::Find(const LookupType& key) const
+	{
+		return const_iterator(*this, _FindIndex(key, _Mix(_hash(key))));
+	}
+
+	template <typename TKey, typename TData, typename THash, typename TKeyEquality>
+	inline std::pair<typename FlatHashMap<TKey, TData, THash, TKeyEquality>::iterator, bool> FlatHashMap<TKey, TData, THash, TKeyEquality>::Insert(const PairType& keyValuePair)
+	{
+		const std::uint64_t mixed = _Mix(_hash(keyValuePair.first));
+		const size_type index = _FindIndex(keyValuePair.first, mixed);
+		if (index != _capacity)
+		{
+			return std::pair(iterator(*this, index), false);
+		}
+		return std::pair(iterator(*this, _InsertUnique(mixed, keyValuePair)), true);
+	}
+
+	template <typename TKey, typename TData, typename THash, typename TKeyEquality>
+	inline std::pair<typename FlatHashMap<TKey, TData, THash, TKeyEquality>::iterator, bool> FlatHashMap<TKey, TData, THash, TKeyEquality>::Insert(PairType&& keyValuePair)
+	{
+		const std::uint64_t mixed = _Mix(_hash(keyValuePair.first));
+		const size_type index = _FindIndex(keyValuePair.first, mixed);
+		if (index != _capacity)
+		{
+			return std::pair(iterator(*this, index), false);
+		}
+		return std::pair(iterator(*this, _InsertUnique(mixed, std::move(keyValuePair))), true);
+	}
+
+	template <typename TKey, typename TData, typename THash, typename TKeyEquality>
+	template <typename... Args>
+	inline std::pair<typename FlatHashMap<TKey, TData, THash, TKeyEquality>::iterator, bool> FlatHashMap<TKey, TData, THash, TKeyEquality>::Emplace(Args&&... args)
+	{
+		// Construct key
+		PairType keyValuePair(std::forward<Args>(args)...);
+		return Insert(std::move(keyValuePair));
+	}
+
+	template <typename TKey, typename TData, typename THash, typename TKeyEquality>
+	inline TData& FlatHashMap<TKey, TData, THash, TKeyEquality>::operator[](const TKey& key)
+	{
+		const std::uint64_t mixed = _Mix(_hash(key));
+		size_type index = _FindIndex(key, mixed);
+		if (index == _capacity)
+		{
+			index = _InsertUnique(mixed, std::piecewise_construct, std::forward_as_tuple(key), std::forward_as_tuple());
+		}
+		return _slots[index].second;
+	}
+
+	template <typename TKey, typename TData, typename THash, typename TKeyEquality>
+	inline bool FlatHashMap<TKey, TData, THash, TKeyEquality>::Remove(const LookupType& key)
+	{
+		const size_type index = _FindIndex(key, _Mix(_hash(key)));
+		if (index == _capacity)
+		{
+			// Key not found
+			return false;
+		}
+
+		_slots[index].~PairType();
+		--_numElements;
+
+		// If the group still has an empty slot no probe sequence continues past it,
+		// so the slot can become empty instead of a tombstone
+		const size_type groupStart = index & ~(_GROUP_WIDTH - 1);
+		if (Group(_control + groupStart).MatchEmpty() != 0)
+		{
+			_control[index] = _EMPTY;
+			++_growthLeft;
+		}
+		else
+		{
+			_control[index] = _DELETED;
+		}
+		return true;
+	}
+
+	template <typename TKey, typename TData, typename THash, typename TKeyEquality>
+	inline void FlatHashMap<TKey, TData, THash, TKeyEquality>::Clear()
+	{
+		_DestroyAll();
+		if (_capacity > 0)
+		{
+			std::memset(_control, static_cast<unsigned char>(_EMPTY), _capacity);
+		}
+		_numElements = 0;
+		_growthLeft = _MaxElements(_capacity);
+	}
+
+	template <typename TKey, typename TData, typename THash, typename TKeyEquality>
+	inline typename FlatHashMap<TKey, TData, THash, TKeyEquality>::size_type FlatHashMap<TKey, TData, THash, TKeyEquality>::Size() const
+	{
+		return _numElements;
+	}
+
+	template <typename TKey, typename TData, typename THash, typename TKeyEquality>
+	inline typename FlatHashMap<TKey, TData, THash, TKeyEquality>::size_type FlatHashMap<TKey, TData, THash, TKeyEquality>::BucketCount() const
+	{
+		return _capacity;
+	}
+
+	template <typename TKey, typename TData, typename THash, typename TKeyEquality>
+	inline float FlatHashMap<TKey, TData, THash, TKeyEquality>::LoadFactor() const
+	{
+		return _capacity == 0 ? 0.0f : static_cast<float>(_numElements) / _capacity;
+	}
+
+	template <typename TKey, typename TData, typename THash, typename TKeyEquality>
+	inline bool FlatHashMap<TKey, TData, THash, TKeyEquality>::ContainsKey(const LookupType& key) const
+	{
+		return _FindIndex(key, _Mix(_hash(key))) != _capacity;
+	}
+
+	template <typename TKey, typename TData, typename THash, typename TKeyEquality>
+	inline TData& FlatHashMap<TKey, TData, THash, TKeyEquality>::At(const LookupType& key)
+	{
+		const size_type index = _FindIndex(key, _Mix(_hash(key)));
+		if (index == _capacity)
+		{
+			throw std::runtime_error("Key does not exist in the container");
+		}
+		return _slots[index].second;
+	}
+
+	template <typename TKey, typename TData, typename THash, typename TKeyEquality>
+	inline const TData& FlatHashMap<TKey, TData, THash, TKeyEquality>::At(const LookupType& key) const
+	{
+		const size_type index = _FindIndex(key, _Mix(_hash(key)));
+		if (index == _capacity)
+		{
+			throw std::runtime_error("Key does not exist in the container");
+		}
+		return _slots[index].second;
+	}
+
+	template <typename TKey, typename TData, typename THash, typename TKeyEquality>
+	inline void FlatHashMap<TKey, TData, THash, TKeyEquality>::Resize(size_type bucketCount)
+	{
+		if (bucketCount < _capacity)
+		{
+			throw std::runtime_error("New bucket count must be greater than current bucket count");
+		}
+		_Rehash(std::bit_ceil(std::max(bucketCount, _GROUP_WIDTH)));
+	}
+
+	template <typename TKey, typename TData, typename THash, typename TKeyEquality>
+	inline std::uint64_t FlatHashMap<TKey, TData, THash, TKeyEquality>::_Mix(std::size_t hash)
+	{
+		return static_cast<std::uint64_t>(hash) * 0x9E3779B97F4A7C15ull;
+	}
+
+	template <typename TKey, typename TData, typename THash, typename TKeyEquality>
+	inline typename FlatHashMap<TKey, TData, THash, TKeyEquality>::ControlByte FlatHashMap<TKey, TData, THash, TKeyEquality>::_H2(std::uint64_t mixed)
+	{
+		return static_cast<ControlByte>(mixed >> 57);
+	}
+
+	template <typename TKey, typename TData, typename THash, typename TKeyEquality>
+	inline typename FlatHashMap<TKey, TData, THash, TKeyEquality>::size_type FlatHashMap<TKey, TData, THash, TKeyEquality>::_MaxElements(size_type capacity)
+	{
+		return capacity - capacity / 8;
+	}
+
+	template <typename TKey, typename TData, typename THash, typename TKeyEquality>
+	inline typename FlatHashMap<TKey, TData, THash, TKeyEquality>::size_type FlatHashMap<TKey, TData, THash, TKeyEquality>::_FirstGroup(std::uint64_t mixed) const
+	{
+		return static_cast<size_type>(mixed >> 32) & (_capacity / _GROUP_WIDTH - 1);
+	}
+
+	template <typename TKey, typename TData, typename THash, typename TKeyEquality>
+	inline typename FlatHashMap<TKey, TData, THash, TKeyEquality>::size_type FlatHashMap<TKey, TData, THash, TKeyEquality>::_FindIndex(const LookupType& key, std::uint64_t mixed) const
+	{
+		if (_numElements == 0)
+		{
+			return _capacity;
+		}
+
+		const size_type groupMask = _capacity / _GROUP_WIDTH - 1;
+		const ControlByte h2 = _H2(mixed);
+		size_type group = _FirstGroup(mixed);
+
+		// Triangular probing over groups visits every group once for power of two group counts
+		for (size_type probe = 1; probe <= groupMask + 1; ++probe)
+		{
+			const size_type groupStart = group * _GROUP_WIDTH;
+			const Group metadata(_control + groupStart);
+			for (std::uint32_t matches = metadata.Match(h2); matches != 0; matches &= matches - 1)
+			{
+				const size_type index = groupStart + std::countr_zero(matches);
+				if (_keyEquality(_slots[index].first, key))
+				{
+					return index;
+				}
+			}
+			if (metadata.MatchEmpty() != 0)
+			{
+				break;
+			}
+			group = (group + probe) & groupMask;
+		}
+		return _capacity;
+	}
+
+	template <typename TKey, typename TData, typename THash, typename TKeyEquality>
+	inline typename FlatHashMap<TKey, TData, THash, TKeyEquality>::size_type FlatHashMap<TKey, TData, THash, TKeyEquality>::_FindInsertIndex(std::uint64_t mixed) const
+	{
+		const size_type groupMask = _capacity / _GROUP_WIDTH - 1;
+		size_type group = _FirstGroup(mixed);
+		for (size_type probe = 1; ; ++probe)
+		{
+			const size_type groupStart = group * _GROUP_WIDTH;
+			const std::uint32_t available = Group(_control + groupStart).MatchEmptyOrDeleted();
+			if (available != 0)
+			{
+				return groupStart + std::countr_zero(available);
+			}
+			group = (group + probe) & groupMask;
+		}
+	}
+
+	template <typename TKey, typename TData, typename THash, typename TKeyEquality>
+	template <typename... Args>
+	inline typename FlatHashMap<TKey, TData, THash, TKeyEquality>::size_type FlatHashMap<TKey, TData, THash, TKeyEquality>::_InsertUnique(std::uint64_t mixed, Args&&... args)
+	{
+		if (_capacity == 0)
+		{
+			_Rehash(_GROUP_WIDTH);
+		}
+
+		size_type index = _FindInsertIndex(mixed);
+		if (_growthLeft == 0 && _control[index] == _EMPTY)
+		{
+			// Out of room. Rehash in place when mostly tombstones, otherwise double
+			const bool mostlyDeleted = _numElements < _MaxElements(_capacity) / 2;
+			_Rehash(mostlyDeleted ? _capacity : _capacity * 2);
+			index = _FindInsertIndex(mixed);
+		}
+
+		new (_slots + index) PairType(std::forward<Args>(args)...);
+		if (_control[index] == _EMPTY)
+		{
+			--_growthLeft;
+		}
+		_control[index] = _H2(mixed);
+		++_numElements;
+		return index;
+	}
+
+	template <typename TKey, typename TData, typename THash, typename TKeyEquality>
+	inline typename FlatHashMap<TKey, TData, THash, TKeyEquality>::size_type FlatHashMap<TKey, TData, THash, TKeyEquality>::_NextFullIndex(size_type index) const
+	{
+		while (index < _capacity && _control[index] < 0)
+		{
+			++index;
+		}
+		return index;
+	}
+
+	template <typename TKey, typename TData, typename THash, typename TKeyEquality>
+	inline void FlatHashMap<TKey, TData, THash, TKeyEquality>::_Allocate(size_type capacity)
+	{
+		_capacity = capacity;
+		_numElements = 0;
+		_growthLeft = _MaxElements(capacity);
+		if (capacity == 0)
+		{
+			_slots = nullptr;
+			_control = nullptr;
+			return;
+		}
+		// Slots and metadata share one allocation
+		void* memory = ::operator new(capacity * sizeof(PairType) + capacity, std::align_val_t{ alignof(PairType) });
+		_slots = static_cast<PairType*>(memory);
+		_control = reinterpret_cast<ControlByte*>(_slots + capacity);
+		std::memset(_control, static_cast<unsigned char>(_EMPTY), capacity);
+	}
+
+	template <typename TKey, typename TData, typename THash, typename TKeyEquality>
+	inline void FlatHashMap<TKey, TData, THash, TKeyEquality>::_Rehash(size_type capacity)
+	{
+		ControlByte* oldControl = _control;
+		PairType* oldSlots = _slots;
+		const size_type oldCapacity = _capacity;
+		const size_type numElements = _numElements;
+
+		_Allocate(capacity);
+		for (size_type i = 0; i < oldCapacity; ++i)
+		{
+			if (oldControl[i] >= 0)
+			{
+				const std::uint64_t mixed = _Mix(_hash(oldSlots[i].first));
+				const size_type index = _FindInsertIndex(mixed);
+				new (_slots + index) PairType(std::move(oldSlots[i]));
+				oldSlots[i].~PairType();
+				_control[index] = _H2(mixed);
+			}
+		}
+		_numElements = numElements;
+		_growthLeft -= numElements;
+
+		if (oldSlots != nullptr)
+		{
+			::operator delete(oldSlots, std::align_val_t{ alignof(PairType) });
+		}
+	}
+
+	template <typename TKey, typename TData, typename THash, typename TKeyEquality>
+	inline void FlatHashMap<TKey, TData, THash, TKeyEquality>::_DestroyAll()
+	{
+		if constexpr (!std::is_trivially_destructible_v<PairType>)
+		{
+			for (size_type i = 0; i < _capacity; ++i)
+			{
+				if (_control[i] >= 0)
+				{
+					_slots[i].~PairType();
+				}
+			}
+		}
+	}
+
+	template <typename TKey, typename TData, typename THash, typename TKeyEquality>
+	inline void FlatHashMap<TKey, TData, THash, TKeyEquality>::_Deallocate()
+	{
+		if (_slots != nullptr)
+		{
+			::operator delete(_slots, std::align_val_t{ alignof(PairType) });
+			_slots = nullptr;
+			_control = nullptr;
+		}
+		_capacity = 0;
+		_numElements = 0;
+		_growthLeft = 0;
+	}
+#pragma endregion FlatHashMap
+
+#pragma region Group
+	template <typename TKey, typename TData, typename THash, typename TKeyEquality>
+	inline FlatHashMap<TKey, TData, THash, TKeyEquality>::Group::Group(const ControlByte* control) :
+#if defined(FIEA_FLAT_HASH_MAP_SSE2)
+		Control(_mm_loadu_si128(reinterpret_cast<const __m128i*>(control)))
+#else
+		Control(control)
+#endif
+	{
+	}
+
+	template <typename TKey, typename TData, typename THash, typename TKeyEquality>
+	inline std::uint32_t FlatHashMap<TKey, TData, THash, TKeyEquality>::Group::Match(ControlByte h2) const
+	{
+#if defined(FIEA_FLAT_HASH_MAP_SSE2)
+		return static_cast<std::uint32_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(_mm_set1_epi8(h2), Control)));
+#else
+		std::uint32_t mask = 0;
+		for (size_type i = 0; i < _GROUP_WIDTH; ++i)
+		{
+			mask |= static_cast<std::uint32_t>(Control[i] == h2) << i;
+		}
+		return mask;
+#endif
+	}
+
+	template <typename TKey, typename TData, typename THash, typename TKeyEquality>
+	inline std::uint32_t FlatHashMap<TKey, TData, THash, TKeyEquality>::Group::MatchEmpty() const
+	{
+		return Match(_EMPTY);
+	}
+
+	template <typename TKey, typename TData, typename THash, typename TKeyEquality>
+	inline std::uint32_t FlatHashMap<TKey, TData, THash, TKeyEquality>::Group::MatchEmptyOrDeleted() const
+	{
+#if defined(FIEA_FLAT_HASH_MAP_SSE2)
+		// Empty and deleted are the only values below -1
+		return static_cast<std::uint32_t>(_mm_movemask_epi8(_mm_cmpgt_epi8(_mm_set1_epi8(-1), Control)));
+#else
+		std::uint32_t mask = 0;
+		for (size_type i = 0; i < _GROUP_WIDTH; ++i)
+		{
+			mask |= static_cast<std::uint32_t>(Control[i] < -1) << i;
+		}
+		return mask;
+#endif
+	}
+#pragma endregion Group
+
+#pragma region const_iterator
+	template <typename TKey, typename TData, typename THash, typename TKeyEquality>
+	inline FlatHashMap<TKey, TData, THash, TKeyEquality>::const_iterator::const_iterator(const iterator& other) :
+		_container(other._container),
+		_index(other._index)
+	{
+	}
+
+	template <typename TKey, typename TData, typename THash, typename TKeyEquality>
+	inline FlatHashMap<TKey, TData, THash, TKeyEquality>::const_iterator::const_iterator(const FlatHashMap& container, size_type index) :
+		_container(&container),
+		_index(index)
+	{
+	}
+
+	template <typename TKey, typename TData, typename THash, typename TKeyEquality>
+	inline typename FlatHashMap<TKey, TData, THash, TKeyEquality>::const_reference FlatHashMap<TKey, TData, THash, TKeyEquality>::const_iterator::operator*() const
+	{
+		if (_container == nullptr)
+		{
+			throw std::runtime_error("Iterator is not associated with a container");
+		}
+
+		if (_index >= _container->_capacity || _container->_control[_index] < 0)
+		{
+			throw std::runtime_error("Iterator does not point to an element in the container");
+		}
+
+		return _container->_slots[_index];
+	}
+
+	template <typename TKey, typename TData, typename THash, typename TKeyEquality>
+	inline const typename FlatHashMap<TKey, TData, THash, TKeyEquality>::const_iterator::value_type* FlatHashMap<TKey, TData, THash, TKeyEquality>::const_iterator::operator->() const
+	{
+		return &operator*();
+	}
+
+	template <typename TKey, typename TData, typename THash, typename TKeyEquality>
+	inline typename FlatHashMap<TKey, TData, THash, TKeyEquality>::const_iterator& FlatHashMap<TKey, TData, THash, TKeyEquality>::const_iterator::operator++()
+	{
+		if (_container == nullptr)
+		{
+			throw std::runtime_error("Iterator is not associated with a container");
+		}
+
+		if (_index < _container->_capacity)
+		{
+			_index = _container->_NextFullIndex(_index + 1);
+		}
+		return *this;
+	}
+
+	template <typename TKey, typename TData, typename THash, typename TKeyEquality>
+	inline typename FlatHashMap<TKey, TData, THash, TKeyEquality>::const_iterator FlatHashMap<TKey, TData, THash, TKeyEquality>::const_iterator::operator++(int)
+	{
+		const_iterator it = *this;
+		operator++();
+		return it;
+	}
+
+	template <typename TKey, typename TData, typename THash, typename TKeyEquality>
+	inline bool FlatHashMap<TKey, TData, THash, TKeyEquality>::const_iterator::operator==(const const_iterator& other) const
+	{
+		return _container == other._container && _index == other._index;
+	}
+
+	template <typename TKey, typename TData, typename THash, typename TKeyEquality>
+	inline bool FlatHashMap<TKey, TData, THash, TKeyEquality>::const_iterator::operator!=(const const_iterator& other) const
+	{
+		return !operator==(other);
+	}
+#pragma endregion const_iterator
+
+#pragma region iterator
+	template <typename TKey, typename TData, typename THash, typename TKeyEquality>
+	inline FlatHashMap<TKey, TData, THash, TKeyEquality>::iterator::iterator(FlatHashMap& container, size_type index) :
+		_container(&container),
+		_index(index)
+	{
+	}
+
+	template <typename TKey, typename TData, typename THash, typename TKeyEquality>
+	inline typename FlatHashMap<TKey, TData, THash, TKeyEquality>::reference FlatHashMap<TKey, TData, THash, TKeyEquality>::iterator::operator*() const
+	{
+		if (_container == nullptr)
+		{
+			throw std::runtime_error("Iterator is not associated with a container");
+		}
+
+		if (_index >= _container->_capacity || _container->_control[_index] < 0)
+		{
+			throw std::runtime_error("Iterator does not point to an element in the container");
+		}
+
+		return _container->_slots[_index];
+	}
+
+	template <typename TKey, typename TData, typename THash, typename TKeyEquality>
+	inline typename FlatHashMap<TKey, TData, THash, TKeyEquality>::pointer FlatHashMap<TKey, TData, THash, TKeyEquality>::iterator::operator->() const
+	{
+		return &operator*();
+	}
+
+	template <typename TKey, typename TData, typename THash, typename TKeyEquality>
+	inline typename FlatHashMap<TKey, TData, THash, TKeyEquality>::iterator& FlatHashMap<TKey, TData, THash, TKeyEquality>::iterator::operator++()
+	{
+		if (_container == nullptr)
+		{
+			throw std::runtime_error("Iterator is not associated with a container");
+		}
+
+		if (_index < _container->_capacity)
+		{
+			_index = _container->_NextFullIndex(_index + 1);
+		}
+		return *this;
+	}
+
+	template <typename TKey, typename TData, typename THash, typename TKeyEquality>
+	inline typename FlatHashMap<TKey, TData, THash, TKeyEquality>::iterator FlatHashMap<TKey, TData, THash, TKeyEquality>::iterator::operator++(int)
+	{
+		iterator it = *this;
+		operator++();
+		return it;
+	}
+
+	template <typename TKey, typename TData, typename THash, typename TKeyEquality>
+	inline bool FlatHashMap<TKey, TData, THash, TKeyEquality>::iterator::operator==(const iterator& other) const
+	{
+		return _container == other._container && _index == other._index;
+	}
+
+	template <typename TKey, typename TData, typename THash, typename TKeyEquality>
+	inline bool FlatHashMap<TKey, TData, THash, TKeyEquality>::iterator::operator!=(const iterator& other) const
+	{
+		return !operator==(other);
+	}
+#pragma endregion iterator
+}
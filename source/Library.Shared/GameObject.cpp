@@ -31,32 +31,32 @@ namespace FieaGameEngine
 
     Datum& GameObject::Children()
     {
-        return At("Children"s);
+        return Slot<Slots::Children>();
     }
 
     const Datum& GameObject::Children() const
     {
-        return At("Children"s);
+        return Slot<Slots::Children>();
     }
 
     Datum& GameObject::Actions()
     {
-        return At("Actions"s);
+        return Slot<Slots::Actions>();
     }
 
     const Datum& GameObject::Actions() const
     {
-        return At("Actions"s);
+        return Slot<Slots::Actions>();
     }
 
     Datum& GameObject::Reactions()
     {
-        return At("Reactions"s);
+        return Slot<Slots::Reactions>();
     }
 
     const Datum& GameObject::Reactions() const
     {
-        return At("Reactions"s);
+        return Slot<Slots::Reactions>();
     }
 
     Action& GameObject::CreateAction(std::string actionClass, std::string name)
@@ -69,7 +69,7 @@ namespace FieaGameEngine
         assert(newAction->Is(Action::TypeIdClass()));
         Action& newActionRef = static_cast<Action&>(*newAction);
         newActionRef.Name = name;
-        Adopt(newAction, "Actions"s);
+        Adopt(newAction, "Actions"_sym);
         return newActionRef;
     }
 
@@ -82,11 +82,11 @@ namespace FieaGameEngine
     {
         return
         {
-            {"Name", DatumTypes::String, true, Signature::ExternalInfo{1, offsetof(GameObject, Name)}},
-            {"Transform", DatumTypes::TablePointer, true, Signature::ExternalInfo{1, offsetof(GameObject, Transform)}},
-            {"Children", DatumTypes::Table, false},
-            {"Actions", DatumTypes::Table, false},
-            {"Reactions", DatumTypes::Table, false}
+            {"Name"_sym, DatumTypes::String, true, Signature::ExternalInfo{1, offsetof(GameObject, Name)}},
+            {"Transform"_sym, DatumTypes::TablePointer, true, Signature::ExternalInfo{1, offsetof(GameObject, Transform)}},
+            {"Children"_sym, DatumTypes::Table, false},
+            {"Actions"_sym, DatumTypes::Table, false},
+            {"Reactions"_sym, DatumTypes::Table, false}
         };
     }
 
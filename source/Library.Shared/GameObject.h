@@ -16,6 +16,19 @@ namespace FieaGameEngine
 		ATTRIBUTED_DECLARATIONS(GameObject, FieaGameEngine::Attributed);
     
     public:
+        /// <summary>
+        /// Slots of the prescribed attributes, in Signatures() order. See Attributed::Slot
+        /// </summary>
+        enum class Slots : std::size_t
+        {
+            Name = FieaGameEngine::Attributed::SlotCount,
+            Transform,
+            Children,
+            Actions,
+            Reactions
+        };
+        static constexpr std::size_t SlotCount = static_cast<std::size_t>(Slots::Reactions) + 1;
+
         GameObject();
         GameObject(const GameObject& rhs);
         GameObject(GameObject&& rhs) noexcept;
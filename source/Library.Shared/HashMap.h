@@ -3,11 +3,14 @@
 #include "Vector.h"
 #include "SList.h"
 #include "DefaultHash.h"
+#include "NoUniqueAddress.h"
 
 #include <functional>
 #include <cstddef>
 #include <utility>
 #include <initializer_list>
+#include <algorithm>
+#include <cmath>
 
 namespace FieaGameEngine
 {
@@ -16,7 +19,9 @@ namespace FieaGameEngine
 	/// </summary>
 	/// <typeparam name="TKey">Key type</typeparam>
 	/// <typeparam name="TData">Value type</typeparam>
-	template <typename TKey, typename TData>
+	/// <typeparam name="THash">Functor that hashes a LookupType</typeparam>
+	/// <typeparam name="TKeyEquality">Functor that compares two LookupTypes</typeparam>
+	template <typename TKey, typename TData, typename THash = DefaultHash<TKey>, typename TKeyEquality = DefaultEquality<TKey>>
 	class HashMap final
 	{
 	public:
@@ -28,8 +33,20 @@ namespace FieaGameEngine
 		using rvalue_reference = value_type&&;
 		using pointer = value_type*;
 		using const_pointer = const value_type*;
-		using Hash = std::function<std::size_t(const TKey&)>;
-		using KeyEquality = std::function<bool(const TKey&, const TKey&)>;
+		using LookupType = LookupKeyType<TKey>;
+		using Hash = THash;
+		using KeyEquality = TKeyEquality;
+		using Allocator = std::pmr::polymorphic_allocator<PairType>;
+
+		/// <summary>
+		/// Size of each chain node the map allocates, for sizing a NodePoolResource. Bucket arrays larger than a node bypass the pool
+		/// </summary>
+		static constexpr std::size_t NodeSize = SList<PairType>::NodeSize;
+
+		/// <summary>
+		/// Alignment of each chain node the map allocates, for sizing a NodePoolResource
+		/// </summary>
+		static constexpr std::size_t NodeAlignment = SList<PairType>::NodeAlignment;
 
 	public:
 		class iterator;
@@ -60,21 +77,21 @@ namespace FieaGameEngine
 			/// <summary>
 			/// Gets a non-const version of the value in the container pointed to by this iterator
 			/// </summary>
-			/// <exception cref="runtime_error">If the iterator is not associated with a container or points to an element not within a container</exception>
+			/// <exception cref="runtime_error">With checked iterators, if the iterator is not associated with a container or points to an element not within a container</exception>
 			/// <returns>value in the container</returns>
 			[[nodiscard]] const_reference operator*() const;
 
 			/// <summary>
 			/// Gets a const version of the value in the container pointed to by this iterator
 			/// </summary>
-			/// <exception cref="runtime_error">If the iterator is not associated with a container or points to an element not within a container</exception>
+			/// <exception cref="runtime_error">With checked iterators, if the iterator is not associated with a container or points to an element not within a container</exception>
 			/// <returns>value in the container</returns>
 			[[nodiscard]] const value_type* operator->() const;
 
 			/// <summary>
 			/// Increments the iterator so the iterator points to the next element in the container
 			/// </summary>
-			/// <exception cref="runtime_error">Iterator is not associated with a container</exception>
+			/// <exception cref="runtime_error">With checked iterators, if the iterator is not associated with a container</exception>
 			/// <returns>Reference to the incremented iterator</returns>
 			const_iterator& operator++();
 
@@ -82,7 +99,7 @@ namespace FieaGameEngine
 			/// Increments the iterator so the iterator points to the next element in the container
 			/// </summary>
 			/// <param name=""></param>
-			/// <exception cref="runtime_error">Iterator is not associated with a container</exception>
+			/// <exception cref="runtime_error">With checked iterators, if the iterator is not associated with a container</exception>
 			/// <returns>Iterator before it is incremented</returns>
 			const_iterator operator++(int);
 
@@ -138,21 +155,21 @@ namespace FieaGameEngine
 			/// <summary>
 			/// Gets a const version of the value in the container pointed to by this iterator
 			/// </summary>
-			/// <exception cref="runtime_error">If the iterator is not associated with a container or points to an element not within a container</exception>
+			/// <exception cref="runtime_error">With checked iterators, if the iterator is not associated with a container or points to an element not within a container</exception>
 			/// <returns>value in the container</returns>
 			[[nodiscard]] reference operator*() const;
 
 			/// <summary>
 			/// Gets a const version of the value in the container pointed to by this iterator
 			/// </summary>
-			/// <exception cref="runtime_error">If the iterator is not associated with a container or points to an element not within a container</exception>
+			/// <exception cref="runtime_error">With checked iterators, if the iterator is not associated with a container or points to an element not within a container</exception>
 			/// <returns>value in the container</returns>
 			[[nodiscard]] pointer operator->() const;
 
 			/// <summary>
 			/// Increments the iterator so the iterator points to the next element in the container
 			/// </summary>
-			/// <exception cref="runtime_error">Iterator is not associated with a container</exception>
+			/// <exception cref="runtime_error">With checked iterators, if the iterator is not associated with a container</exception>
 			/// <returns>Reference to the incremented iterator</returns>
 			iterator& operator++();
 
@@ -160,7 +177,7 @@ namespace FieaGameEngine
 			/// Increments the iterator so the iterator points to the next element in the container
 			/// </summary>
 			/// <param name=""></param>
-			/// <exception cref="runtime_error">Iterator is not associated with a container</exception>
+			/// <exception cref="runtime_error">With checked iterators, if the iterator is not associated with a container</exception>
 			/// <returns>Iterator before it is incremented</returns>
 			iterator operator++(int);
 
@@ -195,14 +212,39 @@ namespace FieaGameEngine
 			SList<PairType>::iterator _chainIterator;
 		};
 
-		explicit HashMap(size_t bucketCount = _DEFAULT_BUCKET_COUNT, Hash hash = DefaultHash<TKey>{}, KeyEquality keyEquality = DefaultEquality<TKey>{});
+		explicit HashMap(size_t bucketCount = _DEFAULT_BUCKET_COUNT, Hash hash = Hash{}, KeyEquality keyEquality = KeyEquality{});
+
+		/// <summary>
+		/// Constructs a hash map whose buckets and entries are allocated from a memory resource
+		/// </summary>
+		/// <param name="allocator">Allocator, or the memory resource it allocates from. The resource must outlive the map</param>
+		/// <param name="bucketCount">Initial number of buckets</param>
+		/// <param name="hash">Key hash functor</param>
+		/// <param name="keyEquality">Key equality functor</param>
+		explicit HashMap(const Allocator& allocator, size_t bucketCount = _DEFAULT_BUCKET_COUNT, Hash hash = Hash{}, KeyEquality keyEquality = KeyEquality{});
+
 		HashMap(const HashMap& other) = default;
 		HashMap(HashMap&& other) = default;
+
+		/// <summary>
+		/// Copy constructor that allocates from a memory resource
+		/// </summary>
+		/// <param name="other">Map to copy</param>
+		/// <param name="allocator">Allocator of the copy</param>
+		HashMap(const HashMap& other, const Allocator& allocator);
+
 		HashMap(std::initializer_list<PairType> list);
 		~HashMap() = default;
 
-		HashMap& operator=(const HashMap& rhs) = default;
-		HashMap& operator=(HashMap&& rhs) = default;
+		/// <summary>
+		/// Copy assignment. The copy keeps allocating from this map's resource
+		/// </summary>
+		HashMap& operator=(const HashMap& rhs);
+
+		/// <summary>
+		/// Move assignment. Entries are only taken from rhs if both maps allocate from the same resource; otherwise they are copied
+		/// </summary>
+		HashMap& operator=(HashMap&& rhs) noexcept;
 
 		/// <summary>
 		/// Gets an iterator pointing to the first element in the container
@@ -244,17 +286,17 @@ namespace FieaGameEngine
 		/// Finds a element in the containers and returns an iterator to the element.
 		/// If no element is found, an iterator pointing to the end of the container is returned.
 		/// </summary>
-		/// <param name="value">Value to find</param>
+		/// <param name="key">Key to find. String keys can be given as a std::string_view or literal without allocating</param>
 		/// <returns>Iterator pointing to the value found or to the end of the container</returns>
-		[[nodiscard]] iterator Find(const TKey& key);
+		[[nodiscard]] iterator Find(const LookupType& key);
 
 		/// <summary>
 		/// Finds a element in the containers and returns an iterator to the element.
 		/// If no element is found, an iterator pointing to the end of the container is returned.
 		/// </summary>
-		/// <param name="value">Value to find</param>
+		/// <param name="key">Key to find. String keys can be given as a std::string_view or literal without allocating</param>
 		/// <returns>Iterator pointing to the value found or to the end of the container</returns>
-		[[nodiscard]] const_iterator Find(const TKey& key) const;
+		[[nodiscard]] const_iterator Find(const LookupType& key) const;
 
 		/// <summary>
 		/// Adds a value at the key provided container. If the key already exists,
@@ -275,11 +317,21 @@ namespace FieaGameEngine
 		/// <summary>
 		/// Adds a value at the key provided container. If the key already exists,
 		/// and iterator to the already existing key value pair is returned.
+		/// Adding may grow or shrink the buckets, which invalidates iterators but not references to key value pairs.
 		/// </summary>
 		/// <param name="keyValuePair">Key value pair to add</param>
 		/// <returns>Iterator pointing to the key value pair. Boolean indicates if the value was inserted</returns>
 		template <typename... Args>
 		std::pair<iterator, bool> Emplace(Args&&... args);
+
+		/// <summary>
+		/// Adds a key value pair whose key is known not to be in the container.
+		/// Skips the lookup Emplace does; adding a key that already exists is undefined.
+		/// </summary>
+		/// <param name="args">Arguments to construct the key value pair</param>
+		/// <returns>Iterator pointing to the new key value pair</returns>
+		template <typename... Args>
+		iterator EmplaceUnique(Args&&... args);
 		
 		/// <summary>
 		/// Gets the value at the specified key. If the key does not exist in the container,
@@ -290,11 +342,12 @@ namespace FieaGameEngine
 		TData& operator[](const TKey& key);
 
 		/// <summary>
-		/// Removes the key and value from the container given a key
+		/// Removes the key and value from the container given a key.
+		/// The bucket count does not change, so iterators to other elements stay valid; the next insert shrinks the container if it is sparse
 		/// </summary>
 		/// <param name="key">Key to remove</param>
 		/// <returns>Whether the key was found</returns>
-		bool Remove(const TKey& key);
+		bool Remove(const LookupType& key);
 
 		// TODO: remove that takes in iterator
 
@@ -316,19 +369,67 @@ namespace FieaGameEngine
 		[[nodiscard]] std::size_t BucketCount() const;
 
 		/// <summary>
-		/// The percentage of buckets in use in the container from [0, 1].
-		/// 0 means the container is empty, and 1 means the container is full.
-		/// When the load factor increases, the container becomes more susceptible to collisions on insert 
+		/// Gets the allocator the container allocates its buckets and entries with
 		/// </summary>
-		/// <returns>Percentage of buckets in use from 0 to 1</returns>
+		/// <returns>Allocator of the container</returns>
+		[[nodiscard]] Allocator GetAllocator() const;
+
+		/// <summary>
+		/// Average number of elements per bucket. 0 means the container is empty.
+		/// When the load factor increases, chains get longer and lookups get slower.
+		/// The container rehashes automatically to keep the load factor between the minimum and maximum load factors.
+		/// </summary>
+		/// <returns>Elements per bucket</returns>
 		[[nodiscard]] float LoadFactor() const;
 
+		/// <summary>
+		/// Gets the load factor above which inserting grows the bucket count
+		/// </summary>
+		/// <returns>Maximum load factor</returns>
+		[[nodiscard]] float MaxLoadFactor() const;
+
+		/// <summary>
+		/// Sets the load factor above which inserting grows the bucket count.
+		/// Rehashes immediately if the container is already above it.
+		/// </summary>
+		/// <param name="maxLoadFactor">New maximum load factor</param>
+		/// <exception cref="runtime_error">Maximum load factor is not positive or is not more than twice the minimum load factor</exception>
+		void SetMaxLoadFactor(float maxLoadFactor);
+
+		/// <summary>
+		/// Gets the load factor below which inserting after removals shrinks the bucket count.
+		/// The container never shrinks below the bucket count it was constructed with.
+		/// </summary>
+		/// <returns>Minimum load factor</returns>
+		[[nodiscard]] float MinLoadFactor() const;
+
+		/// <summary>
+		/// Sets the load factor below which inserting shrinks the bucket count.
+		/// The container never shrinks below the bucket count it was constructed with.
+		/// </summary>
+		/// <param name="minLoadFactor">New minimum load factor. 0 disables shrinking</param>
+		/// <exception cref="runtime_error">Minimum load factor is negative or is not less than half the maximum load factor</exception>
+		void SetMinLoadFactor(float minLoadFactor);
+
+		/// <summary>
+		/// Grows the bucket count so that elementCount elements fit without exceeding the maximum load factor.
+		/// Use before bulk inserts to rehash once instead of several times.
+		/// </summary>
+		/// <param name="elementCount">Number of elements to make room for</param>
+		void Reserve(std::size_t elementCount);
+
+		/// <summary>
+		/// Shrinks the bucket count to hold the elements at half the maximum load factor, whatever the minimum load factor.
+		/// The container never shrinks below the bucket count it was constructed with. Invalidates iterators if it shrinks.
+		/// </summary>
+		void ShrinkToFit();
+
 		/// <summary>
 		/// Checks if a key is in the container
 		/// </summary>
 		/// <param name="key"></param>
 		/// <returns>True if the key exists; otherwise false</returns>
-		[[nodiscard]] bool ContainsKey(const TKey& key) const;
+		[[nodiscard]] bool ContainsKey(const LookupType& key) const;
 		
 		/// <summary>
 		/// Gets the value at the key.
@@ -336,7 +437,7 @@ namespace FieaGameEngine
 		/// <param name="key"></param>
 		/// <exception cref="runtime_error">Key does not exist in the container</exception>
 		/// <returns>Data at the given key in the container</returns>
-		[[nodiscard]] TData& At(const TKey& key);
+		[[nodiscard]] TData& At(const LookupType& key);
 
 		/// <summary>
 		/// Gets the value at the key.
@@ -344,27 +445,42 @@ namespace FieaGameEngine
 		/// <param name="key"></param>
 		/// <exception cref="runtime_error">Key does not exist in the container</exception>
 		/// <returns>Data at the given key in the container</returns>
-		[[nodiscard]] const TData& At(const TKey& key) const;
+		[[nodiscard]] const TData& At(const LookupType& key) const;
 
 		/// <summary>
 		/// Resizes the number of buckets in the container. Causes a rehash of all key value pairs
-		/// currently in the container
+		/// currently in the container. Nodes are relinked into their new buckets, so references
+		/// to key value pairs stay valid.
 		/// </summary>
-		/// <exception cref="runtime_error">New bucket count must be greater than current bucket count</exception>
+		/// <exception cref="runtime_error">Bucket count is 0</exception>
 		/// <param name="bucketCount">New bucket count</param>
 		void Resize(size_t bucketCount);
 
 	private:
-		KeyEquality _keyEquality;
-		Hash _hash;
+		NO_UNIQUE_ADDRESS KeyEquality _keyEquality;
+		NO_UNIQUE_ADDRESS Hash _hash;
 		Vector<SList<PairType>> _buckets;
 		std::size_t _numElements = 0;
-		std::size_t _bucketsInUse = 0;
+		std::size_t _minimumBucketCount = _DEFAULT_BUCKET_COUNT;
+		float _maxLoadFactor = _DEFAULT_MAX_LOAD_FACTOR;
+		float _minLoadFactor = _DEFAULT_MIN_LOAD_FACTOR;
+		// Set when removing leaves the container below the minimum load factor, so the next insert shrinks it
+		bool _isSparse = false;
 		static const std::size_t _DEFAULT_BUCKET_COUNT = 11;
+		static constexpr float _DEFAULT_MAX_LOAD_FACTOR = 1.0f;
+		static constexpr float _DEFAULT_MIN_LOAD_FACTOR = 0.125f;
+
+		// Smallest odd bucket count that holds elementCount elements at the maximum load factor
+		[[nodiscard]] std::size_t _BucketCountFor(std::size_t elementCount) const;
+		// Buckets whose chains all allocate from the same resource, so nodes can be spliced between them
+		[[nodiscard]] static Vector<SList<PairType>> _MakeBuckets(const Allocator& allocator, std::size_t bucketCount);
+		// Grows when elementCount elements would be above the maximum load factor, or shrinks when removals left the container
+		// sparse and they would be below the minimum. Returns true if the buckets changed
+		bool _Rehash(std::size_t elementCount);
 
 		// Helper methods for Find() that output index to prevent duplicate hashing
-		[[nodiscard]] iterator _Find(const TKey& key, size_t& index);
-		[[nodiscard]] const_iterator _Find(const TKey& key, size_t& index) const;
+		[[nodiscard]] iterator _Find(const LookupType& key, size_t& index);
+		[[nodiscard]] const_iterator _Find(const LookupType& key, size_t& index) const;
 	};
 }
 
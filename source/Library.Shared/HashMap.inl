@@ -3,18 +3,76 @@
 namespace FieaGameEngine
 {
 #pragma region HashMap
-	template<typename TKey, typename TData>
-	inline FieaGameEngine::HashMap<TKey, TData>::HashMap(std::size_t bucketCount, Hash hash, KeyEquality keyEquality) :
-		_buckets(bucketCount),
+	template <typename TKey, typename TData, typename THash, typename TKeyEquality>
+	inline HashMap<TKey, TData, THash, TKeyEquality>::HashMap(std::size_t bucketCount, Hash hash, KeyEquality keyEquality) :
+		HashMap(Allocator{}, bucketCount, std::move(hash), std::move(keyEquality))
+	{
+	}
+
+	template <typename TKey, typename TData, typename THash, typename TKeyEquality>
+	inline HashMap<TKey, TData, THash, TKeyEquality>::HashMap(const Allocator& allocator, std::size_t bucketCount, Hash hash, KeyEquality keyEquality) :
+		_keyEquality(keyEquality),
 		_hash(hash),
-		_keyEquality(keyEquality)
+		_buckets(_MakeBuckets(allocator, bucketCount)),
+		_minimumBucketCount(bucketCount)
 	{
 		assert(bucketCount > 0);
-		_buckets.Resize(bucketCount);
 	}
 
-	template<typename TKey, typename TData>
-	inline HashMap<TKey, TData>::HashMap(std::initializer_list<PairType> list) : HashMap(list.size())
+	template <typename TKey, typename TData, typename THash, typename TKeyEquality>
+	inline HashMap<TKey, TData, THash, TKeyEquality>::HashMap(const HashMap& other, const Allocator& allocator) :
+		_keyEquality(other._keyEquality),
+		_hash(other._hash),
+		_buckets(_MakeBuckets(allocator, other._buckets.Size())),
+		_numElements(other._numElements),
+		_minimumBucketCount(other._minimumBucketCount),
+		_maxLoadFactor(other._maxLoadFactor),
+		_minLoadFactor(other._minLoadFactor)
+	{
+		for (size_t i = 0; i < other._buckets.Size(); ++i)
+		{
+			for (const PairType& pair : other._buckets[i])
+			{
+				_buckets[i].PushBack(pair);
+			}
+		}
+	}
+
+	template <typename TKey, typename TData, typename THash, typename TKeyEquality>
+	inline HashMap<TKey, TData, THash, TKeyEquality>& HashMap<TKey, TData, THash, TKeyEquality>::operator=(const HashMap& rhs)
+	{
+		if (this != &rhs)
+		{
+			*this = HashMap(rhs, GetAllocator());
+		}
+		return *this;
+	}
+
+	template <typename TKey, typename TData, typename THash, typename TKeyEquality>
+	inline HashMap<TKey, TData, THash, TKeyEquality>& HashMap<TKey, TData, THash, TKeyEquality>::operator=(HashMap&& rhs) noexcept
+	{
+		if (this != &rhs)
+		{
+			if (GetAllocator() != rhs.GetAllocator())
+			{
+				// Nodes from another resource cannot be spliced into ours
+				return *this = HashMap(rhs, GetAllocator());
+			}
+
+			_keyEquality = std::move(rhs._keyEquality);
+			_hash = std::move(rhs._hash);
+			_buckets = std::move(rhs._buckets);
+			_numElements = rhs._numElements;
+			_minimumBucketCount = rhs._minimumBucketCount;
+			_maxLoadFactor = rhs._maxLoadFactor;
+			_minLoadFactor = rhs._minLoadFactor;
+			rhs._numElements = 0;
+		}
+		return *this;
+	}
+
+	template <typename TKey, typename TData, typename THash, typename TKeyEquality>
+	inline HashMap<TKey, TData, THash, TKeyEquality>::HashMap(std::initializer_list<PairType> list) : HashMap(list.size())
 	{
 		for (const PairType& pair : list)
 		{
@@ -22,35 +80,35 @@ namespace FieaGameEngine
 		}
 	}
 
-	template<typename TKey, typename TData>
-	inline typename HashMap<TKey, TData>::iterator HashMap<TKey, TData>::Find(const TKey& key)
+	template <typename TKey, typename TData, typename THash, typename TKeyEquality>
+	inline typename HashMap<TKey, TData, THash, TKeyEquality>::iterator HashMap<TKey, TData, THash, TKeyEquality>::Find(const LookupType& key)
 	{
 		std::size_t index;
 		return _Find(key, index);
 	}
 
-	template<typename TKey, typename TData>
-	inline typename HashMap<TKey, TData>::const_iterator HashMap<TKey, TData>::Find(const TKey& key) const
+	template <typename TKey, typename TData, typename THash, typename TKeyEquality>
+	inline typename HashMap<TKey, TData, THash, TKeyEquality>::const_iterator HashMap<TKey, TData, THash, TKeyEquality>::Find(const LookupType& key) const
 	{
 		std::size_t index;
 		return _Find(key, index);
 	}
 
-	template<typename TKey, typename TData>
-	inline std::pair<typename HashMap<TKey, TData>::iterator, bool> HashMap<TKey, TData>::Insert(const PairType& keyValuePair)
+	template <typename TKey, typename TData, typename THash, typename TKeyEquality>
+	inline std::pair<typename HashMap<TKey, TData, THash, TKeyEquality>::iterator, bool> HashMap<TKey, TData, THash, TKeyEquality>::Insert(const PairType& keyValuePair)
 	{
 		return Emplace(keyValuePair);
 	}
 
-	template<typename TKey, typename TData>
-	inline std::pair<typename HashMap<TKey, TData>::iterator, bool> HashMap<TKey, TData>::Insert(PairType&& keyValuePair)
+	template <typename TKey, typename TData, typename THash, typename TKeyEquality>
+	inline std::pair<typename HashMap<TKey, TData, THash, TKeyEquality>::iterator, bool> HashMap<TKey, TData, THash, TKeyEquality>::Insert(PairType&& keyValuePair)
 	{
 		return Emplace(std::move(keyValuePair));
 	}
 
-	template<typename TKey, typename TData>
+	template <typename TKey, typename TData, typename THash, typename TKeyEquality>
 	template <typename... Args>
-	inline std::pair<typename HashMap<TKey, TData>::iterator, bool> HashMap<TKey, TData>::Emplace(Args&&... args)
+	inline std::pair<typename HashMap<TKey, TData, THash, TKeyEquality>::iterator, bool> HashMap<TKey, TData, THash, TKeyEquality>::Emplace(Args&&... args)
 	{
 		// Construct key
 		PairType keyValuePair(std::forward<Args>(args)...);
@@ -61,28 +119,39 @@ namespace FieaGameEngine
 			// Key already exists in the hashmap
 			return std::pair(it, false);
 		}
-		// Key does not already exist in the hashmap
-		SList<PairType>& chain = _buckets[index];
-		if (chain.Size() == 0)
+		// Key does not already exist in the hashmap. Grow or shrink first so the new node is linked once
+		if (_Rehash(_numElements + 1))
 		{
-			// First element in this chain. Increase counter for Load Capacity calculation
-			++_bucketsInUse;
+			index = _hash(keyValuePair.first) % _buckets.Size();
 		}
-		// Size
+		SList<PairType>& chain = _buckets[index];
 		++_numElements;
 		it = iterator(*this, _buckets.begin() + index, chain.PushBack(std::move(keyValuePair)));
 		return std::pair(it, true);
 	}
 
-	template<typename TKey, typename TData>
-	inline TData& HashMap<TKey, TData>::operator[](const TKey& key)
+	template <typename TKey, typename TData, typename THash, typename TKeyEquality>
+	template <typename... Args>
+	inline typename HashMap<TKey, TData, THash, TKeyEquality>::iterator HashMap<TKey, TData, THash, TKeyEquality>::EmplaceUnique(Args&&... args)
+	{
+		PairType keyValuePair(std::forward<Args>(args)...);
+		assert(!ContainsKey(keyValuePair.first));
+		_Rehash(_numElements + 1);
+		const size_t index = _hash(keyValuePair.first) % _buckets.Size();
+		SList<PairType>& chain = _buckets[index];
+		++_numElements;
+		return iterator(*this, _buckets.begin() + index, chain.PushBack(std::move(keyValuePair)));
+	}
+
+	template <typename TKey, typename TData, typename THash, typename TKeyEquality>
+	inline TData& HashMap<TKey, TData, THash, TKeyEquality>::operator[](const TKey& key)
 	{
 		iterator it = Insert({ key, TData{} }).first;
 		return it->second;
 	}
 
-	template<typename TKey, typename TData>
-	inline bool HashMap<TKey, TData>::Remove(const TKey& key)
+	template <typename TKey, typename TData, typename THash, typename TKeyEquality>
+	inline bool HashMap<TKey, TData, THash, TKeyEquality>::Remove(const LookupType& key)
 	{
 		iterator it = Find(key);
 		if (it == end())
@@ -93,52 +162,121 @@ namespace FieaGameEngine
 		// Key found
 		SList<PairType>& chain = *it._containerIterator;
 		chain.Remove(it._chainIterator);
-		if (chain.Size() == 0)
-		{
-			--_bucketsInUse;
-		}
 		--_numElements;
+		// Shrinking here would invalidate iterators to the other elements, so the next insert does it
+		_isSparse = _buckets.Size() > _minimumBucketCount && _numElements < _minLoadFactor * _buckets.Size();
 		return true;
 	}
 
-	template<typename TKey, typename TData>
-	inline void HashMap<TKey, TData>::Clear()
+	template <typename TKey, typename TData, typename THash, typename TKeyEquality>
+	inline void HashMap<TKey, TData, THash, TKeyEquality>::Clear()
 	{
 		// Clear the chains without removing them
 		for (size_t i = 0; i < _buckets.Size(); ++i)
 		{
 			_buckets[i].Clear();
 		}
-		_bucketsInUse = 0;
 		_numElements = 0;
 	}
 
-	template<typename TKey, typename TData>
-	inline std::size_t HashMap<TKey, TData>::Size() const
+	template <typename TKey, typename TData, typename THash, typename TKeyEquality>
+	inline std::size_t HashMap<TKey, TData, THash, TKeyEquality>::Size() const
 	{
 		return _numElements;
 	}
 
-	template<typename TKey, typename TData>
-	inline std::size_t HashMap<TKey, TData>::BucketCount() const
+	template <typename TKey, typename TData, typename THash, typename TKeyEquality>
+	inline std::size_t HashMap<TKey, TData, THash, TKeyEquality>::BucketCount() const
 	{
 		return _buckets.Size();
 	}
 
-	template<typename TKey, typename TData>
-	inline float HashMap<TKey, TData>::LoadFactor() const
+	template <typename TKey, typename TData, typename THash, typename TKeyEquality>
+	inline typename HashMap<TKey, TData, THash, TKeyEquality>::Allocator HashMap<TKey, TData, THash, TKeyEquality>::GetAllocator() const
+	{
+		return Allocator(_buckets.GetAllocator());
+	}
+
+	template <typename TKey, typename TData, typename THash, typename TKeyEquality>
+	inline Vector<SList<typename HashMap<TKey, TData, THash, TKeyEquality>::PairType>> HashMap<TKey, TData, THash, TKeyEquality>::_MakeBuckets(const Allocator& allocator, std::size_t bucketCount)
+	{
+		Vector<SList<PairType>> buckets(typename Vector<SList<PairType>>::Allocator(allocator), bucketCount);
+		for (std::size_t i = 0; i < bucketCount; ++i)
+		{
+			buckets.EmplaceBack(allocator);
+		}
+		return buckets;
+	}
+
+	template <typename TKey, typename TData, typename THash, typename TKeyEquality>
+	inline float HashMap<TKey, TData, THash, TKeyEquality>::LoadFactor() const
+	{
+		return _buckets.Size() == 0 ? 0.0f : static_cast<float>(_numElements) / _buckets.Size();
+	}
+
+	template <typename TKey, typename TData, typename THash, typename TKeyEquality>
+	inline float HashMap<TKey, TData, THash, TKeyEquality>::MaxLoadFactor() const
 	{
-		return static_cast<float>(_bucketsInUse) / _buckets.Size();
+		return _maxLoadFactor;
 	}
 
-	template<typename TKey, typename TData>
-	inline bool HashMap<TKey, TData>::ContainsKey(const TKey& key) const
+	template <typename TKey, typename TData, typename THash, typename TKeyEquality>
+	inline void HashMap<TKey, TData, THash, TKeyEquality>::SetMaxLoadFactor(float maxLoadFactor)
+	{
+		if (maxLoadFactor <= 0.0f || maxLoadFactor <= _minLoadFactor * 2.0f)
+		{
+			throw std::runtime_error("Maximum load factor must be positive and more than twice the minimum load factor");
+		}
+		_maxLoadFactor = maxLoadFactor;
+		Reserve(_numElements);
+	}
+
+	template <typename TKey, typename TData, typename THash, typename TKeyEquality>
+	inline float HashMap<TKey, TData, THash, TKeyEquality>::MinLoadFactor() const
+	{
+		return _minLoadFactor;
+	}
+
+	template <typename TKey, typename TData, typename THash, typename TKeyEquality>
+	inline void HashMap<TKey, TData, THash, TKeyEquality>::SetMinLoadFactor(float minLoadFactor)
+	{
+		// Growing halves the load factor, so the minimum must stay below half the maximum to avoid thrashing
+		if (minLoadFactor < 0.0f || minLoadFactor * 2.0f >= _maxLoadFactor)
+		{
+			throw std::runtime_error("Minimum load factor must not be negative and must be less than half the maximum load factor");
+		}
+		_minLoadFactor = minLoadFactor;
+		_isSparse = _isSparse && _numElements < _minLoadFactor * _buckets.Size();
+	}
+
+	template <typename TKey, typename TData, typename THash, typename TKeyEquality>
+	inline void HashMap<TKey, TData, THash, TKeyEquality>::Reserve(std::size_t elementCount)
+	{
+		const std::size_t bucketCount = _BucketCountFor(elementCount);
+		if (bucketCount > _buckets.Size())
+		{
+			Resize(bucketCount);
+		}
+	}
+
+	template <typename TKey, typename TData, typename THash, typename TKeyEquality>
+	inline void HashMap<TKey, TData, THash, TKeyEquality>::ShrinkToFit()
+	{
+		const std::size_t bucketCount = std::max(_BucketCountFor(_numElements * 2), _minimumBucketCount);
+		if (bucketCount < _buckets.Size())
+		{
+			Resize(bucketCount);
+		}
+	}
+
+	template <typename TKey, typename TData, typename THash, typename TKeyEquality>
+	inline bool HashMap<TKey, TData, THash, TKeyEquality>::ContainsKey(const LookupType& key) const
 	{
 		return Find(key) != end();
 	}
 
-	template<typename TKey, typename TData>
-	inline TData& HashMap<TKey, TData>::At(const TKey& key)
+	template <typename TKey, typename TData, typename THash, typename TKeyEquality>
+	inline TData& HashMap<TKey, TData, THash, TKeyEquality>::At(const LookupType& key)
 	{
 		iterator it = Find(key);
 		if (it == end())
@@ -148,8 +286,8 @@ namespace FieaGameEngine
 		return it->second;
 	}
 
-	template<typename TKey, typename TData>
-	inline const TData& HashMap<TKey, TData>::At(const TKey& key) const
+	template <typename TKey, typename TData, typename THash, typename TKeyEquality>
+	inline const TData& HashMap<TKey, TData, THash, TKeyEquality>::At(const LookupType& key) const
 	{
 		const_iterator it = Find(key);
 		if (it == end())
@@ -159,24 +297,52 @@ namespace FieaGameEngine
 		return it->second;
 	}
 
-	template<typename TKey, typename TData>
-	inline void HashMap<TKey, TData>::Resize(size_t bucketCount)
+	template <typename TKey, typename TData, typename THash, typename TKeyEquality>
+	inline void HashMap<TKey, TData, THash, TKeyEquality>::Resize(size_t bucketCount)
 	{
-		if (bucketCount < _buckets.Size())
+		if (bucketCount == 0)
 		{
-			throw std::runtime_error("New bucket count must be greater than current bucket count");
+			throw std::runtime_error("Bucket count must be greater than 0");
 		}
-		Vector<SList<PairType>> newBuckets(bucketCount);
-		newBuckets.Resize(bucketCount);
-		for (auto& pair : *this)
+		Vector<SList<PairType>> newBuckets = _MakeBuckets(GetAllocator(), bucketCount);
+		// Relink nodes instead of moving pairs so their addresses do not change
+		for (SList<PairType>& chain : _buckets)
 		{
-			newBuckets[_hash(pair.first) % bucketCount].PushBack(std::move(pair));
+			while (!chain.IsEmpty())
+			{
+				newBuckets[_hash(chain.Front().first) % bucketCount].SpliceFrontToBack(chain);
+			}
 		}
 		_buckets = std::move(newBuckets);
+		_isSparse = false;
+	}
+
+	template <typename TKey, typename TData, typename THash, typename TKeyEquality>
+	inline std::size_t HashMap<TKey, TData, THash, TKeyEquality>::_BucketCountFor(std::size_t elementCount) const
+	{
+		const std::size_t bucketCount = static_cast<std::size_t>(std::ceil(elementCount / _maxLoadFactor));
+		return std::max(bucketCount, std::size_t(1)) | 1;
 	}
 
-	template<typename TKey, typename TData>
-	inline typename HashMap<TKey, TData>::iterator HashMap<TKey, TData>::begin()
+	template <typename TKey, typename TData, typename THash, typename TKeyEquality>
+	inline bool HashMap<TKey, TData, THash, TKeyEquality>::_Rehash(std::size_t elementCount)
+	{
+		if (elementCount > _maxLoadFactor * _buckets.Size())
+		{
+			Resize(std::max(_BucketCountFor(elementCount), _buckets.Size() * 2 + 1));
+			return true;
+		}
+		if (_isSparse && elementCount < _minLoadFactor * _buckets.Size())
+		{
+			// Shrink to half the maximum load factor so the next few inserts do not grow again
+			Resize(std::max(_BucketCountFor(elementCount * 2), _minimumBucketCount));
+			return true;
+		}
+		return false;
+	}
+
+	template <typename TKey, typename TData, typename THash, typename TKeyEquality>
+	inline typename HashMap<TKey, TData, THash, TKeyEquality>::iterator HashMap<TKey, TData, THash, TKeyEquality>::begin()
 	{
 		typename Vector<SList<PairType>>::iterator beg = _buckets.begin();
 		SList<PairType>& firstChain = *beg;
@@ -189,8 +355,8 @@ namespace FieaGameEngine
 		return it;
 	}
 
-	template<typename TKey, typename TData>
-	inline typename HashMap<TKey, TData>::const_iterator HashMap<TKey, TData>::begin() const
+	template <typename TKey, typename TData, typename THash, typename TKeyEquality>
+	inline typename HashMap<TKey, TData, THash, TKeyEquality>::const_iterator HashMap<TKey, TData, THash, TKeyEquality>::begin() const
 	{
 		const typename Vector<SList<PairType>>::const_iterator beg = _buckets.begin();
 		const SList<PairType>& firstChain = *beg;
@@ -203,20 +369,20 @@ namespace FieaGameEngine
 		return it;
 	}
 
-	template<typename TKey, typename TData>
-	inline typename HashMap<TKey, TData>::iterator HashMap<TKey, TData>::end()
+	template <typename TKey, typename TData, typename THash, typename TKeyEquality>
+	inline typename HashMap<TKey, TData, THash, TKeyEquality>::iterator HashMap<TKey, TData, THash, TKeyEquality>::end()
 	{
 		return iterator(*this, _buckets.end(), typename SList<PairType>::iterator{});
 	}
 
-	template<typename TKey, typename TData>
-	inline typename HashMap<TKey, TData>::const_iterator HashMap<TKey, TData>::end() const
+	template <typename TKey, typename TData, typename THash, typename TKeyEquality>
+	inline typename HashMap<TKey, TData, THash, TKeyEquality>::const_iterator HashMap<TKey, TData, THash, TKeyEquality>::end() const
 	{
 		return const_iterator(*this, _buckets.end(), typename SList<PairType>::const_iterator{});
 	}
 
-	template<typename TKey, typename TData>
-	inline typename HashMap<TKey, TData>::const_iterator HashMap<TKey, TData>::cbegin()
+	template <typename TKey, typename TData, typename THash, typename TKeyEquality>
+	inline typename HashMap<TKey, TData, THash, TKeyEquality>::const_iterator HashMap<TKey, TData, THash, TKeyEquality>::cbegin()
 	{
 		const typename Vector<SList<PairType>>::const_iterator beg = _buckets.begin();
 		const SList<PairType>& firstChain = *beg;
@@ -229,14 +395,14 @@ namespace FieaGameEngine
 		return it;
 	}
 
-	template<typename TKey, typename TData>
-	inline typename HashMap<TKey, TData>::const_iterator HashMap<TKey, TData>::cend()
+	template <typename TKey, typename TData, typename THash, typename TKeyEquality>
+	inline typename HashMap<TKey, TData, THash, TKeyEquality>::const_iterator HashMap<TKey, TData, THash, TKeyEquality>::cend()
 	{
 		return const_iterator(*this, _buckets.end(), typename SList<PairType>::const_iterator{});
 	}
 
-	template<typename TKey, typename TData>
-	inline typename HashMap<TKey, TData>::iterator HashMap<TKey, TData>::_Find(const TKey& key, size_t& index)
+	template <typename TKey, typename TData, typename THash, typename TKeyEquality>
+	inline typename HashMap<TKey, TData, THash, TKeyEquality>::iterator HashMap<TKey, TData, THash, TKeyEquality>::_Find(const LookupType& key, size_t& index)
 	{
 		if (_buckets.size() == 0)
 		{
@@ -244,55 +410,57 @@ namespace FieaGameEngine
 		}
 		index = _hash(key) % _buckets.Size();
 		SList<PairType>& chain = _buckets[index];
-		typename SList<PairType>::iterator it = chain.Find(
-			std::pair(key, TData{}),
-			[this](const PairType& lhs, const PairType& rhs) { return this->_keyEquality(lhs.first, rhs.first); });
-		if (it == chain.end())
+		// Compare against the stored keys directly so looking up does not construct a key or value
+		for (typename SList<PairType>::iterator it = chain.begin(); it != chain.end(); ++it)
 		{
-			// Key does not exist
-			return end();
+			if (_keyEquality(it->first, key))
+			{
+				// Key found
+				return iterator(*this, _buckets.begin() + index, it);
+			}
 		}
-		// Key found
-		return iterator(*this, _buckets.begin() + index, it);
+		// Key does not exist
+		return end();
 	}
 
-	template<typename TKey, typename TData>
-	inline typename HashMap<TKey, TData>::const_iterator HashMap<TKey, TData>::_Find(const TKey& key, size_t& index) const
+	template <typename TKey, typename TData, typename THash, typename TKeyEquality>
+	inline typename HashMap<TKey, TData, THash, TKeyEquality>::const_iterator HashMap<TKey, TData, THash, TKeyEquality>::_Find(const LookupType& key, size_t& index) const
 	{
 		index = _hash(key) % _buckets.Size();
 		const SList<PairType>& chain = _buckets[index];
-		typename SList<PairType>::const_iterator it = chain.Find(
-			std::pair(key, TData{}),
-			[this](const PairType& lhs, const PairType& rhs) { return this->_keyEquality(lhs.first, rhs.first); });
-		if (it == chain.end())
+		for (typename SList<PairType>::const_iterator it = chain.begin(); it != chain.end(); ++it)
 		{
-			// Key does not exist
-			return end();
+			if (_keyEquality(it->first, key))
+			{
+				return const_iterator(*this, _buckets.begin() + index, it);
+			}
 		}
-		return const_iterator(*this, _buckets.begin() + index, it);
+		// Key does not exist
+		return end();
 	}
 #pragma endregion HashMap
 
 #pragma region const_iterator
-	template<typename TKey, typename TData>
-	inline HashMap<TKey, TData>::const_iterator::const_iterator(const iterator& other) :
+	template <typename TKey, typename TData, typename THash, typename TKeyEquality>
+	inline HashMap<TKey, TData, THash, TKeyEquality>::const_iterator::const_iterator(const iterator& other) :
 		_container(other._container),
 		_containerIterator(other._containerIterator),
 		_chainIterator(other._chainIterator)
 	{
 	}
 
-	template <typename TKey, typename TData>
-	inline HashMap<TKey, TData>::const_iterator::const_iterator(const HashMap& _container, Vector<SList<value_type>>::const_iterator _containerIterator, SList<value_type>::const_iterator _chainIterator) :
+	template <typename TKey, typename TData, typename THash, typename TKeyEquality>
+	inline HashMap<TKey, TData, THash, TKeyEquality>::const_iterator::const_iterator(const HashMap& _container, Vector<SList<value_type>>::const_iterator _containerIterator, SList<value_type>::const_iterator _chainIterator) :
 		_container(&_container),
 		_containerIterator(_containerIterator),
 		_chainIterator(_chainIterator)
 	{
 	}
 
-	template<typename TKey, typename TData>
-	inline typename HashMap<TKey, TData>::const_reference HashMap<TKey, TData>::const_iterator::operator*() const
+	template <typename TKey, typename TData, typename THash, typename TKeyEquality>
+	inline typename HashMap<TKey, TData, THash, TKeyEquality>::const_reference HashMap<TKey, TData, THash, TKeyEquality>::const_iterator::operator*() const
 	{
+#if FIEA_CHECKED_ITERATORS
 		if (_container == nullptr)
 		{
 			throw std::runtime_error("Iterator is not associated with a container");
@@ -302,24 +470,27 @@ namespace FieaGameEngine
 		{
 			throw std::runtime_error("Iterator does not point to an element in the container");
 		}
+#endif
 
 		return *_chainIterator;
 
 	}
 
-	template<typename TKey, typename TData>
-	inline const typename HashMap<TKey, TData>::const_iterator::value_type* HashMap<TKey, TData>::const_iterator::operator->() const
+	template <typename TKey, typename TData, typename THash, typename TKeyEquality>
+	inline const typename HashMap<TKey, TData, THash, TKeyEquality>::const_iterator::value_type* HashMap<TKey, TData, THash, TKeyEquality>::const_iterator::operator->() const
 	{
 		return &operator*();
 	}
 
-	template<typename TKey, typename TData>
-	inline typename HashMap<TKey, TData>::const_iterator& HashMap<TKey, TData>::const_iterator::operator++()
+	template <typename TKey, typename TData, typename THash, typename TKeyEquality>
+	inline typename HashMap<TKey, TData, THash, TKeyEquality>::const_iterator& HashMap<TKey, TData, THash, TKeyEquality>::const_iterator::operator++()
 	{
+#if FIEA_CHECKED_ITERATORS
 		if (_container == nullptr)
 		{
 			throw std::runtime_error("Iterator is not associated with a container");
 		}
+#endif
 
 		auto end = _container->_buckets.end();
 
@@ -359,22 +530,22 @@ namespace FieaGameEngine
 		return *this;
 	}
 
-	template<typename TKey, typename TData>
-	inline typename HashMap<TKey, TData>::const_iterator HashMap<TKey, TData>::const_iterator::operator++(int)
+	template <typename TKey, typename TData, typename THash, typename TKeyEquality>
+	inline typename HashMap<TKey, TData, THash, TKeyEquality>::const_iterator HashMap<TKey, TData, THash, TKeyEquality>::const_iterator::operator++(int)
 	{
 		const_iterator it = *this;
 		operator++();
 		return it;
 	}
 
-	template<typename TKey, typename TData>
-	inline bool HashMap<TKey, TData>::const_iterator::operator==(const const_iterator& other) const
+	template <typename TKey, typename TData, typename THash, typename TKeyEquality>
+	inline bool HashMap<TKey, TData, THash, TKeyEquality>::const_iterator::operator==(const const_iterator& other) const
 	{
 		return !operator!=(other);
 	}
 
-	template<typename TKey, typename TData>
-	bool HashMap<TKey, TData>::const_iterator::operator!=(const const_iterator& other) const
+	template <typename TKey, typename TData, typename THash, typename TKeyEquality>
+	bool HashMap<TKey, TData, THash, TKeyEquality>::const_iterator::operator!=(const const_iterator& other) const
 	{
 		if (_container != other._container)
 		{
@@ -398,17 +569,18 @@ namespace FieaGameEngine
 #pragma endregion const_iterator
 
 #pragma region iterator
-	template <typename TKey, typename TData>
-	inline HashMap<TKey, TData>::iterator::iterator(HashMap& _container, Vector<SList<value_type>>::iterator _containerIterator, SList<value_type>::iterator _chainIterator) :
+	template <typename TKey, typename TData, typename THash, typename TKeyEquality>
+	inline HashMap<TKey, TData, THash, TKeyEquality>::iterator::iterator(HashMap& _container, Vector<SList<value_type>>::iterator _containerIterator, SList<value_type>::iterator _chainIterator) :
 		_container(&_container),
 		_containerIterator(_containerIterator),
 		_chainIterator(_chainIterator)
 	{
 	}
 
-	template<typename TKey, typename TData>
-	inline typename HashMap<TKey, TData>::reference HashMap<TKey, TData>::iterator::operator*() const
+	template <typename TKey, typename TData, typename THash, typename TKeyEquality>
+	inline typename HashMap<TKey, TData, THash, TKeyEquality>::reference HashMap<TKey, TData, THash, TKeyEquality>::iterator::operator*() const
 	{
+#if FIEA_CHECKED_ITERATORS
 		if (_container == nullptr)
 		{
 			throw std::runtime_error("Iterator is not associated with a container");
@@ -418,24 +590,27 @@ namespace FieaGameEngine
 		{
 			throw std::runtime_error("Iterator does not point to an element in the container");
 		}
+#endif
 
 		return *_chainIterator;
 
 	}
 
-	template<typename TKey, typename TData>
-	inline typename HashMap<TKey, TData>::pointer HashMap<TKey, TData>::iterator::operator->() const
+	template <typename TKey, typename TData, typename THash, typename TKeyEquality>
+	inline typename HashMap<TKey, TData, THash, TKeyEquality>::pointer HashMap<TKey, TData, THash, TKeyEquality>::iterator::operator->() const
 	{
 		return &operator*();
 	}
 
-	template<typename TKey, typename TData>
-	inline typename HashMap<TKey, TData>::iterator& HashMap<TKey, TData>::iterator::operator++()
+	template <typename TKey, typename TData, typename THash, typename TKeyEquality>
+	inline typename HashMap<TKey, TData, THash, TKeyEquality>::iterator& HashMap<TKey, TData, THash, TKeyEquality>::iterator::operator++()
 	{
+#if FIEA_CHECKED_ITERATORS
 		if (_container == nullptr)
 		{
 			throw std::runtime_error("Iterator is not associated with a container");
 		}
+#endif
 
 		auto end = _container->_buckets.end();
 
@@ -475,22 +650,22 @@ namespace FieaGameEngine
 		return *this;
 	}
 
-	template<typename TKey, typename TData>
-	inline typename HashMap<TKey, TData>::iterator HashMap<TKey, TData>::iterator::operator++(int)
+	template <typename TKey, typename TData, typename THash, typename TKeyEquality>
+	inline typename HashMap<TKey, TData, THash, TKeyEquality>::iterator HashMap<TKey, TData, THash, TKeyEquality>::iterator::operator++(int)
 	{
 		iterator it = *this;
 		operator++();
 		return it;
 	}
 
-	template<typename TKey, typename TData>
-	inline bool HashMap<TKey, TData>::iterator::operator==(const iterator& other) const
+	template <typename TKey, typename TData, typename THash, typename TKeyEquality>
+	inline bool HashMap<TKey, TData, THash, TKeyEquality>::iterator::operator==(const iterator& other) const
 	{
 		return !operator!=(other);
 	}
 
-	template<typename TKey, typename TData>
-	bool HashMap<TKey, TData>::iterator::operator!=(const iterator& other) const
+	template <typename TKey, typename TData, typename THash, typename TKeyEquality>
+	bool HashMap<TKey, TData, THash, TKeyEquality>::iterator::operator!=(const iterator& other) const
 	{
 		if (_container != other._container)
 		{
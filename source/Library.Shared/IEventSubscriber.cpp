@@ -0,0 +1,35 @@
+#include "pch.h"
+#include "IEventSubscriber.h"
+
+namespace FieaGameEngine
+{
+	IEventSubscriber::IEventSubscriber() :
+		_subscription(*this)
+	{
+	}
+
+	IEventSubscriber::IEventSubscriber(const IEventSubscriber&) :
+		_subscription(*this)
+	{
+	}
+
+	IEventSubscriber::IEventSubscriber(IEventSubscriber&&) noexcept :
+		_subscription(*this)
+	{
+	}
+
+	IEventSubscriber& IEventSubscriber::operator=(const IEventSubscriber&)
+	{
+		return *this;
+	}
+
+	IEventSubscriber& IEventSubscriber::operator=(IEventSubscriber&&) noexcept
+	{
+		return *this;
+	}
+
+	IEventSubscriber::Subscription::Subscription(IEventSubscriber& subscriber) :
+		Subscriber(&subscriber)
+	{
+	}
+}
@@ -1,13 +1,52 @@
 #pragma once
 
+#include <memory>
 #include "Event.h"
+#include "IntrusiveList.h"
 
 namespace FieaGameEngine
 {
 	class IEventSubscriber
 	{
+		friend class EventPublisher;
+
 	public:
+		IEventSubscriber();
+
+		/// <summary>
+		/// Copies are not subscribed to anything; subscriptions belong to the subscriber that made them
+		/// </summary>
+		IEventSubscriber(const IEventSubscriber& rhs);
+		IEventSubscriber(IEventSubscriber&& rhs) noexcept;
+
+		/// <summary>
+		/// Assigning keeps the subscriptions of the destination
+		/// </summary>
+		IEventSubscriber& operator=(const IEventSubscriber& rhs);
+		IEventSubscriber& operator=(IEventSubscriber&& rhs) noexcept;
+
+		/// <summary>
+		/// Destroying a subscriber unsubscribes it from every event it is subscribed to
+		/// </summary>
 		virtual ~IEventSubscriber() = default;
+
 		virtual void Notify(const EventBase& e) noexcept = 0;
+
+	private:
+		/// <summary>
+		/// One subscription to one event type, linked into the publisher's list for that type
+		/// </summary>
+		struct Subscription final : IntrusiveListHook<>
+		{
+			explicit Subscription(IEventSubscriber& subscriber);
+
+			IEventSubscriber* Subscriber;
+			RTTI::IdType EventType = 0;
+			// Further subscriptions of the same subscriber
+			std::unique_ptr<Subscription> Next;
+		};
+
+		// Subscribers usually subscribe to one event, so the first subscription is stored inline and costs no allocation
+		Subscription _subscription;
 	};
 }
@@ -0,0 +1,380 @@
+#pragma once
+
+#include <cstddef>
+#include <iterator>
+#include <concepts>
+#include "CheckedIterators.h"
+
+namespace FieaGameEngine
+{
+	template <typename T, typename TTag>
+	class IntrusiveList;
+
+	/// <summary>
+	/// Links an object into an IntrusiveList. Objects derive from the hook, once per tag for each list they can be in at the same time.
+	/// A hook unlinks itself when destroyed, so objects leave their list without the list being told.
+	/// Copies and moves start out unlinked, and assigning leaves the destination in the list it was in.
+	/// </summary>
+	/// <typeparam name="TTag">Distinguishes hooks when an object derives from several</typeparam>
+	template <typename TTag = void>
+	class IntrusiveListHook
+	{
+		template <typename T, typename TListTag>
+		friend class IntrusiveList;
+
+	public:
+		IntrusiveListHook() = default;
+		IntrusiveListHook(const IntrusiveListHook&) noexcept;
+		IntrusiveListHook& operator=(const IntrusiveListHook&) noexcept;
+		~IntrusiveListHook();
+
+		/// <summary>
+		/// Gets whether the hook is in a list
+		/// </summary>
+		/// <returns>True if linked; otherwise false</returns>
+		[[nodiscard]] bool IsLinked() const;
+
+		/// <summary>
+		/// Removes the hook from its list in constant time. Does nothing if it is not linked
+		/// </summary>
+		void Unlink();
+
+	private:
+		IntrusiveListHook* _next = nullptr;
+		IntrusiveListHook* _previous = nullptr;
+	};
+
+	/// <summary>
+	/// Doubly linked list of objects that carry their own links. The list never allocates and does not own its elements:
+	/// pushing links an existing object, and removing or destroying the object unlinks it in constant time.
+	/// An object is in at most one list per hook. Elements only need to outlive their membership.
+	/// </summary>
+	/// <typeparam name="T">Element type, derived from IntrusiveListHook&lt;TTag&gt;</typeparam>
+	/// <typeparam name="TTag">Tag of the hook this list links through</typeparam>
+	template <typename T, typename TTag = void>
+	class IntrusiveList final
+	{
+		static_assert(std::derived_from<T, IntrusiveListHook<TTag>>, "Elements must derive from IntrusiveListHook<TTag>");
+
+		using Hook = IntrusiveListHook<TTag>;
+
+	public:
+		using size_type = std::size_t;
+		using value_type = T;
+		using reference = value_type&;
+		using const_reference = const value_type&;
+		using pointer = value_type*;
+		using const_pointer = const value_type*;
+
+		class iterator;
+
+		/// <summary>
+		/// Iterator that when dereferenced returns a const version of a value in the container
+		/// </summary>
+		class const_iterator final
+		{
+			friend IntrusiveList;
+
+		public:
+			using iterator_category = std::bidirectional_iterator_tag;
+			using difference_type = std::ptrdiff_t;
+			using value_type = value_type;
+			using pointer = const value_type*;
+			using reference = const value_type&;
+
+			const_iterator() = default;
+
+			/// <summary>
+			/// Creates a constant iterator from a non-const iterator
+			/// </summary>
+			/// <param name="other">iterator to turn into a const_iterator</param>
+			const_iterator(const iterator& other);
+
+			/// <summary>
+			/// Gets the value in the container pointed to by this iterator
+			/// </summary>
+			/// <exception cref="runtime_error">With checked iterators, if the iterator does not point to an element in the container</exception>
+			/// <returns>value in the container</returns>
+			[[nodiscard]] const_reference operator*() const;
+
+			/// <summary>
+			/// Gets the value in the container pointed to by this iterator
+			/// </summary>
+			/// <exception cref="runtime_error">With checked iterators, if the iterator does not point to an element in the container</exception>
+			/// <returns>value in the container</returns>
+			[[nodiscard]] const_pointer operator->() const;
+
+			/// <summary>
+			/// Moves the iterator to the next element in the container
+			/// </summary>
+			/// <returns>Reference to the incremented iterator</returns>
+			const_iterator& operator++();
+
+			/// <summary>
+			/// Moves the iterator to the next element in the container
+			/// </summary>
+			/// <returns>Iterator before it is incremented</returns>
+			const_iterator operator++(int);
+
+			/// <summary>
+			/// Moves the iterator to the previous element in the container
+			/// </summary>
+			/// <returns>Reference to the decremented iterator</returns>
+			const_iterator& operator--();
+
+			/// <summary>
+			/// Moves the iterator to the previous element in the container
+			/// </summary>
+			/// <returns>Iterator before it is decremented</returns>
+			const_iterator operator--(int);
+
+			/// <summary>
+			/// Compares iterators. Iterators are equal if they point to the same element
+			/// </summary>
+			/// <param name="other">Iterator to compare against</param>
+			/// <returns>Whether the iterators are equal</returns>
+			[[nodiscard]] bool operator==(const const_iterator& other) const;
+
+		private:
+			const_iterator(const IntrusiveList& container, const Hook* hook);
+
+			const Hook* _hook = nullptr;
+#if FIEA_CHECKED_ITERATORS
+			const IntrusiveList* _container = nullptr;
+#endif
+		};
+
+		/// <summary>
+		/// Iterator that when dereferenced returns a non-const version of a value in the container
+		/// </summary>
+		class iterator final
+		{
+			friend IntrusiveList;
+			friend const_iterator;
+
+		public:
+			using iterator_category = std::bidirectional_iterator_tag;
+			using difference_type = std::ptrdiff_t;
+			using value_type = value_type;
+			using pointer = value_type*;
+			using reference = value_type&;
+
+			iterator() = default;
+
+			/// <summary>
+			/// Gets the value in the container pointed to by this iterator
+			/// </summary>
+			/// <exception cref="runtime_error">With checked iterators, if the iterator does not point to an element in the container</exception>
+			/// <returns>value in the container</returns>
+			[[nodiscard]] reference operator*() const;
+
+			/// <summary>
+			/// Gets the value in the container pointed to by this iterator
+			/// </summary>
+			/// <exception cref="runtime_error">With checked iterators, if the iterator does not point to an element in the container</exception>
+			/// <returns>value in the container</returns>
+			[[nodiscard]] pointer operator->() const;
+
+			/// <summary>
+			/// Moves the iterator to the next element in the container
+			/// </summary>
+			/// <returns>Reference to the incremented iterator</returns>
+			iterator& operator++();
+
+			/// <summary>
+			/// Moves the iterator to the next element in the container
+			/// </summary>
+			/// <returns>Iterator before it is incremented</returns>
+			iterator operator++(int);
+
+			/// <summary>
+			/// Moves the iterator to the previous element in the container
+			/// </summary>
+			/// <returns>Reference to the decremented iterator</returns>
+			iterator& operator--();
+
+			/// <summary>
+			/// Moves the iterator to the previous element in the container
+			/// </summary>
+			/// <returns>Iterator before it is decremented</returns>
+			iterator operator--(int);
+
+			/// <summary>
+			/// Compares iterators. Iterators are equal if they point to the same element
+			/// </summary>
+			/// <param name="other">Iterator to compare against</param>
+			/// <returns>Whether the iterators are equal</returns>
+			[[nodiscard]] bool operator==(const iterator& other) const;
+
+		private:
+			iterator(const IntrusiveList& container, Hook* hook);
+
+			Hook* _hook = nullptr;
+#if FIEA_CHECKED_ITERATORS
+			const IntrusiveList* _container = nullptr;
+#endif
+		};
+
+		/// <summary>
+		/// Creates an empty list
+		/// </summary>
+		IntrusiveList();
+
+		/// <summary>
+		/// Elements can only be in one list per hook, so lists cannot be copied
+		/// </summary>
+		IntrusiveList(const IntrusiveList&) = delete;
+		IntrusiveList& operator=(const IntrusiveList&) = delete;
+
+		/// <summary>
+		/// Move constructor. Takes over the elements of rhs, which is left empty
+		/// </summary>
+		IntrusiveList(IntrusiveList&& rhs) noexcept;
+
+		/// <summary>
+		/// Move assignment. Unlinks the current elements and takes over the elements of rhs, which is left empty
+		/// </summary>
+		IntrusiveList& operator=(IntrusiveList&& rhs) noexcept;
+
+		/// <summary>
+		/// Unlinks every element. The elements themselves are not destroyed
+		/// </summary>
+		~IntrusiveList();
+
+		/// <summary>
+		/// Gets an iterator pointing to the first element in the container
+		/// </summary>
+		/// <returns>iterator at the beginning of the container</returns>
+		[[nodiscard]] iterator begin();
+
+		/// <summary>
+		/// Gets a const_iterator pointing to the first element in the container
+		/// </summary>
+		/// <returns>const_iterator at the beginning of the container</returns>
+		[[nodiscard]] const_iterator begin() const;
+
+		/// <summary>
+		/// Gets an iterator pointing to one past the last element in the container
+		/// </summary>
+		/// <returns>iterator at the end of the container</returns>
+		[[nodiscard]] iterator end();
+
+		/// <summary>
+		/// Gets a const_iterator pointing to one past the last element in the container
+		/// </summary>
+		/// <returns>const_iterator at the end of the container</returns>
+		[[nodiscard]] const_iterator end() const;
+
+		/// <summary>
+		/// Gets a const_iterator pointing to the first element in the container
+		/// </summary>
+		/// <returns>const_iterator at the beginning of the container</returns>
+		[[nodiscard]] const_iterator cbegin() const;
+
+		/// <summary>
+		/// Gets a const_iterator pointing to one past the last element in the container
+		/// </summary>
+		/// <returns>const_iterator at the end of the container</returns>
+		[[nodiscard]] const_iterator cend() const;
+
+		/// <summary>
+		/// Links an element at the front of the list
+		/// </summary>
+		/// <param name="element">Element to link</param>
+		/// <exception cref="runtime_error">Element is already in a list through this hook</exception>
+		/// <returns>Iterator to the element</returns>
+		iterator PushFront(reference element);
+
+		/// <summary>
+		/// Links an element at the back of the list
+		/// </summary>
+		/// <param name="element">Element to link</param>
+		/// <exception cref="runtime_error">Element is already in a list through this hook</exception>
+		/// <returns>Iterator to the element</returns>
+		iterator PushBack(reference element);
+
+		/// <summary>
+		/// Links an element before the element an iterator points to
+		/// </summary>
+		/// <param name="position">Element to insert before; end() appends</param>
+		/// <param name="element">Element to link</param>
+		/// <exception cref="runtime_error">Element is already in a list through this hook, or with checked iterators, the iterator is not from this list</exception>
+		/// <returns>Iterator to the element</returns>
+		iterator InsertBefore(const iterator& position, reference element);
+
+		/// <summary>
+		/// Unlinks the front element
+		/// </summary>
+		/// <exception cref="runtime_error">List is empty</exception>
+		void PopFront();
+
+		/// <summary>
+		/// Unlinks the back element
+		/// </summary>
+		/// <exception cref="runtime_error">List is empty</exception>
+		void PopBack();
+
+		/// <summary>
+		/// Unlinks an element in constant time. The element must be in this list or in no list
+		/// </summary>
+		/// <param name="element">Element to unlink</param>
+		/// <returns>True if the element was linked; otherwise false</returns>
+		bool Remove(reference element);
+
+		/// <summary>
+		/// Gets the element at the front of the list
+		/// </summary>
+		/// <exception cref="runtime_error">List is empty</exception>
+		/// <returns>Front element</returns>
+		[[nodiscard]] reference Front();
+
+		/// <summary>
+		/// Gets the element at the front of the list
+		/// </summary>
+		/// <exception cref="runtime_error">List is empty</exception>
+		/// <returns>Front element</returns>
+		[[nodiscard]] const_reference Front() const;
+
+		/// <summary>
+		/// Gets the element at the back of the list
+		/// </summary>
+		/// <exception cref="runtime_error">List is empty</exception>
+		/// <returns>Back element</returns>
+		[[nodiscard]] reference Back();
+
+		/// <summary>
+		/// Gets the element at the back of the list
+		/// </summary>
+		/// <exception cref="runtime_error">List is empty</exception>
+		/// <returns>Back element</returns>
+		[[nodiscard]] const_reference Back() const;
+
+		/// <summary>
+		/// Returns if the list is empty
+		/// </summary>
+		/// <returns>True if the list is empty; otherwise false</returns>
+		[[nodiscard]] bool IsEmpty() const;
+
+		/// <summary>
+		/// Counts the elements. Elements can unlink themselves, so the list does not keep a count and this walks the list
+		/// </summary>
+		/// <returns>Number of elements</returns>
+		[[nodiscard]] size_type Size() const;
+
+		/// <summary>
+		/// Unlinks every element. The elements themselves are not destroyed
+		/// </summary>
+		void Clear();
+
+	private:
+		// Links a hook that is in no list between two neighbours
+		static void _Link(Hook& hook, Hook& previous, Hook& next);
+		// Points the sentinel's neighbours back at it after the sentinel moved
+		void _AdoptLinks(IntrusiveList& rhs);
+
+		// Circular sentinel: its next is the front and its previous is the back
+		Hook _head;
+	};
+}
+
+#include "IntrusiveList.inl"
@@ -0,0 +1,439 @@
+#include "IntrusiveList.h"
+#include <stdexcept>
+
+namespace FieaGameEngine
+{
+#pragma region IntrusiveListHook
+	template <typename TTag>
+	inline IntrusiveListHook<TTag>::IntrusiveListHook(const IntrusiveListHook&) noexcept
+	{
+	}
+
+	template <typename TTag>
+	inline IntrusiveListHook<TTag>& IntrusiveListHook<TTag>::operator=(const IntrusiveListHook&) noexcept
+	{
+		return *this;
+	}
+
+	template <typename TTag>
+	inline IntrusiveListHook<TTag>::~IntrusiveListHook()
+	{
+		Unlink();
+	}
+
+	template <typename TTag>
+	inline bool IntrusiveListHook<TTag>::IsLinked() const
+	{
+		return _next != nullptr;
+	}
+
+	template <typename TTag>
+	inline void IntrusiveListHook<TTag>::Unlink()
+	{
+		if (_next != nullptr)
+		{
+			_next->_previous = _previous;
+			_previous->_next = _next;
+			_next = nullptr;
+			_previous = nullptr;
+		}
+	}
+#pragma endregion IntrusiveListHook
+
+#pragma region IntrusiveList
+	template <typename T, typename TTag>
+	inline IntrusiveList<T, TTag>::IntrusiveList()
+	{
+		_head._next = &_head;
+		_head._previous = &_head;
+	}
+
+	template <typename T, typename TTag>
+	inline IntrusiveList<T, TTag>::IntrusiveList(IntrusiveList&& rhs) noexcept :
+		IntrusiveList()
+	{
+		_AdoptLinks(rhs);
+	}
+
+	template <typename T, typename TTag>
+	inline IntrusiveList<T, TTag>& IntrusiveList<T, TTag>::operator=(IntrusiveList&& rhs) noexcept
+	{
+		if (this != &rhs)
+		{
+			Clear();
+			_AdoptLinks(rhs);
+		}
+		return *this;
+	}
+
+	template <typename T, typename TTag>
+	inline IntrusiveList<T, TTag>::~IntrusiveList()
+	{
+		Clear();
+		// The sentinel links to itself, which its own destructor would otherwise try to unlink
+		_head._next = nullptr;
+		_head._previous = nullptr;
+	}
+
+	template <typename T, typename TTag>
+	inline typename IntrusiveList<T, TTag>::iterator IntrusiveList<T, TTag>::begin()
+	{
+		return iterator(*this, _head._next);
+	}
+
+	template <typename T, typename TTag>
+	inline typename IntrusiveList<T, TTag>::const_iterator IntrusiveList<T, TTag>::begin() const
+	{
+		return const_iterator(*this, _head._next);
+	}
+
+	template <typename T, typename TTag>
+	inline typename IntrusiveList<T, TTag>::iterator IntrusiveList<T, TTag>::end()
+	{
+		return iterator(*this, &_head);
+	}
+
+	template <typename T, typename TTag>
+	inline typename IntrusiveList<T, TTag>::const_iterator IntrusiveList<T, TTag>::end() const
+	{
+		return const_iterator(*this, &_head);
+	}
+
+	template <typename T, typename TTag>
+	inline typename IntrusiveList<T, TTag>::const_iterator IntrusiveList<T, TTag>::cbegin() const
+	{
+		return begin();
+	}
+
+	template <typename T, typename TTag>
+	inline typename IntrusiveList<T, TTag>::const_iterator IntrusiveList<T, TTag>::cend() const
+	{
+		return end();
+	}
+
+	template <typename T, typename TTag>
+	inline typename IntrusiveList<T, TTag>::iterator IntrusiveList<T, TTag>::PushFront(reference element)
+	{
+		Hook& hook = element;
+		_Link(hook, _head, *_head._next);
+		return iterator(*this, &hook);
+	}
+
+	template <typename T, typename TTag>
+	inline typename IntrusiveList<T, TTag>::iterator IntrusiveList<T, TTag>::PushBack(reference element)
+	{
+		Hook& hook = element;
+		_Link(hook, *_head._previous, _head);
+		return iterator(*this, &hook);
+	}
+
+	template <typename T, typename TTag>
+	inline typename IntrusiveList<T, TTag>::iterator IntrusiveList<T, TTag>::InsertBefore(const iterator& position, reference element)
+	{
+#if FIEA_CHECKED_ITERATORS
+		if (position._container != this)
+		{
+			throw std::runtime_error("Iterator is not associated with this container");
+		}
+#endif
+		Hook& hook = element;
+		_Link(hook, *position._hook->_previous, *position._hook);
+		return iterator(*this, &hook);
+	}
+
+	template <typename T, typename TTag>
+	inline void IntrusiveList<T, TTag>::PopFront()
+	{
+		if (IsEmpty())
+		{
+			throw std::runtime_error("List is empty");
+		}
+		_head._next->Unlink();
+	}
+
+	template <typename T, typename TTag>
+	inline void IntrusiveList<T, TTag>::PopBack()
+	{
+		if (IsEmpty())
+		{
+			throw std::runtime_error("List is empty");
+		}
+		_head._previous->Unlink();
+	}
+
+	template <typename T, typename TTag>
+	inline bool IntrusiveList<T, TTag>::Remove(reference element)
+	{
+		Hook& hook = element;
+		const bool wasLinked = hook.IsLinked();
+		hook.Unlink();
+		return wasLinked;
+	}
+
+	template <typename T, typename TTag>
+	inline T& IntrusiveList<T, TTag>::Front()
+	{
+		if (IsEmpty())
+		{
+			throw std::runtime_error("List is empty");
+		}
+		return static_cast<T&>(*_head._next);
+	}
+
+	template <typename T, typename TTag>
+	inline const T& IntrusiveList<T, TTag>::Front() const
+	{
+		if (IsEmpty())
+		{
+			throw std::runtime_error("List is empty");
+		}
+		return static_cast<const T&>(*_head._next);
+	}
+
+	template <typename T, typename TTag>
+	inline T& IntrusiveList<T, TTag>::Back()
+	{
+		if (IsEmpty())
+		{
+			throw std::runtime_error("List is empty");
+		}
+		return static_cast<T&>(*_head._previous);
+	}
+
+	template <typename T, typename TTag>
+	inline const T& IntrusiveList<T, TTag>::Back() const
+	{
+		if (IsEmpty())
+		{
+			throw std::runtime_error("List is empty");
+		}
+		return static_cast<const T&>(*_head._previous);
+	}
+
+	template <typename T, typename TTag>
+	inline bool IntrusiveList<T, TTag>::IsEmpty() const
+	{
+		return _head._next == &_head;
+	}
+
+	template <typename T, typename TTag>
+	inline std::size_t IntrusiveList<T, TTag>::Size() const
+	{
+		std::size_t size = 0;
+		for (const Hook* hook = _head._next; hook != &_head; hook = hook->_next)
+		{
+			++size;
+		}
+		return size;
+	}
+
+	template <typename T, typename TTag>
+	inline void IntrusiveList<T, TTag>::Clear()
+	{
+		Hook* hook = _head._next;
+		while (hook != &_head)
+		{
+			Hook* next = hook->_next;
+			hook->_next = nullptr;
+			hook->_previous = nullptr;
+			hook = next;
+		}
+		_head._next = &_head;
+		_head._previous = &_head;
+	}
+
+	template <typename T, typename TTag>
+	inline void IntrusiveList<T, TTag>::_Link(Hook& hook, Hook& previous, Hook& next)
+	{
+		if (hook.IsLinked())
+		{
+			throw std::runtime_error("Element is already in a list");
+		}
+		hook._previous = &previous;
+		hook._next = &next;
+		previous._next = &hook;
+		next._previous = &hook;
+	}
+
+	template <typename T, typename TTag>
+	inline void IntrusiveList<T, TTag>::_AdoptLinks(IntrusiveList& rhs)
+	{
+		if (!rhs.IsEmpty())
+		{
+			_head._next = rhs._head._next;
+			_head._previous = rhs._head._previous;
+			_head._next->_previous = &_head;
+			_head._previous->_next = &_head;
+
+			rhs._head._next = &rhs._head;
+			rhs._head._previous = &rhs._head;
+		}
+	}
+#pragma endregion IntrusiveList
+
+#pragma region const_iterator
+	template <typename T, typename TTag>
+	inline IntrusiveList<T, TTag>::const_iterator::const_iterator(const iterator& other) :
+#if FIEA_CHECKED_ITERATORS
+		_hook(other._hook), _container(other._container)
+#else
+		_hook(other._hook)
+#endif
+	{
+	}
+
+	template <typename T, typename TTag>
+	inline IntrusiveList<T, TTag>::const_iterator::const_iterator([[maybe_unused]] const IntrusiveList& container, const Hook* hook) :
+#if FIEA_CHECKED_ITERATORS
+		_hook(hook), _container(&container)
+#else
+		_hook(hook)
+#endif
+	{
+	}
+
+	template <typename T, typename TTag>
+	inline const T& IntrusiveList<T, TTag>::const_iterator::operator*() const
+	{
+#if FIEA_CHECKED_ITERATORS
+		if (_container == nullptr || _hook == &_container->_head)
+		{
+			throw std::runtime_error("Iterator does not point to an element in the container");
+		}
+#endif
+		return static_cast<const T&>(*_hook);
+	}
+
+	template <typename T, typename TTag>
+	inline const T* IntrusiveList<T, TTag>::const_iterator::operator->() const
+	{
+		return &operator*();
+	}
+
+	template <typename T, typename TTag>
+	inline typename IntrusiveList<T, TTag>::const_iterator& IntrusiveList<T, TTag>::const_iterator::operator++()
+	{
+#if FIEA_CHECKED_ITERATORS
+		if (_container == nullptr)
+		{
+			throw std::runtime_error("Iterator is not associated with a container");
+		}
+#endif
+		_hook = _hook->_next;
+		return *this;
+	}
+
+	template <typename T, typename TTag>
+	inline typename IntrusiveList<T, TTag>::const_iterator IntrusiveList<T, TTag>::const_iterator::operator++(int)
+	{
+		const_iterator it = *this;
+		operator++();
+		return it;
+	}
+
+	template <typename T, typename TTag>
+	inline typename IntrusiveList<T, TTag>::const_iterator& IntrusiveList<T, TTag>::const_iterator::operator--()
+	{
+#if FIEA_CHECKED_ITERATORS
+		if (_container == nullptr)
+		{
+			throw std::runtime_error("Iterator is not associated with a container");
+		}
+#endif
+		_hook = _hook->_previous;
+		return *this;
+	}
+
+	template <typename T, typename TTag>
+	inline typename IntrusiveList<T, TTag>::const_iterator IntrusiveList<T, TTag>::const_iterator::operator--(int)
+	{
+		const_iterator it = *this;
+		operator--();
+		return it;
+	}
+
+	template <typename T, typename TTag>
+	inline bool IntrusiveList<T, TTag>::const_iterator::operator==(const const_iterator& other) const
+	{
+		return _hook == other._hook;
+	}
+#pragma endregion const_iterator
+
+#pragma region iterator
+	template <typename T, typename TTag>
+	inline IntrusiveList<T, TTag>::iterator::iterator([[maybe_unused]] const IntrusiveList& container, Hook* hook) :
+#if FIEA_CHECKED_ITERATORS
+		_hook(hook), _container(&container)
+#else
+		_hook(hook)
+#endif
+	{
+	}
+
+	template <typename T, typename TTag>
+	inline T& IntrusiveList<T, TTag>::iterator::operator*() const
+	{
+#if FIEA_CHECKED_ITERATORS
+		if (_container == nullptr || _hook == &_container->_head)
+		{
+			throw std::runtime_error("Iterator does not point to an element in the container");
+		}
+#endif
+		return static_cast<T&>(*_hook);
+	}
+
+	template <typename T, typename TTag>
+	inline T* IntrusiveList<T, TTag>::iterator::operator->() const
+	{
+		return &operator*();
+	}
+
+	template <typename T, typename TTag>
+	inline typename IntrusiveList<T, TTag>::iterator& IntrusiveList<T, TTag>::iterator::operator++()
+	{
+#if FIEA_CHECKED_ITERATORS
+		if (_container == nullptr)
+		{
+			throw std::runtime_error("Iterator is not associated with a container");
+		}
+#endif
+		_hook = _hook->_next;
+		return *this;
+	}
+
+	template <typename T, typename TTag>
+	inline typename IntrusiveList<T, TTag>::iterator IntrusiveList<T, TTag>::iterator::operator++(int)
+	{
+		iterator it = *this;
+		operator++();
+		return it;
+	}
+
+	template <typename T, typename TTag>
+	inline typename IntrusiveList<T, TTag>::iterator& IntrusiveList<T, TTag>::iterator::operator--()
+	{
+#if FIEA_CHECKED_ITERATORS
+		if (_container == nullptr)
+		{
+			throw std::runtime_error("Iterator is not associated with a container");
+		}
+#endif
+		_hook = _hook->_previous;
+		return *this;
+	}
+
+	template <typename T, typename TTag>
+	inline typename IntrusiveList<T, TTag>::iterator IntrusiveList<T, TTag>::iterator::operator--(int)
+	{
+		iterator it = *this;
+		operator--();
+		return it;
+	}
+
+	template <typename T, typename TTag>
+	inline bool IntrusiveList<T, TTag>::iterator::operator==(const iterator& other) const
+	{
+		return _hook == other._hook;
+	}
+#pragma endregion iterator
+}
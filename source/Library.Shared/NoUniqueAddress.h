@@ -0,0 +1,11 @@
+#pragma once
+
+/// <summary>
+/// Lets an empty member, such as a stateless policy functor, take no space in its class.
+/// MSVC ignores the standard attribute and needs its own spelling.
+/// </summary>
+#if defined(_MSC_VER) && !defined(__clang__)
+#define NO_UNIQUE_ADDRESS [[msvc::no_unique_address]]
+#else
+#define NO_UNIQUE_ADDRESS [[no_unique_address]]
+#endif
@@ -0,0 +1,139 @@
+#include "pch.h"
+
+#include "NodePoolResource.h"
+#include <algorithm>
+#include <stdexcept>
+
+using namespace std;
+
+namespace FieaGameEngine
+{
+	namespace
+	{
+		constexpr size_t RoundUp(size_t value, size_t alignment)
+		{
+			return (value + alignment - 1) & ~(alignment - 1);
+		}
+	}
+
+	NodePoolResource::NodePoolResource(size_t nodeSize, size_t nodeAlignment, size_t nodesPerSlab, pmr::memory_resource* upstream) :
+		_upstream(upstream), _nodeSize(nodeSize), _nodeAlignment(max(nodeAlignment, alignof(FreeNode))), _nodesPerSlab(nodesPerSlab)
+	{
+		if (nodeSize == 0 || nodesPerSlab == 0)
+		{
+			throw runtime_error("Node size and nodes per slab must be greater than 0");
+		}
+		if ((nodeAlignment & (nodeAlignment - 1)) != 0)
+		{
+			throw runtime_error("Node alignment must be a power of two");
+		}
+		if (upstream == nullptr)
+		{
+			throw runtime_error("Upstream resource cannot be null");
+		}
+
+		// Every node must be able to hold a free list link, and the first node must stay aligned after the header
+		_stride = RoundUp(max(nodeSize, sizeof(FreeNode)), _nodeAlignment);
+		_slabHeaderSize = RoundUp(sizeof(SlabHeader), _nodeAlignment);
+		_slabSize = _slabHeaderSize + _stride * _nodesPerSlab;
+	}
+
+	NodePoolResource::~NodePoolResource()
+	{
+		Release();
+	}
+
+	void NodePoolResource::Release()
+	{
+		const size_t slabAlignment = max(_nodeAlignment, alignof(SlabHeader));
+		while (_slabs != nullptr)
+		{
+			SlabHeader* next = _slabs->Next;
+			_upstream->deallocate(_slabs, _slabSize, slabAlignment);
+			_slabs = next;
+		}
+		_freeList = nullptr;
+		_carveNext = nullptr;
+		_carveEnd = nullptr;
+		_slabCount = 0;
+		_nodesInUse = 0;
+	}
+
+	size_t NodePoolResource::NodeSize() const
+	{
+		return _nodeSize;
+	}
+
+	size_t NodePoolResource::SlabCount() const
+	{
+		return _slabCount;
+	}
+
+	size_t NodePoolResource::NodesInUse() const
+	{
+		return _nodesInUse;
+	}
+
+	pmr::memory_resource* NodePoolResource::Upstream() const
+	{
+		return _upstream;
+	}
+
+	void* NodePoolResource::do_allocate(size_t bytes, size_t alignment)
+	{
+		if (!_IsPooled(bytes, alignment))
+		{
+			return _upstream->allocate(bytes, alignment);
+		}
+
+		void* node;
+		if (_freeList != nullptr)
+		{
+			node = _freeList;
+			_freeList = _freeList->Next;
+		}
+		else
+		{
+			// Nodes are carved from the newest slab lazily, so a fresh slab costs no more than its allocation
+			if (_carveNext == _carveEnd)
+			{
+				_AddSlab();
+			}
+			node = _carveNext;
+			_carveNext += _stride;
+		}
+		++_nodesInUse;
+		return node;
+	}
+
+	void NodePoolResource::do_deallocate(void* p, size_t bytes, size_t alignment)
+	{
+		if (!_IsPooled(bytes, alignment))
+		{
+			_upstream->deallocate(p, bytes, alignment);
+			return;
+		}
+
+		_freeList = new(p) FreeNode{ _freeList };
+		--_nodesInUse;
+	}
+
+	bool NodePoolResource::do_is_equal(const pmr::memory_resource& other) const noexcept
+	{
+		return this == &other;
+	}
+
+	bool NodePoolResource::_IsPooled(size_t bytes, size_t alignment) const
+	{
+		return bytes <= _nodeSize && alignment <= _nodeAlignment;
+	}
+
+	void NodePoolResource::_AddSlab()
+	{
+		std::byte* slab = static_cast<std::byte*>(_upstream->allocate(_slabSize, max(_nodeAlignment, alignof(SlabHeader))));
+		_slabs = new(slab) SlabHeader{ _slabs };
+		_carveNext = slab + _slabHeaderSize;
+		_carveEnd = slab + _slabSize;
+		++_slabCount;
+	}
+}
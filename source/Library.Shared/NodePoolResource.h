@@ -0,0 +1,103 @@
+#pragma once
+
+#include <cstddef>
+#include <memory_resource>
+
+namespace FieaGameEngine
+{
+	/// <summary>
+	/// Memory resource for node based containers such as SList, HashMap chains and UnrolledSList.
+	/// Nodes of one size are carved out of slabs from an upstream resource, and released nodes go on a free list
+	/// that the next allocation reuses, so a list allocates from the upstream once per slab instead of once per element
+	/// and its nodes sit next to each other.
+	/// Requests larger or more aligned than a node, such as HashMap bucket arrays, are forwarded to the upstream resource.
+	/// Not thread safe; use one pool per list, per container family or per thread.
+	/// Slabs are only returned to the upstream resource when the pool is released or destroyed.
+	/// </summary>
+	class NodePoolResource final : public std::pmr::memory_resource
+	{
+	public:
+		/// <summary>
+		/// Creates an empty pool. Nothing is allocated until the first node is requested
+		/// </summary>
+		/// <param name="nodeSize">Largest request served from the pool, usually sizeof the container's node</param>
+		/// <param name="nodeAlignment">Largest alignment served from the pool</param>
+		/// <param name="nodesPerSlab">Number of nodes each slab holds</param>
+		/// <param name="upstream">Resource slabs and oversized requests are allocated from. Must outlive the pool</param>
+		/// <exception cref="runtime_error">Node size or nodes per slab is 0, alignment is not a power of two, or upstream is null</exception>
+		explicit NodePoolResource(std::size_t nodeSize, std::size_t nodeAlignment = alignof(std::max_align_t), std::size_t nodesPerSlab = _DEFAULT_NODES_PER_SLAB,
+			std::pmr::memory_resource* upstream = std::pmr::get_default_resource());
+		NodePoolResource(const NodePoolResource&) = delete;
+		NodePoolResource(NodePoolResource&&) = delete;
+		NodePoolResource& operator=(const NodePoolResource&) = delete;
+		NodePoolResource& operator=(NodePoolResource&&) = delete;
+		~NodePoolResource() override;
+
+		/// <summary>
+		/// Returns every slab to the upstream resource. Nodes still in use become invalid
+		/// </summary>
+		void Release();
+
+		/// <summary>
+		/// Gets the largest request the pool serves itself
+		/// </summary>
+		/// <returns>Node size</returns>
+		[[nodiscard]] std::size_t NodeSize() const;
+
+		/// <summary>
+		/// Gets the number of slabs allocated from the upstream resource
+		/// </summary>
+		/// <returns>Slab count</returns>
+		[[nodiscard]] std::size_t SlabCount() const;
+
+		/// <summary>
+		/// Gets the number of pooled nodes currently allocated
+		/// </summary>
+		/// <returns>Nodes in use</returns>
+		[[nodiscard]] std::size_t NodesInUse() const;
+
+		/// <summary>
+		/// Gets the resource slabs and oversized requests are allocated from
+		/// </summary>
+		/// <returns>Upstream resource</returns>
+		[[nodiscard]] std::pmr::memory_resource* Upstream() const;
+
+	private:
+		static constexpr std::size_t _DEFAULT_NODES_PER_SLAB = 64;
+
+		// Released nodes are linked through their own storage
+		struct FreeNode final
+		{
+			FreeNode* Next;
+		};
+
+		// Slabs are linked through a header at their start, so releasing needs no bookkeeping allocations
+		struct SlabHeader final
+		{
+			SlabHeader* Next;
+		};
+
+		void* do_allocate(std::size_t bytes, std::size_t alignment) override;
+		void do_deallocate(void* p, std::size_t bytes, std::size_t alignment) override;
+		bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override;
+
+		// Whether a request is served from the slabs
+		[[nodiscard]] bool _IsPooled(std::size_t bytes, std::size_t alignment) const;
+		// Allocates another slab and makes it the one nodes are carved from
+		void _AddSlab();
+
+		std::pmr::memory_resource* _upstream;
+		std::size_t _nodeSize;
+		std::size_t _nodeAlignment;
+		std::size_t _stride;
+		std::size_t _slabHeaderSize;
+		std::size_t _slabSize;
+		std::size_t _nodesPerSlab;
+		FreeNode* _freeList = nullptr;
+		SlabHeader* _slabs = nullptr;
+		std::byte* _carveNext = nullptr;
+		std::byte* _carveEnd = nullptr;
+		std::size_t _slabCount = 0;
+		std::size_t _nodesInUse = 0;
+	};
+}
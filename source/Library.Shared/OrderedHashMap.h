@@ -0,0 +1,454 @@
+#pragma once
+
+#include "DefaultHash.h"
+#include "DefaultEquality.h"
+#include "NoUniqueAddress.h"
+#include "CheckedIterators.h"
+#include "Vector.h"
+
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+#include <memory_resource>
+#include <stdexcept>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define FIEA_ORDERED_HASH_MAP_SSE2
+#include <emmintrin.h>
+#endif
+
+namespace FieaGameEngine
+{
+	/// <summary>
+	/// Largest capacity at which OrderedHashMap scans for keys instead of hashing into a table.
+	/// Chosen from ScopeBenchmarks::LinearSearchCrossover: past eight entries a single hashed probe is faster
+	/// </summary>
+	inline constexpr std::size_t DefaultLinearSearchCapacity = 8;
+
+	/// <summary>
+	/// Associative array that keeps its entries in insertion order.
+	/// Entries live in contiguous segments: the first segment holds the reserved capacity and
+	/// every later segment doubles the capacity, so iterating is a linear walk over a few arrays.
+	/// Keys are found through a separate open addressing index of 32-bit entry indices.
+	/// While the capacity is small the index is instead a packed array of each entry's 32-bit hash,
+	/// which is scanned sixteen at a time (with SSE2 when available), and keys are only compared when their hashes match.
+	/// Segments are never moved, so references to entries stay valid until the container is cleared.
+	/// Entries cannot be removed individually.
+	/// </summary>
+	/// <typeparam name="TKey">Key type</typeparam>
+	/// <typeparam name="TData">Value type</typeparam>
+	/// <typeparam name="THash">Functor that hashes a key</typeparam>
+	/// <typeparam name="TKeyEquality">Functor that compares two keys</typeparam>
+	/// <typeparam name="TLinearSearchCapacity">Largest capacity that scans the packed hashes. Growing past it builds the hash table</typeparam>
+	template <typename TKey, typename TData, typename THash = DefaultHash<TKey>, typename TKeyEquality = DefaultEquality<TKey>, std::size_t TLinearSearchCapacity = DefaultLinearSearchCapacity>
+	class OrderedHashMap final
+	{
+	public:
+		using PairType = std::pair<const TKey, TData>;
+		using size_type = std::size_t;
+		using value_type = PairType;
+		using reference = value_type&;
+		using const_reference = const value_type&;
+		using pointer = value_type*;
+		using const_pointer = const value_type*;
+		using Hash = THash;
+		using KeyEquality = TKeyEquality;
+		using Allocator = std::pmr::polymorphic_allocator<PairType>;
+
+	public:
+		class iterator;
+
+		/// <summary>
+		/// Iterator that when dereferenced returns a const version of a value in the container
+		/// </summary>
+		class const_iterator final
+		{
+			friend class OrderedHashMap;
+
+		public:
+			using iterator_category = std::forward_iterator_tag;
+			using difference_type = std::ptrdiff_t;
+			using value_type = value_type;
+			using pointer = value_type*;
+			using reference = value_type&;
+
+			const_iterator() = default;
+			const_iterator& operator=(const const_iterator&) = default;
+
+			/// <summary>
+			/// Creates a constant iterator from a non-const iterator
+			/// </summary>
+			/// <param name="other">iterator to turn into a const_iterator</param>
+			const_iterator(const iterator& other);
+
+			/// <summary>
+			/// Gets a const version of the value in the container pointed to by this iterator
+			/// </summary>
+			/// <exception cref="runtime_error">If the iterator is not associated with a container or points to an element not within a container</exception>
+			/// <returns>value in the container</returns>
+			[[nodiscard]] const_reference operator*() const;
+
+			/// <summary>
+			/// Gets a const version of the value in the container pointed to by this iterator
+			/// </summary>
+			/// <exception cref="runtime_error">If the iterator is not associated with a container or points to an element not within a container</exception>
+			/// <returns>value in the container</returns>
+			[[nodiscard]] const value_type* operator->() const;
+
+			/// <summary>
+			/// Increments the iterator so the iterator points to the next element in insertion order
+			/// </summary>
+			/// <exception cref="runtime_error">Iterator is not associated with a container</exception>
+			/// <returns>Reference to the incremented iterator</returns>
+			const_iterator& operator++();
+
+			/// <summary>
+			/// Increments the iterator so the iterator points to the next element in insertion order
+			/// </summary>
+			/// <exception cref="runtime_error">Iterator is not associated with a container</exception>
+			/// <returns>Iterator before it is incremented</returns>
+			const_iterator operator++(int);
+
+			/// <summary>
+			/// Compares iterators. Iterators are equal if they point to the same position
+			/// </summary>
+			/// <param name="other"></param>
+			/// <returns>Whether the iterators are equal</returns>
+			[[nodiscard]] bool operator==(const const_iterator& other) const;
+
+		private:
+			/// <summary>
+			/// Creates an iterator associated with a container that points to an entry
+			/// </summary>
+			/// <param name="container">Container the iterator is associated with</param>
+			/// <param name="index">Insertion index of the entry</param>
+			const_iterator(const OrderedHashMap& container, size_type index);
+
+			const OrderedHashMap* _container = nullptr;
+			const PairType* _entry = nullptr;
+			size_type _index = 0;
+			// Index one past the segment _entry is in
+			size_type _segmentEnd = 0;
+		};
+
+		/// <summary>
+		/// Iterator that when dereferenced returns a non-const version of a value in the container
+		/// </summary>
+		class iterator final
+		{
+			friend OrderedHashMap;
+			friend const_iterator;
+
+		public:
+			using iterator_category = std::forward_iterator_tag;
+			using difference_type = std::ptrdiff_t;
+			using value_type = value_type;
+			using pointer = value_type*;
+			using reference = value_type&;
+
+			iterator() = default;
+			iterator& operator=(const iterator&) = default;
+
+			/// <summary>
+			/// Gets a non-const version of the value in the container pointed to by this iterator
+			/// </summary>
+			/// <exception cref="runtime_error">If the iterator is not associated with a container or points to an element not within a container</exception>
+			/// <returns>value in the container</returns>
+			[[nodiscard]] reference operator*() const;
+
+			/// <summary>
+			/// Gets a non-const version of the value in the container pointed to by this iterator
+			/// </summary>
+			/// <exception cref="runtime_error">If the iterator is not associated with a container or points to an element not within a container</exception>
+			/// <returns>value in the container</returns>
+			[[nodiscard]] pointer operator->() const;
+
+			/// <summary>
+			/// Increments the iterator so the iterator points to the next element in insertion order
+			/// </summary>
+			/// <exception cref="runtime_error">Iterator is not associated with a container</exception>
+			/// <returns>Reference to the incremented iterator</returns>
+			iterator& operator++();
+
+			/// <summary>
+			/// Increments the iterator so the iterator points to the next element in insertion order
+			/// </summary>
+			/// <exception cref="runtime_error">Iterator is not associated with a container</exception>
+			/// <returns>Iterator before it is incremented</returns>
+			iterator operator++(int);
+
+			/// <summary>
+			/// Compares iterators. Iterators are equal if they point to the same position
+			/// </summary>
+			/// <param name="other"></param>
+			/// <returns>Whether the iterators are equal</returns>
+			[[nodiscard]] bool operator==(const iterator& other) const;
+
+		private:
+			/// <summary>
+			/// Creates an iterator associated with a container that points to an entry
+			/// </summary>
+			/// <param name="container">Container the iterator is associated with</param>
+			/// <param name="index">Insertion index of the entry</param>
+			iterator(OrderedHashMap& container, size_type index);
+
+			OrderedHashMap* _container = nullptr;
+			PairType* _entry = nullptr;
+			size_type _index = 0;
+			// Index one past the segment _entry is in
+			size_type _segmentEnd = 0;
+		};
+
+		/// <summary>
+		/// Creates an empty container. Nothing is allocated until capacity is needed
+		/// </summary>
+		/// <param name="capacity">Number of entries to reserve room for</param>
+		/// <param name="hash">Hash function for keys</param>
+		/// <param name="keyEquality">Equality function for keys</param>
+		explicit OrderedHashMap(size_type capacity = 0, Hash hash = Hash{}, KeyEquality keyEquality = KeyEquality{});
+
+		/// <summary>
+		/// Creates an empty container whose entries and index are allocated from a memory resource
+		/// </summary>
+		/// <param name="allocator">Allocator, or the memory resource it allocates from. The resource must outlive the container</param>
+		/// <param name="capacity">Number of entries to reserve room for</param>
+		/// <param name="hash">Hash function for keys</param>
+		/// <param name="keyEquality">Equality function for keys</param>
+		explicit OrderedHashMap(const Allocator& allocator, size_type capacity = 0, Hash hash = Hash{}, KeyEquality keyEquality = KeyEquality{});
+
+		/// <summary>
+		/// Copy constructor. The copy stores every entry in a single segment
+		/// </summary>
+		/// <param name="other">Container to copy</param>
+		OrderedHashMap(const OrderedHashMap& other);
+
+		/// <summary>
+		/// Copy constructor that allocates from a memory resource. The copy stores every entry in a single segment
+		/// </summary>
+		/// <param name="other">Container to copy</param>
+		/// <param name="allocator">Allocator of the copy</param>
+		OrderedHashMap(const OrderedHashMap& other, const Allocator& allocator);
+
+		OrderedHashMap(OrderedHashMap&& other) noexcept;
+		~OrderedHashMap();
+
+		/// <summary>
+		/// Copy assignment. The copy keeps allocating from this container's resource
+		/// </summary>
+		OrderedHashMap& operator=(const OrderedHashMap& rhs);
+
+		/// <summary>
+		/// Move assignment. Both containers must allocate from the same resource; copy assign containers on different resources
+		/// </summary>
+		OrderedHashMap& operator=(OrderedHashMap&& rhs) noexcept;
+
+		/// <summary>
+		/// Gets an iterator pointing to the first element in insertion order
+		/// </summary>
+		/// <returns>iterator at the beginning of the container</returns>
+		[[nodiscard]] iterator begin();
+
+		/// <summary>
+		/// Gets a const_iterator pointing to the first element in insertion order
+		/// </summary>
+		/// <returns>const_iterator at the beginning of the container</returns>
+		[[nodiscard]] const_iterator begin() const;
+
+		/// <summary>
+		/// Gets an iterator pointing to one past the last element in the container
+		/// </summary>
+		/// <returns>iterator at the end of the container</returns>
+		[[nodiscard]] iterator end();
+
+		/// <summary>
+		/// Gets a const_iterator pointing to one past the last element in the container
+		/// </summary>
+		/// <returns>const_iterator at the end of the container</returns>
+		[[nodiscard]] const_iterator end() const;
+
+		/// <summary>
+		/// Gets a const_iterator pointing to the first element in insertion order
+		/// </summary>
+		/// <returns>const_iterator at the beginning of the container</returns>
+		[[nodiscard]] const_iterator cbegin() const;
+
+		/// <summary>
+		/// Gets a const_iterator pointing to one past the last element in the container
+		/// </summary>
+		/// <returns>const_iterator at the end of the container</returns>
+		[[nodiscard]] const_iterator cend() const;
+
+		/// <summary>
+		/// Finds the entry with a key
+		/// </summary>
+		/// <param name="key">Key to find</param>
+		/// <returns>Address of the entry, or null if the key is not in the container</returns>
+		[[nodiscard]] PairType* Find(const TKey& key);
+
+		/// <summary>
+		/// Finds the entry with a key
+		/// </summary>
+		/// <param name="key">Key to find</param>
+		/// <returns>Address of the entry, or null if the key is not in the container</returns>
+		[[nodiscard]] const PairType* Find(const TKey& key) const;
+
+		/// <summary>
+		/// Appends an entry for the key whose value is constructed from the arguments. If the key already exists,
+		/// the existing entry is returned and nothing is constructed.
+		/// </summary>
+		/// <param name="key">Key of the entry</param>
+		/// <param name="args">Arguments forwarded to the value constructor</param>
+		/// <returns>The entry with the key. Boolean indicates if the entry was appended</returns>
+		template <typename... Args>
+		std::pair<PairType*, bool> Emplace(const TKey& key, Args&&... args);
+
+		/// <summary>
+		/// Appends an entry for a key known not to be in the container, skipping the lookup Emplace does
+		/// </summary>
+		/// <param name="key">Key of the entry. Must not already be in the container</param>
+		/// <param name="args">Arguments forwarded to the value constructor</param>
+		/// <returns>The new entry</returns>
+		template <typename... Args>
+		PairType& EmplaceUnique(const TKey& key, Args&&... args);
+
+		/// <summary>
+		/// Gets the value at the key
+		/// </summary>
+		/// <param name="key">Key to get</param>
+		/// <exception cref="runtime_error">Key does not exist in the container</exception>
+		/// <returns>Data at the given key in the container</returns>
+		[[nodiscard]] TData& At(const TKey& key);
+
+		/// <summary>
+		/// Gets the value at the key
+		/// </summary>
+		/// <param name="key">Key to get</param>
+		/// <exception cref="runtime_error">Key does not exist in the container</exception>
+		/// <returns>Data at the given key in the container</returns>
+		[[nodiscard]] const TData& At(const TKey& key) const;
+
+		/// <summary>
+		/// Gets the entry appended at an index
+		/// </summary>
+		/// <param name="index">Insertion index of the entry</param>
+		/// <exception cref="runtime_error">Index is out of bounds</exception>
+		/// <returns>Entry at the index</returns>
+		[[nodiscard]] PairType& EntryAt(size_type index);
+
+		/// <summary>
+		/// Gets the entry appended at an index
+		/// </summary>
+		/// <param name="index">Insertion index of the entry</param>
+		/// <exception cref="runtime_error">Index is out of bounds</exception>
+		/// <returns>Entry at the index</returns>
+		[[nodiscard]] const PairType& EntryAt(size_type index) const;
+
+		/// <summary>
+		/// Finds the insertion index of the entry with a key, to get it back later with EntryAt
+		/// </summary>
+		/// <param name="key">Key to find</param>
+		/// <returns>Insertion index of the entry, or Size() if the key is not in the container</returns>
+		[[nodiscard]] size_type IndexOf(const TKey& key) const;
+
+		/// <summary>
+		/// Checks if a key is in the container
+		/// </summary>
+		/// <param name="key"></param>
+		/// <returns>True if the key exists; otherwise false</returns>
+		[[nodiscard]] bool ContainsKey(const TKey& key) const;
+
+		/// <summary>
+		/// Gets the number of entries in the container
+		/// </summary>
+		/// <returns>Number of entries in the container</returns>
+		[[nodiscard]] size_type Size() const;
+
+		/// <summary>
+		/// Checks if the container has no entries
+		/// </summary>
+		/// <returns>True if the container is empty; otherwise false</returns>
+		[[nodiscard]] bool IsEmpty() const;
+
+		/// <summary>
+		/// Gets the number of entries the container can hold before allocating another segment
+		/// </summary>
+		/// <returns>Capacity of the container</returns>
+		[[nodiscard]] size_type Capacity() const;
+
+		/// <summary>
+		/// Makes room for entries. On an empty container the whole capacity is one segment
+		/// </summary>
+		/// <param name="capacity">Number of entries to make room for</param>
+		void Reserve(size_type capacity);
+
+		/// <summary>
+		/// Destroys every entry and releases the memory of the container
+		/// </summary>
+		void Clear();
+
+		/// <summary>
+		/// Gets the allocator the container allocates its entries and index with
+		/// </summary>
+		/// <returns>Allocator of the container</returns>
+		[[nodiscard]] Allocator GetAllocator() const;
+
+	private:
+		/// <summary>
+		/// Contiguous run of entries, starting at an insertion index
+		/// </summary>
+		struct Segment final
+		{
+			PairType* Entries = nullptr;
+			size_type Begin = 0;
+			size_type Capacity = 0;
+		};
+
+		using SlotType = std::uint32_t;
+
+		static constexpr SlotType _EMPTY_SLOT = 0;
+		static constexpr size_type _MINIMUM_SEGMENT_CAPACITY = 8;
+		static constexpr size_type _MINIMUM_SLOT_COUNT = 8;
+		static constexpr size_type _GROUP_WIDTH = 16;
+		static constexpr size_type _MAXIMUM_SIZE = SlotType(-1) - 1;
+
+		Allocator _alloc;
+		NO_UNIQUE_ADDRESS KeyEquality _keyEquality;
+		NO_UNIQUE_ADDRESS Hash _hash;
+		// Most containers never grow past what they reserve, so the first segment is kept inline
+		Segment _first;
+		Vector<Segment> _segments;
+		// Scanning: slot i holds the hash of entry i. Hashing: each slot is empty or holds the insertion index of an entry plus one
+		SlotType* _slots = nullptr;
+		size_type _slotCount = 0;
+		size_type _size = 0;
+		size_type _capacity = 0;
+		bool _isLinear = true;
+
+		[[nodiscard]] const Segment& _SegmentOf(size_type index) const;
+		[[nodiscard]] PairType& _Entry(size_type index) const;
+		[[nodiscard]] SlotType _Tag(const TKey& key) const;
+		// Returns the insertion index of key, or _size if it does not exist. The index must be scanning
+		[[nodiscard]] size_type _FindLinear(const TKey& key, SlotType tag) const;
+		[[nodiscard]] size_type _FirstSlot(const TKey& key) const;
+		// Returns the slot holding key, or the empty slot its probe ends on
+		[[nodiscard]] size_type _FindSlot(const TKey& key) const;
+		// Returns the insertion index of key, or _size if it does not exist
+		[[nodiscard]] size_type _FindIndex(const TKey& key) const;
+		[[nodiscard]] static size_type _SlotCountFor(size_type capacity);
+		[[nodiscard]] static bool _IsLinearFor(size_type capacity);
+
+		// Appends an entry for a key known not to be in the container. Grows if needed
+		template <typename... Args>
+		PairType& _Append(const TKey& key, Args&&... args);
+		// Constructs the next entry and stores value in a free slot of the index. There must be room for it
+		template <typename... Args>
+		PairType& _Construct(size_type slot, SlotType value, const TKey& key, Args&&... args);
+		void _GrowEntries(size_type capacity);
+		// Replaces the index with one sized for a capacity, choosing scanning or hashing by that capacity
+		void _RebuildIndex(size_type capacity);
+		void _Release();
+	};
+}
+
+#include "OrderedHashMap.inl"
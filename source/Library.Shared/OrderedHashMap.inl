@@ -0,0 +1,757 @@
+#include "OrderedHashMap.h"
+#include <algorithm>
+#include <bit>
+#include <cstring>
+#include <memory>
+#include <new>
+#include <tuple>
+
+namespace FieaGameEngine
+{
+#pragma region OrderedHashMap
+	template <typename TKey, typename TData, typename THash, typename TKeyEquality, std::size_t TLinearSearchCapacity>
+	inline OrderedHashMap<TKey, TData, THash, TKeyEquality, TLinearSearchCapacity>::OrderedHashMap(size_type capacity, Hash hash, KeyEquality keyEquality) :
+		OrderedHashMap(Allocator{}, capacity, std::move(hash), std::move(keyEquality))
+	{
+	}
+
+	template <typename TKey, typename TData, typename THash, typename TKeyEquality, std::size_t TLinearSearchCapacity>
+	inline OrderedHashMap<TKey, TData, THash, TKeyEquality, TLinearSearchCapacity>::OrderedHashMap(const Allocator& allocator, size_type capacity, Hash hash, KeyEquality keyEquality) :
+		_alloc(allocator),
+		_keyEquality(std::move(keyEquality)),
+		_hash(std::move(hash)),
+		_segments(typename Vector<Segment>::Allocator(allocator))
+	{
+		Reserve(capacity);
+	}
+
+	template <typename TKey, typename TData, typename THash, typename TKeyEquality, std::size_t TLinearSearchCapacity>
+	inline OrderedHashMap<TKey, TData, THash, TKeyEquality, TLinearSearchCapacity>::OrderedHashMap(const OrderedHashMap& other) :
+		OrderedHashMap(other, Allocator{})
+	{
+	}
+
+	template <typename TKey, typename TData, typename THash, typename TKeyEquality, std::size_t TLinearSearchCapacity>
+	inline OrderedHashMap<TKey, TData, THash, TKeyEquality, TLinearSearchCapacity>::OrderedHashMap(const OrderedHashMap& other, const Allocator& allocator) :
+		_alloc(allocator),
+		_keyEquality(other._keyEquality),
+		_hash(other._hash),
+		_segments(typename Vector<Segment>::Allocator(allocator))
+	{
+		if (other._size == 0)
+		{
+			return;
+		}
+
+		try
+		{
+			_first.Entries = _alloc.allocate(other._size);
+			_first.Capacity = other._size;
+			_capacity = other._size;
+			for (const PairType& entry : other)
+			{
+				new (_first.Entries + _size) PairType(entry);
+				++_size;
+			}
+
+			if (!other._isLinear && !_IsLinearFor(_capacity))
+			{
+				// Same slot count and hash, and the entries keep their insertion indices, so the table is copied as is
+				_slots = static_cast<SlotType*>(_alloc.allocate_bytes(other._slotCount * sizeof(SlotType), alignof(SlotType)));
+				_slotCount = other._slotCount;
+				std::memcpy(_slots, other._slots, _slotCount * sizeof(SlotType));
+				_isLinear = false;
+			}
+			else
+			{
+				_RebuildIndex(_capacity);
+			}
+		}
+		catch (...)
+		{
+			_Release();
+			throw;
+		}
+	}
+
+	template <typename TKey, typename TData, typename THash, typename TKeyEquality, std::size_t TLinearSearchCapacity>
+	inline OrderedHashMap<TKey, TData, THash, TKeyEquality, TLinearSearchCapacity>::OrderedHashMap(OrderedHashMap&& other) noexcept :
+		_alloc(other._alloc),
+		_keyEquality(std::move(other._keyEquality)),
+		_hash(std::move(other._hash)),
+		_first(other._first),
+		_segments(std::move(other._segments)),
+		_slots(other._slots),
+		_slotCount(other._slotCount),
+		_size(other._size),
+		_capacity(other._capacity),
+		_isLinear(other._isLinear)
+	{
+		other._first = Segment{};
+		other._slots = nullptr;
+		other._slotCount = 0;
+		other._size = 0;
+		other._capacity = 0;
+		other._isLinear = true;
+	}
+
+	template <typename TKey, typename TData, typename THash, typename TKeyEquality, std::size_t TLinearSearchCapacity>
+	inline OrderedHashMap<TKey, TData, THash, TKeyEquality, TLinearSearchCapacity>::~OrderedHashMap()
+	{
+		_Release();
+	}
+
+	template <typename TKey, typename TData, typename THash, typename TKeyEquality, std::size_t TLinearSearchCapacity>
+	inline OrderedHashMap<TKey, TData, THash, TKeyEquality, TLinearSearchCapacity>& OrderedHashMap<TKey, TData, THash, TKeyEquality, TLinearSearchCapacity>::operator=(const OrderedHashMap& rhs)
+	{
+		if (this != &rhs)
+		{
+			OrderedHashMap copy(rhs, _alloc);
+			*this = std::move(copy);
+		}
+		return *this;
+	}
+
+	template <typename TKey, typename TData, typename THash, typename TKeyEquality, std::size_t TLinearSearchCapacity>
+	inline OrderedHashMap<TKey, TData, THash, TKeyEquality, TLinearSearchCapacity>& OrderedHashMap<TKey, TData, THash, TKeyEquality, TLinearSearchCapacity>::operator=(OrderedHashMap&& rhs) noexcept
+	{
+		// The entries of rhs could not be released by our resource, and copying them may throw
+		assert(_alloc == rhs._alloc);
+		if (this != &rhs)
+		{
+			_Release();
+			_keyEquality = std::move(rhs._keyEquality);
+			_hash = std::move(rhs._hash);
+			_first = rhs._first;
+			_segments = std::move(rhs._segments);
+			_slots = rhs._slots;
+			_slotCount = rhs._slotCount;
+			_size = rhs._size;
+			_capacity = rhs._capacity;
+			_isLinear = rhs._isLinear;
+
+			rhs._first = Segment{};
+			rhs._slots = nullptr;
+			rhs._slotCount = 0;
+			rhs._size = 0;
+			rhs._capacity = 0;
+			rhs._isLinear = true;
+		}
+		return *this;
+	}
+
+	template <typename TKey, typename TData, typename THash, typename TKeyEquality, std::size_t TLinearSearchCapacity>
+	inline typename OrderedHashMap<TKey, TData, THash, TKeyEquality, TLinearSearchCapacity>::iterator OrderedHashMap<TKey, TData, THash, TKeyEquality, TLinearSearchCapacity>::begin()
+	{
+		return iterator(*this, 0);
+	}
+
+	template <typename TKey, typename TData, typename THash, typename TKeyEquality, std::size_t TLinearSearchCapacity>
+	inline typename OrderedHashMap<TKey, TData, THash, TKeyEquality, TLinearSearchCapacity>::const_iterator OrderedHashMap<TKey, TData, THash, TKeyEquality, TLinearSearchCapacity>::begin() const
+	{
+		return const_iterator(*this, 0);
+	}
+
+	template <typename TKey, typename TData, typename THash, typename TKeyEquality, std::size_t TLinearSearchCapacity>
+	inline typename OrderedHashMap<TKey, TData, THash, TKeyEquality, TLinearSearchCapacity>::iterator OrderedHashMap<TKey, TData, THash, TKeyEquality, TLinearSearchCapacity>::end()
+	{
+		return iterator(*this, _size);
+	}
+
+	template <typename TKey, typename TData, typename THash, typename TKeyEquality, std::size_t TLinearSearchCapacity>
+	inline typename OrderedHashMap<TKey, TData, THash, TKeyEquality, TLinearSearchCapacity>::const_iterator OrderedHashMap<TKey, TData, THash, TKeyEquality, TLinearSearchCapacity>::end() const
+	{
+		return const_iterator(*this, _size);
+	}
+
+	template <typename TKey, typename TData, typename THash, typename TKeyEquality, std::size_t TLinearSearchCapacity>
+	inline typename OrderedHashMap<TKey, TData, THash, TKeyEquality, TLinearSearchCapacity>::const_iterator OrderedHashMap<TKey, TData, THash, TKeyEquality, TLinearSearchCapacity>::cbegin() const
+	{
+		return begin();
+	}
+
+	template <typename TKey, typename TData, typename THash, typename TKeyEquality, std::size_t TLinearSearchCapacity>
+	inline typename OrderedHashMap<TKey, TData, THash, TKeyEquality, TLinearSearchCapacity>::const_iterator OrderedHashMap<TKey, TData, THash, TKeyEquality, TLinearSearchCapacity>::cend() const
+	{
+		return end();
+	}
+
+	template <typename TKey, typename TData, typename THash, typename TKeyEquality, std::size_t TLinearSearchCapacity>
+	inline typename OrderedHashMap<TKey, TData, THash, TKeyEquality, TLinearSearchCapacity>::PairType* OrderedHashMap<TKey, TData, THash, TKeyEquality, TLinearSearchCapacity>::Find(const TKey& key)
+	{
+		const size_type index = _FindIndex(key);
+		return index < _size ? &_Entry(index) : nullptr;
+	}
+
+	template <typename TKey, typename TData, typename THash, typename TKeyEquality, std::size_t TLinearSearchCapacity>
+	inline const typename OrderedHashMap<TKey, TData, THash, TKeyEquality, TLinearSearchCapacity>::PairType* OrderedHashMap<TKey, TData, THash, TKeyEquality, TLinearSearchCapacity>::Find(const TKey& key) const
+	{
+		const size_type index = _FindIndex(key);
+		return index < _size ? &_Entry(index) : nullptr;
+	}
+
+	template <typename TKey, typename TData, typename THash, typename TKeyEquality, std::size_t TLinearSearchCapacity>
+	template <typename... Args>
+	inline std::pair<typename OrderedHashMap<TKey, TData, THash, TKeyEquality, TLinearSearchCapacity>::PairType*, bool> OrderedHashMap<TKey, TData, THash, TKeyEquality, TLinearSearchCapacity>::Emplace(const TKey& key, Args&&... args)
+	{
+		if (_slots != nullptr)
+		{
+			if (_isLinear)
+			{
+				const SlotType tag = _Tag(key);
+				const size_type index = _FindLinear(key, tag);
+				if (index < _size)
+				{
+					return { &_Entry(index), false };
+				}
+				if (_size < _capacity)
+				{
+					return { &_Construct(_size, tag, key, std::forward<Args>(args)...), true };
+				}
+			}
+			else
+			{
+				const size_type slot = _FindSlot(key);
+				if (_slots[slot] != _EMPTY_SLOT)
+				{
+					return { &_Entry(_slots[slot] - 1), false };
+				}
+				if (_size < _capacity)
+				{
+					// The probe already ended on the slot the new entry goes in
+					return { &_Construct(slot, static_cast<SlotType>(_size + 1), key, std::forward<Args>(args)...), true };
+				}
+			}
+		}
+		return { &_Append(key, std::forward<Args>(args)...), true };
+	}
+
+	template <typename TKey, typename TData, typename THash, typename TKeyEquality, std::size_t TLinearSearchCapacity>
+	template <typename... Args>
+	inline typename OrderedHashMap<TKey, TData, THash, TKeyEquality, TLinearSearchCapacity>::PairType& OrderedHashMap<TKey, TData, THash, TKeyEquality, TLinearSearchCapacity>::EmplaceUnique(const TKey& key, Args&&... args)
+	{
+		assert(!ContainsKey(key));
+		return _Append(key, std::forward<Args>(args)...);
+	}
+
+	template <typename TKey, typename TData, typename THash, typename TKeyEquality, std::size_t TLinearSearchCapacity>
+	inline TData& OrderedHashMap<TKey, TData, THash, TKeyEquality, TLinearSearchCapacity>::At(const TKey& key)
+	{
+		PairType* entry = Find(key);
+		if (entry == nullptr)
+		{
+			throw std::runtime_error("Key does not exist");
+		}
+		return entry->second;
+	}
+
+	template <typename TKey, typename TData, typename THash, typename TKeyEquality, std::size_t TLinearSearchCapacity>
+	inline const TData& OrderedHashMap<TKey, TData, THash, TKeyEquality, TLinearSearchCapacity>::At(const TKey& key) const
+	{
+		const PairType* entry = Find(key);
+		if (entry == nullptr)
+		{
+			throw std::runtime_error("Key does not exist");
+		}
+		return entry->second;
+	}
+
+	template <typename TKey, typename TData, typename THash, typename TKeyEquality, std::size_t TLinearSearchCapacity>
+	inline typename OrderedHashMap<TKey, TData, THash, TKeyEquality, TLinearSearchCapacity>::PairType& OrderedHashMap<TKey, TData, THash, TKeyEquality, TLinearSearchCapacity>::EntryAt(size_type index)
+	{
+		if (index >= _size)
+		{
+			throw std::runtime_error("Index out of bounds");
+		}
+		return _Entry(index);
+	}
+
+	template <typename TKey, typename TData, typename THash, typename TKeyEquality, std::size_t TLinearSearchCapacity>
+	inline const typename OrderedHashMap<TKey, TData, THash, TKeyEquality, TLinearSearchCapacity>::PairType& OrderedHashMap<TKey, TData, THash, TKeyEquality, TLinearSearchCapacity>::EntryAt(size_type index) const
+	{
+		if (index >= _size)
+		{
+			throw std::runtime_error("Index out of bounds");
+		}
+		return _Entry(index);
+	}
+
+	template <typename TKey, typename TData, typename THash, typename TKeyEquality, std::size_t TLinearSearchCapacity>
+	inline typename OrderedHashMap<TKey, TData, THash, TKeyEquality, TLinearSearchCapacity>::size_type OrderedHashMap<TKey, TData, THash, TKeyEquality, TLinearSearchCapacity>::IndexOf(const TKey& key) const
+	{
+		return _FindIndex(key);
+	}
+
+	template <typename TKey, typename TData, typename THash, typename TKeyEquality, std::size_t TLinearSearchCapacity>
+	inline bool OrderedHashMap<TKey, TData, THash, TKeyEquality, TLinearSearchCapacity>::ContainsKey(const TKey& key) const
+	{
+		return _FindIndex(key) < _size;
+	}
+
+	template <typename TKey, typename TData, typename THash, typename TKeyEquality, std::size_t TLinearSearchCapacity>
+	inline typename OrderedHashMap<TKey, TData, THash, TKeyEquality, TLinearSearchCapacity>::size_type OrderedHashMap<TKey, TData, THash, TKeyEquality, TLinearSearchCapacity>::Size() const
+	{
+		return _size;
+	}
+
+	template <typename TKey, typename TData, typename THash, typename TKeyEquality, std::size_t TLinearSearchCapacity>
+	inline bool OrderedHashMap<TKey, TData, THash, TKeyEquality, TLinearSearchCapacity>::IsEmpty() const
+	{
+		return _size == 0;
+	}
+
+	template <typename TKey, typename TData, typename THash, typename TKeyEquality, std::size_t TLinearSearchCapacity>
+	inline typename OrderedHashMap<TKey, TData, THash, TKeyEquality, TLinearSearchCapacity>::size_type OrderedHashMap<TKey, TData, THash, TKeyEquality, TLinearSearchCapacity>::Capacity() const
+	{
+		return _capacity;
+	}
+
+	template <typename TKey, typename TData, typename THash, typename TKeyEquality, std::size_t TLinearSearchCapacity>
+	inline void OrderedHashMap<TKey, TData, THash, TKeyEquality, TLinearSearchCapacity>::Reserve(size_type capacity)
+	{
+		if (capacity <= _capacity)
+		{
+			return;
+		}
+		if (capacity > _MAXIMUM_SIZE)
+		{
+			throw std::runtime_error("Capacity is too large");
+		}
+		_GrowEntries(capacity - _capacity);
+	}
+
+	template <typename TKey, typename TData, typename THash, typename TKeyEquality, std::size_t TLinearSearchCapacity>
+	inline void OrderedHashMap<TKey, TData, THash, TKeyEquality, TLinearSearchCapacity>::Clear()
+	{
+		_Release();
+		_first = Segment{};
+		_segments.Clear();
+		_slots = nullptr;
+		_slotCount = 0;
+		_size = 0;
+		_capacity = 0;
+		_isLinear = true;
+	}
+
+	template <typename TKey, typename TData, typename THash, typename TKeyEquality, std::size_t TLinearSearchCapacity>
+	inline typename OrderedHashMap<TKey, TData, THash, TKeyEquality, TLinearSearchCapacity>::Allocator OrderedHashMap<TKey, TData, THash, TKeyEquality, TLinearSearchCapacity>::GetAllocator() const
+	{
+		return _alloc;
+	}
+
+	template <typename TKey, typename TData, typename THash, typename TKeyEquality, std::size_t TLinearSearchCapacity>
+	inline const typename OrderedHashMap<TKey, TData, THash, TKeyEquality, TLinearSearchCapacity>::Segment& OrderedHashMap<TKey, TData, THash, TKeyEquality, TLinearSearchCapacity>::_SegmentOf(size_type index) const
+	{
+		if (index < _first.Capacity)
+		{
+			return _first;
+		}
+		// Every later segment at least doubles the capacity, so there are only a few to look through
+		for (const Segment& segment : _segments)
+		{
+			if (index < segment.Begin + segment.Capacity)
+			{
+				return segment;
+			}
+		}
+		assert(false);
+		return _first;
+	}
+
+	template <typename TKey, typename TData, typename THash, typename TKeyEquality, std::size_t TLinearSearchCapacity>
+	inline typename OrderedHashMap<TKey, TData, THash, TKeyEquality, TLinearSearchCapacity>::PairType& OrderedHashMap<TKey, TData, THash, TKeyEquality, TLinearSearchCapacity>::_Entry(size_type index) const
+	{
+		const Segment& segment = _SegmentOf(index);
+		return segment.Entries[index - segment.Begin];
+	}
+
+	template <typename TKey, typename TData, typename THash, typename TKeyEquality, std::size_t TLinearSearchCapacity>
+	inline typename OrderedHashMap<TKey, TData, THash, TKeyEquality, TLinearSearchCapacity>::SlotType OrderedHashMap<TKey, TData, THash, TKeyEquality, TLinearSearchCapacity>::_Tag(const TKey& key) const
+	{
+		return static_cast<SlotType>(_hash(key));
+	}
+
+	template <typename TKey, typename TData, typename THash, typename TKeyEquality, std::size_t TLinearSearchCapacity>
+	inline typename OrderedHashMap<TKey, TData, THash, TKeyEquality, TLinearSearchCapacity>::size_type OrderedHashMap<TKey, TData, THash, TKeyEquality, TLinearSearchCapacity>::_FindLinear(const TKey& key, SlotType tag) const
+	{
+		assert(_isLinear);
+		for (size_type group = 0; group < _size; group += _GROUP_WIDTH)
+		{
+#if defined(FIEA_ORDERED_HASH_MAP_SSE2)
+			// Compare four hashes at a time and pack the sixteen results into one byte mask
+			const __m128i needle = _mm_set1_epi32(static_cast<int>(tag));
+			const __m128i* hashes = reinterpret_cast<const __m128i*>(_slots + group);
+			const __m128i low = _mm_packs_epi32(_mm_cmpeq_epi32(_mm_loadu_si128(hashes), needle), _mm_cmpeq_epi32(_mm_loadu_si128(hashes + 1), needle));
+			const __m128i high = _mm_packs_epi32(_mm_cmpeq_epi32(_mm_loadu_si128(hashes + 2), needle), _mm_cmpeq_epi32(_mm_loadu_si128(hashes + 3), needle));
+			std::uint32_t matches = static_cast<std::uint32_t>(_mm_movemask_epi8(_mm_packs_epi16(low, high)));
+#else
+			std::uint32_t matches = 0;
+			for (size_type i = 0; i < _GROUP_WIDTH; ++i)
+			{
+				matches |= static_cast<std::uint32_t>(_slots[group + i] == tag) << i;
+			}
+#endif
+			// Padding past the last entry can match too
+			if (_size - group < _GROUP_WIDTH)
+			{
+				matches &= (1u << (_size - group)) - 1;
+			}
+			while (matches != 0)
+			{
+				const size_type index = group + static_cast<size_type>(std::countr_zero(matches));
+				if (_keyEquality(_Entry(index).first, key))
+				{
+					return index;
+				}
+				matches &= matches - 1;
+			}
+		}
+		return _size;
+	}
+
+	template <typename TKey, typename TData, typename THash, typename TKeyEquality, std::size_t TLinearSearchCapacity>
+	inline typename OrderedHashMap<TKey, TData, THash, TKeyEquality, TLinearSearchCapacity>::size_type OrderedHashMap<TKey, TData, THash, TKeyEquality, TLinearSearchCapacity>::_FirstSlot(const TKey& key) const
+	{
+		// Fibonacci hashing spreads weak hashes over the whole index
+		const std::uint64_t mixed = static_cast<std::uint64_t>(_hash(key)) * 0x9E3779B97F4A7C15ull;
+		return static_cast<size_type>(mixed >> 32) & (_slotCount - 1);
+	}
+
+	template <typename TKey, typename TData, typename THash, typename TKeyEquality, std::size_t TLinearSearchCapacity>
+	inline typename OrderedHashMap<TKey, TData, THash, TKeyEquality, TLinearSearchCapacity>::size_type OrderedHashMap<TKey, TData, THash, TKeyEquality, TLinearSearchCapacity>::_FindSlot(const TKey& key) const
+	{
+		assert(_slotCount > 0);
+		const size_type mask = _slotCount - 1;
+		size_type slot = _FirstSlot(key);
+		// The index is never more than three quarters full, so the probe always reaches an empty slot
+		while (_slots[slot] != _EMPTY_SLOT && !_keyEquality(_Entry(_slots[slot] - 1).first, key))
+		{
+			slot = (slot + 1) & mask;
+		}
+		return slot;
+	}
+
+	template <typename TKey, typename TData, typename THash, typename TKeyEquality, std::size_t TLinearSearchCapacity>
+	inline typename OrderedHashMap<TKey, TData, THash, TKeyEquality, TLinearSearchCapacity>::size_type OrderedHashMap<TKey, TData, THash, TKeyEquality, TLinearSearchCapacity>::_FindIndex(const TKey& key) const
+	{
+		if (_slots == nullptr)
+		{
+			return _size;
+		}
+		if (_isLinear)
+		{
+			return _FindLinear(key, _Tag(key));
+		}
+		const SlotType value = _slots[_FindSlot(key)];
+		return value == _EMPTY_SLOT ? _size : value - 1;
+	}
+
+	template <typename TKey, typename TData, typename THash, typename TKeyEquality, std::size_t TLinearSearchCapacity>
+	inline typename OrderedHashMap<TKey, TData, THash, TKeyEquality, TLinearSearchCapacity>::size_type OrderedHashMap<TKey, TData, THash, TKeyEquality, TLinearSearchCapacity>::_SlotCountFor(size_type capacity)
+	{
+		if (_IsLinearFor(capacity))
+		{
+			// Scanning reads whole groups, so the packed hashes are padded to a multiple of the group width
+			return (capacity + _GROUP_WIDTH - 1) / _GROUP_WIDTH * _GROUP_WIDTH;
+		}
+		return std::bit_ceil(std::max(_MINIMUM_SLOT_COUNT, capacity + capacity / 3 + 1));
+	}
+
+	template <typename TKey, typename TData, typename THash, typename TKeyEquality, std::size_t TLinearSearchCapacity>
+	inline bool OrderedHashMap<TKey, TData, THash, TKeyEquality, TLinearSearchCapacity>::_IsLinearFor(size_type capacity)
+	{
+		return capacity <= TLinearSearchCapacity;
+	}
+
+	template <typename TKey, typename TData, typename THash, typename TKeyEquality, std::size_t TLinearSearchCapacity>
+	template <typename... Args>
+	inline typename OrderedHashMap<TKey, TData, THash, TKeyEquality, TLinearSearchCapacity>::PairType& OrderedHashMap<TKey, TData, THash, TKeyEquality, TLinearSearchCapacity>::_Append(const TKey& key, Args&&... args)
+	{
+		if (_size == _capacity)
+		{
+			if (_capacity == _MAXIMUM_SIZE)
+			{
+				throw std::runtime_error("Container is full");
+			}
+			_GrowEntries(std::min(std::max(_capacity, _MINIMUM_SEGMENT_CAPACITY), _MAXIMUM_SIZE - _capacity));
+		}
+
+		if (_isLinear)
+		{
+			return _Construct(_size, _Tag(key), key, std::forward<Args>(args)...);
+		}
+
+		const size_type mask = _slotCount - 1;
+		size_type slot = _FirstSlot(key);
+		while (_slots[slot] != _EMPTY_SLOT)
+		{
+			slot = (slot + 1) & mask;
+		}
+		return _Construct(slot, static_cast<SlotType>(_size + 1), key, std::forward<Args>(args)...);
+	}
+
+	template <typename TKey, typename TData, typename THash, typename TKeyEquality, std::size_t TLinearSearchCapacity>
+	template <typename... Args>
+	inline typename OrderedHashMap<TKey, TData, THash, TKeyEquality, TLinearSearchCapacity>::PairType& OrderedHashMap<TKey, TData, THash, TKeyEquality, TLinearSearchCapacity>::_Construct(size_type slot, SlotType value, const TKey& key, Args&&... args)
+	{
+		assert(_size < _capacity && slot < _slotCount);
+		PairType* entry = new (&_Entry(_size)) PairType(std::piecewise_construct, std::forward_as_tuple(key), std::forward_as_tuple(std::forward<Args>(args)...));
+		_slots[slot] = value;
+		++_size;
+		return *entry;
+	}
+
+	template <typename TKey, typename TData, typename THash, typename TKeyEquality, std::size_t TLinearSearchCapacity>
+	inline void OrderedHashMap<TKey, TData, THash, TKeyEquality, TLinearSearchCapacity>::_GrowEntries(size_type segmentCapacity)
+	{
+		assert(segmentCapacity > 0);
+		// Grow the index first so a failed allocation leaves the index large enough for the capacity
+		const size_type capacity = _capacity + segmentCapacity;
+		const bool isLinear = _IsLinearFor(capacity);
+		const size_type slotCount = _SlotCountFor(capacity);
+		if (_slots == nullptr || isLinear != _isLinear || slotCount > _slotCount)
+		{
+			_RebuildIndex(capacity);
+		}
+
+		const Segment segment{ _alloc.allocate(segmentCapacity), _capacity, segmentCapacity };
+		if (_first.Entries == nullptr)
+		{
+			assert(_capacity == 0);
+			_first = segment;
+		}
+		else
+		{
+			try
+			{
+				_segments.PushBack(segment);
+			}
+			catch (...)
+			{
+				_alloc.deallocate(segment.Entries, segmentCapacity);
+				throw;
+			}
+		}
+		_capacity += segmentCapacity;
+	}
+
+	template <typename TKey, typename TData, typename THash, typename TKeyEquality, std::size_t TLinearSearchCapacity>
+	inline void OrderedHashMap<TKey, TData, THash, TKeyEquality, TLinearSearchCapacity>::_RebuildIndex(size_type capacity)
+	{
+		const bool isLinear = _IsLinearFor(capacity);
+		const size_type slotCount = _SlotCountFor(capacity);
+		SlotType* slots = static_cast<SlotType*>(_alloc.allocate_bytes(slotCount * sizeof(SlotType), alignof(SlotType)));
+		std::fill_n(slots, slotCount, _EMPTY_SLOT);
+		if (_slots != nullptr)
+		{
+			_alloc.deallocate_bytes(_slots, _slotCount * sizeof(SlotType), alignof(SlotType));
+		}
+		_slots = slots;
+		_slotCount = slotCount;
+		_isLinear = isLinear;
+
+		if (_isLinear)
+		{
+			size_type index = 0;
+			for (const PairType& entry : *this)
+			{
+				_slots[index++] = _Tag(entry.first);
+			}
+			return;
+		}
+
+		const size_type mask = _slotCount - 1;
+		SlotType value = 1;
+		for (const PairType& entry : *this)
+		{
+			size_type slot = _FirstSlot(entry.first);
+			while (_slots[slot] != _EMPTY_SLOT)
+			{
+				slot = (slot + 1) & mask;
+			}
+			_slots[slot] = value++;
+		}
+	}
+
+	template <typename TKey, typename TData, typename THash, typename TKeyEquality, std::size_t TLinearSearchCapacity>
+	inline void OrderedHashMap<TKey, TData, THash, TKeyEquality, TLinearSearchCapacity>::_Release()
+	{
+		auto releaseSegment = [this](const Segment& segment)
+		{
+			if (_size > segment.Begin)
+			{
+				std::destroy_n(segment.Entries, std::min(segment.Capacity, _size - segment.Begin));
+			}
+			_alloc.deallocate(segment.Entries, segment.Capacity);
+		};
+
+		if (_first.Entries != nullptr)
+		{
+			releaseSegment(_first);
+		}
+		for (const Segment& segment : _segments)
+		{
+			releaseSegment(segment);
+		}
+		if (_slots != nullptr)
+		{
+			_alloc.deallocate_bytes(_slots, _slotCount * sizeof(SlotType), alignof(SlotType));
+		}
+	}
+#pragma endregion OrderedHashMap
+
+#pragma region const_iterator
+	template <typename TKey, typename TData, typename THash, typename TKeyEquality, std::size_t TLinearSearchCapacity>
+	inline OrderedHashMap<TKey, TData, THash, TKeyEquality, TLinearSearchCapacity>::const_iterator::const_iterator(const iterator& other) :
+		_container(other._container),
+		_entry(other._entry),
+		_index(other._index),
+		_segmentEnd(other._segmentEnd)
+	{
+	}
+
+	template <typename TKey, typename TData, typename THash, typename TKeyEquality, std::size_t TLinearSearchCapacity>
+	inline OrderedHashMap<TKey, TData, THash, TKeyEquality, TLinearSearchCapacity>::const_iterator::const_iterator(const OrderedHashMap& container, size_type index) :
+		_container(&container),
+		_index(index)
+	{
+		if (index < container._size)
+		{
+			const Segment& segment = container._SegmentOf(index);
+			_entry = segment.Entries + (index - segment.Begin);
+			_segmentEnd = segment.Begin + segment.Capacity;
+		}
+	}
+
+	template <typename TKey, typename TData, typename THash, typename TKeyEquality, std::size_t TLinearSearchCapacity>
+	inline typename OrderedHashMap<TKey, TData, THash, TKeyEquality, TLinearSearchCapacity>::const_reference OrderedHashMap<TKey, TData, THash, TKeyEquality, TLinearSearchCapacity>::const_iterator::operator*() const
+	{
+#if FIEA_CHECKED_ITERATORS
+		if (_container == nullptr)
+		{
+			throw std::runtime_error("Iterator is not associated with a container");
+		}
+
+		if (_index >= _container->_size)
+		{
+			throw std::runtime_error("Iterator does not point to an element in the container");
+		}
+#endif
+		return *_entry;
+	}
+
+	template <typename TKey, typename TData, typename THash, typename TKeyEquality, std::size_t TLinearSearchCapacity>
+	inline const typename OrderedHashMap<TKey, TData, THash, TKeyEquality, TLinearSearchCapacity>::const_iterator::value_type* OrderedHashMap<TKey, TData, THash, TKeyEquality, TLinearSearchCapacity>::const_iterator::operator->() const
+	{
+		return &operator*();
+	}
+
+	template <typename TKey, typename TData, typename THash, typename TKeyEquality, std::size_t TLinearSearchCapacity>
+	inline typename OrderedHashMap<TKey, TData, THash, TKeyEquality, TLinearSearchCapacity>::const_iterator& OrderedHashMap<TKey, TData, THash, TKeyEquality, TLinearSearchCapacity>::const_iterator::operator++()
+	{
+#if FIEA_CHECKED_ITERATORS
+		if (_container == nullptr)
+		{
+			throw std::runtime_error("Iterator is not associated with a container");
+		}
+#endif
+		if (_index < _container->_size)
+		{
+			++_index;
+			++_entry;
+			if (_index == _segmentEnd && _index < _container->_size)
+			{
+				*this = const_iterator(*_container, _index);
+			}
+		}
+		return *this;
+	}
+
+	template <typename TKey, typename TData, typename THash, typename TKeyEquality, std::size_t TLinearSearchCapacity>
+	inline typename OrderedHashMap<TKey, TData, THash, TKeyEquality, TLinearSearchCapacity>::const_iterator OrderedHashMap<TKey, TData, THash, TKeyEquality, TLinearSearchCapacity>::const_iterator::operator++(int)
+	{
+		const_iterator it = *this;
+		operator++();
+		return it;
+	}
+
+	template <typename TKey, typename TData, typename THash, typename TKeyEquality, std::size_t TLinearSearchCapacity>
+	inline bool OrderedHashMap<TKey, TData, THash, TKeyEquality, TLinearSearchCapacity>::const_iterator::operator==(const const_iterator& other) const
+	{
+		return _container == other._container && _index == other._index;
+	}
+#pragma endregion const_iterator
+
+#pragma region iterator
+	template <typename TKey, typename TData, typename THash, typename TKeyEquality, std::size_t TLinearSearchCapacity>
+	inline OrderedHashMap<TKey, TData, THash, TKeyEquality, TLinearSearchCapacity>::iterator::iterator(OrderedHashMap& container, size_type index) :
+		_container(&container),
+		_index(index)
+	{
+		if (index < container._size)
+		{
+			const Segment& segment = container._SegmentOf(index);
+			_entry = segment.Entries + (index - segment.Begin);
+			_segmentEnd = segment.Begin + segment.Capacity;
+		}
+	}
+
+	template <typename TKey, typename TData, typename THash, typename TKeyEquality, std::size_t TLinearSearchCapacity>
+	inline typename OrderedHashMap<TKey, TData, THash, TKeyEquality, TLinearSearchCapacity>::reference OrderedHashMap<TKey, TData, THash, TKeyEquality, TLinearSearchCapacity>::iterator::operator*() const
+	{
+#if FIEA_CHECKED_ITERATORS
+		if (_container == nullptr)
+		{
+			throw std::runtime_error("Iterator is not associated with a container");
+		}
+
+		if (_index >= _container->_size)
+		{
+			throw std::runtime_error("Iterator does not point to an element in the container");
+		}
+#endif
+		return *_entry;
+	}
+
+	template <typename TKey, typename TData, typename THash, typename TKeyEquality, std::size_t TLinearSearchCapacity>
+	inline typename OrderedHashMap<TKey, TData, THash, TKeyEquality, TLinearSearchCapacity>::pointer OrderedHashMap<TKey, TData, THash, TKeyEquality, TLinearSearchCapacity>::iterator::operator->() const
+	{
+		return &operator*();
+	}
+
+	template <typename TKey, typename TData, typename THash, typename TKeyEquality, std::size_t TLinearSearchCapacity>
+	inline typename OrderedHashMap<TKey, TData, THash, TKeyEquality, TLinearSearchCapacity>::iterator& OrderedHashMap<TKey, TData, THash, TKeyEquality, TLinearSearchCapacity>::iterator::operator++()
+	{
+#if FIEA_CHECKED_ITERATORS
+		if (_container == nullptr)
+		{
+			throw std::runtime_error("Iterator is not associated with a container");
+		}
+#endif
+		if (_index < _container->_size)
+		{
+			++_index;
+			++_entry;
+			if (_index == _segmentEnd && _index < _container->_size)
+			{
+				*this = iterator(*_container, _index);
+			}
+		}
+		return *this;
+	}
+
+	template <typename TKey, typename TData, typename THash, typename TKeyEquality, std::size_t TLinearSearchCapacity>
+	inline typename OrderedHashMap<TKey, TData, THash, TKeyEquality, TLinearSearchCapacity>::iterator OrderedHashMap<TKey, TData, THash, TKeyEquality, TLinearSearchCapacity>::iterator::operator++(int)
+	{
+		iterator it = *this;
+		operator++();
+		return it;
+	}
+
+	template <typename TKey, typename TData, typename THash, typename TKeyEquality, std::size_t TLinearSearchCapacity>
+	inline bool OrderedHashMap<TKey, TData, THash, TKeyEquality, TLinearSearchCapacity>::iterator::operator==(const iterator& other) const
+	{
+		return _container == other._container && _index == other._index;
+	}
+#pragma endregion iterator
+}
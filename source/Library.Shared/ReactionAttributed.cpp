@@ -28,11 +28,6 @@ namespace FieaGameEngine
 		Game::Instance().Publisher.Subscribe<Event<EventMessageAttributed>>(*this);
 	}
 
-	ReactionAttributed::~ReactionAttributed()
-	{
-		Game::Instance().Publisher.Unsubscribe<Event<EventMessageAttributed>>(*this);
-	}
-
 	void ReactionAttributed::Notify(const EventBase& e) noexcept
 	{
 		assert(e.Is(Event<EventMessageAttributed>::TypeIdClass()));
@@ -48,7 +43,7 @@ namespace FieaGameEngine
 				assert(actionScope.Is(Action::TypeIdClass()));
 				Action& action = static_cast<Action&>(actionScope);
 				message.ForEachAuxiliaryAttribute(
-					[&message, &action](const std::pair<const std::string, Datum>* datumPair)
+					[&message, &action](const std::pair<const Symbol, Datum>* datumPair)
 					{
 						// TODO: cannot support prescribed attributes
 						Datum& attribute = action.Append(datumPair->first);
@@ -73,7 +68,7 @@ namespace FieaGameEngine
 	{
 		return
 		{
-			{"Subtype", DatumTypes::Integer, true, Signature::ExternalInfo{1, offsetof(ReactionAttributed, Subtype)}}
+			{"Subtype"_sym, DatumTypes::Integer, true, Signature::ExternalInfo{1, offsetof(ReactionAttributed, Subtype)}}
 		};
 	}
 }
\ No newline at end of file
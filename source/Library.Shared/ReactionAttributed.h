@@ -9,12 +9,22 @@ namespace FieaGameEngine
 		ATTRIBUTED_DECLARATIONS(ReactionAttributed, Reaction);
 
 	public:
+		/// <summary>
+		/// Slots of the prescribed attributes, in Signatures() order. See Attributed::Slot
+		/// </summary>
+		enum class Slots : std::size_t
+		{
+			Subtype = Reaction::SlotCount
+		};
+		static constexpr std::size_t SlotCount = static_cast<std::size_t>(Slots::Subtype) + 1;
+
 		ReactionAttributed();
 		ReactionAttributed(const ReactionAttributed& rhs);
 		ReactionAttributed(ReactionAttributed&& rhs) noexcept;
 		ReactionAttributed& operator=(const ReactionAttributed& rhs) = default;
 		ReactionAttributed& operator=(ReactionAttributed&& rhs) noexcept = default;
-		~ReactionAttributed();
+		// Subscriptions unlink themselves when the subscriber is destroyed, even while the publisher is updating
+		~ReactionAttributed() = default;
 
 		/// <summary>
 		/// Subtype to match for event message
@@ -6,6 +6,8 @@
 #include <memory>
 #include <memory_resource>
 #include "DefaultEquality.h"
+#include "NodePoolResource.h"
+#include "TriviallyRelocatable.h"
 
 namespace FieaGameEngine
 {
@@ -28,6 +30,8 @@ namespace FieaGameEngine
 		using const_pointer = const value_type*;
 		using EqualityFunctor = std::function<bool(const_reference lhs, const_reference rhs)>;
 		using Allocator = std::pmr::polymorphic_allocator<T>;
+		// Nodes live on the heap, so the list holds no pointers into itself
+		TRIVIALLY_RELOCATABLE(SList);
 
 	private:
 		/// <summary>
@@ -51,6 +55,16 @@ namespace FieaGameEngine
 		};
 
 	public:
+		/// <summary>
+		/// Size of each allocation the list makes, for sizing a NodePoolResource
+		/// </summary>
+		static constexpr std::size_t NodeSize = sizeof(Node);
+
+		/// <summary>
+		/// Alignment of each allocation the list makes, for sizing a NodePoolResource
+		/// </summary>
+		static constexpr std::size_t NodeAlignment = alignof(Node);
+
 		class iterator;
 
 		/// <summary>
@@ -215,6 +229,12 @@ namespace FieaGameEngine
 
 		SList() = default;
 
+		/// <summary>
+		/// Creates an empty forward list that allocates its nodes from a memory resource
+		/// </summary>
+		/// <param name="allocator">Allocator, or the memory resource it allocates from. The resource must outlive the list</param>
+		explicit SList(const Allocator& allocator);
+
 		/// <summary>
 		/// Creates a forward list from an initializer list of values
 		/// </summary>
@@ -231,13 +251,20 @@ namespace FieaGameEngine
 		/// </summary>
 		SList(SList&& rhs) noexcept;
 
+		/// <summary>
+		/// Copy constructor that allocates from a memory resource
+		/// </summary>
+		/// <param name="rhs">List to copy</param>
+		/// <param name="allocator">Allocator of the copy</param>
+		SList(const SList& rhs, const Allocator& allocator);
+
 		/// <summary>
 		/// Copy Assignment
 		/// </summary>
 		SList& operator=(const SList& rhs);
 
 		/// <summary>
-		/// Move Assignment
+		/// Move Assignment. The allocator is not propagated: if rhs allocates from a different resource, its elements are moved one by one
 		/// </summary>
 		SList& operator=(SList&& rhs) noexcept;
 
@@ -367,6 +394,16 @@ namespace FieaGameEngine
 		/// <exception cref="runtime_error">List is empty</exception>
 		void PopBack();
 
+		/// <summary>
+		/// Moves the front node of another list to the back of this list.
+		/// The element is relinked rather than copied or moved, so references to it stay valid.
+		/// Both lists must use the same allocator.
+		/// </summary>
+		/// <param name="source">List to take the front node from</param>
+		/// <exception cref="runtime_error">Source list is empty</exception>
+		/// <returns>Iterator to the moved element in this list</returns>
+		iterator SpliceFrontToBack(SList& source);
+
 		/// <summary>
 		/// Returns if the the list is empty
 		/// </summary>
@@ -407,6 +444,20 @@ namespace FieaGameEngine
 		/// <returns>List size</returns>
 		[[nodiscard]] std::size_t Size() const;
 
+		/// <summary>
+		/// Gets the allocator the list allocates its nodes with
+		/// </summary>
+		/// <returns>Allocator of the list</returns>
+		[[nodiscard]] Allocator GetAllocator() const;
+
+		/// <summary>
+		/// Gets a node pool shared by lists of this type on the calling thread.
+		/// Lists constructed with it allocate nodes from per-thread slabs instead of the heap,
+		/// so they must be used and destroyed on the thread that created them.
+		/// </summary>
+		/// <returns>Node pool of the calling thread</returns>
+		[[nodiscard]] static NodePoolResource& ThreadNodePool();
+
 		/// <summary>
 		/// Removes all values from the list
 		/// </summary>
@@ -26,6 +26,12 @@ namespace FieaGameEngine
 #pragma endregion Node
 
 #pragma region SList
+	template <typename T>
+	inline SList<T>::SList(const Allocator& allocator) :
+		_alloc(allocator)
+	{
+	}
+
 	template <typename T>
 	inline SList<T>::SList(std::initializer_list<value_type> list)
 	{
@@ -48,13 +54,25 @@ namespace FieaGameEngine
 
 	template<typename T>
 	inline SList<T>::SList(SList&& rhs) noexcept :
-		_front(rhs._front), _back(rhs._back), _size(rhs._size)
+		_alloc(rhs._alloc), _size(rhs._size), _front(rhs._front), _back(rhs._back)
 	{
 		rhs._front = nullptr;
 		rhs._back = nullptr;
 		rhs._size = 0;
 	}
 
+	template <typename T>
+	SList<T>::SList(const SList& rhs, const Allocator& allocator) :
+		_alloc(allocator)
+	{
+		Node* currentNode = rhs._front;
+		while (currentNode != nullptr)
+		{
+			PushBack(currentNode->Data);
+			currentNode = currentNode->Next;
+		}
+	}
+
 	template <typename T>
 	SList<T>& SList<T>::operator=(const SList& rhs)
 	{
@@ -83,13 +101,25 @@ namespace FieaGameEngine
 			// Clear list
 			Clear();
 
-			_front = rhs._front;
-			_back = rhs._back;
-			_size = rhs._size;
+			if (_alloc == rhs._alloc)
+			{
+				_front = rhs._front;
+				_back = rhs._back;
+				_size = rhs._size;
 
-			rhs._front = nullptr;
-			rhs._back = nullptr;
-			rhs._size = 0;
+				rhs._front = nullptr;
+				rhs._back = nullptr;
+				rhs._size = 0;
+			}
+			else
+			{
+				// Nodes from another resource cannot be released by ours
+				for (Node* currentNode = rhs._front; currentNode != nullptr; currentNode = currentNode->Next)
+				{
+					PushBack(std::move(currentNode->Data));
+				}
+				rhs.Clear();
+			}
 		}
 
 		return *this;
@@ -147,6 +177,39 @@ namespace FieaGameEngine
 		}
 	}
 
+	template <typename T>
+	inline SList<T>::iterator SList<T>::SpliceFrontToBack(SList& source)
+	{
+		if (source._size == 0)
+		{
+			throw std::runtime_error("List is empty");
+		}
+		assert(_alloc == source._alloc);
+
+		// Unlink from source
+		Node* node = source._front;
+		source._front = node->Next;
+		--source._size;
+		if (source._size == 0)
+		{
+			source._back = nullptr;
+		}
+
+		// Link as new back
+		node->Next = nullptr;
+		if (_back != nullptr)
+		{
+			_back->Next = node;
+		}
+		_back = node;
+		++_size;
+		if (_size == 1)
+		{
+			_front = _back;
+		}
+		return iterator(*this, node);
+	}
+
 	template <typename T>
 	inline SList<T>::iterator SList<T>::PushBack(const_reference item)
 	{
@@ -263,6 +326,19 @@ namespace FieaGameEngine
 		return _size;
 	}
 
+	template <typename T>
+	inline typename SList<T>::Allocator SList<T>::GetAllocator() const
+	{
+		return _alloc;
+	}
+
+	template <typename T>
+	inline NodePoolResource& SList<T>::ThreadNodePool()
+	{
+		thread_local NodePoolResource pool(NodeSize, NodeAlignment);
+		return pool;
+	}
+
 	template <typename T>
 	inline void SList<T>::Clear()
 	{
@@ -386,6 +462,10 @@ namespace FieaGameEngine
 			it._node->Data.~T();
 			_alloc.construct(&it._node->Data, std::move(next->Data));
 			it._node->Next = next->Next;
+			if (next == _back)
+			{
+				_back = it._node;
+			}
 			_alloc.delete_object<Node>(next);
 
 			--_size;
@@ -2,6 +2,8 @@
 #include "Scope.h"
 #include "Factory.h"
 #include <stdexcept>
+#include <algorithm>
+#include <utility>
 
 using namespace std;
 
@@ -9,51 +11,80 @@ namespace FieaGameEngine
 {
 	RTTI_DEFINITIONS(Scope);
 
-	Scope::Scope()
+	Scope::Scope() :
+		_entries(_BoundAllocator())
 	{
 	}
 
 	Scope::Scope(std::size_t capacity) :
-		_hashMap(capacity),
-		_orderedList(capacity)
+		_entries(_BoundAllocator(), capacity)
 	{
+	}
 
+	Scope::Scope(const Allocator& allocator) :
+		_entries(allocator)
+	{
+	}
+
+	Scope::Scope(std::size_t capacity, const Allocator& allocator) :
+		_entries(allocator, capacity)
+	{
 	}
 
 	Scope::Scope(const Scope& rhs) :
-		_orderedList(rhs._orderedList.Size()),
-		_hashMap(rhs._hashMap.BucketCount())
+		Scope(rhs, _BoundAllocator())
 	{
-		for (auto keyPair : rhs._orderedList)
+	}
+
+	Scope::Scope(const Scope& rhs, const Allocator& allocator) :
+		_entries(allocator, rhs.Size())
+	{
+		// Keys of rhs are already unique
+		for (const auto& [name, datum] : rhs._entries)
 		{
-			Datum& datumToCopy = keyPair->second;
-			Datum& newDatum = Append(keyPair->first);
-			if (datumToCopy.Type() == DatumTypes::Table)
-			{
-				for (std::size_t i = 0; i < datumToCopy.Size(); ++i)
-				{
-					unique_ptr<Scope> newScope = datumToCopy.Get<shared_ptr<Scope>>(i)->Clone();
-					newScope->_parent = this;
-					newDatum.PushBack<shared_ptr<Scope>>(std::move(newScope));
-				}
-			}
-			else
-			{
-				newDatum = datumToCopy;
-			}
+			_CopyDatum(_AppendUnique(name), datum);
 		}
 	}
 
 	Scope::Scope(Scope&& rhs) noexcept :
-		_orderedList(std::move(rhs._orderedList)),
-		_hashMap(std::move(rhs._hashMap))
+		_entries(std::move(rhs._entries)), _isBranch(rhs._isBranch)
 	{
+		// rhs no longer nests anything. Orphaning may destroy it
+		rhs._isBranch = false;
+		rhs._Touch();
 		_Orphan(rhs);
 		_FixNestedScopesParents();
 	}
 
 	Scope::~Scope()
 	{
+		// Nested scopes that outlive this one become parentless, so searches through them see the change
+		for (auto& [name, datum] : _entries)
+		{
+			if (datum.Type() == DatumTypes::Table)
+			{
+				for (const shared_ptr<Scope>& scope : datum.AsSpan<shared_ptr<Scope>>())
+				{
+					if (scope != nullptr && scope.use_count() > 1 && scope->_parent == this)
+					{
+						scope->_parent = nullptr;
+						scope->_parentDatum = nullptr;
+						scope->_Touch();
+					}
+				}
+			}
+			else if (datum.Type() == DatumTypes::TablePointer)
+			{
+				for (Scope* scope : datum.AsSpan<Scope*>())
+				{
+					if (scope != nullptr && scope->_parent == this)
+					{
+						scope->_parent = nullptr;
+						scope->_Touch();
+					}
+				}
+			}
+		}
 	}
 
 	Scope& Scope::operator=(const Scope& rhs)
@@ -61,7 +92,7 @@ namespace FieaGameEngine
 		assert(!IsDescendent(rhs));
 		assert(!IsAncestor(rhs));
 
-		Scope temp(rhs);
+		Scope temp(rhs, GetAllocator());
 		swap(*this, temp);
 
 		return *this;
@@ -71,6 +102,8 @@ namespace FieaGameEngine
 	{
 		assert(!IsDescendent(rhs));
 		assert(!IsAncestor(rhs));
+		// The datums of rhs could not be released by our resource, and copying them may throw
+		assert(GetAllocator() == rhs.GetAllocator());
 
 		swap(*this, rhs);
 
@@ -79,35 +112,43 @@ namespace FieaGameEngine
 
 	void swap(Scope& left, Scope& right) noexcept
 	{
+		assert(left.GetAllocator() == right.GetAllocator());
 		using std::swap;
-		swap(left._hashMap, right._hashMap);
-		swap(left._orderedList, right._orderedList);
+		swap(left._entries, right._entries);
+		swap(left._isBranch, right._isBranch);
 
+		left._Touch();
+		right._Touch();
 		left._FixNestedScopesParents();
 		right._FixNestedScopesParents();
 	}
 
-	Datum* Scope::Find(const std::string key)
+	Datum* Scope::Find(Symbol key)
 	{
-		const auto& it = _hashMap.Find(key);
-		if (it == _hashMap.end())
-		{
-			return nullptr;
-		}
-		return &it->second;
+		auto entry = _entries.Find(key);
+		return entry != nullptr ? &entry->second : nullptr;
 	}
 
-	const Datum* Scope::Find(const std::string key) const
+	const Datum* Scope::Find(Symbol key) const
 	{
-		const auto& it = _hashMap.Find(key);
-		if (it == _hashMap.end())
-		{
-			return nullptr;
-		}
-		return &it->second;
+		auto entry = _entries.Find(key);
+		return entry != nullptr ? &entry->second : nullptr;
+	}
+
+	Datum* Scope::Find(std::string_view key)
+	{
+		// A string that was never interned cannot be a key
+		const Symbol symbol = Symbol::Find(key);
+		return symbol.IsEmpty() ? nullptr : Find(symbol);
+	}
+
+	const Datum* Scope::Find(std::string_view key) const
+	{
+		const Symbol symbol = Symbol::Find(key);
+		return symbol.IsEmpty() ? nullptr : Find(symbol);
 	}
 
-	Datum* Scope::Search(const std::string& key, Scope*& ptr)
+	Datum* Scope::Search(Symbol key, Scope*& ptr)
 	{
 		Datum* datum = Find(key);
 		if (datum != nullptr)
@@ -123,7 +164,12 @@ namespace FieaGameEngine
 		return nullptr;
 	}
 
-	const Datum* Scope::Search(const std::string& key, const Scope*& ptr) const
+	Datum* Scope::Search(std::string_view key, Scope*& ptr)
+	{
+		return Search(Symbol::Find(key), ptr);
+	}
+
+	const Datum* Scope::Search(Symbol key, const Scope*& ptr) const
 	{
 		const Datum* datum = Find(key);
 		if (datum != nullptr)
@@ -139,83 +185,167 @@ namespace FieaGameEngine
 		return nullptr;
 	}
 
-	Datum* Scope::Search(const std::string& key)
+	const Datum* Scope::Search(std::string_view key, const Scope*& ptr) const
+	{
+		return Search(Symbol::Find(key), ptr);
+	}
+
+	Datum* Scope::Search(Symbol key)
 	{
 		Scope* scope;
 		return Search(key, scope);
 	}
 
-	const Datum* Scope::Search(const std::string& key) const
+	Datum* Scope::Search(std::string_view key)
+	{
+		Scope* scope;
+		return Search(key, scope);
+	}
+
+	const Datum* Scope::Search(Symbol key) const
 	{
 		const Scope* scope;
 		return Search(key, scope);
 	}
 
-	Datum& Scope::At(const std::string& key)
+	const Datum* Scope::Search(std::string_view key) const
 	{
-		return _hashMap.At(key);
+		const Scope* scope;
+		return Search(key, scope);
 	}
 
-	const Datum& Scope::At(const std::string& key) const
+	Datum* Scope::Search(Symbol key, SearchCache& cache)
 	{
-		return _hashMap.At(key);
+		const std::uint64_t branchGeneration = _branchGeneration.load(std::memory_order_relaxed);
+		if (cache.Searcher != this || cache.Key != key || cache.Generation != _structureGeneration || cache.BranchGeneration != branchGeneration)
+		{
+			cache.Found = Search(key, cache.Owner);
+			cache.Key = key;
+			cache.Searcher = this;
+			cache.Generation = _structureGeneration;
+			cache.BranchGeneration = branchGeneration;
+		}
+		return cache.Found;
+	}
+
+	std::uint64_t Scope::StructureGeneration() const
+	{
+		return _structureGeneration;
+	}
+
+	Datum& Scope::At(Symbol key)
+	{
+		return _entries.At(key);
+	}
+
+	const Datum& Scope::At(Symbol key) const
+	{
+		return _entries.At(key);
+	}
+
+	Datum& Scope::At(std::string_view key)
+	{
+		return At(Symbol::Find(key));
+	}
+
+	const Datum& Scope::At(std::string_view key) const
+	{
+		return At(Symbol::Find(key));
 	}
 
-	Datum& Scope::Append(const std::string& datumName)
+	Datum& Scope::Append(Symbol datumName)
 	{
-		if (datumName == "")
+		if (datumName.IsEmpty())
 		{
 			throw runtime_error("Key cannot be empty");
 		}
 
-		auto [it, wasInserted] = _hashMap.Emplace(std::piecewise_construct, std::forward_as_tuple(datumName), std::forward_as_tuple());
-		// Add to ordered list if this is a new datum
+		auto [entry, wasInserted] = _entries.Emplace(datumName);
 		if (wasInserted)
 		{
-			_orderedList.PushBack(&*it);
+			_Touch();
 		}
-		return it->second;
+		return entry->second;
+	}
+
+	Datum& Scope::Append(std::string_view datumName)
+	{
+		return Append(Symbol(datumName));
 	}
 
-	Scope& Scope::AppendScope(const std::string& datumName, const std::string& className)
+	Datum& Scope::_AppendUnique(Symbol datumName)
 	{
-		if (datumName == "")
+		assert(!datumName.IsEmpty());
+		_Touch();
+		return _entries.EmplaceUnique(datumName).second;
+	}
+
+	void Scope::_CopyDatum(Datum& newDatum, const Datum& datumToCopy)
+	{
+		if (datumToCopy.Type() == DatumTypes::Table)
+		{
+			if (datumToCopy.Size() > 0)
+			{
+				newDatum.SetType(DatumTypes::Table);
+				newDatum.Reserve(newDatum.Size() + datumToCopy.Size());
+			}
+			for (std::size_t i = 0; i < datumToCopy.Size(); ++i)
+			{
+				unique_ptr<Scope> newScope = datumToCopy.Get<shared_ptr<Scope>>(i)->Clone();
+				_Nest(*newScope, newDatum, newDatum.Size());
+				newDatum.PushBack<shared_ptr<Scope>>(std::move(newScope));
+			}
+		}
+		else
+		{
+			newDatum = datumToCopy;
+		}
+	}
+
+	Scope& Scope::AppendScope(Symbol datumName, const std::string& className)
+	{
+		if (datumName.IsEmpty())
 		{
 			throw runtime_error("Key cannot be empty");
 		}
 
-		auto [it, wasInserted] = _hashMap.Emplace(std::piecewise_construct, std::forward_as_tuple(datumName),  std::forward_as_tuple());
-		// Add to ordered list if this is a new datum
+		auto [entry, wasInserted] = _entries.Emplace(datumName);
 		if (wasInserted)
 		{
 			// Datum just created
-			it->second.SetType(DatumTypes::Table);
-			_orderedList.PushBack(&*it);
+			entry->second.SetType(DatumTypes::Table);
+			_Touch();
 		}
 		else
 		{
 			// Datum already exists
-			if (it->second.Type() != DatumTypes::Table)
+			if (entry->second.Type() != DatumTypes::Table)
 			{
 				throw std::runtime_error("Datum is not of type Table");
 			}
 		}
-		// Create scope
-		shared_ptr<Scope> newScope(Factory<Scope>::Create(className));
+		// Create scope, in the bound arena if there is one
+		std::pmr::memory_resource* arena = BoundArena();
+		shared_ptr<Scope> newScope = arena != nullptr ? Factory<Scope>::Create(className, Allocator(arena)) : shared_ptr<Scope>(Factory<Scope>::Create(className));
 		if (newScope == nullptr)
 		{
 			throw runtime_error(std::format("Factory of {} does not exist", className));
 		}
 
-		newScope->_parent = this;
+		_Nest(*newScope, entry->second, entry->second.Size());
 		// Add scope to datum
-		it->second.PushBack<shared_ptr<Scope>>(newScope);
+		entry->second.PushBack<shared_ptr<Scope>>(newScope);
 		return *newScope;
 	}
 
-	void Scope::Adopt(std::shared_ptr<Scope> scope, std::string datumName)
+	Scope& Scope::AppendScope(std::string_view datumName, const std::string& className)
+	{
+		return AppendScope(Symbol(datumName), className);
+	}
+
+	void Scope::Adopt(std::shared_ptr<Scope> scope, Symbol datumName)
 	{
-		if (datumName == "")
+		if (datumName.IsEmpty())
 		{
 			throw runtime_error("Key cannot be empty");
 		}
@@ -230,29 +360,33 @@ namespace FieaGameEngine
 			throw runtime_error("Scope cannot adopt an ancestor of itself");
 		}
 
-		auto [it, wasInserted] = _hashMap.Emplace(std::piecewise_construct, std::forward_as_tuple(datumName), std::forward_as_tuple());
-		// Add to ordered list if this is a new datum
+		auto [entry, wasInserted] = _entries.Emplace(datumName);
 		if (wasInserted)
 		{
-			it->second.SetType(DatumTypes::Table);
-			_orderedList.PushBack(&*it);
+			entry->second.SetType(DatumTypes::Table);
+			_Touch();
 		}
 		else
 		{
-			if (it->second.Type() != DatumTypes::Table)
+			if (entry->second.Type() != DatumTypes::Table)
 			{
 				throw runtime_error("Datum is not of type Table");
 			}
 		}
 		_Orphan(*scope);
-		scope->_parent = this;
+		_Nest(*scope, entry->second, entry->second.Size());
 
-		it->second.PushBack(std::move(scope));
+		entry->second.PushBack(std::move(scope));
 	}
 
-	void Scope::Adopt(Scope* scope, std::string datumName)
+	void Scope::Adopt(std::shared_ptr<Scope> scope, std::string_view datumName)
 	{
-		if (datumName == "")
+		Adopt(std::move(scope), Symbol(datumName));
+	}
+
+	void Scope::Adopt(Scope* scope, Symbol datumName)
+	{
+		if (datumName.IsEmpty())
 		{
 			throw runtime_error("Key cannot be empty");
 		}
@@ -267,23 +401,110 @@ namespace FieaGameEngine
 			throw runtime_error("Scope cannot adopt an ancestor of itself");
 		}
 
-		auto [it, wasInserted] = _hashMap.Emplace(std::piecewise_construct, std::forward_as_tuple(datumName), std::forward_as_tuple());
-		// Add to ordered list if this is a new datum
+		auto [entry, wasInserted] = _entries.Emplace(datumName);
 		if (wasInserted)
 		{
-			it->second.SetType(DatumTypes::TablePointer);
-			_orderedList.PushBack(&*it);
+			entry->second.SetType(DatumTypes::TablePointer);
+			_Touch();
 		}
 		else
 		{
-			if (it->second.Type() != DatumTypes::TablePointer)
+			if (entry->second.Type() != DatumTypes::TablePointer)
 			{
 				throw runtime_error("Datum is not of type Table");
 			}
 		}
+		// Pointers to scopes are not found through the table datums
+		_isBranch = true;
 		scope->_parent = this;
+		scope->_parentDatum = nullptr;
+		scope->_Touch();
+
+		entry->second.PushBack(scope);
+	}
+
+	void Scope::Adopt(Scope* scope, std::string_view datumName)
+	{
+		Adopt(scope, Symbol(datumName));
+	}
+
+	void Scope::AdoptAll(std::span<const std::shared_ptr<Scope>> scopes, Symbol datumName)
+	{
+		if (datumName.IsEmpty())
+		{
+			throw runtime_error("Key cannot be empty");
+		}
+
+		for (const shared_ptr<Scope>& scope : scopes)
+		{
+			if (scope.get() == this)
+			{
+				throw runtime_error("Scope cannot adopt itself");
+			}
+
+			if (IsAncestor(*scope))
+			{
+				throw runtime_error("Scope cannot adopt an ancestor of itself");
+			}
+		}
+
+		auto [entry, wasInserted] = _entries.Emplace(datumName);
+		if (wasInserted)
+		{
+			entry->second.SetType(DatumTypes::Table);
+			_Touch();
+		}
+		else
+		{
+			if (entry->second.Type() != DatumTypes::Table)
+			{
+				throw runtime_error("Datum is not of type Table");
+			}
+		}
+
+		// The span may be the storage of a table datum emptied below, so the scopes are held here first
+		Vector<shared_ptr<Scope>> adopted(scopes.size());
+		for (const shared_ptr<Scope>& scope : scopes)
+		{
+			adopted.PushBack(scope);
+		}
+
+		// Empty the slots of the scopes in their parents, then close the gaps once per datum
+		Vector<Datum*> emptiedDatums;
+		for (const shared_ptr<Scope>& scope : adopted)
+		{
+			if (scope->_parent != nullptr)
+			{
+				auto [datum, index] = scope->_Locate();
+				assert(datum != nullptr);
+				scope->_parent = nullptr;
+				scope->_parentDatum = nullptr;
+				if (datum != nullptr)
+				{
+					datum->Get<shared_ptr<Scope>>(index).reset();
+					if (emptiedDatums.Find(datum) == emptiedDatums.end())
+					{
+						emptiedDatums.PushBack(datum);
+					}
+				}
+			}
+		}
+		for (Datum* datum : emptiedDatums)
+		{
+			_Compact(*datum);
+		}
 
-		it->second.PushBack(scope);
+		Datum& datum = entry->second;
+		datum.Reserve(datum.Size() + adopted.Size());
+		for (const shared_ptr<Scope>& scope : adopted)
+		{
+			// Every scope is parentless by now, unless it was given more than once
+			if (scope->_parent != this)
+			{
+				_Nest(*scope, datum, datum.Size());
+				datum.PushBack(scope);
+			}
+		}
 	}
 
 	bool Scope::IsAncestor(const Scope& scope) const
@@ -309,32 +530,39 @@ namespace FieaGameEngine
 		return _parent;
 	}
 
-	Datum& Scope::operator[](const std::string& key)
+	std::size_t Scope::Size() const
+	{
+		return _entries.Size();
+	}
+
+	Scope::Allocator Scope::GetAllocator() const
+	{
+		return Allocator(_entries.GetAllocator());
+	}
+
+	Datum& Scope::operator[](Symbol key)
+	{
+		return Append(key);
+	}
+
+	Datum& Scope::operator[](std::string_view key)
 	{
 		return Append(key);
 	}
 
 	Datum& Scope::operator[](const std::size_t index)
 	{
-		return _orderedList[index]->second;
+		return _entries.EntryAt(index).second;
 	}
 
 	bool Scope::operator==(const Scope& rhs) const
 	{
-		if (_orderedList.Size() != rhs._orderedList.Size())
+		if (_entries.Size() != rhs._entries.Size())
 		{
 			return false;
 		}
 
-		for (std::size_t i = 0; i < _orderedList.Size(); ++i)
-		{
-			if (*_orderedList[i] != *rhs._orderedList[i])
-			{
-				return false;
-			}
-		}
-
-		return true;
+		return std::equal(_entries.begin(), _entries.end(), rhs._entries.begin());
 	}
 
 	bool Scope::operator!=(const Scope& rhs) const
@@ -351,6 +579,11 @@ namespace FieaGameEngine
 		return rhs->Is(_typeId) ? *this == *rhs->As<Scope>() : false;
 	}
 
+	std::pair<Datum*, std::size_t> Scope::GetParentSlot() const
+	{
+		return { _parentDatum, _parentIndex };
+	}
+
 	std::pair<Datum*, std::size_t> Scope::FindContainedScope(const Scope& scope) const
 	{
 		auto [datum, index] = _ForEachNestedScope(
@@ -366,41 +599,135 @@ namespace FieaGameEngine
 		return std::make_unique<Scope>(*this);
 	}
 
+	Scope::Allocator Scope::_BoundAllocator()
+	{
+		std::pmr::memory_resource* arena = BoundArena();
+		return arena != nullptr ? Allocator(arena) : Allocator();
+	}
+
 	void Scope::_Orphan(Scope& scope)
 	{
 		if (scope._parent != nullptr)
 		{
-			auto [datum, index] = scope._parent->FindContainedScope(scope);
+			auto [datum, index] = scope._Locate();
 			assert(datum != nullptr);
+			scope._parent = nullptr;
+			scope._parentDatum = nullptr;
+			// Removing the slot may destroy the scope
+			scope._Touch();
 			if (datum != nullptr)
 			{
-				datum->Get<shared_ptr<Scope>>(index)->_parent = nullptr;
-				datum->RemoveAt(index);
+				_RemoveSlot(*datum, index);
 			}
 		}
 	}
 
 	void Scope::_FixNestedScopesParents()
 	{
-		_ForEachNestedScope(
-			[this](Scope& nestedScope)
+		for (auto& [name, datum] : _entries)
+		{
+			if (datum.Type() == DatumTypes::Table)
 			{
-				nestedScope._parent = this;
-				return false;
+				for (std::size_t i = 0; i < datum.Size(); ++i)
+				{
+					_Nest(*datum.Get<shared_ptr<Scope>>(i), datum, i);
+				}
+			}
+		}
+	}
+
+	void Scope::_Nest(Scope& scope, Datum& datum, std::size_t index)
+	{
+		_isBranch = true;
+		scope._parent = this;
+		scope._parentDatum = &datum;
+		scope._parentIndex = index;
+		scope._Touch();
+	}
+
+	std::uint64_t Scope::_NextGeneration()
+	{
+		return _lastGeneration.fetch_add(1, std::memory_order_relaxed) + 1;
+	}
+
+	void Scope::_Touch()
+	{
+		_structureGeneration = _NextGeneration();
+		if (_isBranch)
+		{
+			_branchGeneration.fetch_add(1, std::memory_order_relaxed);
+		}
+	}
+
+	std::pair<Datum*, std::size_t> Scope::_Locate() const
+	{
+		assert(_parent != nullptr);
+		if (_parentDatum != nullptr && _parentDatum->Type() == DatumTypes::Table)
+		{
+			std::span<const shared_ptr<Scope>> scopes = std::as_const(*_parentDatum).AsSpan<shared_ptr<Scope>>();
+			if (_parentIndex < scopes.size() && scopes[_parentIndex].get() == this)
+			{
+				return { _parentDatum, _parentIndex };
+			}
+		}
+
+		return _parent->_ForEachNestedScope(
+			[this](const Scope& nestedScope)
+			{
+				return &nestedScope == this;
 			});
 	}
 
+	void Scope::_RemoveSlot(Datum& datum, std::size_t index)
+	{
+		std::span<shared_ptr<Scope>> scopes = datum.AsSpan<shared_ptr<Scope>>();
+		assert(index < scopes.size());
+		if (index + 1 != scopes.size())
+		{
+			std::swap(scopes[index], scopes.back());
+			if (scopes[index] != nullptr && scopes[index]->_parentDatum == &datum)
+			{
+				scopes[index]->_parentIndex = index;
+			}
+		}
+		datum.PopBack();
+	}
+
+	void Scope::_Compact(Datum& datum)
+	{
+		std::span<shared_ptr<Scope>> scopes = datum.AsSpan<shared_ptr<Scope>>();
+		std::size_t kept = 0;
+		for (shared_ptr<Scope>& scope : scopes)
+		{
+			if (scope != nullptr)
+			{
+				if (scope->_parentDatum == &datum)
+				{
+					scope->_parentIndex = kept;
+				}
+				if (&scopes[kept] != &scope)
+				{
+					scopes[kept] = std::move(scope);
+				}
+				++kept;
+			}
+		}
+		datum.Resize(kept);
+	}
+
 	std::pair<Datum*, size_t> Scope::_ForEachNestedScope(NestedScopeFunction func) const
 	{
-		for (auto keyPair : _orderedList)
+		for (const auto& entry : _entries)
 		{
-			Datum& datum = keyPair->second;
+			// Visiting nested scopes does not change the datums of this scope
+			Datum& datum = const_cast<Datum&>(entry.second);
 			if (datum.Type() == DatumTypes::Table)
 			{
 				for (std::size_t i = 0; i < datum.Size(); ++i)
 				{
-					Scope& scope = *datum.Get<shared_ptr<Scope>>(i);
-					if (func(scope))
+					// Slots are only empty while AdoptAll moves scopes out of them
+					const shared_ptr<Scope>& scope = datum.Get<shared_ptr<Scope>>(i);
+					if (scope != nullptr && func(*scope))
 					{
 						return std::pair(&datum, i);
 					}
@@ -1,14 +1,20 @@
 #pragma once
 
 #include <string>
+#include <string_view>
 #include <stdexcept>
 #include <functional>
+#include <atomic>
+#include <cstdint>
 #include <gsl/gsl>
 #include <memory>
+#include <span>
 #include "RTTI.h"
 #include "Vector.h"
+#include "OrderedHashMap.h"
 #include "Datum.h"
 #include "Factory.h"
+#include "Symbol.h"
 
 namespace FieaGameEngine
 {
@@ -20,25 +26,87 @@ namespace FieaGameEngine
 	RTTI_DECLARATIONS(Scope, RTTI);
 
 	public:
+		using Allocator = std::pmr::polymorphic_allocator<>;
 
 		/// <summary>
-		/// Constructor
+		/// Remembers where a search from a scope resolved, so repeating it costs a walk up the parents comparing generations
+		/// until the structure of a scope the search went through changes. Keep one per call site, for example as a member of the searching object.
+		/// </summary>
+		struct SearchCache final
+		{
+			/// <summary>
+			/// Key that was searched for
+			/// </summary>
+			Symbol Key;
+
+			/// <summary>
+			/// Scope the search started from
+			/// </summary>
+			const Scope* Searcher = nullptr;
+
+			/// <summary>
+			/// Scope that contains the datum found, or null if it was not found
+			/// </summary>
+			Scope* Owner = nullptr;
+
+			/// <summary>
+			/// Datum found, or null if it was not found
+			/// </summary>
+			Datum* Found = nullptr;
+
+			/// <summary>
+			/// Structure generation of the searcher. Zero is never current
+			/// </summary>
+			std::uint64_t Generation = 0;
+
+			/// <summary>
+			/// Count of changes to scopes with nested scopes, which are the only scopes a search goes up through
+			/// </summary>
+			std::uint64_t BranchGeneration = 0;
+		};
+
+		/// <summary>
+		/// Constructor. The table of datums is allocated from the arena bound to the thread, if any
 		/// </summary>
 		Scope();
 
 		/// <summary>
-		/// Constructor
+		/// Constructor. The table of datums is allocated from the arena bound to the thread, if any
 		/// </summary>
 		/// <param name="capacity">Initial capacity of the scope</param>
 		explicit Scope(std::size_t capacity);
+
+		/// <summary>
+		/// Constructs a scope whose table of datums is allocated from a memory resource.
+		/// Datum values and nested scopes allocate on their own, so to build a whole tree on a resource,
+		/// construct the nested scopes on it too and adopt them
+		/// </summary>
+		/// <param name="allocator">Allocator, or the memory resource it allocates from. The resource must outlive the scope</param>
+		explicit Scope(const Allocator& allocator);
+
+		/// <summary>
+		/// Constructs a scope whose table of datums is allocated from a memory resource
+		/// </summary>
+		/// <param name="capacity">Initial capacity of the scope</param>
+		/// <param name="allocator">Allocator, or the memory resource it allocates from. The resource must outlive the scope</param>
+		Scope(std::size_t capacity, const Allocator& allocator);
 		
 		/// <summary>
 		/// Copy constructor
-		/// The parent of the newly constructor object will be null
+		/// The parent of the newly constructor object will be null.
+		/// The table of datums is allocated from the arena bound to the thread, if any
 		/// </summary>
 		/// <param name="rhs">Scope to copy</param>
 		Scope(const Scope& rhs);
 
+		/// <summary>
+		/// Copy constructor that allocates from a memory resource.
+		/// The parent of the newly constructor object will be null
+		/// </summary>
+		/// <param name="rhs">Scope to copy</param>
+		/// <param name="allocator">Allocator of the copy</param>
+		Scope(const Scope& rhs, const Allocator& allocator);
+
 		/// <summary>
 		/// Move constructor.
 		/// If the rhs has a parent, the rhs will be deleted, otherwise
@@ -65,13 +133,14 @@ namespace FieaGameEngine
 		/// to this object. If the rhs has a parent, the rhs will be deleted, otherwise
 		/// it will be in an unusable state.
 		/// This does not change the parent of the left hand side.
+		/// Both scopes must allocate from the same resource; copy assign scopes on different resources.
 		/// </summary>
 		/// <param name="rhs">Scope to move</param>
 		/// <returns></returns>
 		Scope& operator=(Scope&& rhs) noexcept;
 
 		/// <summary>
-		/// Swaps two scopes
+		/// Swaps two scopes. Both must allocate from the same resource
 		/// </summary>
 		/// <param name="left">First scope</param>
 		/// <param name="right">Second scope</param>
@@ -83,15 +152,33 @@ namespace FieaGameEngine
 		/// </summary>
 		/// <param name="key">Name of the datum to retrieve</param>
 		/// <returns>Datum address associated with the key</returns>
-		Datum* Find(const std::string key);
+		Datum* Find(Symbol key);
+
+		/// <summary>
+		/// Gets the address of the Datum associated with the given name in this scope.
+		/// If the name does not exist, null is returned.
+		/// </summary>
+		/// <param name="key">Name of the datum to retrieve</param>
+		/// <returns>Datum address associated with the key</returns>
+		const Datum* Find(Symbol key) const;
 
 		/// <summary>
 		/// Gets the address of the Datum associated with the given name in this scope.
 		/// If the name does not exist, null is returned.
+		/// Prefer the Symbol overload on hot paths; this one looks the string up in the symbol table first.
 		/// </summary>
 		/// <param name="key">Name of the datum to retrieve</param>
 		/// <returns>Datum address associated with the key</returns>
-		const Datum* Find(const std::string key) const;
+		Datum* Find(std::string_view key);
+
+		/// <summary>
+		/// Gets the address of the Datum associated with the given name in this scope.
+		/// If the name does not exist, null is returned.
+		/// Prefer the Symbol overload on hot paths; this one looks the string up in the symbol table first.
+		/// </summary>
+		/// <param name="key">Name of the datum to retrieve</param>
+		/// <returns>Datum address associated with the key</returns>
+		const Datum* Find(std::string_view key) const;
 
 		/// <summary>
 		/// Gets the address of the closest nested Datum associated with
@@ -103,7 +190,7 @@ namespace FieaGameEngine
 		/// <param name="ptr">Output variable that will be written to.
 		/// Will contain the address of the scope object which contains the match</param>
 		/// <returns>Address of the datum found or nullptr</returns>
-		Datum* Search(const std::string& key, Scope*& ptr);
+		Datum* Search(Symbol key, Scope*& ptr);
 
 		/// <summary>
 		/// Gets the address of the closest nested Datum associated with
@@ -115,7 +202,7 @@ namespace FieaGameEngine
 		/// <param name="ptr">Output variable that will be written to.
 		/// Will contain the address of the scope object which contains the match</param>
 		/// <returns>Address of the datum found or nullptr</returns>
-		const Datum* Search(const std::string& key, const Scope*& ptr) const;
+		Datum* Search(std::string_view key, Scope*& ptr);
 
 		/// <summary>
 		/// Gets the address of the closest nested Datum associated with
@@ -124,8 +211,10 @@ namespace FieaGameEngine
 		/// If there is no datum found with this key, null is returned.
 		/// </summary>
 		/// <param name="key">Datum key to search</param>
+		/// <param name="ptr">Output variable that will be written to.
+		/// Will contain the address of the scope object which contains the match</param>
 		/// <returns>Address of the datum found or nullptr</returns>
-		Datum* Search(const std::string& key);
+		const Datum* Search(Symbol key, const Scope*& ptr) const;
 
 		/// <summary>
 		/// Gets the address of the closest nested Datum associated with
@@ -134,44 +223,167 @@ namespace FieaGameEngine
 		/// If there is no datum found with this key, null is returned.
 		/// </summary>
 		/// <param name="key">Datum key to search</param>
+		/// <param name="ptr">Output variable that will be written to.
+		/// Will contain the address of the scope object which contains the match</param>
 		/// <returns>Address of the datum found or nullptr</returns>
-		const Datum* Search(const std::string& key) const;
+		const Datum* Search(std::string_view key, const Scope*& ptr) const;
 
-		Datum& At(const std::string& key);
-		const Datum& At(const std::string& key) const;
+		/// <summary>
+		/// Gets the address of the closest nested Datum associated with
+		/// the given name in this scope or its ancestors. This method goes up
+		/// the nested Scope heiarchy to find a datum with the matching key.
+		/// If there is no datum found with this key, null is returned.
+		/// </summary>
+		/// <param name="key">Datum key to search</param>
+		/// <returns>Address of the datum found or nullptr</returns>
+		Datum* Search(Symbol key);
+
+		/// <summary>
+		/// Gets the address of the closest nested Datum associated with
+		/// the given name in this scope or its ancestors. This method goes up
+		/// the nested Scope heiarchy to find a datum with the matching key.
+		/// If there is no datum found with this key, null is returned.
+		/// </summary>
+		/// <param name="key">Datum key to search</param>
+		/// <returns>Address of the datum found or nullptr</returns>
+		Datum* Search(std::string_view key);
+
+		/// <summary>
+		/// Gets the address of the closest nested Datum associated with
+		/// the given name in this scope or its ancestors. This method goes up
+		/// the nested Scope heiarchy to find a datum with the matching key.
+		/// If there is no datum found with this key, null is returned.
+		/// </summary>
+		/// <param name="key">Datum key to search</param>
+		/// <returns>Address of the datum found or nullptr</returns>
+		const Datum* Search(Symbol key) const;
+
+		/// <summary>
+		/// Gets the address of the closest nested Datum associated with
+		/// the given name in this scope or its ancestors. This method goes up
+		/// the nested Scope heiarchy to find a datum with the matching key.
+		/// If there is no datum found with this key, null is returned.
+		/// </summary>
+		/// <param name="key">Datum key to search</param>
+		/// <returns>Address of the datum found or nullptr</returns>
+		const Datum* Search(std::string_view key) const;
+
+		/// <summary>
+		/// Searches this scope and its ancestors like Search, but reuses the result held in the cache
+		/// while neither this scope nor any scope that nests others has changed structure, checking two counters rather than
+		/// walking the parents. Scopes without nested scopes, such as most leaves, can be created, changed and destroyed elsewhere
+		/// without invalidating it. The owning scope is written to cache.Owner.
+		/// </summary>
+		/// <param name="key">Datum key to search</param>
+		/// <param name="cache">Result of the previous search from this call site. Updated if it is stale</param>
+		/// <returns>Address of the datum found or nullptr</returns>
+		Datum* Search(Symbol key, SearchCache& cache);
+
+		/// <summary>
+		/// Gets the structure generation of this scope, which changes whenever it appends a datum, swaps its datums,
+		/// or is given another parent. Each change takes a new value from a counter shared by every scope, so a generation
+		/// is higher than any taken before it. The counter is atomic; a scope itself is not thread safe.
+		/// </summary>
+		/// <returns>Current structure generation of this scope</returns>
+		[[nodiscard]] std::uint64_t StructureGeneration() const;
+
+		/// <summary>
+		/// Gets the Datum associated with the given name in this scope
+		/// </summary>
+		/// <param name="key">Name of the datum to retrieve</param>
+		/// <exception cref="runtime_error">Key does not exist in the scope</exception>
+		/// <returns>Datum associated with the key</returns>
+		Datum& At(Symbol key);
+
+		/// <summary>
+		/// Gets the Datum associated with the given name in this scope
+		/// </summary>
+		/// <param name="key">Name of the datum to retrieve</param>
+		/// <exception cref="runtime_error">Key does not exist in the scope</exception>
+		/// <returns>Datum associated with the key</returns>
+		const Datum& At(Symbol key) const;
+
+		Datum& At(std::string_view key);
+		const Datum& At(std::string_view key) const;
 
 		/// <summary>
 		/// Adds a datum to the scope with the given name.
 		/// If the name already exist, then the prexisting datum will be returned.
 		/// </summary>
 		/// <param name="datumName">Datum name to append</param>
+		/// <exception cref="runtime_error">Name is empty</exception>
 		/// <returns>Datum at the key</returns>
-		Datum& Append(const std::string& datumName);
+		Datum& Append(Symbol datumName);
+
+		/// <summary>
+		/// Adds a datum to the scope with the given name. The name is interned.
+		/// If the name already exist, then the prexisting datum will be returned.
+		/// </summary>
+		/// <param name="datumName">Datum name to append</param>
+		/// <exception cref="runtime_error">Name is empty</exception>
+		/// <returns>Datum at the key</returns>
+		Datum& Append(std::string_view datumName);
 
 		/// <summary>
 		/// Adds a datum to the scope with the given name and adds a newly created scope to the datum.
 		/// If the name already exist, then the newly created scope will be appended to the prexisting datum.
+		/// While an arena is bound to the thread, the new scope is allocated from it.
 		/// </summary>
 		/// <param name="datumName">Datum name to append</param>
 		/// <param name="className">Scope derived class to create</param>
 		/// <returns>The newly created scope</returns>
-		Scope& AppendScope(const std::string& datumName, const std::string& className = "Scope");
+		Scope& AppendScope(Symbol datumName, const std::string& className = "Scope");
+
+		/// <summary>
+		/// Adds a datum to the scope with the given name and adds a newly created scope to the datum.
+		/// If the name already exist, then the newly created scope will be appended to the prexisting datum.
+		/// </summary>
+		/// <param name="datumName">Datum name to append</param>
+		/// <param name="className">Scope derived class to create</param>
+		/// <returns>The newly created scope</returns>
+		Scope& AppendScope(std::string_view datumName, const std::string& className = "Scope");
+
+		/// <summary>
+		/// Adds a scope this scope. If the provided scope already has a parent,
+		/// it is orphaned and reparented to this scope. Its slot in the old parent is filled by the last scope of that datum.
+		/// </summary>
+		/// <param name="scope">Scope to nest into this scope</param>
+		/// <param name="datumName">Datum name to put the scope</param>
+		void Adopt(std::shared_ptr<Scope> scope, Symbol datumName);
+
+		/// <summary>
+		/// Adds a scope this scope. If the provided scope already has a parent,
+		/// it is orphaned and reparented to this scope. Its slot in the old parent is filled by the last scope of that datum.
+		/// </summary>
+		/// <param name="scope">Scope to nest into this scope</param>
+		/// <param name="datumName">Datum name to put the scope</param>
+		void Adopt(std::shared_ptr<Scope> scope, std::string_view datumName);
 
 		/// <summary>
 		/// Adds a scope this scope. If the provided scope already has a parent,
-		/// it is orphaned and reparented to this scope.
+		/// it is orphaned and reparented to this scope. Its slot in the old parent is filled by the last scope of that datum.
 		/// </summary>
 		/// <param name="scope">Scope to nest into this scope</param>
 		/// <param name="datumName">Datum name to put the scope</param>
-		void Adopt(std::shared_ptr<Scope> scope, std::string datumName);
+		void Adopt(Scope* scope, Symbol datumName);
 
 		/// <summary>
 		/// Adds a scope this scope. If the provided scope already has a parent,
-		/// it is orphaned and reparented to this scope.
+		/// it is orphaned and reparented to this scope. Its slot in the old parent is filled by the last scope of that datum.
 		/// </summary>
 		/// <param name="scope">Scope to nest into this scope</param>
 		/// <param name="datumName">Datum name to put the scope</param>
-		void Adopt(Scope* scope, std::string datumName);
+		void Adopt(Scope* scope, std::string_view datumName);
+
+		/// <summary>
+		/// Adds scopes to this scope, in order. Scopes that already have a parent are orphaned and reparented to this scope.
+		/// Unlike Adopt, the scopes left in each datum the scopes are taken from keep their order; each such datum is compacted once.
+		/// A scope given more than once is adopted once.
+		/// </summary>
+		/// <param name="scopes">Scopes to nest into this scope, which may be the storage of a table datum they are taken from</param>
+		/// <param name="datumName">Datum name to put the scopes</param>
+		/// <exception cref="runtime_error">Name is empty, a scope is this scope or one of its ancestors, or the datum is not of type Table</exception>
+		void AdoptAll(std::span<const std::shared_ptr<Scope>> scopes, Symbol datumName);
 
 		/// <summary>
 		/// Checks if the the provided scope is an ancestor of this scope
@@ -194,12 +406,31 @@ namespace FieaGameEngine
 		/// <returns></returns>
 		[[nodiscard]] Scope* GetParent() const;
 
+		/// <summary>
+		/// Gets the number of datums in this scope
+		/// </summary>
+		/// <returns>Number of datums</returns>
+		[[nodiscard]] std::size_t Size() const;
+
+		/// <summary>
+		/// Gets the allocator the scope allocates its table of datums with
+		/// </summary>
+		/// <returns>Allocator of the scope</returns>
+		[[nodiscard]] Allocator GetAllocator() const;
+
 		/// <summary>
 		/// Wraps the append method
 		/// </summary>
 		/// <param name="key">Key to append</param>
 		/// <returns>Datum at the associated key</returns>
-		Datum& operator[](const std::string& key);
+		Datum& operator[](Symbol key);
+
+		/// <summary>
+		/// Wraps the append method
+		/// </summary>
+		/// <param name="key">Key to append</param>
+		/// <returns>Datum at the associated key</returns>
+		Datum& operator[](std::string_view key);
 
 		/// <summary>
 		/// Gets a reference to the datum at the index the datum was appended
@@ -231,6 +462,13 @@ namespace FieaGameEngine
 		/// <returns>True if equal; otherwise false</returns>
 		bool Equals(const RTTI* rhs) const override;
 
+		/// <summary>
+		/// Gets the table datum of the parent this scope is in, and its index there, as recorded when the scope was nested
+		/// and updated as its siblings move. Editing the table datum directly, rather than through this class, is not reflected.
+		/// </summary>
+		/// <returns>Datum address and the index within the datum, or null and 0 if the scope has no parent or was adopted by pointer</returns>
+		[[nodiscard]] std::pair<Datum*, std::size_t> GetParentSlot() const;
+
 		/// <summary>
 		/// Attempts to find a given nested child scope within this object.
 		/// If the scope is found, the datum associated with the scope and the index
@@ -247,15 +485,69 @@ namespace FieaGameEngine
 		[[nodiscard]] virtual std::unique_ptr<Scope> Clone() const;
 
 	protected:
-		Vector<std::pair<const std::string, Datum>*> _orderedList;
-		HashMap<const std::string, Datum> _hashMap;
+		// Datums in the order they were appended. References to them stay valid as the scope grows
+		OrderedHashMap<Symbol, Datum> _entries;
+
+		/// <summary>
+		/// Appends a datum whose name is known not to be in this scope, skipping the lookup Append does
+		/// </summary>
+		/// <param name="datumName">Name of the new datum. Must not be empty or already in the scope</param>
+		/// <returns>The new datum</returns>
+		Datum& _AppendUnique(Symbol datumName);
+
+		/// <summary>
+		/// Copies a datum into a datum of this scope. Nested scopes are cloned and parented to this scope
+		/// </summary>
+		/// <param name="newDatum">Datum of this scope to copy into</param>
+		/// <param name="datumToCopy">Datum to copy</param>
+		void _CopyDatum(Datum& newDatum, const Datum& datumToCopy);
 
 	private:
 		Scope* _parent = nullptr;
 
+		// Where this scope is in its parent. Every method that moves scopes keeps it exact; only editing the table datum directly makes it stale
+		Datum* _parentDatum = nullptr;
+		std::size_t _parentIndex = 0;
+
+		// Last generation handed out, so a new one is higher than every generation of every scope
+		inline static std::atomic<std::uint64_t> _lastGeneration = 0;
+
+		// Changed whenever the datums or the parent of this scope change, so cached searches from it resolve again
+		std::uint64_t _structureGeneration = _NextGeneration();
+
+		// Bumped whenever a scope that has ever nested another is changed, so cached searches from its descendants resolve again.
+		// Scopes without nested scopes are the ones that change most, and leave it alone
+		inline static std::atomic<std::uint64_t> _branchGeneration = 0;
+
+		// Set once this scope nests another
+		bool _isBranch = false;
+
+		friend class ScopeArena;
+		friend class ScopePath;
+
+		// Allocator of the arena bound to the thread, or of the default resource
+		[[nodiscard]] static Allocator _BoundAllocator();
+
+		[[nodiscard]] static std::uint64_t _NextGeneration();
+
+		// Gives this scope a new structure generation
+		void _Touch();
+
 		void _Orphan(Scope& scope);
 		void _FixNestedScopesParents();
 
+		// Parents a scope to this scope at the given slot of one of its table datums
+		void _Nest(Scope& scope, Datum& datum, std::size_t index);
+
+		// Finds this scope in its parent at the recorded slot, or by searching the parent if the slot is stale
+		[[nodiscard]] std::pair<Datum*, std::size_t> _Locate() const;
+
+		// Removes a slot of a table datum by moving the last scope into it, recording the moved scope's new slot
+		static void _RemoveSlot(Datum& datum, std::size_t index);
+
+		// Removes the empty slots of a table datum, keeping the order of the rest and recording their new slots
+		static void _Compact(Datum& datum);
+
 		using NestedScopeFunction = std::function<bool(Scope&)>;
 		std::pair<Datum*, std::size_t> _ForEachNestedScope(NestedScopeFunction func) const;
 	};
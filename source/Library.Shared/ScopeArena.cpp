@@ -0,0 +1,96 @@
+#include "pch.h"
+#include "ScopeArena.h"
+#include <cassert>
+#include <string>
+
+using namespace std;
+
+namespace FieaGameEngine
+{
+	ScopeArena::Binding::Binding(ScopeArena& arena) :
+		_previous(BindArena(&arena._resource))
+	{
+	}
+
+	ScopeArena::Binding::~Binding()
+	{
+		BindArena(_previous);
+	}
+
+	ScopeArena::ScopeArena(std::size_t initialSize) :
+		_resource(initialSize)
+	{
+		_CreateRoot();
+	}
+
+	ScopeArena::~ScopeArena()
+	{
+		std::destroy_at(_root);
+	}
+
+	Scope& ScopeArena::Root()
+	{
+		return *_root;
+	}
+
+	std::pmr::memory_resource* ScopeArena::Resource()
+	{
+		return &_resource;
+	}
+
+	void ScopeArena::Clear()
+	{
+		std::destroy_at(_root);
+		_resource.release();
+		_CreateRoot();
+	}
+
+	void ScopeArena::Release()
+	{
+		assert(_IsSelfContained(*_root));
+
+		_resource.release();
+		_CreateRoot();
+	}
+
+	void ScopeArena::_CreateRoot()
+	{
+		void* storage = _resource.allocate(sizeof(Scope), alignof(Scope));
+		_root = new (storage) Scope(Scope::Allocator(&_resource));
+	}
+
+	bool ScopeArena::_IsSelfContained(const Scope& scope) const
+	{
+		const size_t inlineCapacity = string().capacity();
+		for (const auto& [name, datum] : scope._entries)
+		{
+			if (!datum._isExternal && !datum._isInline && datum._heap.Data != nullptr && !datum._isArena)
+			{
+				return false;
+			}
+
+			if (datum.Type() == DatumTypes::String)
+			{
+				for (size_t i = 0; i < datum.Size(); ++i)
+				{
+					if (datum.Get<string>(i).capacity() > inlineCapacity)
+					{
+						return false;
+					}
+				}
+			}
+			else if (datum.Type() == DatumTypes::Table)
+			{
+				for (size_t i = 0; i < datum.Size(); ++i)
+				{
+					const Scope& nestedScope = *datum.Get<shared_ptr<Scope>>(i);
+					if (nestedScope.GetAllocator().resource() != &_resource || !_IsSelfContained(nestedScope))
+					{
+						return false;
+					}
+				}
+			}
+		}
+		return true;
+	}
+}
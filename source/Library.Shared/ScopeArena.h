@@ -0,0 +1,112 @@
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <memory_resource>
+#include "Scope.h"
+#include "BoundArena.h"
+
+namespace FieaGameEngine
+{
+	/// <summary>
+	/// Memory arena that a whole tree of scopes is built in: the scope objects, their tables of datums and the datum storage.
+	/// Destroying the arena destroys the tree as usual. Release instead discards the tree and all of its memory in one step,
+	/// without walking it or running any destructor.
+	/// Attribute keys are interned symbols, so the tree holds no key strings of its own.
+	/// </summary>
+	class ScopeArena final
+	{
+	public:
+		/// <summary>
+		/// Binds an arena to the calling thread while it is alive, so the scopes and datum storage created meanwhile come from it.
+		/// Bindings nest; the arena bound before is bound again when the binding ends
+		/// </summary>
+		class Binding final
+		{
+		public:
+			/// <summary>
+			/// Binds an arena to the calling thread
+			/// </summary>
+			/// <param name="arena">Arena to bind</param>
+			explicit Binding(ScopeArena& arena);
+			Binding(const Binding&) = delete;
+			Binding(Binding&&) = delete;
+			Binding& operator=(const Binding&) = delete;
+			Binding& operator=(Binding&&) = delete;
+
+			/// <summary>
+			/// Binds the arena that was bound before
+			/// </summary>
+			~Binding();
+
+		private:
+			std::pmr::memory_resource* _previous;
+		};
+
+		/// <summary>
+		/// Size of the first block the arena takes from the heap. Later blocks grow geometrically
+		/// </summary>
+		static constexpr std::size_t DefaultInitialSize = 64 * 1024;
+
+		/// <summary>
+		/// Constructor. Creates an empty root scope in the arena
+		/// </summary>
+		/// <param name="initialSize">Size of the first block the arena takes from the heap</param>
+		explicit ScopeArena(std::size_t initialSize = DefaultInitialSize);
+		ScopeArena(const ScopeArena&) = delete;
+		ScopeArena(ScopeArena&&) = delete;
+		ScopeArena& operator=(const ScopeArena&) = delete;
+		ScopeArena& operator=(ScopeArena&&) = delete;
+
+		/// <summary>
+		/// Destroys the tree, running the destructors of every scope, then frees the arena
+		/// </summary>
+		~ScopeArena();
+
+		/// <summary>
+		/// Gets the root of the tree. Nested scopes adopted into it or appended to it while the arena is bound belong to the arena
+		/// </summary>
+		/// <returns>Root scope</returns>
+		[[nodiscard]] Scope& Root();
+
+		/// <summary>
+		/// Creates a scope in the arena, with the arena bound while it is constructed
+		/// </summary>
+		/// <typeparam name="T">Scope or a class derived from it</typeparam>
+		/// <param name="args">Arguments of the constructor</param>
+		/// <returns>The new scope, ready to adopt</returns>
+		template <typename T = Scope, typename... Args>
+		[[nodiscard]] std::shared_ptr<T> MakeShared(Args&&... args);
+
+		/// <summary>
+		/// Gets the memory resource of the arena
+		/// </summary>
+		/// <returns>Memory resource of the arena</returns>
+		[[nodiscard]] std::pmr::memory_resource* Resource();
+
+		/// <summary>
+		/// Destroys the tree, running the destructors of every scope, and frees the arena. The root is replaced with an empty scope
+		/// </summary>
+		void Clear();
+
+		/// <summary>
+		/// Discards the tree and frees the arena without running any destructor. The root is replaced with an empty scope.
+		/// Only for trees that keep all of their memory in the arena and whose destructors have no other side effects:
+		/// build them while the arena is bound, create nested scopes with AppendScope or MakeShared, and keep string values
+		/// short enough to be stored inside the string. Debug builds check this.
+		/// Nothing outside the tree may still refer to it.
+		/// </summary>
+		void Release();
+
+	private:
+		std::pmr::monotonic_buffer_resource _resource;
+		Scope* _root = nullptr;
+
+		void _CreateRoot();
+
+		// Whether every datum and nested scope under the scope keeps its memory in the arena
+		[[nodiscard]] bool _IsSelfContained(const Scope& scope) const;
+	};
+}
+
+#include "ScopeArena.inl"
@@ -0,0 +1,11 @@
+#include "ScopeArena.h"
+
+namespace FieaGameEngine
+{
+	template <typename T, typename... Args>
+	inline std::shared_ptr<T> ScopeArena::MakeShared(Args&&... args)
+	{
+		Binding binding(*this);
+		return std::allocate_shared<T>(std::pmr::polymorphic_allocator<T>(&_resource), std::forward<Args>(args)...);
+	}
+}
@@ -0,0 +1,149 @@
+#include "pch.h"
+#include "ScopePath.h"
+#include <charconv>
+#include <stdexcept>
+#include <format>
+
+using namespace std;
+
+namespace FieaGameEngine
+{
+	ScopePath::ScopePath(std::string_view path)
+	{
+		if (path.empty())
+		{
+			throw runtime_error("Path cannot be empty");
+		}
+
+		size_t position = 0;
+		while (position <= path.size())
+		{
+			const size_t end = min(path.find('.', position), path.size());
+			string_view component = path.substr(position, end - position);
+			position = end + 1;
+
+			Step& step = *_steps.EmplaceBack();
+			const size_t open = component.find('[');
+			if (open != string_view::npos)
+			{
+				const string_view index = component.substr(open + 1, component.size() - open - 1);
+				if (index.empty() || index.back() != ']')
+				{
+					throw runtime_error(format("Malformed index in path component {}", component));
+				}
+				if (index == "*]")
+				{
+					step.Index = _WILDCARD;
+					_hasWildcard = true;
+				}
+				else
+				{
+					const auto [last, error] = from_chars(index.data(), index.data() + index.size() - 1, step.Index);
+					if (error != errc{} || last != index.data() + index.size() - 1)
+					{
+						throw runtime_error(format("Malformed index in path component {}", component));
+					}
+				}
+				component = component.substr(0, open);
+			}
+
+			if (component.empty() || component.find(']') != string_view::npos)
+			{
+				throw runtime_error(format("Path {} has an empty or malformed component", path));
+			}
+			step.Name = Symbol(component);
+		}
+
+		if (path.back() == ']')
+		{
+			throw runtime_error(format("Path {} must end with a datum name", path));
+		}
+	}
+
+	Datum* ScopePath::Resolve(Scope& root)
+	{
+		if (_hasWildcard)
+		{
+			throw runtime_error("Path with a wildcard can match many datums");
+		}
+
+		std::span<Datum* const> results = ResolveAll(root);
+		return results.empty() ? nullptr : results.front();
+	}
+
+	std::span<Datum* const> ScopePath::ResolveAll(Scope& root)
+	{
+		_results.Clear();
+		_Gather(root, 0);
+		return _results.AsSpan();
+	}
+
+	bool ScopePath::HasWildcard() const
+	{
+		return _hasWildcard;
+	}
+
+	Datum* ScopePath::_Find(Scope& scope, Step& step)
+	{
+		auto& entries = scope._entries;
+		if (step.EntryHint < entries.Size())
+		{
+			auto& entry = entries.EntryAt(step.EntryHint);
+			if (entry.first == step.Name)
+			{
+				return &entry.second;
+			}
+		}
+
+		const size_t index = entries.IndexOf(step.Name);
+		if (index == entries.Size())
+		{
+			return nullptr;
+		}
+		step.EntryHint = index;
+		return &entries.EntryAt(index).second;
+	}
+
+	void ScopePath::_Gather(Scope& scope, std::size_t stepIndex)
+	{
+		Step& step = _steps[stepIndex];
+		Datum* const datum = _Find(scope, step);
+		if (datum == nullptr)
+		{
+			return;
+		}
+
+		if (stepIndex + 1 == _steps.Size())
+		{
+			_results.PushBack(datum);
+			return;
+		}
+
+		const Datum& scopes = *datum;
+		const size_t begin = step.Index == _WILDCARD ? 0 : step.Index;
+		const size_t end = step.Index == _WILDCARD ? scopes.Size() : min(step.Index + 1, scopes.Size());
+		// Empty slots hold no scope, so nothing below them matches
+		if (scopes.Type() == DatumTypes::Table)
+		{
+			for (size_t i = begin; i < end; ++i)
+			{
+				const shared_ptr<Scope>& nested = scopes.Get<shared_ptr<Scope>>(i);
+				if (nested != nullptr)
+				{
+					_Gather(*nested, stepIndex + 1);
+				}
+			}
+		}
+		else if (scopes.Type() == DatumTypes::TablePointer)
+		{
+			for (size_t i = begin; i < end; ++i)
+			{
+				Scope* const nested = scopes.Get<Scope*>(i);
+				if (nested != nullptr)
+				{
+					_Gather(*nested, stepIndex + 1);
+				}
+			}
+		}
+	}
+}
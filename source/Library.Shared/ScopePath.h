@@ -0,0 +1,77 @@
+#pragma once
+
+#include <cstddef>
+#include <limits>
+#include <span>
+#include <string_view>
+#include "Scope.h"
+#include "Symbol.h"
+#include "Vector.h"
+
+namespace FieaGameEngine
+{
+	/// <summary>
+	/// Path to datums nested in a tree of scopes, such as "Children[3].Transform.Position", compiled once into interned names.
+	/// Each component names a datum of the current scope. A table datum in the middle of the path continues into its scope
+	/// at the bracketed index, or into its first scope without one. "[*]" continues into every scope of the datum, so the
+	/// path can match many datums. The last component names the datums the path resolves to.
+	/// Every name remembers the entry index it was last found at, which scopes of the same layout share, so resolving
+	/// the path again mostly skips hashing.
+	/// </summary>
+	class ScopePath final
+	{
+	public:
+		/// <summary>
+		/// Compiles a path
+		/// </summary>
+		/// <param name="path">Components separated by dots, each a datum name optionally followed by [index] or [*]</param>
+		/// <exception cref="runtime_error">Path is empty, has an empty component, a malformed index, or an index on its last component</exception>
+		explicit ScopePath(std::string_view path);
+
+		/// <summary>
+		/// Resolves a path without wildcards from a scope
+		/// </summary>
+		/// <param name="root">Scope the first component is found in</param>
+		/// <exception cref="runtime_error">Path has a wildcard</exception>
+		/// <returns>Address of the datum at the path, or nullptr if some component does not exist</returns>
+		[[nodiscard]] Datum* Resolve(Scope& root);
+
+		/// <summary>
+		/// Resolves a path from a scope, gathering every datum it matches in the order the scopes are nested.
+		/// The span stays valid until this path is resolved again or destroyed
+		/// </summary>
+		/// <param name="root">Scope the first component is found in</param>
+		/// <returns>Addresses of the datums at the path</returns>
+		[[nodiscard]] std::span<Datum* const> ResolveAll(Scope& root);
+
+		/// <summary>
+		/// Checks if the path has a wildcard, and so can match more than one datum
+		/// </summary>
+		/// <returns>True if some component is followed by [*]; otherwise false</returns>
+		[[nodiscard]] bool HasWildcard() const;
+
+	private:
+		// Index of a component that continues into every scope of its table datum
+		static constexpr std::size_t _WILDCARD = std::numeric_limits<std::size_t>::max();
+
+		struct Step final
+		{
+			Symbol Name;
+			std::size_t Index = 0;
+			// Entry index the name was last found at
+			std::size_t EntryHint = 0;
+		};
+
+		Vector<Step> _steps;
+		bool _hasWildcard = false;
+
+		// Result of the last resolve, kept so its storage is reused
+		Vector<Datum*> _results;
+
+		// Finds the datum of a step in a scope, trying the entry the name was last found at first
+		[[nodiscard]] static Datum* _Find(Scope& scope, Step& step);
+
+		// Follows the steps from the given one, appending the datums the last step finds to the results
+		void _Gather(Scope& scope, std::size_t stepIndex);
+	};
+}
@@ -2,6 +2,7 @@
 
 #include <string>
 #include "Datum.h"
+#include "Symbol.h"
 #include <Variant>
 
 namespace FieaGameEngine
@@ -14,7 +15,7 @@ namespace FieaGameEngine
 			std::size_t Offset;
 		};
 
-		std::string Name;
+		Symbol Name;
 		DatumTypes Type;
 		bool IsExternal;
 		std::variant<std::monostate, ExternalInfo> SigInfo;
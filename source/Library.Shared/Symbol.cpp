@@ -0,0 +1,235 @@
+#include "pch.h"
+
+#include "Symbol.h"
+#include <array>
+#include <atomic>
+#include <bit>
+#include <memory>
+#include <mutex>
+#include <limits>
+#include <vector>
+#include <gsl/gsl>
+#if defined(_MSC_VER) && defined(_DEBUG)
+#include <crtdbg.h>
+#endif
+
+using namespace std;
+
+namespace FieaGameEngine
+{
+	struct Symbol::Table final
+	{
+		struct Entry final
+		{
+			string Text;
+			uint32_t Hash = 0;
+		};
+
+		// Open addressing index of ids, 0 marking an empty slot
+		struct Index final
+		{
+			explicit Index(size_t capacity) :
+				Mask(capacity - 1), Slots(make_unique<atomic<uint32_t>[]>(capacity))
+			{
+				assert(has_single_bit(capacity));
+			}
+
+			size_t Mask;
+			unique_ptr<atomic<uint32_t>[]> Slots;
+			size_t Size = 0;
+		};
+
+		// Chunk k holds FIRST_CHUNK_SIZE << k entries, so entries never move and every 32-bit id fits in a few chunks
+		static constexpr size_t FIRST_CHUNK_BITS = 8;
+		static constexpr size_t FIRST_CHUNK_SIZE = size_t(1) << FIRST_CHUNK_BITS;
+		static constexpr size_t CHUNK_COUNT = 32 - FIRST_CHUNK_BITS + 1;
+		static constexpr size_t FIRST_INDEX_CAPACITY = 1024;
+
+		Table();
+		~Table();
+
+		[[nodiscard]] const Entry& At(uint32_t id) const;
+
+		// Id of an interned string, or 0. Safe to call while another thread interns
+		[[nodiscard]] uint32_t Find(string_view text, uint32_t hash) const;
+
+		// Interns a string that is not in the table. Takes the mutex
+		[[nodiscard]] uint32_t Add(string_view text, uint32_t hash);
+
+		[[nodiscard]] static uint32_t HashOf(string_view text);
+
+		array<atomic<Entry*>, CHUNK_COUNT> Chunks{};
+		atomic<uint32_t> Count = 0;
+
+		// A full index is replaced by a larger copy. Replaced copies are kept, since lookups on other threads may still be reading them
+		atomic<Index*> Current = nullptr;
+		vector<unique_ptr<Index>> Indices;
+
+		// Only interning takes it. Reading strings and finding symbols never lock
+		mutex Mutex;
+
+	private:
+		[[nodiscard]] static pair<size_t, size_t> _Locate(uint32_t id);
+		static void _Place(Index& index, uint32_t id, uint32_t hash);
+	};
+
+	Symbol::Table::Table()
+	{
+		// Id 0 is the empty string
+		Chunks[0].store(new Entry[FIRST_CHUNK_SIZE], memory_order_release);
+		Count.store(1, memory_order_release);
+		Current.store(Indices.emplace_back(make_unique<Index>(FIRST_INDEX_CAPACITY)).get(), memory_order_release);
+	}
+
+	Symbol::Table::~Table()
+	{
+		for (atomic<Entry*>& chunk : Chunks)
+		{
+			delete[] chunk.load(memory_order_relaxed);
+		}
+	}
+
+	const Symbol::Table::Entry& Symbol::Table::At(uint32_t id) const
+	{
+		const auto [chunk, offset] = _Locate(id);
+		return Chunks[chunk].load(memory_order_acquire)[offset];
+	}
+
+	uint32_t Symbol::Table::Find(string_view text, uint32_t hash) const
+	{
+		const Index& index = *Current.load(memory_order_acquire);
+		for (size_t slot = hash & index.Mask;; slot = (slot + 1) & index.Mask)
+		{
+			const uint32_t id = index.Slots[slot].load(memory_order_acquire);
+			if (id == 0)
+			{
+				return 0;
+			}
+			const Entry& entry = At(id);
+			if (entry.Hash == hash && entry.Text == text)
+			{
+				return id;
+			}
+		}
+	}
+
+	uint32_t Symbol::Table::Add(string_view text, uint32_t hash)
+	{
+		const uint32_t id = Count.load(memory_order_relaxed);
+		if (id == numeric_limits<uint32_t>::max())
+		{
+			throw runtime_error("Symbol table is full");
+		}
+
+		const auto [chunk, offset] = _Locate(id);
+		Entry* entries = Chunks[chunk].load(memory_order_relaxed);
+		if (entries == nullptr)
+		{
+			entries = new Entry[FIRST_CHUNK_SIZE << chunk];
+			Chunks[chunk].store(entries, memory_order_release);
+		}
+		entries[offset] = Entry{ string(text), hash };
+		Count.store(id + 1, memory_order_release);
+
+		// Keep the index at most half full so probes stay short
+		Index* index = Current.load(memory_order_relaxed);
+		if ((index->Size + 1) * 2 > index->Mask + 1)
+		{
+			index = Indices.emplace_back(make_unique<Index>((index->Mask + 1) * 2)).get();
+			for (uint32_t existing = 1; existing < id; ++existing)
+			{
+				_Place(*index, existing, At(existing).Hash);
+			}
+			index->Size = id - 1;
+			Current.store(index, memory_order_release);
+		}
+		_Place(*index, id, hash);
+		++index->Size;
+		return id;
+	}
+
+	uint32_t Symbol::Table::HashOf(string_view text)
+	{
+		const size_t hash = DefaultHash<string_view>{}(text);
+		return static_cast<uint32_t>(hash ^ (hash >> 32));
+	}
+
+	pair<size_t, size_t> Symbol::Table::_Locate(uint32_t id)
+	{
+		const size_t biased = static_cast<size_t>(id) + FIRST_CHUNK_SIZE;
+		const size_t chunk = static_cast<size_t>(bit_width(biased)) - 1 - FIRST_CHUNK_BITS;
+		return { chunk, biased - (FIRST_CHUNK_SIZE << chunk) };
+	}
+
+	void Symbol::Table::_Place(Index& index, uint32_t id, uint32_t hash)
+	{
+		size_t slot = hash & index.Mask;
+		while (index.Slots[slot].load(memory_order_relaxed) != 0)
+		{
+			slot = (slot + 1) & index.Mask;
+		}
+		// Publishes the entry written before it to lookups on other threads
+		index.Slots[slot].store(id, memory_order_release);
+	}
+
+	// Create the table before anything runs that checks for memory leaks
+	[[maybe_unused]] static const size_t _startupSymbolCount = Symbol::Count();
+
+	Symbol::Symbol(string_view text)
+	{
+		if (text.empty())
+		{
+			return;
+		}
+
+		Table& table = _GetTable();
+		const uint32_t hash = Table::HashOf(text);
+		uint32_t id = table.Find(text, hash);
+		if (id == 0)
+		{
+			lock_guard lock(table.Mutex);
+			// Another thread may have interned the string since the lookup
+			id = table.Find(text, hash);
+			if (id == 0)
+			{
+#if defined(_MSC_VER) && defined(_DEBUG)
+				// The table lives for the whole process. Allocations made while interning are not tracked,
+				// so leak checks around code that introduces new names are not affected
+				const int debugFlags = _CrtSetDbgFlag(_CRTDBG_REPORT_FLAG);
+				_CrtSetDbgFlag(debugFlags & ~_CRTDBG_ALLOC_MEM_DF);
+				auto restoreDebugFlags = gsl::finally([debugFlags]() { _CrtSetDbgFlag(debugFlags); });
+#endif
+				id = table.Add(text, hash);
+			}
+		}
+		*this = Symbol(id, hash);
+	}
+
+	Symbol Symbol::Find(string_view text)
+	{
+		if (text.empty())
+		{
+			return Symbol();
+		}
+
+		const uint32_t hash = Table::HashOf(text);
+		const uint32_t id = _GetTable().Find(text, hash);
+		return id != 0 ? Symbol(id, hash) : Symbol();
+	}
+
+	size_t Symbol::Count()
+	{
+		return _GetTable().Count.load(memory_order_acquire);
+	}
+
+	const string& Symbol::Str() const
+	{
+		return _GetTable().At(_id).Text;
+	}
+
+	Symbol::Table& Symbol::_GetTable()
+	{
+		static Table table;
+		return table;
+	}
+}
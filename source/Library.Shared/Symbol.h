@@ -0,0 +1,137 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <algorithm>
+#include "DefaultHash.h"
+
+namespace FieaGameEngine
+{
+	/// <summary>
+	/// Interned string. Every distinct string is stored once in a process-wide table and
+	/// given a stable 32-bit id, so symbols compare and hash as integers.
+	/// The table only grows: it is never cleared, so every string interned stays for the life of the process,
+	/// including the keys of every parsed JSON file and the names of auxiliary attributes.
+	/// Symbols are meant for names (attribute keys, types), not arbitrary text.
+	/// Symbols can be interned and read from any thread. Only interning a new string takes a lock;
+	/// reading a symbol's string and finding a symbol never do.
+	/// </summary>
+	class Symbol final
+	{
+	public:
+		/// <summary>
+		/// Creates the empty symbol
+		/// </summary>
+		Symbol() = default;
+
+		/// <summary>
+		/// Interns a string. If the string is already in the table, the existing symbol is returned.
+		/// </summary>
+		/// <param name="text">String to intern</param>
+		explicit Symbol(std::string_view text);
+
+		/// <summary>
+		/// Finds the symbol of a string without interning it
+		/// </summary>
+		/// <param name="text">String to find</param>
+		/// <returns>Symbol of the string, or the empty symbol if the string has never been interned</returns>
+		[[nodiscard]] static Symbol Find(std::string_view text);
+
+		/// <summary>
+		/// Gets the number of strings interned in the table, including the empty string
+		/// </summary>
+		/// <returns>Number of symbols</returns>
+		[[nodiscard]] static std::size_t Count();
+
+		/// <summary>
+		/// Gets the id of this symbol. The empty symbol has id 0.
+		/// </summary>
+		/// <returns>Id of the symbol</returns>
+		[[nodiscard]] std::uint32_t Id() const;
+
+		/// <summary>
+		/// Gets the hash of the string, computed once when it was interned
+		/// </summary>
+		/// <returns>Hash of the symbol</returns>
+		[[nodiscard]] std::size_t Hash() const;
+
+		/// <summary>
+		/// Gets the interned string. The reference stays valid for the lifetime of the process.
+		/// </summary>
+		/// <returns>String of the symbol</returns>
+		[[nodiscard]] const std::string& Str() const;
+
+		/// <summary>
+		/// Checks if this is the empty symbol
+		/// </summary>
+		/// <returns>True if the symbol is empty; otherwise false</returns>
+		[[nodiscard]] bool IsEmpty() const;
+
+		/// <summary>
+		/// Compares two symbols by id
+		/// </summary>
+		/// <returns>True if the symbols are the same string; otherwise false</returns>
+		friend bool operator==(const Symbol& lhs, const Symbol& rhs);
+
+		/// <summary>
+		/// Compares a symbol against a string
+		/// </summary>
+		/// <returns>True if the symbol is the string; otherwise false</returns>
+		friend bool operator==(const Symbol& lhs, std::string_view rhs);
+
+	private:
+		struct Table;
+
+		Symbol(std::uint32_t id, std::uint32_t hash);
+
+		// Process-wide string table, created on first use
+		[[nodiscard]] static Table& _GetTable();
+
+		std::uint32_t _id = 0;
+		std::uint32_t _hash = 0;
+	};
+
+	/// <summary>
+	/// String literal used as a template argument by the _sym literal operator
+	/// </summary>
+	template <std::size_t Length>
+	struct SymbolLiteral final
+	{
+		constexpr SymbolLiteral(const char (&text)[Length])
+		{
+			std::copy_n(text, Length, Text);
+		}
+
+		char Text[Length];
+	};
+
+	/// <summary>
+	/// Symbol literal. "Name"_sym interns "Name" the first time the expression runs
+	/// and returns the cached symbol after that.
+	/// </summary>
+	/// <returns>Symbol of the literal</returns>
+	template <SymbolLiteral Literal>
+	[[nodiscard]] Symbol operator""_sym();
+
+	/// <summary>
+	/// Symbol specialization. Uses the hash computed when the symbol was interned
+	/// </summary>
+	template <>
+	struct DefaultHash<Symbol>
+	{
+		size_t operator()(const Symbol& key) const;
+	};
+
+	/// <summary>
+	/// Symbol specialization. Uses the hash computed when the symbol was interned
+	/// </summary>
+	template <>
+	struct DefaultHash<const Symbol>
+	{
+		size_t operator()(const Symbol& key) const;
+	};
+}
+
+#include "Symbol.inl"
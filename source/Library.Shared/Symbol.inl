@@ -0,0 +1,53 @@
+#include "Symbol.h"
+
+namespace FieaGameEngine
+{
+	inline Symbol::Symbol(std::uint32_t id, std::uint32_t hash) :
+		_id(id),
+		_hash(hash)
+	{
+	}
+
+	inline std::uint32_t Symbol::Id() const
+	{
+		return _id;
+	}
+
+	inline std::size_t Symbol::Hash() const
+	{
+		return _hash;
+	}
+
+	inline bool Symbol::IsEmpty() const
+	{
+		return _id == 0;
+	}
+
+	[[nodiscard]] inline bool operator==(const Symbol& lhs, const Symbol& rhs)
+	{
+		return lhs._id == rhs._id;
+	}
+
+	[[nodiscard]] inline bool operator==(const Symbol& lhs, std::string_view rhs)
+	{
+		return lhs.Str() == rhs;
+	}
+
+	template <SymbolLiteral Literal>
+	inline Symbol operator""_sym()
+	{
+		// Interned once per literal
+		static const Symbol symbol(std::string_view(Literal.Text, std::size(Literal.Text) - 1));
+		return symbol;
+	}
+
+	inline size_t DefaultHash<Symbol>::operator()(const Symbol& key) const
+	{
+		return key.Hash();
+	}
+
+	inline size_t DefaultHash<const Symbol>::operator()(const Symbol& key) const
+	{
+		return key.Hash();
+	}
+}
@@ -38,9 +38,9 @@ namespace FieaGameEngine
     {
         return
         {
-            {"Position", DatumTypes::Vector, true, Signature::ExternalInfo{1, offsetof(Transform, Position)}},
-            {"Rotation", DatumTypes::Vector, true, Signature::ExternalInfo{1, offsetof(Transform, Rotation)}},
-            {"Scale", DatumTypes::Vector, true, Signature::ExternalInfo{1, offsetof(Transform, Scale)}}
+            {"Position"_sym, DatumTypes::Vector, true, Signature::ExternalInfo{1, offsetof(Transform, Position)}},
+            {"Rotation"_sym, DatumTypes::Vector, true, Signature::ExternalInfo{1, offsetof(Transform, Rotation)}},
+            {"Scale"_sym, DatumTypes::Vector, true, Signature::ExternalInfo{1, offsetof(Transform, Scale)}}
         };
     }
 }
\ No newline at end of file
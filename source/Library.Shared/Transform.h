@@ -13,6 +13,17 @@ namespace FieaGameEngine
 
     public:
 
+        /// <summary>
+        /// Slots of the prescribed attributes, in Signatures() order. See Attributed::Slot
+        /// </summary>
+        enum class Slots : std::size_t
+        {
+            Position = FieaGameEngine::Attributed::SlotCount,
+            Rotation,
+            Scale
+        };
+        static constexpr std::size_t SlotCount = static_cast<std::size_t>(Slots::Scale) + 1;
+
         Transform();
         Transform(const Transform& rhs);
         Transform(Transform&& rhs) noexcept;
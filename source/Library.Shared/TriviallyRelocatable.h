@@ -0,0 +1,116 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstring>
+#include <memory>
+#include <type_traits>
+#include <utility>
+
+/// <summary>
+/// Opts a class into IsTriviallyRelocatable, in the spirit of [[trivially_relocatable]].
+/// Use in a public section, and only if moving the object's bytes to a new address and forgetting the old ones
+/// is equivalent to move constructing and destroying it: no pointers into itself and no registrations of its own address.
+/// Derived classes do not inherit the opt in.
+/// </summary>
+#define TRIVIALLY_RELOCATABLE(Type) using TriviallyRelocatableType = Type
+
+namespace FieaGameEngine
+{
+	template <typename T>
+	concept DeclaresTriviallyRelocatable = std::is_same_v<typename T::TriviallyRelocatableType, T>;
+
+	/// <summary>
+	/// Whether containers may move a T to new storage with memcpy (or realloc) instead of move constructing and destroying it.
+	/// True for trivially copyable types and types that opt in with TRIVIALLY_RELOCATABLE. Specialize for other types.
+	/// </summary>
+	template <typename T>
+	struct IsTriviallyRelocatable : std::bool_constant<std::is_trivially_copyable_v<T> || DeclaresTriviallyRelocatable<T>>
+	{
+	};
+
+	template <typename T>
+	struct IsTriviallyRelocatable<std::shared_ptr<T>> : std::true_type
+	{
+	};
+
+	template <typename T>
+	struct IsTriviallyRelocatable<std::weak_ptr<T>> : std::true_type
+	{
+	};
+
+	template <typename T>
+	struct IsTriviallyRelocatable<std::unique_ptr<T>> : std::true_type
+	{
+	};
+
+	template <typename TFirst, typename TSecond>
+	struct IsTriviallyRelocatable<std::pair<TFirst, TSecond>> : std::bool_constant<IsTriviallyRelocatable<std::remove_const_t<TFirst>>::value && IsTriviallyRelocatable<std::remove_const_t<TSecond>>::value>
+	{
+	};
+
+	template <typename T>
+	inline constexpr bool IsTriviallyRelocatableV = IsTriviallyRelocatable<std::remove_cv_t<T>>::value;
+
+	/// <summary>
+	/// Moves objects to uninitialized storage and ends their lifetime at the source.
+	/// Trivially relocatable objects are copied bytewise; others are moved (or copied, if moving could throw) and then destroyed,
+	/// so a throwing copy leaves the source intact.
+	/// </summary>
+	/// <param name="destination">Uninitialized storage for count objects. Must not overlap the source</param>
+	/// <param name="source">Objects to relocate. Left uninitialized</param>
+	/// <param name="count">Number of objects</param>
+	template <typename T>
+	void Relocate(T* destination, T* source, std::size_t count)
+	{
+		if (count == 0)
+		{
+			return;
+		}
+
+		if constexpr (IsTriviallyRelocatableV<T>)
+		{
+			std::memcpy(static_cast<void*>(destination), static_cast<const void*>(source), count * sizeof(T));
+		}
+		else
+		{
+			if constexpr (std::is_nothrow_move_constructible_v<T> || !std::is_copy_constructible_v<T>)
+			{
+				std::uninitialized_move(source, source + count, destination);
+			}
+			else
+			{
+				std::uninitialized_copy(source, source + count, destination);
+			}
+			std::destroy_n(source, count);
+		}
+	}
+
+	/// <summary>
+	/// Closes a gap of destroyed objects by shifting the objects after it to the front
+	/// </summary>
+	/// <param name="gap">First destroyed object</param>
+	/// <param name="gapSize">Number of destroyed objects</param>
+	/// <param name="count">Number of live objects after the gap. The last gapSize slots are left uninitialized</param>
+	template <typename T>
+	void CloseGap(T* gap, std::size_t gapSize, std::size_t count)
+	{
+		if (count == 0 || gapSize == 0)
+		{
+			return;
+		}
+
+		if constexpr (IsTriviallyRelocatableV<T>)
+		{
+			std::memmove(static_cast<void*>(gap), static_cast<const void*>(gap + gapSize), count * sizeof(T));
+		}
+		else
+		{
+			// Construct into the destroyed slots, assign over live ones, then destroy the vacated tail
+			const std::size_t constructed = std::min(gapSize, count);
+			std::uninitialized_move(gap + gapSize, gap + gapSize + constructed, gap);
+			std::move(gap + gapSize + constructed, gap + gapSize + count, gap + constructed);
+			std::destroy(gap + std::max(gapSize, count), gap + gapSize + count);
+		}
+	}
+}
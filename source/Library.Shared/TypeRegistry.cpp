@@ -0,0 +1,77 @@
+#include "pch.h"
+
+#include "TypeRegistry.h"
+#include <stdexcept>
+#include <utility>
+
+using namespace std;
+
+namespace FieaGameEngine
+{
+	size_t TypeRegistry::TypeInfo::IndexOf(Symbol name) const
+	{
+		auto it = SignatureIndices.Find(name);
+		return it != SignatureIndices.end() ? it->second : Signatures.Size();
+	}
+
+	bool TypeRegistry::TypeInfo::IsPrescribed(Symbol name) const
+	{
+		return SignatureIndices.ContainsKey(name);
+	}
+
+	const TypeRegistry::TypeInfo& TypeRegistry::Register(RTTI::IdType typeId, const TypeInfo* parent, const Vector<Signature>& signatures)
+	{
+		HashMap<RTTI::IdType, TypeInfo>& types = _Types();
+		auto [it, wasInserted] = types.Insert(std::make_pair(typeId, TypeInfo()));
+		TypeInfo& typeInfo = it->second;
+		if (!wasInserted)
+		{
+			return typeInfo;
+		}
+
+		typeInfo.TypeId = typeId;
+		typeInfo.Signatures.Reserve((parent != nullptr ? parent->Signatures.Size() : 0) + signatures.Size());
+		if (parent != nullptr)
+		{
+			typeInfo.ParentTypeId = parent->TypeId;
+			typeInfo.Signatures.Append(parent->Signatures);
+		}
+		typeInfo.Signatures.Append(signatures);
+
+		for (size_t i = 0; i < typeInfo.Signatures.Size(); ++i)
+		{
+			// A name declared twice keeps the index of its first declaration, which is the datum Populate fills
+			typeInfo.SignatureIndices.Insert({ typeInfo.Signatures[i].Name, i });
+		}
+		typeInfo.HasUniqueNames = typeInfo.SignatureIndices.Size() == typeInfo.Signatures.Size();
+		return typeInfo;
+	}
+
+	const TypeRegistry::TypeInfo* TypeRegistry::Find(RTTI::IdType typeId)
+	{
+		const HashMap<RTTI::IdType, TypeInfo>& types = _Types();
+		auto it = types.Find(typeId);
+		return it != types.end() ? &it->second : nullptr;
+	}
+
+	const TypeRegistry::TypeInfo& TypeRegistry::Get(RTTI::IdType typeId)
+	{
+		const TypeInfo* typeInfo = Find(typeId);
+		if (typeInfo == nullptr)
+		{
+			throw runtime_error("Type is not registered");
+		}
+		return *typeInfo;
+	}
+
+	size_t TypeRegistry::Size()
+	{
+		return _Types().Size();
+	}
+
+	HashMap<RTTI::IdType, TypeRegistry::TypeInfo>& TypeRegistry::_Types()
+	{
+		static HashMap<RTTI::IdType, TypeInfo> types;
+		return types;
+	}
+}
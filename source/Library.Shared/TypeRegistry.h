@@ -0,0 +1,90 @@
+#pragma once
+
+#include <cstddef>
+#include "RTTI.h"
+#include "Vector.h"
+#include "HashMap.h"
+#include "FlatHashMap.h"
+#include "Signature.h"
+#include "Symbol.h"
+
+namespace FieaGameEngine
+{
+	/// <summary>
+	/// Process-wide table of the prescribed attributes of every Attributed class, keyed by TypeIdClass().
+	/// Each class's signatures are flattened (parents first) once when the class registers,
+	/// so looking them up afterwards never allocates.
+	/// Classes register automatically through ATTRIBUTED_DEFINITIONS.
+	/// </summary>
+	class TypeRegistry final
+	{
+	public:
+		/// <summary>
+		/// Prescribed attribute layout of one Attributed class
+		/// </summary>
+		struct TypeInfo final
+		{
+			/// <summary>
+			/// Gets the index of a prescribed attribute in Signatures
+			/// </summary>
+			/// <param name="name">Attribute name</param>
+			/// <returns>Index of the signature, or the number of signatures if the name is not prescribed</returns>
+			[[nodiscard]] std::size_t IndexOf(Symbol name) const;
+
+			/// <summary>
+			/// Checks if a name is a prescribed attribute of this class or one of its parents
+			/// </summary>
+			/// <param name="name">Attribute name</param>
+			/// <returns>True if the name is prescribed; otherwise false</returns>
+			[[nodiscard]] bool IsPrescribed(Symbol name) const;
+
+			RTTI::IdType TypeId = 0;
+			RTTI::IdType ParentTypeId = 0;
+			Vector<Signature> Signatures;
+			FlatHashMap<Symbol, std::size_t> SignatureIndices;
+
+			/// <summary>
+			/// True if no two signatures share a name, so an instance's prescribed attributes
+			/// can be laid out one per signature without lookups
+			/// </summary>
+			bool HasUniqueNames = true;
+		};
+
+		TypeRegistry() = delete;
+
+		/// <summary>
+		/// Registers a class. The class's signatures are appended to its parent's.
+		/// Registering a type id a second time returns the existing entry.
+		/// </summary>
+		/// <param name="typeId">TypeIdClass() of the class</param>
+		/// <param name="parent">Registered parent class, or null for a root class</param>
+		/// <param name="signatures">Signatures declared by the class itself</param>
+		/// <returns>Registered entry. The reference stays valid for the lifetime of the process</returns>
+		static const TypeInfo& Register(RTTI::IdType typeId, const TypeInfo* parent, const Vector<Signature>& signatures);
+
+		/// <summary>
+		/// Finds a registered class
+		/// </summary>
+		/// <param name="typeId">TypeIdClass() of the class</param>
+		/// <returns>Registered entry or null if the class is not registered</returns>
+		[[nodiscard]] static const TypeInfo* Find(RTTI::IdType typeId);
+
+		/// <summary>
+		/// Gets a registered class
+		/// </summary>
+		/// <param name="typeId">TypeIdClass() of the class</param>
+		/// <exception cref="runtime_error">Class is not registered</exception>
+		/// <returns>Registered entry</returns>
+		[[nodiscard]] static const TypeInfo& Get(RTTI::IdType typeId);
+
+		/// <summary>
+		/// Gets the number of registered classes
+		/// </summary>
+		/// <returns>Number of registered classes</returns>
+		[[nodiscard]] static std::size_t Size();
+
+	private:
+		// Node based so references to entries stay valid as classes register
+		[[nodiscard]] static HashMap<RTTI::IdType, TypeInfo>& _Types();
+	};
+}
@@ -0,0 +1,420 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <initializer_list>
+#include <memory_resource>
+#include "CheckedIterators.h"
+#include "TriviallyRelocatable.h"
+
+namespace FieaGameEngine
+{
+	/// <summary>
+	/// Number of elements an UnrolledSList node holds by default, about two cache lines per node
+	/// </summary>
+	/// <typeparam name="T">Element type</typeparam>
+	template <typename T>
+	inline constexpr std::size_t DefaultUnrolledNodeCapacity = std::max<std::size_t>(1, 112 / sizeof(T));
+
+	/// <summary>
+	/// Forward linked list that stores several elements per node.
+	/// Pushing and popping at either end only allocates or frees a node once per node capacity,
+	/// and iteration walks contiguous elements instead of chasing a pointer per element.
+	/// Element references stay valid until the element is removed.
+	/// </summary>
+	/// <typeparam name="T">Element type</typeparam>
+	/// <typeparam name="TNodeCapacity">Number of elements each node holds</typeparam>
+	template <typename T, std::size_t TNodeCapacity = DefaultUnrolledNodeCapacity<T>>
+	class UnrolledSList final
+	{
+		static_assert(TNodeCapacity > 0, "Nodes must hold at least one element");
+		static_assert(TNodeCapacity <= UINT32_MAX, "Node capacity must fit in 32 bits");
+
+		/// <summary>
+		/// Node holding the elements in [Begin, End) of its storage
+		/// </summary>
+		struct Node final
+		{
+			/// <summary>
+			/// Creates an empty node whose first element will be placed at the given storage index
+			/// </summary>
+			/// <param name="index">Storage index of the first element</param>
+			explicit Node(std::uint32_t index);
+
+			[[nodiscard]] T* Element(std::uint32_t index);
+
+			Node* Next = nullptr;
+			std::uint32_t Begin = 0;
+			std::uint32_t End = 0;
+			alignas(T) std::byte Storage[TNodeCapacity * sizeof(T)];
+		};
+
+	public:
+		using size_type = std::size_t;
+		using value_type = T;
+		using reference = value_type&;
+		using const_reference = const value_type&;
+		using rvalue_reference = value_type&&;
+		using pointer = value_type*;
+		using const_pointer = const value_type*;
+		using Allocator = std::pmr::polymorphic_allocator<T>;
+		// Nodes live on the heap, so the list holds no pointers into itself
+		TRIVIALLY_RELOCATABLE(UnrolledSList);
+
+		/// <summary>
+		/// Number of elements each node holds
+		/// </summary>
+		static constexpr std::size_t NodeCapacity = TNodeCapacity;
+
+		/// <summary>
+		/// Size of each allocation the list makes, for sizing a NodePoolResource
+		/// </summary>
+		static constexpr std::size_t NodeSize = sizeof(Node);
+
+		/// <summary>
+		/// Alignment of each allocation the list makes, for sizing a NodePoolResource
+		/// </summary>
+		static constexpr std::size_t NodeAlignment = alignof(Node);
+
+		class iterator;
+
+		/// <summary>
+		/// Iterator that when dereferenced returns a const version of a value in the container
+		/// </summary>
+		class const_iterator final
+		{
+			friend UnrolledSList;
+
+		public:
+			using iterator_category = std::forward_iterator_tag;
+			using difference_type = std::ptrdiff_t;
+			using value_type = value_type;
+			using pointer = const value_type*;
+			using reference = const value_type&;
+
+			const_iterator() = default;
+
+			/// <summary>
+			/// Creates a constant iterator from a non-const iterator
+			/// </summary>
+			/// <param name="other">iterator to turn into a const_iterator</param>
+			const_iterator(const iterator& other);
+
+			/// <summary>
+			/// Gets the value in the container pointed to by this iterator
+			/// </summary>
+			/// <exception cref="runtime_error">With checked iterators, if the iterator does not point to an element in the container</exception>
+			/// <returns>value in the container</returns>
+			[[nodiscard]] const_reference operator*() const;
+
+			/// <summary>
+			/// Gets the value in the container pointed to by this iterator
+			/// </summary>
+			/// <exception cref="runtime_error">With checked iterators, if the iterator does not point to an element in the container</exception>
+			/// <returns>value in the container</returns>
+			[[nodiscard]] const_pointer operator->() const;
+
+			/// <summary>
+			/// Increments the iterator so the iterator points to the next element in the container
+			/// </summary>
+			/// <exception cref="runtime_error">With checked iterators, if the iterator is not associated with a container</exception>
+			/// <returns>Reference to the incremented iterator</returns>
+			const_iterator& operator++();
+
+			/// <summary>
+			/// Increments the iterator so the iterator points to the next element in the container
+			/// </summary>
+			/// <exception cref="runtime_error">With checked iterators, if the iterator is not associated with a container</exception>
+			/// <returns>Iterator before it is incremented</returns>
+			const_iterator operator++(int);
+
+			/// <summary>
+			/// Compares iterators. Iterators are equal if they point to the same element
+			/// </summary>
+			/// <param name="other">Iterator to compare against</param>
+			/// <returns>Whether the iterators are equal</returns>
+			[[nodiscard]] bool operator==(const const_iterator& other) const;
+
+		private:
+			const_iterator(const UnrolledSList& container, Node* node, std::uint32_t index);
+
+			Node* _node = nullptr;
+			std::uint32_t _index = 0;
+#if FIEA_CHECKED_ITERATORS
+			const UnrolledSList* _container = nullptr;
+#endif
+		};
+
+		/// <summary>
+		/// Iterator that when dereferenced returns a non-const version of a value in the container
+		/// </summary>
+		class iterator final
+		{
+			friend UnrolledSList;
+			friend const_iterator;
+
+		public:
+			using iterator_category = std::forward_iterator_tag;
+			using difference_type = std::ptrdiff_t;
+			using value_type = value_type;
+			using pointer = value_type*;
+			using reference = value_type&;
+
+			iterator() = default;
+
+			/// <summary>
+			/// Gets the value in the container pointed to by this iterator
+			/// </summary>
+			/// <exception cref="runtime_error">With checked iterators, if the iterator does not point to an element in the container</exception>
+			/// <returns>value in the container</returns>
+			[[nodiscard]] reference operator*() const;
+
+			/// <summary>
+			/// Gets the value in the container pointed to by this iterator
+			/// </summary>
+			/// <exception cref="runtime_error">With checked iterators, if the iterator does not point to an element in the container</exception>
+			/// <returns>value in the container</returns>
+			[[nodiscard]] pointer operator->() const;
+
+			/// <summary>
+			/// Increments the iterator so the iterator points to the next element in the container
+			/// </summary>
+			/// <exception cref="runtime_error">With checked iterators, if the iterator is not associated with a container</exception>
+			/// <returns>Reference to the incremented iterator</returns>
+			iterator& operator++();
+
+			/// <summary>
+			/// Increments the iterator so the iterator points to the next element in the container
+			/// </summary>
+			/// <exception cref="runtime_error">With checked iterators, if the iterator is not associated with a container</exception>
+			/// <returns>Iterator before it is incremented</returns>
+			iterator operator++(int);
+
+			/// <summary>
+			/// Compares iterators. Iterators are equal if they point to the same element
+			/// </summary>
+			/// <param name="other">Iterator to compare against</param>
+			/// <returns>Whether the iterators are equal</returns>
+			[[nodiscard]] bool operator==(const iterator& other) const;
+
+		private:
+			iterator(const UnrolledSList& container, Node* node, std::uint32_t index);
+
+			Node* _node = nullptr;
+			std::uint32_t _index = 0;
+#if FIEA_CHECKED_ITERATORS
+			const UnrolledSList* _container = nullptr;
+#endif
+		};
+
+		/// <summary>
+		/// Creates an empty list
+		/// </summary>
+		UnrolledSList() = default;
+
+		/// <summary>
+		/// Creates an empty list that allocates its nodes from a memory resource
+		/// </summary>
+		/// <param name="allocator">Allocator, or the memory resource it allocates from. The resource must outlive the list</param>
+		explicit UnrolledSList(const Allocator& allocator);
+
+		/// <summary>
+		/// Creates a list from an initializer list of values
+		/// </summary>
+		/// <param name="list">initializer list of values</param>
+		UnrolledSList(std::initializer_list<value_type> list);
+
+		/// <summary>
+		/// Copy constructor
+		/// </summary>
+		UnrolledSList(const UnrolledSList& rhs);
+
+		/// <summary>
+		/// Copy constructor that allocates from a memory resource
+		/// </summary>
+		/// <param name="rhs">List to copy</param>
+		/// <param name="allocator">Allocator of the copy</param>
+		UnrolledSList(const UnrolledSList& rhs, const Allocator& allocator);
+
+		/// <summary>
+		/// Move constructor
+		/// </summary>
+		UnrolledSList(UnrolledSList&& rhs) noexcept;
+
+		/// <summary>
+		/// Copy Assignment
+		/// </summary>
+		UnrolledSList& operator=(const UnrolledSList& rhs);
+
+		/// <summary>
+		/// Move Assignment. The allocator is not propagated: if rhs allocates from a different resource, its elements are moved one by one
+		/// </summary>
+		UnrolledSList& operator=(UnrolledSList&& rhs) noexcept;
+
+		~UnrolledSList();
+
+		/// <summary>
+		/// Gets an iterator pointing to the first element in the container
+		/// </summary>
+		/// <returns>iterator at the beginning of the container</returns>
+		[[nodiscard]] iterator begin();
+
+		/// <summary>
+		/// Gets a const_iterator pointing to the first element in the container
+		/// </summary>
+		/// <returns>const_iterator at the beginning of the container</returns>
+		[[nodiscard]] const_iterator begin() const;
+
+		/// <summary>
+		/// Gets an iterator pointing to one past the last element in the container
+		/// </summary>
+		/// <returns>iterator at the end of the container</returns>
+		[[nodiscard]] iterator end();
+
+		/// <summary>
+		/// Gets a const_iterator pointing to one past the last element in the container
+		/// </summary>
+		/// <returns>const_iterator at the end of the container</returns>
+		[[nodiscard]] const_iterator end() const;
+
+		/// <summary>
+		/// Gets a const_iterator pointing to the first element in the container
+		/// </summary>
+		/// <returns>const_iterator at the beginning of the container</returns>
+		[[nodiscard]] const_iterator cbegin() const;
+
+		/// <summary>
+		/// Gets a const_iterator pointing to one past the last element in the container
+		/// </summary>
+		/// <returns>const_iterator at the end of the container</returns>
+		[[nodiscard]] const_iterator cend() const;
+
+		/// <summary>
+		/// Adds a value to the front of the list
+		/// </summary>
+		/// <param name="item">Item to add to the list</param>
+		/// <returns>Iterator to the added value</returns>
+		iterator PushFront(const_reference item);
+
+		/// <summary>
+		/// Adds a value to the front of the list
+		/// </summary>
+		/// <param name="item">Item to add to the list</param>
+		/// <returns>Iterator to the added value</returns>
+		iterator PushFront(rvalue_reference item);
+
+		/// <summary>
+		/// Constructs a value in place at the front of the list
+		/// </summary>
+		/// <param name="args">Arguments to construct the value with</param>
+		/// <returns>Iterator to the added value</returns>
+		template <typename... Args>
+		iterator EmplaceFront(Args&&... args);
+
+		/// <summary>
+		/// Adds a value to the back of the list
+		/// </summary>
+		/// <param name="item">Item to add to the list</param>
+		/// <returns>Iterator to the added value</returns>
+		iterator PushBack(const_reference item);
+
+		/// <summary>
+		/// Adds a value to the back of the list
+		/// </summary>
+		/// <param name="item">Item to add to the list</param>
+		/// <returns>Iterator to the added value</returns>
+		iterator PushBack(rvalue_reference item);
+
+		/// <summary>
+		/// Constructs a value in place at the back of the list
+		/// </summary>
+		/// <param name="args">Arguments to construct the value with</param>
+		/// <returns>Iterator to the added value</returns>
+		template <typename... Args>
+		iterator EmplaceBack(Args&&... args);
+
+		/// <summary>
+		/// Removes a value from the front of the list
+		/// </summary>
+		/// <exception cref="runtime_error">List is empty</exception>
+		void PopFront();
+
+		/// <summary>
+		/// Removes a value from the back of the list.
+		/// Walks the list when it empties the back node, like SList::PopBack
+		/// </summary>
+		/// <exception cref="runtime_error">List is empty</exception>
+		void PopBack();
+
+		/// <summary>
+		/// Returns if the the list is empty
+		/// </summary>
+		/// <returns>True if the list is empty; otherwise false</returns>
+		[[nodiscard]] bool IsEmpty() const;
+
+		/// <summary>
+		/// Gets the value at the front of the list
+		/// </summary>
+		/// <exception cref="runtime_error">List is empty</exception>
+		/// <returns>Front value</returns>
+		[[nodiscard]] reference Front();
+
+		/// <summary>
+		/// Gets the value at the front of the list
+		/// </summary>
+		/// <exception cref="runtime_error">List is empty</exception>
+		/// <returns>Front value</returns>
+		[[nodiscard]] const_reference Front() const;
+
+		/// <summary>
+		/// Gets the value at the back of the list
+		/// </summary>
+		/// <exception cref="runtime_error">List is empty</exception>
+		/// <returns>Back value</returns>
+		[[nodiscard]] reference Back();
+
+		/// <summary>
+		/// Gets the value at the back of the list
+		/// </summary>
+		/// <exception cref="runtime_error">List is empty</exception>
+		/// <returns>Back value</returns>
+		[[nodiscard]] const_reference Back() const;
+
+		/// <summary>
+		/// Gets the size of the list
+		/// </summary>
+		/// <returns>List size</returns>
+		[[nodiscard]] std::size_t Size() const;
+
+		/// <summary>
+		/// Gets the number of nodes the list has allocated
+		/// </summary>
+		/// <returns>Node count</returns>
+		[[nodiscard]] std::size_t NodeCount() const;
+
+		/// <summary>
+		/// Gets the allocator the list allocates its nodes with
+		/// </summary>
+		/// <returns>Allocator of the list</returns>
+		[[nodiscard]] Allocator GetAllocator() const;
+
+		/// <summary>
+		/// Removes all values from the list
+		/// </summary>
+		void Clear();
+
+	private:
+		// Allocates an empty node whose elements will be added at the given storage index
+		[[nodiscard]] Node* _NewNode(std::uint32_t index);
+		void _DeleteNode(Node* node);
+
+		Allocator _alloc;
+		std::size_t _size = 0;
+		std::size_t _nodeCount = 0;
+		Node* _front = nullptr;
+		Node* _back = nullptr;
+	};
+}
+
+#include "UnrolledSList.inl"
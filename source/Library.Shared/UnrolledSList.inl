@@ -0,0 +1,550 @@
+#include "UnrolledSList.h"
+#include <memory>
+#include <new>
+#include <stdexcept>
+#include <utility>
+
+namespace FieaGameEngine
+{
+#pragma region Node
+	template <typename T, std::size_t TNodeCapacity>
+	inline UnrolledSList<T, TNodeCapacity>::Node::Node(std::uint32_t index) :
+		Begin(index), End(index)
+	{
+	}
+
+	template <typename T, std::size_t TNodeCapacity>
+	inline T* UnrolledSList<T, TNodeCapacity>::Node::Element(std::uint32_t index)
+	{
+		return std::launder(reinterpret_cast<T*>(Storage)) + index;
+	}
+#pragma endregion Node
+
+#pragma region UnrolledSList
+	template <typename T, std::size_t TNodeCapacity>
+	inline UnrolledSList<T, TNodeCapacity>::UnrolledSList(const Allocator& allocator) :
+		_alloc(allocator)
+	{
+	}
+
+	template <typename T, std::size_t TNodeCapacity>
+	inline UnrolledSList<T, TNodeCapacity>::UnrolledSList(std::initializer_list<value_type> list)
+	{
+		for (const auto& value : list)
+		{
+			PushBack(value);
+		}
+	}
+
+	template <typename T, std::size_t TNodeCapacity>
+	UnrolledSList<T, TNodeCapacity>::UnrolledSList(const UnrolledSList& rhs)
+	{
+		for (const auto& value : rhs)
+		{
+			PushBack(value);
+		}
+	}
+
+	template <typename T, std::size_t TNodeCapacity>
+	UnrolledSList<T, TNodeCapacity>::UnrolledSList(const UnrolledSList& rhs, const Allocator& allocator) :
+		_alloc(allocator)
+	{
+		for (const auto& value : rhs)
+		{
+			PushBack(value);
+		}
+	}
+
+	template <typename T, std::size_t TNodeCapacity>
+	inline UnrolledSList<T, TNodeCapacity>::UnrolledSList(UnrolledSList&& rhs) noexcept :
+		_alloc(rhs._alloc), _size(rhs._size), _nodeCount(rhs._nodeCount), _front(rhs._front), _back(rhs._back)
+	{
+		rhs._front = nullptr;
+		rhs._back = nullptr;
+		rhs._size = 0;
+		rhs._nodeCount = 0;
+	}
+
+	template <typename T, std::size_t TNodeCapacity>
+	UnrolledSList<T, TNodeCapacity>& UnrolledSList<T, TNodeCapacity>::operator=(const UnrolledSList& rhs)
+	{
+		if (this != &rhs)
+		{
+			Clear();
+			for (const auto& value : rhs)
+			{
+				PushBack(value);
+			}
+		}
+
+		return *this;
+	}
+
+	template <typename T, std::size_t TNodeCapacity>
+	UnrolledSList<T, TNodeCapacity>& UnrolledSList<T, TNodeCapacity>::operator=(UnrolledSList&& rhs) noexcept
+	{
+		if (this != &rhs)
+		{
+			Clear();
+
+			if (_alloc == rhs._alloc)
+			{
+				_front = rhs._front;
+				_back = rhs._back;
+				_size = rhs._size;
+				_nodeCount = rhs._nodeCount;
+
+				rhs._front = nullptr;
+				rhs._back = nullptr;
+				rhs._size = 0;
+				rhs._nodeCount = 0;
+			}
+			else
+			{
+				// Nodes from another resource cannot be released by ours
+				for (auto& value : rhs)
+				{
+					PushBack(std::move(value));
+				}
+				rhs.Clear();
+			}
+		}
+
+		return *this;
+	}
+
+	template <typename T, std::size_t TNodeCapacity>
+	UnrolledSList<T, TNodeCapacity>::~UnrolledSList()
+	{
+		Clear();
+	}
+
+	template <typename T, std::size_t TNodeCapacity>
+	inline typename UnrolledSList<T, TNodeCapacity>::iterator UnrolledSList<T, TNodeCapacity>::begin()
+	{
+		return iterator(*this, _front, _front != nullptr ? _front->Begin : 0);
+	}
+
+	template <typename T, std::size_t TNodeCapacity>
+	inline typename UnrolledSList<T, TNodeCapacity>::const_iterator UnrolledSList<T, TNodeCapacity>::begin() const
+	{
+		return const_iterator(*this, _front, _front != nullptr ? _front->Begin : 0);
+	}
+
+	template <typename T, std::size_t TNodeCapacity>
+	inline typename UnrolledSList<T, TNodeCapacity>::iterator UnrolledSList<T, TNodeCapacity>::end()
+	{
+		return iterator(*this, nullptr, 0);
+	}
+
+	template <typename T, std::size_t TNodeCapacity>
+	inline typename UnrolledSList<T, TNodeCapacity>::const_iterator UnrolledSList<T, TNodeCapacity>::end() const
+	{
+		return const_iterator(*this, nullptr, 0);
+	}
+
+	template <typename T, std::size_t TNodeCapacity>
+	inline typename UnrolledSList<T, TNodeCapacity>::const_iterator UnrolledSList<T, TNodeCapacity>::cbegin() const
+	{
+		return begin();
+	}
+
+	template <typename T, std::size_t TNodeCapacity>
+	inline typename UnrolledSList<T, TNodeCapacity>::const_iterator UnrolledSList<T, TNodeCapacity>::cend() const
+	{
+		return end();
+	}
+
+	template <typename T, std::size_t TNodeCapacity>
+	inline typename UnrolledSList<T, TNodeCapacity>::iterator UnrolledSList<T, TNodeCapacity>::PushFront(const_reference item)
+	{
+		return EmplaceFront(item);
+	}
+
+	template <typename T, std::size_t TNodeCapacity>
+	inline typename UnrolledSList<T, TNodeCapacity>::iterator UnrolledSList<T, TNodeCapacity>::PushFront(rvalue_reference item)
+	{
+		return EmplaceFront(std::move(item));
+	}
+
+	template <typename T, std::size_t TNodeCapacity>
+	template <typename... Args>
+	typename UnrolledSList<T, TNodeCapacity>::iterator UnrolledSList<T, TNodeCapacity>::EmplaceFront(Args&&... args)
+	{
+		if (_front != nullptr && _front->Begin > 0)
+		{
+			_alloc.construct(_front->Element(_front->Begin - 1), std::forward<Args>(args)...);
+			--_front->Begin;
+		}
+		else
+		{
+			// A new front node fills from its end, so the pushes that follow share it
+			Node* node = _NewNode(static_cast<std::uint32_t>(TNodeCapacity));
+			try
+			{
+				_alloc.construct(node->Element(node->Begin - 1), std::forward<Args>(args)...);
+			}
+			catch (...)
+			{
+				_DeleteNode(node);
+				throw;
+			}
+			--node->Begin;
+
+			node->Next = _front;
+			_front = node;
+			if (_back == nullptr)
+			{
+				_back = node;
+			}
+		}
+		++_size;
+		return iterator(*this, _front, _front->Begin);
+	}
+
+	template <typename T, std::size_t TNodeCapacity>
+	inline typename UnrolledSList<T, TNodeCapacity>::iterator UnrolledSList<T, TNodeCapacity>::PushBack(const_reference item)
+	{
+		return EmplaceBack(item);
+	}
+
+	template <typename T, std::size_t TNodeCapacity>
+	inline typename UnrolledSList<T, TNodeCapacity>::iterator UnrolledSList<T, TNodeCapacity>::PushBack(rvalue_reference item)
+	{
+		return EmplaceBack(std::move(item));
+	}
+
+	template <typename T, std::size_t TNodeCapacity>
+	template <typename... Args>
+	typename UnrolledSList<T, TNodeCapacity>::iterator UnrolledSList<T, TNodeCapacity>::EmplaceBack(Args&&... args)
+	{
+		if (_back != nullptr && _back->End < TNodeCapacity)
+		{
+			_alloc.construct(_back->Element(_back->End), std::forward<Args>(args)...);
+			++_back->End;
+		}
+		else
+		{
+			Node* node = _NewNode(0);
+			try
+			{
+				_alloc.construct(node->Element(0), std::forward<Args>(args)...);
+			}
+			catch (...)
+			{
+				_DeleteNode(node);
+				throw;
+			}
+			++node->End;
+
+			if (_back != nullptr)
+			{
+				_back->Next = node;
+			}
+			_back = node;
+			if (_front == nullptr)
+			{
+				_front = node;
+			}
+		}
+		++_size;
+		return iterator(*this, _back, _back->End - 1);
+	}
+
+	template <typename T, std::size_t TNodeCapacity>
+	void UnrolledSList<T, TNodeCapacity>::PopFront()
+	{
+		if (_size == 0)
+		{
+			throw std::runtime_error("List is empty");
+		}
+
+		std::destroy_at(_front->Element(_front->Begin));
+		++_front->Begin;
+		--_size;
+		if (_front->Begin == _front->End)
+		{
+			Node* frontToDelete = _front;
+			_front = _front->Next;
+			if (_front == nullptr)
+			{
+				_back = nullptr;
+			}
+			_DeleteNode(frontToDelete);
+		}
+	}
+
+	template <typename T, std::size_t TNodeCapacity>
+	void UnrolledSList<T, TNodeCapacity>::PopBack()
+	{
+		if (_size == 0)
+		{
+			throw std::runtime_error("List is empty");
+		}
+
+		--_back->End;
+		std::destroy_at(_back->Element(_back->End));
+		--_size;
+		if (_back->Begin == _back->End)
+		{
+			Node* backToDelete = _back;
+			if (_front == _back)
+			{
+				_front = nullptr;
+				_back = nullptr;
+			}
+			else
+			{
+				// Loop until back - 1 and update next to nullptr
+				Node* currentNode = _front;
+				while (currentNode->Next != _back)
+				{
+					currentNode = currentNode->Next;
+				}
+				currentNode->Next = nullptr;
+				_back = currentNode;
+			}
+			_DeleteNode(backToDelete);
+		}
+	}
+
+	template <typename T, std::size_t TNodeCapacity>
+	inline bool UnrolledSList<T, TNodeCapacity>::IsEmpty() const
+	{
+		return _size == 0;
+	}
+
+	template <typename T, std::size_t TNodeCapacity>
+	inline T& UnrolledSList<T, TNodeCapacity>::Front()
+	{
+		if (_size == 0)
+		{
+			throw std::runtime_error("List is empty");
+		}
+		return *_front->Element(_front->Begin);
+	}
+
+	template <typename T, std::size_t TNodeCapacity>
+	inline const T& UnrolledSList<T, TNodeCapacity>::Front() const
+	{
+		if (_size == 0)
+		{
+			throw std::runtime_error("List is empty");
+		}
+		return *_front->Element(_front->Begin);
+	}
+
+	template <typename T, std::size_t TNodeCapacity>
+	inline T& UnrolledSList<T, TNodeCapacity>::Back()
+	{
+		if (_size == 0)
+		{
+			throw std::runtime_error("List is empty");
+		}
+		return *_back->Element(_back->End - 1);
+	}
+
+	template <typename T, std::size_t TNodeCapacity>
+	inline const T& UnrolledSList<T, TNodeCapacity>::Back() const
+	{
+		if (_size == 0)
+		{
+			throw std::runtime_error("List is empty");
+		}
+		return *_back->Element(_back->End - 1);
+	}
+
+	template <typename T, std::size_t TNodeCapacity>
+	inline std::size_t UnrolledSList<T, TNodeCapacity>::Size() const
+	{
+		return _size;
+	}
+
+	template <typename T, std::size_t TNodeCapacity>
+	inline std::size_t UnrolledSList<T, TNodeCapacity>::NodeCount() const
+	{
+		return _nodeCount;
+	}
+
+	template <typename T, std::size_t TNodeCapacity>
+	inline typename UnrolledSList<T, TNodeCapacity>::Allocator UnrolledSList<T, TNodeCapacity>::GetAllocator() const
+	{
+		return _alloc;
+	}
+
+	template <typename T, std::size_t TNodeCapacity>
+	void UnrolledSList<T, TNodeCapacity>::Clear()
+	{
+		while (_front != nullptr)
+		{
+			Node* next = _front->Next;
+			std::destroy(_front->Element(_front->Begin), _front->Element(_front->End));
+			_DeleteNode(_front);
+			_front = next;
+		}
+		_back = nullptr;
+		_size = 0;
+	}
+
+	template <typename T, std::size_t TNodeCapacity>
+	inline typename UnrolledSList<T, TNodeCapacity>::Node* UnrolledSList<T, TNodeCapacity>::_NewNode(std::uint32_t index)
+	{
+		Node* node = _alloc.new_object<Node>(index);
+		++_nodeCount;
+		return node;
+	}
+
+	template <typename T, std::size_t TNodeCapacity>
+	inline void UnrolledSList<T, TNodeCapacity>::_DeleteNode(Node* node)
+	{
+		_alloc.delete_object<Node>(node);
+		--_nodeCount;
+	}
+#pragma endregion UnrolledSList
+
+#pragma region const_iterator
+	template <typename T, std::size_t TNodeCapacity>
+	inline UnrolledSList<T, TNodeCapacity>::const_iterator::const_iterator(const iterator& other) :
+#if FIEA_CHECKED_ITERATORS
+		_node(other._node), _index(other._index), _container(other._container)
+#else
+		_node(other._node), _index(other._index)
+#endif
+	{
+	}
+
+	template <typename T, std::size_t TNodeCapacity>
+	inline UnrolledSList<T, TNodeCapacity>::const_iterator::const_iterator([[maybe_unused]] const UnrolledSList& container, Node* node, std::uint32_t index) :
+#if FIEA_CHECKED_ITERATORS
+		_node(node), _index(index), _container(&container)
+#else
+		_node(node), _index(index)
+#endif
+	{
+	}
+
+	template <typename T, std::size_t TNodeCapacity>
+	inline typename UnrolledSList<T, TNodeCapacity>::const_reference UnrolledSList<T, TNodeCapacity>::const_iterator::operator*() const
+	{
+#if FIEA_CHECKED_ITERATORS
+		if (_node == nullptr)
+		{
+			throw std::runtime_error("Iterator does not point to an element in the container");
+		}
+#endif
+		return *_node->Element(_index);
+	}
+
+	template <typename T, std::size_t TNodeCapacity>
+	inline typename UnrolledSList<T, TNodeCapacity>::const_pointer UnrolledSList<T, TNodeCapacity>::const_iterator::operator->() const
+	{
+		return &operator*();
+	}
+
+	template <typename T, std::size_t TNodeCapacity>
+	inline typename UnrolledSList<T, TNodeCapacity>::const_iterator& UnrolledSList<T, TNodeCapacity>::const_iterator::operator++()
+	{
+#if FIEA_CHECKED_ITERATORS
+		if (_container == nullptr)
+		{
+			throw std::runtime_error("Iterator is not associated with a container");
+		}
+#endif
+
+		if (_node != nullptr && ++_index == _node->End)
+		{
+			_node = _node->Next;
+			_index = _node != nullptr ? _node->Begin : 0;
+		}
+		return *this;
+	}
+
+	template <typename T, std::size_t TNodeCapacity>
+	inline typename UnrolledSList<T, TNodeCapacity>::const_iterator UnrolledSList<T, TNodeCapacity>::const_iterator::operator++(int)
+	{
+		const_iterator it = *this;
+		operator++();
+		return it;
+	}
+
+	template <typename T, std::size_t TNodeCapacity>
+	inline bool UnrolledSList<T, TNodeCapacity>::const_iterator::operator==(const const_iterator& other) const
+	{
+#if FIEA_CHECKED_ITERATORS
+		if (_container != other._container)
+		{
+			return false;
+		}
+#endif
+		return _node == other._node && _index == other._index;
+	}
+#pragma endregion const_iterator
+
+#pragma region iterator
+	template <typename T, std::size_t TNodeCapacity>
+	inline UnrolledSList<T, TNodeCapacity>::iterator::iterator([[maybe_unused]] const UnrolledSList& container, Node* node, std::uint32_t index) :
+#if FIEA_CHECKED_ITERATORS
+		_node(node), _index(index), _container(&container)
+#else
+		_node(node), _index(index)
+#endif
+	{
+	}
+
+	template <typename T, std::size_t TNodeCapacity>
+	inline typename UnrolledSList<T, TNodeCapacity>::reference UnrolledSList<T, TNodeCapacity>::iterator::operator*() const
+	{
+#if FIEA_CHECKED_ITERATORS
+		if (_node == nullptr)
+		{
+			throw std::runtime_error("Iterator does not point to an element in the container");
+		}
+#endif
+		return *_node->Element(_index);
+	}
+
+	template <typename T, std::size_t TNodeCapacity>
+	inline typename UnrolledSList<T, TNodeCapacity>::pointer UnrolledSList<T, TNodeCapacity>::iterator::operator->() const
+	{
+		return &operator*();
+	}
+
+	template <typename T, std::size_t TNodeCapacity>
+	inline typename UnrolledSList<T, TNodeCapacity>::iterator& UnrolledSList<T, TNodeCapacity>::iterator::operator++()
+	{
+#if FIEA_CHECKED_ITERATORS
+		if (_container == nullptr)
+		{
+			throw std::runtime_error("Iterator is not associated with a container");
+		}
+#endif
+
+		if (_node != nullptr && ++_index == _node->End)
+		{
+			_node = _node->Next;
+			_index = _node != nullptr ? _node->Begin : 0;
+		}
+		return *this;
+	}
+
+	template <typename T, std::size_t TNodeCapacity>
+	inline typename UnrolledSList<T, TNodeCapacity>::iterator UnrolledSList<T, TNodeCapacity>::iterator::operator++(int)
+	{
+		iterator it = *this;
+		operator++();
+		return it;
+	}
+
+	template <typename T, std::size_t TNodeCapacity>
+	inline bool UnrolledSList<T, TNodeCapacity>::iterator::operator==(const iterator& other) const
+	{
+#if FIEA_CHECKED_ITERATORS
+		if (_container != other._container)
+		{
+			return false;
+		}
+#endif
+		return _node == other._node && _index == other._index;
+	}
+#pragma endregion iterator
+}
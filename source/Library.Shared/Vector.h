@@ -6,6 +6,10 @@
 #include <functional>
 #include "DefaultEquality.h"
 #include "DefaultReserveStrategy.h"
+#include "NoUniqueAddress.h"
+#include "TriviallyRelocatable.h"
+#include "CheckedIterators.h"
+#include <span>
 
 namespace FieaGameEngine
 {
@@ -13,7 +17,9 @@ namespace FieaGameEngine
 	/// Randomly accessible dynamic array
 	/// </summary>
 	/// <typeparam name="T"></typeparam>
-	template <typename T>
+	/// <typeparam name="TReserveStrategy">Functor that computes the next capacity from the current one. Use DynamicReserveStrategy to choose it at run time</typeparam>
+	/// <typeparam name="TEquality">Functor Find and Remove compare elements with</typeparam>
+	template <typename T, typename TReserveStrategy = DefaultReserveStrategy, typename TEquality = DefaultEquality<T>>
 	class Vector final
 	{
 	public:
@@ -24,8 +30,8 @@ namespace FieaGameEngine
 		using rvalue_reference = value_type&&;
 		using pointer = value_type*;
 		using const_pointer = const value_type*;
-		using ReserveStrategy = std::function<std::size_t(std::size_t)>;
-		using EqualityFunctor = std::function<bool(const_reference lhs, const_reference rhs)>;
+		using ReserveStrategy = TReserveStrategy;
+		using EqualityFunctor = TEquality;
 		using Allocator = std::pmr::polymorphic_allocator<T>;
 		// std library redirects
 		inline bool empty() const { return IsEmpty(); };
@@ -65,28 +71,28 @@ namespace FieaGameEngine
 			/// <summary>
 			/// Gets a non-const version of the value in the container pointed to by this iterator
 			/// </summary>
-			/// <exception cref="runtime_error">If the iterator is not associated with a container or points to an element not within a container</exception>
+			/// <exception cref="runtime_error">With checked iterators, if the iterator is not associated with a container or points to an element not within a container</exception>
 			/// <returns>value in the container</returns>
 			[[nodiscard]] const_reference operator*() const;
 
 			/// <summary>
 			/// Gets a non-const version of the value in the container pointed to by this iterator
 			/// </summary>
-			/// <exception cref="runtime_error">If the iterator is not associated with a container or points to an element not within a container</exception>
+			/// <exception cref="runtime_error">With checked iterators, if the iterator is not associated with a container or points to an element not within a container</exception>
 			/// <returns>value in the container</returns>
 			[[nodiscard]] const value_type* operator->() const;
 
 			/// <summary>
-			/// Gets a value in the container at the given index
+			/// Gets the value index elements after the one the iterator points to
 			/// </summary>
-			/// <exception cref="runtime_error">If the iterator is not associated with a container or index is not within the bounds of the container</exception>
-			/// <returns>value in the container at the given index</returns>
+			/// <exception cref="runtime_error">With checked iterators, if the iterator is not associated with a container or the element is out of bounds</exception>
+			/// <returns>value in the container at the given offset</returns>
 			[[nodiscard]] const_reference operator[](std::size_t index) const;
 
 			/// <summary>
 			/// Increments the iterator so the iterator points to the next element in the container
 			/// </summary>
-			/// <exception cref="runtime_error">Iterator is not associated with a container</exception>
+			/// <exception cref="runtime_error">With checked iterators, if the iterator is not associated with a container</exception>
 			/// <returns>Reference to the incremented iterator</returns>
 			const_iterator& operator++();
 
@@ -94,21 +100,21 @@ namespace FieaGameEngine
 			/// Increments the iterator so the iterator points to the next element in the container
 			/// </summary>
 			/// <param name=""></param>
-			/// <exception cref="runtime_error">Iterator is not associated with a container</exception>
+			/// <exception cref="runtime_error">With checked iterators, if the iterator is not associated with a container</exception>
 			/// <returns>Iterator before it is incremented</returns>
 			const_iterator operator++(int);
 
 			/// <summary>
 			/// Decrements the iterator so the iterator points to the previous element in the container
 			/// </summary>
-			/// <exception cref="runtime_error">Iterator is not associated with a container</exception>
+			/// <exception cref="runtime_error">With checked iterators, if the iterator is not associated with a container</exception>
 			/// <returns>Reference to the decremented iterator</returns>
 			const_iterator& operator--();
 
 			/// <summary>
 			/// Decrements the iterator so the iterator points to the previous element in the container
 			/// </summary>
-			/// <exception cref="runtime_error">Iterator is not associated with a container</exception>
+			/// <exception cref="runtime_error">With checked iterators, if the iterator is not associated with a container</exception>
 			/// <returns>Iterator before it is decremented</returns>
 			const_iterator operator--(int);
 
@@ -116,14 +122,14 @@ namespace FieaGameEngine
 			/// Increments the iterator so the iterator points to nth element ahead from its current position in the container
 			/// </summary>
 			/// <param name="n">Positions to increment by</param>
-			/// <exception cref="runtime_error">Iterator is not associated with a container</exception>
+			/// <exception cref="runtime_error">With checked iterators, if the iterator is not associated with a container</exception>
 			/// <returns>Reference to the incremented iterator</returns>
 			const_iterator& operator+=(size_t n);
 
 			/// <summary>
 			/// Adds a number to the iterator and returns a new iterator to nth element ahead from the current iterator's position in the container
 			/// </summary>
-			/// <exception cref="runtime_error">Iterator is not associated with a container</exception>
+			/// <exception cref="runtime_error">With checked iterators, if the iterator is not associated with a container</exception>
 			/// <returns>Iterator to current position + n</returns>
 			[[nodiscard]] const_iterator operator+(size_t n) const;
 
@@ -131,7 +137,7 @@ namespace FieaGameEngine
 			/// Decrements the iterator so the iterator points to nth element behind from its current position in the container
 			/// </summary>
 			/// <param name="n">Positions to decrement by</param>
-			/// <exception cref="runtime_error">Iterator is not associated with a container</exception>
+			/// <exception cref="runtime_error">With checked iterators, if the iterator is not associated with a container</exception>
 			/// <returns>Reference to the decremented iterator</returns>
 			const_iterator& operator-=(size_t n);
 
@@ -139,7 +145,7 @@ namespace FieaGameEngine
 			/// Subtracts a number to the iterator and returns a new iterator to nth element behind from the current iterator's position in the container
 			/// </summary>
 			/// <param name="n">Positions to decrement by</param>
-			/// <exception cref="runtime_error">Iterator is not associated with a container</exception>
+			/// <exception cref="runtime_error">With checked iterators, if the iterator is not associated with a container</exception>
 			/// <returns>Iterator to current position - n</returns>
 			[[nodiscard]] const_iterator operator-(size_t n) const;
 
@@ -148,7 +154,7 @@ namespace FieaGameEngine
 			/// Iterator to subtract should be before the current position or at the current position of this iterator
 			/// </summary>
 			/// <param name="it">Iterator to subtract</param>
-			/// <exception cref="runtime_error">Iterators are from different containers</exception>
+			/// <exception cref="runtime_error">With checked iterators, if the iterators are from different containers</exception>
 			/// <returns>Difference in positions between the two iterators</returns>
 			[[nodiscard]] size_t operator-(const const_iterator& it) const;
 
@@ -156,7 +162,7 @@ namespace FieaGameEngine
 			/// Checks if the current iterators position is less than an iterator in the same container
 			/// </summary>
 			/// <param name="it">Iterator to compare against</param>
-			/// <exception cref="runtime_error">Iterators are from different containers</exception>
+			/// <exception cref="runtime_error">With checked iterators, if the iterators are from different containers</exception>
 			/// <returns>True if current iterators position is less than the provided iterator; otherwise false</returns>
 			[[nodiscard]] bool operator<(const const_iterator& it) const;
 
@@ -164,7 +170,7 @@ namespace FieaGameEngine
 			/// Checks if the current iterators position is less or equal to an iterator in the same container
 			/// </summary>
 			/// <param name="it">Iterator to compare against</param>
-			/// <exception cref="runtime_error">Iterators are from different containers</exception>
+			/// <exception cref="runtime_error">With checked iterators, if the iterators are from different containers</exception>
 			/// <returns>True if current iterators position is less or equal to the provided iterator; otherwise false</returns>
 			[[nodiscard]] bool operator<=(const const_iterator& it) const;
 
@@ -172,7 +178,7 @@ namespace FieaGameEngine
 			/// Checks if the current iterators position is greater than an iterator in the same container
 			/// </summary>
 			/// <param name="it">Iterator to compare against</param>
-			/// <exception cref="runtime_error">Iterators are from different containers</exception>
+			/// <exception cref="runtime_error">With checked iterators, if the iterators are from different containers</exception>
 			/// <returns>True if current iterators position is greater than the provided iterator; otherwise false</returns>
 			[[nodiscard]] bool operator>(const const_iterator& it) const;
 
@@ -180,7 +186,7 @@ namespace FieaGameEngine
 			/// Checks if the current iterators position is greater than or equal to an iterator in the same container
 			/// </summary>
 			/// <param name="it">Iterator to compare against</param>
-			/// <exception cref="runtime_error">Iterators are from different containers</exception>
+			/// <exception cref="runtime_error">With checked iterators, if the iterators are from different containers</exception>
 			/// <returns>True if current iterators position is greater than or equal to the provided iterator; otherwise false</returns>
 			[[nodiscard]] bool operator>=(const const_iterator& it) const;
 
@@ -211,7 +217,9 @@ namespace FieaGameEngine
 			const_iterator(const Vector& container, pointer ptr = nullptr);
 
 			pointer _ptr = nullptr;
+#if FIEA_CHECKED_ITERATORS
 			const Vector* _container = nullptr;
+#endif
 		};
 
 		/// <summary>
@@ -235,49 +243,49 @@ namespace FieaGameEngine
 			/// <summary>
 			/// Gets a the value in the container pointed to by this iterator
 			/// </summary>
-			/// <exception cref="runtime_error">If the iterator is not associated with a container or points to an element not within a container</exception>
+			/// <exception cref="runtime_error">With checked iterators, if the iterator is not associated with a container or points to an element not within a container</exception>
 			/// <returns>value in the container</returns>
 			[[nodiscard]] reference operator*() const;
 
 			/// <summary>
 			/// Gets a the value in the container pointed to by this iterator
 			/// </summary>
-			/// <exception cref="runtime_error">If the iterator is not associated with a container or points to an element not within a container</exception>
+			/// <exception cref="runtime_error">With checked iterators, if the iterator is not associated with a container or points to an element not within a container</exception>
 			/// <returns>value in the container</returns>
 			[[nodiscard]] pointer operator->() const;
 
 			/// <summary>
-			/// Gets a value in the container at the given index
+			/// Gets the value index elements after the one the iterator points to
 			/// </summary>
-			/// <exception cref="runtime_error">If the iterator is not associated with a container or index is not within the bounds of the container</exception>
-			/// <returns>value in the container at the given index</returns>
+			/// <exception cref="runtime_error">With checked iterators, if the iterator is not associated with a container or the element is out of bounds</exception>
+			/// <returns>value in the container at the given offset</returns>
 			[[nodiscard]] reference operator[](size_t index) const;
 
 			/// <summary>
 			/// Increments the iterator so the iterator points to the next element in the container
 			/// </summary>
-			/// <exception cref="runtime_error">Iterator is not associated with a container</exception>
+			/// <exception cref="runtime_error">With checked iterators, if the iterator is not associated with a container</exception>
 			/// <returns>Reference to the incremented iterator</returns>
 			iterator& operator++();
 
 			/// <summary>
 			/// Increments the iterator so the iterator points to the next element in the container
 			/// </summary>
-			/// <exception cref="runtime_error">Iterator is not associated with a container</exception>
+			/// <exception cref="runtime_error">With checked iterators, if the iterator is not associated with a container</exception>
 			/// <returns>Iterator before it is incremented</returns>
 			iterator operator++(int);
 
 			/// <summary>
 			/// Decrements the iterator so the iterator points to the previous element in the container
 			/// </summary>
-			/// <exception cref="runtime_error">Iterator is not associated with a container</exception>
+			/// <exception cref="runtime_error">With checked iterators, if the iterator is not associated with a container</exception>
 			/// <returns>Reference to the decremented iterator</returns>
 			iterator& operator--();
 
 			/// <summary>
 			/// Decrements the iterator so the iterator points to the previous element in the container
 			/// </summary>
-			/// <exception cref="runtime_error">Iterator is not associated with a container</exception>
+			/// <exception cref="runtime_error">With checked iterators, if the iterator is not associated with a container</exception>
 			/// <returns>Iterator before it is decremented</returns>
 			iterator operator--(int);
 
@@ -285,14 +293,14 @@ namespace FieaGameEngine
 			/// Increments the iterator so the iterator points to nth element ahead from its current position in the container
 			/// </summary>
 			/// <param name="n">Positions to increment by</param>
-			/// <exception cref="runtime_error">Iterator is not associated with a container</exception>
+			/// <exception cref="runtime_error">With checked iterators, if the iterator is not associated with a container</exception>
 			/// <returns>Reference to the incremented iterator</returns>
 			iterator& operator+=(size_t n);
 
 			/// <summary>
 			/// Adds a number to the iterator and returns a new iterator to nth element ahead from the current iterator's position in the container
 			/// </summary>
-			/// <exception cref="runtime_error">Iterator is not associated with a container</exception>
+			/// <exception cref="runtime_error">With checked iterators, if the iterator is not associated with a container</exception>
 			/// <returns>Iterator to current position + n</returns>
 			[[nodiscard]] iterator operator+(size_t n) const;
 
@@ -300,7 +308,7 @@ namespace FieaGameEngine
 			/// Decrements the iterator so the iterator points to nth element behind from its current position in the container
 			/// </summary>
 			/// <param name="n">Positions to decrement by</param>
-			/// <exception cref="runtime_error">Iterator is not associated with a container</exception>
+			/// <exception cref="runtime_error">With checked iterators, if the iterator is not associated with a container</exception>
 			/// <returns>Reference to the decremented iterator</returns>
 			iterator& operator-=(size_t n);
 
@@ -308,7 +316,7 @@ namespace FieaGameEngine
 			/// Subtracts a number to the iterator and returns a new iterator to nth element behind from the current iterator's position in the container
 			/// </summary>
 			/// <param name="n">Positions to decrement by</param>
-			/// <exception cref="runtime_error">Iterator is not associated with a container</exception>
+			/// <exception cref="runtime_error">With checked iterators, if the iterator is not associated with a container</exception>
 			/// <returns>Iterator to current position - n</returns>
 			[[nodiscard]] iterator operator-(size_t n) const;
 
@@ -317,7 +325,7 @@ namespace FieaGameEngine
 			/// Iterator to subtract should be before the current position or at the current position of this iterator
 			/// </summary>
 			/// <param name="it">Iterator to subtract</param>
-			/// <exception cref="runtime_error">Iterators are from different containers</exception>
+			/// <exception cref="runtime_error">With checked iterators, if the iterators are from different containers</exception>
 			/// <returns>Difference in positions between the two iterators</returns>
 			[[nodiscard]] size_t operator-(const iterator& it) const;
 
@@ -325,7 +333,7 @@ namespace FieaGameEngine
 			/// Checks if the current iterators position is less than an iterator in the same container
 			/// </summary>
 			/// <param name="it">Iterator to compare against</param>
-			/// <exception cref="runtime_error">Iterators are from different containers</exception>
+			/// <exception cref="runtime_error">With checked iterators, if the iterators are from different containers</exception>
 			/// <returns>True if current iterators position is less than the provided iterator; otherwise false</returns>
 			[[nodiscard]] bool operator<(const iterator& it) const;
 
@@ -333,7 +341,7 @@ namespace FieaGameEngine
 			/// Checks if the current iterators position is less or equal to an iterator in the same container
 			/// </summary>
 			/// <param name="it">Iterator to compare against</param>
-			/// <exception cref="runtime_error">Iterators are from different containers</exception>
+			/// <exception cref="runtime_error">With checked iterators, if the iterators are from different containers</exception>
 			/// <returns>True if current iterators position is less or equal to the provided iterator; otherwise false</returns>
 			[[nodiscard]] bool operator<=(const iterator& it) const;
 
@@ -341,7 +349,7 @@ namespace FieaGameEngine
 			/// Checks if the current iterators position is greater than an iterator in the same container
 			/// </summary>
 			/// <param name="it">Iterator to compare against</param>
-			/// <exception cref="runtime_error">Iterators are from different containers</exception>
+			/// <exception cref="runtime_error">With checked iterators, if the iterators are from different containers</exception>
 			/// <returns>True if current iterators position is greater than the provided iterator; otherwise false</returns>
 			[[nodiscard]] bool operator>(const iterator& it) const;
 
@@ -349,7 +357,7 @@ namespace FieaGameEngine
 			/// Checks if the current iterators position is greater than or equal to an iterator in the same container
 			/// </summary>
 			/// <param name="it">Iterator to compare against</param>
-			/// <exception cref="runtime_error">Iterators are from different containers</exception>
+			/// <exception cref="runtime_error">With checked iterators, if the iterators are from different containers</exception>
 			/// <returns>True if current iterators position is greater than or equal to the provided iterator; otherwise false</returns>
 			[[nodiscard]] bool operator>=(const iterator& it) const;
 
@@ -380,7 +388,9 @@ namespace FieaGameEngine
 			iterator(Vector& container, pointer ptr = nullptr);
 
 			pointer _ptr = nullptr;
+#if FIEA_CHECKED_ITERATORS
 			Vector* _container = nullptr;
+#endif
 		};
 
 		/// <summary>
@@ -388,7 +398,15 @@ namespace FieaGameEngine
 		/// </summary>
 		/// <param name="capacity">Default capacity</param>
 		/// <param name="reserveStrategy">Functor the increases the capacity when the the vector needs to grow.</param>
-		Vector(std::size_t capacity = 0, ReserveStrategy reserveStrategy = DefaultReserveStrategy{});
+		Vector(std::size_t capacity = 0, ReserveStrategy reserveStrategy = ReserveStrategy{});
+
+		/// <summary>
+		/// Constructs a vector that allocates from a memory resource
+		/// </summary>
+		/// <param name="allocator">Allocator, or the memory resource it allocates from. The resource must outlive the vector</param>
+		/// <param name="capacity">Default capacity</param>
+		/// <param name="reserveStrategy">Functor the increases the capacity when the the vector needs to grow.</param>
+		explicit Vector(const Allocator& allocator, std::size_t capacity = 0, ReserveStrategy reserveStrategy = ReserveStrategy{});
 
 		/// <summary>
 		/// Creates a vector from an initializer list of values
@@ -406,13 +424,28 @@ namespace FieaGameEngine
 		/// </summary>
 		Vector(Vector&& other) noexcept;
 
+		/// <summary>
+		/// Copy constructor that allocates from a memory resource
+		/// </summary>
+		/// <param name="other">Vector to copy</param>
+		/// <param name="allocator">Allocator of the copy</param>
+		Vector(const Vector& other, const Allocator& allocator);
+
+		/// <summary>
+		/// Move constructor that allocates from a memory resource.
+		/// The storage of other is only taken if both allocate from the same resource; otherwise the elements are moved one by one
+		/// </summary>
+		/// <param name="other">Vector to move</param>
+		/// <param name="allocator">Allocator of the new vector</param>
+		Vector(Vector&& other, const Allocator& allocator);
+
 		/// <summary>
 		/// Copy assignment
 		/// </summary>
 		Vector& operator=(const Vector& rhs);
 
 		/// <summary>
-		/// Move assignment
+		/// Move assignment. The allocator is not propagated: if rhs allocates from a different resource, its elements are moved one by one
 		/// </summary>
 		Vector& operator=(Vector&& rhs) noexcept;
 
@@ -541,6 +574,36 @@ namespace FieaGameEngine
 		/// <returns>Capacity</returns>
 		[[nodiscard]] std::size_t Capacity() const;
 
+		/// <summary>
+		/// Gets the contiguous storage of the elements. Invalidated when the container grows or shrinks
+		/// </summary>
+		/// <returns>Pointer to the first element, or null if nothing was ever allocated</returns>
+		[[nodiscard]] pointer Data();
+
+		/// <summary>
+		/// Gets the contiguous storage of the elements. Invalidated when the container grows or shrinks
+		/// </summary>
+		/// <returns>Pointer to the first element, or null if nothing was ever allocated</returns>
+		[[nodiscard]] const_pointer Data() const;
+
+		/// <summary>
+		/// Views the elements without iterator checks, for hot loops
+		/// </summary>
+		/// <returns>Span over the elements. Invalidated when the container grows or shrinks</returns>
+		[[nodiscard]] std::span<value_type> AsSpan();
+
+		/// <summary>
+		/// Views the elements without iterator checks, for hot loops
+		/// </summary>
+		/// <returns>Span over the elements. Invalidated when the container grows or shrinks</returns>
+		[[nodiscard]] std::span<const value_type> AsSpan() const;
+
+		/// <summary>
+		/// Gets the allocator the container allocates its storage with
+		/// </summary>
+		/// <returns>Allocator of the container</returns>
+		[[nodiscard]] Allocator GetAllocator() const;
+
 		/// <summary>
 		/// Reserves space in the container
 		/// </summary>
@@ -581,7 +644,7 @@ namespace FieaGameEngine
 		/// </summary>
 		/// <param name="value">Value to find</param>
 		/// <returns>Iterator pointing to the value found or to the end of the container</returns>
-		iterator Find(const const_reference value, EqualityFunctor equalityFunctor = DefaultEquality<T>{});
+		iterator Find(const const_reference value, EqualityFunctor equalityFunctor = EqualityFunctor{});
 
 		/// <summary>
 		/// Finds a element in the containers and returns an iterator to the element.
@@ -589,7 +652,7 @@ namespace FieaGameEngine
 		/// </summary>
 		/// <param name="value">Value to find</param>
 		/// <returns>Iterator pointing to the value found or to the end of the container</returns>
-		const_iterator Find(const const_reference value, EqualityFunctor equalityFunctor = DefaultEquality<T>{}) const;
+		const_iterator Find(const const_reference value, EqualityFunctor equalityFunctor = EqualityFunctor{}) const;
 
 		/// <summary>
 		/// Clears the elements of the container.
@@ -607,7 +670,7 @@ namespace FieaGameEngine
 		/// </summary>
 		/// <param name="value">element to remove</param>
 		/// <returns>True if the element was found; otherwise false</returns>
-		bool Remove(const_reference value, EqualityFunctor equalityFunctor = DefaultEquality<T>{});
+		bool Remove(const_reference value, EqualityFunctor equalityFunctor = EqualityFunctor{});
 
 		/// <summary>
 		/// Removes the element pointed to by the given interator.
@@ -629,11 +692,26 @@ namespace FieaGameEngine
 		bool Remove(const iterator& first, const iterator& last);
 
 	private:
+		/// <summary>
+		/// Copies values into the capacity after the last element, with a single memcpy when the type is trivially copyable.
+		/// The capacity must already fit them
+		/// </summary>
+		/// <param name="values">First value to copy</param>
+		/// <param name="count">Number of values to copy</param>
+		void _AppendCopies(const_pointer values, std::size_t count);
+
+		/// <summary>
+		/// Moves the elements to new storage from the allocator and releases the old storage.
+		/// Trivially relocatable elements are copied bitwise; others are move constructed and destroyed
+		/// </summary>
+		/// <param name="capacity">Capacity of the new storage. Must fit the elements</param>
+		void _Reallocate(std::size_t capacity);
+
 		Allocator _alloc;
 		value_type* _data = nullptr;
 		std::size_t _capacity = 0;
 		std::size_t _size = 0;
-		ReserveStrategy _reserveStrategy = DefaultReserveStrategy{};
+		NO_UNIQUE_ADDRESS ReserveStrategy _reserveStrategy;
 	};
 }
 #include <Vector>
@@ -2,136 +2,168 @@
 #include <utility>
 #include <cassert>
 #include <algorithm>
+#include <cstring>
+#include <memory>
+#include <type_traits>
 
 namespace FieaGameEngine
 {
 #pragma region Vector
-	template<typename T>
-	inline Vector<T>::Vector(std::size_t capacity, ReserveStrategy reserveStrategy) :
+	template <typename T, typename TReserveStrategy, typename TEquality>
+	inline Vector<T, TReserveStrategy, TEquality>::Vector(std::size_t capacity, ReserveStrategy reserveStrategy) :
 		_reserveStrategy(reserveStrategy)
 	{
 		Reserve(capacity);
 	}
 
-	template<typename T>
-	inline Vector<T>::Vector(std::initializer_list<value_type> list)
+	template <typename T, typename TReserveStrategy, typename TEquality>
+	inline Vector<T, TReserveStrategy, TEquality>::Vector(const Allocator& allocator, std::size_t capacity, ReserveStrategy reserveStrategy) :
+		_alloc(allocator),
+		_reserveStrategy(reserveStrategy)
+	{
+		Reserve(capacity);
+	}
+
+	template <typename T, typename TReserveStrategy, typename TEquality>
+	inline Vector<T, TReserveStrategy, TEquality>::Vector(std::initializer_list<value_type> list)
 	{
 		Reserve(list.size());
-		for (const auto& value : list)
-		{
-			PushBack(value);
-		}
+		_AppendCopies(list.begin(), list.size());
 	}
 
-	template<typename T>
-	inline Vector<T>::Vector(const Vector& other)
+	template <typename T, typename TReserveStrategy, typename TEquality>
+	inline Vector<T, TReserveStrategy, TEquality>::Vector(const Vector& other) :
+		_reserveStrategy(other._reserveStrategy)
 	{
 		Reserve(other._size);
-		for (size_t i = 0; i < other._size; ++i)
-		{
-			PushBack(other[i]);
-		}
+		_AppendCopies(other._data, other._size);
 	}
 
-	template<typename T>
-	inline Vector<T>::Vector(Vector&& other) noexcept :
-		_data(other._data), _size(other._size), _capacity(other._capacity)
+	template <typename T, typename TReserveStrategy, typename TEquality>
+	inline Vector<T, TReserveStrategy, TEquality>::Vector(Vector&& other) noexcept :
+		_alloc(other._alloc), _data(other._data), _capacity(other._capacity), _size(other._size), _reserveStrategy(std::move(other._reserveStrategy))
 	{
 		other._data = nullptr;
 		other._size = 0;
 		other._capacity = 0;
 	}
 
-	template<typename T>
-	inline Vector<T>& Vector<T>::operator=(const Vector& rhs)
+	template <typename T, typename TReserveStrategy, typename TEquality>
+	inline Vector<T, TReserveStrategy, TEquality>::Vector(const Vector& other, const Allocator& allocator) :
+		_alloc(allocator), _reserveStrategy(other._reserveStrategy)
+	{
+		Reserve(other._size);
+		_AppendCopies(other._data, other._size);
+	}
+
+	template <typename T, typename TReserveStrategy, typename TEquality>
+	inline Vector<T, TReserveStrategy, TEquality>::Vector(Vector&& other, const Allocator& allocator) :
+		_alloc(allocator)
+	{
+		*this = std::move(other);
+	}
+
+	template <typename T, typename TReserveStrategy, typename TEquality>
+	inline Vector<T, TReserveStrategy, TEquality>& Vector<T, TReserveStrategy, TEquality>::operator=(const Vector& rhs)
 	{
 		if (this != &rhs)
 		{
 			Clear();
 			Reserve(rhs._size);
-			for (size_t i = 0; i < rhs._size; ++i)
-			{
-				PushBack(rhs[i]);
-			}
+			_AppendCopies(rhs._data, rhs._size);
 		}
 		return *this;
 	}
 
-	template<typename T>
-	inline Vector<T>& Vector<T>::operator=(Vector&& rhs) noexcept
+	template <typename T, typename TReserveStrategy, typename TEquality>
+	inline Vector<T, TReserveStrategy, TEquality>& Vector<T, TReserveStrategy, TEquality>::operator=(Vector&& rhs) noexcept
 	{
 		if (this != &rhs)
 		{
 			Clear();
-			ShrinkToFit();
-			_data = rhs._data;
-			_size = rhs._size;
-			_capacity = rhs._capacity;
-
-			rhs._data = nullptr;
-			rhs._size = 0;
-			rhs._capacity = 0;
+			if (_alloc == rhs._alloc)
+			{
+				ShrinkToFit();
+				_data = rhs._data;
+				_size = rhs._size;
+				_capacity = rhs._capacity;
+
+				rhs._data = nullptr;
+				rhs._size = 0;
+				rhs._capacity = 0;
+			}
+			else
+			{
+				// Storage from another resource cannot be released by ours
+				Reserve(rhs._size);
+				for (size_t i = 0; i < rhs._size; ++i)
+				{
+					new (_data + i) value_type(std::move(rhs._data[i]));
+				}
+				_size = rhs._size;
+				rhs.Clear();
+			}
 		}
 		return *this;
 	}
 
-	template<typename T>
-	inline Vector<T>::~Vector()
+	template <typename T, typename TReserveStrategy, typename TEquality>
+	inline Vector<T, TReserveStrategy, TEquality>::~Vector()
 	{
 		Clear();
 		ShrinkToFit();
 	}
 
-	template<typename T>
-	inline Vector<T>::iterator Vector<T>::begin()
+	template <typename T, typename TReserveStrategy, typename TEquality>
+	inline Vector<T, TReserveStrategy, TEquality>::iterator Vector<T, TReserveStrategy, TEquality>::begin()
 	{
 		return iterator(*this, _data);
 	}
 
-	template<typename T>
-	inline Vector<T>::const_iterator Vector<T>::begin() const
+	template <typename T, typename TReserveStrategy, typename TEquality>
+	inline Vector<T, TReserveStrategy, TEquality>::const_iterator Vector<T, TReserveStrategy, TEquality>::begin() const
 	{
 		return const_iterator(*this, _data);
 	}
 
-	template<typename T>
-	inline Vector<T>::iterator Vector<T>::end()
+	template <typename T, typename TReserveStrategy, typename TEquality>
+	inline Vector<T, TReserveStrategy, TEquality>::iterator Vector<T, TReserveStrategy, TEquality>::end()
 	{
 		return iterator(*this, _data + _size);
 	}
 
-	template<typename T>
-	inline Vector<T>::const_iterator Vector<T>::end() const
+	template <typename T, typename TReserveStrategy, typename TEquality>
+	inline Vector<T, TReserveStrategy, TEquality>::const_iterator Vector<T, TReserveStrategy, TEquality>::end() const
 	{
 		return const_iterator(*this, _data + _size);
 	}
 
-	template<typename T>
-	inline Vector<T>::const_iterator Vector<T>::cbegin() const
+	template <typename T, typename TReserveStrategy, typename TEquality>
+	inline Vector<T, TReserveStrategy, TEquality>::const_iterator Vector<T, TReserveStrategy, TEquality>::cbegin() const
 	{
 		return const_iterator(*this, _data);
 	}
 
-	template<typename T>
-	inline Vector<T>::const_iterator Vector<T>::cend() const
+	template <typename T, typename TReserveStrategy, typename TEquality>
+	inline Vector<T, TReserveStrategy, TEquality>::const_iterator Vector<T, TReserveStrategy, TEquality>::cend() const
 	{
 		return const_iterator(*this, _data + _size);
 	}
 
-	template<typename T>
-	inline Vector<T>::reference Vector<T>::operator[](std::size_t index)
+	template <typename T, typename TReserveStrategy, typename TEquality>
+	inline Vector<T, TReserveStrategy, TEquality>::reference Vector<T, TReserveStrategy, TEquality>::operator[](std::size_t index)
 	{
 		return At(index);
 	}
 
-	template<typename T>
-	inline Vector<T>::const_reference Vector<T>::operator[](std::size_t index) const
+	template <typename T, typename TReserveStrategy, typename TEquality>
+	inline Vector<T, TReserveStrategy, TEquality>::const_reference Vector<T, TReserveStrategy, TEquality>::operator[](std::size_t index) const
 	{
 		return At(index);
 	}
 
-	template<typename T>
-	inline Vector<T>::reference Vector<T>::At(std::size_t index)
+	template <typename T, typename TReserveStrategy, typename TEquality>
+	inline Vector<T, TReserveStrategy, TEquality>::reference Vector<T, TReserveStrategy, TEquality>::At(std::size_t index)
 	{
 		if (index >= _size)
 		{
@@ -140,8 +172,8 @@ namespace FieaGameEngine
 		return _data[index];
 	}
 
-	template<typename T>
-	inline Vector<T>::const_reference Vector<T>::At(std::size_t index) const
+	template <typename T, typename TReserveStrategy, typename TEquality>
+	inline Vector<T, TReserveStrategy, TEquality>::const_reference Vector<T, TReserveStrategy, TEquality>::At(std::size_t index) const
 	{
 		if (index >= _size)
 		{
@@ -150,8 +182,8 @@ namespace FieaGameEngine
 		return _data[index];
 	}
 
-	template<typename T>
-	inline void Vector<T>::PopBack()
+	template <typename T, typename TReserveStrategy, typename TEquality>
+	inline void Vector<T, TReserveStrategy, TEquality>::PopBack()
 	{
 		if (_size == 0)
 		{
@@ -161,14 +193,14 @@ namespace FieaGameEngine
 		--_size;
 	}
 
-	template<typename T>
-	inline bool Vector<T>::IsEmpty() const
+	template <typename T, typename TReserveStrategy, typename TEquality>
+	inline bool Vector<T, TReserveStrategy, TEquality>::IsEmpty() const
 	{
 		return _size == 0;
 	}
 
-	template<typename T>
-	inline Vector<T>::reference Vector<T>::Front()
+	template <typename T, typename TReserveStrategy, typename TEquality>
+	inline Vector<T, TReserveStrategy, TEquality>::reference Vector<T, TReserveStrategy, TEquality>::Front()
 	{
 		if (_size == 0)
 		{
@@ -177,8 +209,8 @@ namespace FieaGameEngine
 		return At(0);
 	}
 
-	template<typename T>
-	inline Vector<T>::const_reference Vector<T>::Front() const
+	template <typename T, typename TReserveStrategy, typename TEquality>
+	inline Vector<T, TReserveStrategy, TEquality>::const_reference Vector<T, TReserveStrategy, TEquality>::Front() const
 	{
 		if (_size == 0)
 		{
@@ -187,8 +219,8 @@ namespace FieaGameEngine
 		return At(0);
 	}
 
-	template<typename T>
-	inline Vector<T>::reference Vector<T>::Back()
+	template <typename T, typename TReserveStrategy, typename TEquality>
+	inline Vector<T, TReserveStrategy, TEquality>::reference Vector<T, TReserveStrategy, TEquality>::Back()
 	{
 		if (_size == 0)
 		{
@@ -197,8 +229,8 @@ namespace FieaGameEngine
 		return At(_size - 1);
 	}
 
-	template<typename T>
-	inline Vector<T>::const_reference Vector<T>::Back() const
+	template <typename T, typename TReserveStrategy, typename TEquality>
+	inline Vector<T, TReserveStrategy, TEquality>::const_reference Vector<T, TReserveStrategy, TEquality>::Back() const
 	{
 		if (_size == 0)
 		{
@@ -207,32 +239,59 @@ namespace FieaGameEngine
 		return At(_size - 1);
 	}
 
-	template<typename T>
-	inline std::size_t Vector<T>::Size() const
+	template <typename T, typename TReserveStrategy, typename TEquality>
+	inline std::size_t Vector<T, TReserveStrategy, TEquality>::Size() const
 	{
 		return _size;
 	}
 
-	template<typename T>
-	inline std::size_t Vector<T>::Capacity() const
+	template <typename T, typename TReserveStrategy, typename TEquality>
+	inline std::size_t Vector<T, TReserveStrategy, TEquality>::Capacity() const
 	{
 		return _capacity;
 	}
 
-	template <typename T>
-	void Vector<T>::Reserve(size_t capacity)
+	template <typename T, typename TReserveStrategy, typename TEquality>
+	inline typename Vector<T, TReserveStrategy, TEquality>::pointer Vector<T, TReserveStrategy, TEquality>::Data()
+	{
+		return _data;
+	}
+
+	template <typename T, typename TReserveStrategy, typename TEquality>
+	inline typename Vector<T, TReserveStrategy, TEquality>::const_pointer Vector<T, TReserveStrategy, TEquality>::Data() const
+	{
+		return _data;
+	}
+
+	template <typename T, typename TReserveStrategy, typename TEquality>
+	inline std::span<typename Vector<T, TReserveStrategy, TEquality>::value_type> Vector<T, TReserveStrategy, TEquality>::AsSpan()
+	{
+		return std::span<value_type>(_data, _size);
+	}
+
+	template <typename T, typename TReserveStrategy, typename TEquality>
+	inline std::span<const typename Vector<T, TReserveStrategy, TEquality>::value_type> Vector<T, TReserveStrategy, TEquality>::AsSpan() const
+	{
+		return std::span<const value_type>(_data, _size);
+	}
+
+	template <typename T, typename TReserveStrategy, typename TEquality>
+	void Vector<T, TReserveStrategy, TEquality>::Reserve(size_t capacity)
 	{
 		if (capacity > _capacity)
 		{
-			pointer data = reinterpret_cast<pointer>(realloc(_data, capacity * sizeof(value_type)));
-			assert(data != nullptr);
-			_data = data;
-			_capacity = capacity;
+			_Reallocate(capacity);
 		}
 	}
 
-	template<typename T>
-	inline void Vector<T>::Resize(size_t size)
+	template <typename T, typename TReserveStrategy, typename TEquality>
+	inline typename Vector<T, TReserveStrategy, TEquality>::Allocator Vector<T, TReserveStrategy, TEquality>::GetAllocator() const
+	{
+		return _alloc;
+	}
+
+	template <typename T, typename TReserveStrategy, typename TEquality>
+	inline void Vector<T, TReserveStrategy, TEquality>::Resize(size_t size)
 	{
 		if (size == _size)
 		{
@@ -254,8 +313,8 @@ namespace FieaGameEngine
 		}
 	}
 
-	template<typename T>
-	inline void Vector<T>::Resize(size_t size, const_reference value)
+	template <typename T, typename TReserveStrategy, typename TEquality>
+	inline void Vector<T, TReserveStrategy, TEquality>::Resize(size_t size, const_reference value)
 	{
 		if (size == _size)
 		{
@@ -277,21 +336,21 @@ namespace FieaGameEngine
 		}
 	}
 
-	template<typename T>
-	inline Vector<T>::iterator Vector<T>::PushBack(const_reference value)
+	template <typename T, typename TReserveStrategy, typename TEquality>
+	inline Vector<T, TReserveStrategy, TEquality>::iterator Vector<T, TReserveStrategy, TEquality>::PushBack(const_reference value)
 	{
 		return EmplaceBack(value);
 	}
 
-	template<typename T>
-	inline Vector<T>::iterator Vector<T>::PushBack(rvalue_reference value)
+	template <typename T, typename TReserveStrategy, typename TEquality>
+	inline Vector<T, TReserveStrategy, TEquality>::iterator Vector<T, TReserveStrategy, TEquality>::PushBack(rvalue_reference value)
 	{
 		return EmplaceBack(std::move(value));
 	}
 
-	template<typename T>
+	template <typename T, typename TReserveStrategy, typename TEquality>
 	template<typename... Args>
-	inline Vector<T>::iterator Vector<T>::EmplaceBack(Args... args)
+	inline Vector<T, TReserveStrategy, TEquality>::iterator Vector<T, TReserveStrategy, TEquality>::EmplaceBack(Args... args)
 	{
 		if (_size == _capacity)
 		{
@@ -303,19 +362,58 @@ namespace FieaGameEngine
 		return iterator(*this, _data + _size - 1);
 	}
 
-	template<typename T>
-	inline Vector<T>& Vector<T>::Append(const Vector& other)
+	template <typename T, typename TReserveStrategy, typename TEquality>
+	inline Vector<T, TReserveStrategy, TEquality>& Vector<T, TReserveStrategy, TEquality>::Append(const Vector& other)
 	{
-		Reserve(_size + other._size);
-		for (const auto& item : other)
+		// Reserve first: appending a vector to itself reads from the reallocated storage
+		const size_t count = other._size;
+		Reserve(_size + count);
+		_AppendCopies(other._data, count);
+		return *this;
+	}
+
+	template <typename T, typename TReserveStrategy, typename TEquality>
+	inline void Vector<T, TReserveStrategy, TEquality>::_AppendCopies(const_pointer values, size_t count)
+	{
+		assert(_size + count <= _capacity);
+		if constexpr (std::is_trivially_copyable_v<value_type>)
 		{
-			PushBack(item);
+			if (count > 0)
+			{
+				std::memcpy(static_cast<void*>(_data + _size), values, count * sizeof(value_type));
+			}
 		}
-		return *this;
+		else
+		{
+			std::uninitialized_copy(values, values + count, _data + _size);
+		}
+		_size += count;
+	}
+
+	template <typename T, typename TReserveStrategy, typename TEquality>
+	inline void Vector<T, TReserveStrategy, TEquality>::_Reallocate(size_t capacity)
+	{
+		assert(capacity >= _size);
+		pointer data = _alloc.allocate(capacity);
+		try
+		{
+			Relocate(data, _data, _size);
+		}
+		catch (...)
+		{
+			_alloc.deallocate(data, capacity);
+			throw;
+		}
+		if (_data != nullptr)
+		{
+			_alloc.deallocate(_data, _capacity);
+		}
+		_data = data;
+		_capacity = capacity;
 	}
 
-	template<typename T>
-	typename Vector<T>::iterator Vector<T>::Find(const_reference value, EqualityFunctor equalityFunctor)
+	template <typename T, typename TReserveStrategy, typename TEquality>
+	typename Vector<T, TReserveStrategy, TEquality>::iterator Vector<T, TReserveStrategy, TEquality>::Find(const_reference value, EqualityFunctor equalityFunctor)
 	{
 		iterator it = begin();
 		while (it != end())
@@ -329,8 +427,8 @@ namespace FieaGameEngine
 		return it;
 	}
 
-	template<typename T>
-	typename Vector<T>::const_iterator Vector<T>::Find(const_reference value, EqualityFunctor equalityFunctor) const
+	template <typename T, typename TReserveStrategy, typename TEquality>
+	typename Vector<T, TReserveStrategy, TEquality>::const_iterator Vector<T, TReserveStrategy, TEquality>::Find(const_reference value, EqualityFunctor equalityFunctor) const
 	{
 		const_iterator it = cbegin();
 		for (; it != end(); ++it)
@@ -343,8 +441,8 @@ namespace FieaGameEngine
 		return it;
 	}
 
-	template<typename T>
-	inline void Vector<T>::Clear()
+	template <typename T, typename TReserveStrategy, typename TEquality>
+	inline void Vector<T, TReserveStrategy, TEquality>::Clear()
 	{
 		for (size_t i = 0; i < _size; i++)
 		{
@@ -353,43 +451,51 @@ namespace FieaGameEngine
 		--_size = 0;
 	}
 
-	template<typename T>
-	inline void Vector<T>::ShrinkToFit()
+	template <typename T, typename TReserveStrategy, typename TEquality>
+	inline void Vector<T, TReserveStrategy, TEquality>::ShrinkToFit()
 	{
 		if (_size == 0)
 		{
-			free(_data);
+			if (_data != nullptr)
+			{
+				_alloc.deallocate(_data, _capacity);
+			}
 			_data = nullptr;
 			_capacity = 0;
 		}
 		else if (_capacity > _size && _capacity != 0)
 		{
-			pointer data = reinterpret_cast<pointer>(std::realloc(_data, _size * sizeof(value_type)));
-			assert(data != nullptr);
-			_data = data;
-			_capacity = _size;
+			_Reallocate(_size);
 		}
 	}
 
-	template<typename T>
-	inline bool Vector<T>::Remove(const_reference value, EqualityFunctor equalityFunctor)
+	template <typename T, typename TReserveStrategy, typename TEquality>
+	inline bool Vector<T, TReserveStrategy, TEquality>::Remove(const_reference value, EqualityFunctor equalityFunctor)
 	{
 		return Remove(Find(value, equalityFunctor));
 	}
 
-	template<typename T>
-	inline bool Vector<T>::Remove(const iterator& first)
+	template <typename T, typename TReserveStrategy, typename TEquality>
+	inline bool Vector<T, TReserveStrategy, TEquality>::Remove(const iterator& first)
 	{
 		return Remove(first, first + 1);
 	}
 
-	template<typename T>
-	inline bool Vector<T>::Remove(const iterator& first, const iterator& last)
+	template <typename T, typename TReserveStrategy, typename TEquality>
+	inline bool Vector<T, TReserveStrategy, TEquality>::Remove(const iterator& first, const iterator& last)
 	{
+#if FIEA_CHECKED_ITERATORS
 		if (first._container != this || last._container != this)
 		{
 			return false;
 		}
+#else
+		// Unchecked iterators do not know their container, but default constructed ones are still rejected
+		if (first._ptr == nullptr || last._ptr == nullptr)
+		{
+			return false;
+		}
+#endif
 
 		iterator firstCpy = first;
 		iterator lastCpy = last;
@@ -416,32 +522,37 @@ namespace FieaGameEngine
 		{
 			it->~T();
 		}
-		std::size_t elementsToMove = end() - lastCpy;
-		if (elementsToMove > 0)
-		{
-			std::memmove(&*firstCpy, &*lastCpy, elementsToMove * sizeof(T));
-		}
+		CloseGap(&*firstCpy, static_cast<std::size_t>(lastCpy - firstCpy), static_cast<std::size_t>(endIt - lastCpy));
 		_size -= lastCpy - firstCpy;
 		return true;
 	}
 #pragma endregion Vector
 
 #pragma region const_iterator
-	template <typename T>
-	Vector<T>::const_iterator::const_iterator(const Vector& container, pointer ptr) :
-		_container(&container), _ptr(ptr)
+	template <typename T, typename TReserveStrategy, typename TEquality>
+	Vector<T, TReserveStrategy, TEquality>::const_iterator::const_iterator([[maybe_unused]] const Vector& container, pointer ptr) :
+#if FIEA_CHECKED_ITERATORS
+		_ptr(ptr), _container(&container)
+#else
+		_ptr(ptr)
+#endif
 	{
 	}
 
-	template <typename T>
-	Vector<T>::const_iterator::const_iterator(const iterator& other) :
-		_container(other._container), _ptr(other._ptr)
+	template <typename T, typename TReserveStrategy, typename TEquality>
+	Vector<T, TReserveStrategy, TEquality>::const_iterator::const_iterator(const iterator& other) :
+#if FIEA_CHECKED_ITERATORS
+		_ptr(other._ptr), _container(other._container)
+#else
+		_ptr(other._ptr)
+#endif
 	{
 	}
 
-	template <typename T>
-	inline typename Vector<T>::const_reference Vector<T>::const_iterator::operator*() const
+	template <typename T, typename TReserveStrategy, typename TEquality>
+	inline typename Vector<T, TReserveStrategy, TEquality>::const_reference Vector<T, TReserveStrategy, TEquality>::const_iterator::operator*() const
 	{
+#if FIEA_CHECKED_ITERATORS
 		if (_ptr == nullptr)
 		{
 			throw std::runtime_error("iterator points to null");
@@ -450,28 +561,26 @@ namespace FieaGameEngine
 		{
 			throw std::runtime_error("iterator out of bounds");
 		}
+#endif
 		return *_ptr;
 	}
 
-	template <typename T>
-	inline const typename Vector<T>::const_iterator::value_type* Vector<T>::const_iterator::operator->() const
+	template <typename T, typename TReserveStrategy, typename TEquality>
+	inline const typename Vector<T, TReserveStrategy, TEquality>::const_iterator::value_type* Vector<T, TReserveStrategy, TEquality>::const_iterator::operator->() const
 	{
 		return &operator*();
 	}
 
-	template<typename T>
-	inline Vector<T>::const_reference Vector<T>::const_iterator::operator[](std::size_t index) const
+	template <typename T, typename TReserveStrategy, typename TEquality>
+	inline typename Vector<T, TReserveStrategy, TEquality>::const_reference Vector<T, TReserveStrategy, TEquality>::const_iterator::operator[](std::size_t index) const
 	{
-		if (_container == nullptr)
-		{
-			throw std::runtime_error("Iterator is not associated with a container");
-		}
-		return _container->At(index);
+		return *(*this + index);
 	}
 
-	template <typename T>
-	inline typename Vector<T>::const_iterator& Vector<T>::const_iterator::operator++()
+	template <typename T, typename TReserveStrategy, typename TEquality>
+	inline typename Vector<T, TReserveStrategy, TEquality>::const_iterator& Vector<T, TReserveStrategy, TEquality>::const_iterator::operator++()
 	{
+#if FIEA_CHECKED_ITERATORS
 		if (_container == nullptr)
 		{
 			throw std::runtime_error("Iterator is not associated with a container");
@@ -481,20 +590,24 @@ namespace FieaGameEngine
 		{
 			++_ptr;
 		}
+#else
+		++_ptr;
+#endif
 		return *this;
 	}
 
-	template <typename T>
-	inline typename Vector<T>::const_iterator Vector<T>::const_iterator::operator++(int)
+	template <typename T, typename TReserveStrategy, typename TEquality>
+	inline typename Vector<T, TReserveStrategy, TEquality>::const_iterator Vector<T, TReserveStrategy, TEquality>::const_iterator::operator++(int)
 	{
 		const_iterator it = *this;
 		operator++();
 		return it;
 	}
 
-	template <typename T>
-	inline typename Vector<T>::const_iterator& Vector<T>::const_iterator::operator--()
+	template <typename T, typename TReserveStrategy, typename TEquality>
+	inline typename Vector<T, TReserveStrategy, TEquality>::const_iterator& Vector<T, TReserveStrategy, TEquality>::const_iterator::operator--()
 	{
+#if FIEA_CHECKED_ITERATORS
 		if (_container == nullptr)
 		{
 			throw std::runtime_error("Iterator is not associated with a container");
@@ -504,20 +617,24 @@ namespace FieaGameEngine
 		{
 			--_ptr;
 		}
+#else
+		--_ptr;
+#endif
 		return *this;
 	}
 
-	template <typename T>
-	inline typename Vector<T>::const_iterator Vector<T>::const_iterator::operator--(int)
+	template <typename T, typename TReserveStrategy, typename TEquality>
+	inline typename Vector<T, TReserveStrategy, TEquality>::const_iterator Vector<T, TReserveStrategy, TEquality>::const_iterator::operator--(int)
 	{
 		const_iterator it = *this;
 		operator--();
 		return it;
 	}
 
-	template <typename T>
-	inline typename Vector<T>::const_iterator& Vector<T>::const_iterator::operator+=(size_t n)
+	template <typename T, typename TReserveStrategy, typename TEquality>
+	inline typename Vector<T, TReserveStrategy, TEquality>::const_iterator& Vector<T, TReserveStrategy, TEquality>::const_iterator::operator+=(size_t n)
 	{
+#if FIEA_CHECKED_ITERATORS
 		if (_container == nullptr)
 		{
 			throw std::runtime_error("Iterator is not associated with a container");
@@ -527,20 +644,24 @@ namespace FieaGameEngine
 		{
 			_ptr += n;
 		}
+#else
+		_ptr += n;
+#endif
 		return *this;
 	}
 
-	template <typename T>
-	inline typename Vector<T>::const_iterator Vector<T>::const_iterator::operator+(size_t n) const
+	template <typename T, typename TReserveStrategy, typename TEquality>
+	inline typename Vector<T, TReserveStrategy, TEquality>::const_iterator Vector<T, TReserveStrategy, TEquality>::const_iterator::operator+(size_t n) const
 	{
 		const_iterator it = *this;
 		it += n;
 		return it;
 	}
 
-	template <typename T>
-	inline typename Vector<T>::const_iterator& Vector<T>::const_iterator::operator-=(size_t n)
+	template <typename T, typename TReserveStrategy, typename TEquality>
+	inline typename Vector<T, TReserveStrategy, TEquality>::const_iterator& Vector<T, TReserveStrategy, TEquality>::const_iterator::operator-=(size_t n)
 	{
+#if FIEA_CHECKED_ITERATORS
 		if (_container == nullptr)
 		{
 			throw std::runtime_error("Iterator is not associated with a container");
@@ -550,90 +671,112 @@ namespace FieaGameEngine
 		{
 			_ptr -= n;
 		}
+#else
+		_ptr -= n;
+#endif
 		return *this;
 	}
 
-	template <typename T>
-	inline typename Vector<T>::const_iterator Vector<T>::const_iterator::operator-(size_t n) const
+	template <typename T, typename TReserveStrategy, typename TEquality>
+	inline typename Vector<T, TReserveStrategy, TEquality>::const_iterator Vector<T, TReserveStrategy, TEquality>::const_iterator::operator-(size_t n) const
 	{
 		const_iterator it = *this;
 		it -= n;
 		return it;
 	}
 
-	template<typename T>
-	inline size_t Vector<T>::const_iterator::operator-(const const_iterator& it) const
+	template <typename T, typename TReserveStrategy, typename TEquality>
+	inline size_t Vector<T, TReserveStrategy, TEquality>::const_iterator::operator-(const const_iterator& it) const
 	{
+#if FIEA_CHECKED_ITERATORS
 		if (_container != it._container)
 		{
 			throw std::runtime_error("Iterators are from different containers");
 		}
+#endif
 		return _ptr - it._ptr;
 	}
 
-	template<typename T>
-	inline bool Vector<T>::const_iterator::operator<(const const_iterator& it) const
+	template <typename T, typename TReserveStrategy, typename TEquality>
+	inline bool Vector<T, TReserveStrategy, TEquality>::const_iterator::operator<(const const_iterator& it) const
 	{
+#if FIEA_CHECKED_ITERATORS
 		if (_container != it._container)
 		{
 			throw std::runtime_error("Iterators are from different containers");
 		}
+#endif
 		return _ptr < it._ptr;
 	}
 
-	template<typename T>
-	inline bool Vector<T>::const_iterator::operator<=(const const_iterator& it) const
+	template <typename T, typename TReserveStrategy, typename TEquality>
+	inline bool Vector<T, TReserveStrategy, TEquality>::const_iterator::operator<=(const const_iterator& it) const
 	{
+#if FIEA_CHECKED_ITERATORS
 		if (_container != it._container)
 		{
 			throw std::runtime_error("Iterators are from different containers");
 		}
+#endif
 		return _ptr <= it._ptr;
 	}
 
-	template<typename T>
-	inline bool Vector<T>::const_iterator::operator>(const const_iterator& it) const
+	template <typename T, typename TReserveStrategy, typename TEquality>
+	inline bool Vector<T, TReserveStrategy, TEquality>::const_iterator::operator>(const const_iterator& it) const
 	{
+#if FIEA_CHECKED_ITERATORS
 		if (_container != it._container)
 		{
 			throw std::runtime_error("Iterators are from different containers");
 		}
+#endif
 		return _ptr > it._ptr;
 	}
 
-	template<typename T>
-	inline bool Vector<T>::const_iterator::operator>=(const const_iterator& it) const
+	template <typename T, typename TReserveStrategy, typename TEquality>
+	inline bool Vector<T, TReserveStrategy, TEquality>::const_iterator::operator>=(const const_iterator& it) const
 	{
+#if FIEA_CHECKED_ITERATORS
 		if (_container != it._container)
 		{
 			throw std::runtime_error("Iterators are from different containers");
 		}
+#endif
 		return _ptr >= it._ptr;
 	}
 
-	template <typename T>
-	inline bool Vector<T>::const_iterator::operator==(const const_iterator& other) const
+	template <typename T, typename TReserveStrategy, typename TEquality>
+	inline bool Vector<T, TReserveStrategy, TEquality>::const_iterator::operator==(const const_iterator& other) const
 	{
 		return !operator!=(other);
 	}
 
-	template <typename T>
-	inline bool Vector<T>::const_iterator::operator!=(const const_iterator& other) const
+	template <typename T, typename TReserveStrategy, typename TEquality>
+	inline bool Vector<T, TReserveStrategy, TEquality>::const_iterator::operator!=(const const_iterator& other) const
 	{
+#if FIEA_CHECKED_ITERATORS
 		return (_ptr != other._ptr) || (_container != other._container);
+#else
+		return _ptr != other._ptr;
+#endif
 	}
 #pragma endregion const_iterator
 
 #pragma region iterator
-	template <typename T>
-	Vector<T>::iterator::iterator(Vector& container, pointer ptr) :
-		_container(&container), _ptr(ptr)
+	template <typename T, typename TReserveStrategy, typename TEquality>
+	Vector<T, TReserveStrategy, TEquality>::iterator::iterator([[maybe_unused]] Vector& container, pointer ptr) :
+#if FIEA_CHECKED_ITERATORS
+		_ptr(ptr), _container(&container)
+#else
+		_ptr(ptr)
+#endif
 	{
 	}
 
-	template <typename T>
-	inline Vector<T>::reference Vector<T>::iterator::operator*() const
+	template <typename T, typename TReserveStrategy, typename TEquality>
+	inline typename Vector<T, TReserveStrategy, TEquality>::reference Vector<T, TReserveStrategy, TEquality>::iterator::operator*() const
 	{
+#if FIEA_CHECKED_ITERATORS
 		if (_ptr == nullptr)
 		{
 			throw std::runtime_error("iterator points to null");
@@ -642,28 +785,26 @@ namespace FieaGameEngine
 		{
 			throw std::runtime_error("iterator out of bounds");
 		}
+#endif
 		return *_ptr;
 	}
 
-	template <typename T>
-	inline typename Vector<T>::pointer Vector<T>::iterator::operator->() const
+	template <typename T, typename TReserveStrategy, typename TEquality>
+	inline typename Vector<T, TReserveStrategy, TEquality>::pointer Vector<T, TReserveStrategy, TEquality>::iterator::operator->() const
 	{
 		return &operator*();
 	}
 
-	template<typename T>
-	inline Vector<T>::reference Vector<T>::iterator::operator[](std::size_t index) const
+	template <typename T, typename TReserveStrategy, typename TEquality>
+	inline typename Vector<T, TReserveStrategy, TEquality>::reference Vector<T, TReserveStrategy, TEquality>::iterator::operator[](std::size_t index) const
 	{
-		if (_container == nullptr)
-		{
-			throw std::runtime_error("Iterator is not associated with a container");
-		}
-		return _container->At(index);
+		return *(*this + index);
 	}
 
-	template <typename T>
-	inline typename Vector<T>::iterator& Vector<T>::iterator::operator++()
+	template <typename T, typename TReserveStrategy, typename TEquality>
+	inline typename Vector<T, TReserveStrategy, TEquality>::iterator& Vector<T, TReserveStrategy, TEquality>::iterator::operator++()
 	{
+#if FIEA_CHECKED_ITERATORS
 		if (_container == nullptr)
 		{
 			throw std::runtime_error("Iterator is not associated with a container");
@@ -673,20 +814,24 @@ namespace FieaGameEngine
 		{
 			++_ptr;
 		}
+#else
+		++_ptr;
+#endif
 		return *this;
 	}
 
-	template <typename T>
-	inline typename Vector<T>::iterator Vector<T>::iterator::operator++(int)
+	template <typename T, typename TReserveStrategy, typename TEquality>
+	inline typename Vector<T, TReserveStrategy, TEquality>::iterator Vector<T, TReserveStrategy, TEquality>::iterator::operator++(int)
 	{
 		iterator it = *this;
 		operator++();
 		return it;
 	}
 
-	template <typename T>
-	inline typename Vector<T>::iterator& Vector<T>::iterator::operator--()
+	template <typename T, typename TReserveStrategy, typename TEquality>
+	inline typename Vector<T, TReserveStrategy, TEquality>::iterator& Vector<T, TReserveStrategy, TEquality>::iterator::operator--()
 	{
+#if FIEA_CHECKED_ITERATORS
 		if (_container == nullptr)
 		{
 			throw std::runtime_error("Iterator is not associated with a container");
@@ -696,20 +841,24 @@ namespace FieaGameEngine
 		{
 			--_ptr;
 		}
+#else
+		--_ptr;
+#endif
 		return *this;
 	}
 
-	template <typename T>
-	inline typename Vector<T>::iterator Vector<T>::iterator::operator--(int)
+	template <typename T, typename TReserveStrategy, typename TEquality>
+	inline typename Vector<T, TReserveStrategy, TEquality>::iterator Vector<T, TReserveStrategy, TEquality>::iterator::operator--(int)
 	{
 		iterator it = *this;
 		operator--();
 		return it;
 	}
 
-	template <typename T>
-	inline typename Vector<T>::iterator& Vector<T>::iterator::operator+=(size_t n)
+	template <typename T, typename TReserveStrategy, typename TEquality>
+	inline typename Vector<T, TReserveStrategy, TEquality>::iterator& Vector<T, TReserveStrategy, TEquality>::iterator::operator+=(size_t n)
 	{
+#if FIEA_CHECKED_ITERATORS
 		if (_container == nullptr)
 		{
 			throw std::runtime_error("Iterator is not associated with a container");
@@ -719,20 +868,24 @@ namespace FieaGameEngine
 		{
 			_ptr += n;
 		}
+#else
+		_ptr += n;
+#endif
 		return *this;
 	}
 
-	template <typename T>
-	inline typename Vector<T>::iterator Vector<T>::iterator::operator+(size_t n) const
+	template <typename T, typename TReserveStrategy, typename TEquality>
+	inline typename Vector<T, TReserveStrategy, TEquality>::iterator Vector<T, TReserveStrategy, TEquality>::iterator::operator+(size_t n) const
 	{
 		iterator it = *this;
 		it += n;
 		return it;
 	}
 
-	template <typename T>
-	inline typename Vector<T>::iterator& Vector<T>::iterator::operator-=(size_t n)
+	template <typename T, typename TReserveStrategy, typename TEquality>
+	inline typename Vector<T, TReserveStrategy, TEquality>::iterator& Vector<T, TReserveStrategy, TEquality>::iterator::operator-=(size_t n)
 	{
+#if FIEA_CHECKED_ITERATORS
 		if (_container == nullptr)
 		{
 			throw std::runtime_error("Iterator is not associated with a container");
@@ -742,77 +895,94 @@ namespace FieaGameEngine
 		{
 			_ptr -= n;
 		}
+#else
+		_ptr -= n;
+#endif
 		return *this;
 	}
 
-	template <typename T>
-	typename Vector<T>::iterator Vector<T>::iterator::operator-(size_t n) const
+	template <typename T, typename TReserveStrategy, typename TEquality>
+	inline typename Vector<T, TReserveStrategy, TEquality>::iterator Vector<T, TReserveStrategy, TEquality>::iterator::operator-(size_t n) const
 	{
 		iterator it = *this;
 		it -= n;
 		return it;
 	}
 
-	template<typename T>
-	inline size_t Vector<T>::iterator::operator-(const iterator& it) const
+	template <typename T, typename TReserveStrategy, typename TEquality>
+	inline size_t Vector<T, TReserveStrategy, TEquality>::iterator::operator-(const iterator& it) const
 	{
+#if FIEA_CHECKED_ITERATORS
 		if (_container != it._container)
 		{
 			throw std::runtime_error("Iterators are from different containers");
 		}
+#endif
 		return _ptr - it._ptr;
 	}
 
-	template<typename T>
-	inline bool Vector<T>::iterator::operator<(const iterator& it) const
+	template <typename T, typename TReserveStrategy, typename TEquality>
+	inline bool Vector<T, TReserveStrategy, TEquality>::iterator::operator<(const iterator& it) const
 	{
+#if FIEA_CHECKED_ITERATORS
 		if (_container != it._container)
 		{
 			throw std::runtime_error("Iterators are from different containers");
 		}
+#endif
 		return _ptr < it._ptr;
 	}
 
-	template<typename T>
-	inline bool Vector<T>::iterator::operator<=(const iterator& it) const
+	template <typename T, typename TReserveStrategy, typename TEquality>
+	inline bool Vector<T, TReserveStrategy, TEquality>::iterator::operator<=(const iterator& it) const
 	{
+#if FIEA_CHECKED_ITERATORS
 		if (_container != it._container)
 		{
 			throw std::runtime_error("Iterators are from different containers");
 		}
+#endif
 		return _ptr <= it._ptr;
 	}
 
-	template<typename T>
-	inline bool Vector<T>::iterator::operator>(const iterator& it) const
+	template <typename T, typename TReserveStrategy, typename TEquality>
+	inline bool Vector<T, TReserveStrategy, TEquality>::iterator::operator>(const iterator& it) const
 	{
+#if FIEA_CHECKED_ITERATORS
 		if (_container != it._container)
 		{
 			throw std::runtime_error("Iterators are from different containers");
 		}
+#endif
 		return _ptr > it._ptr;
 	}
 
-	template<typename T>
-	inline bool Vector<T>::iterator::operator>=(const iterator& it) const
+	template <typename T, typename TReserveStrategy, typename TEquality>
+	inline bool Vector<T, TReserveStrategy, TEquality>::iterator::operator>=(const iterator& it) const
 	{
+#if FIEA_CHECKED_ITERATORS
 		if (_container != it._container)
 		{
 			throw std::runtime_error("Iterators are from different containers");
 		}
+#endif
 		return _ptr >= it._ptr;
 	}
 
-	template <typename T>
-	inline bool Vector<T>::iterator::operator==(const iterator& other) const
+	template <typename T, typename TReserveStrategy, typename TEquality>
+	inline bool Vector<T, TReserveStrategy, TEquality>::iterator::operator==(const iterator& other) const
 	{
 		return !operator!=(other);
 	}
 
-	template <typename T>
-	inline bool Vector<T>::iterator::operator!=(const iterator& other) const
+	template <typename T, typename TReserveStrategy, typename TEquality>
+	inline bool Vector<T, TReserveStrategy, TEquality>::iterator::operator!=(const iterator& other) const
 	{
+#if FIEA_CHECKED_ITERATORS
 		return (_ptr != other._ptr) || (_container != other._container);
+#else
+		return _ptr != other._ptr;
+#endif
 	}
 #pragma endregion iterator
 }
\ No newline at end of file